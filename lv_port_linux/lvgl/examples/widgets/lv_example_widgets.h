@@ -123,6 +123,8 @@ void lv_example_obj_1(void);
 void lv_example_obj_2(void);
 void lv_example_obj_3(void);
 
+void lv_example_recycler_1(void);
+
 void lv_example_roller_1(void);
 void lv_example_roller_2(void);
 void lv_example_roller_3(void);
@@ -0,0 +1,51 @@
+#include "../../lv_examples.h"
+#if LV_USE_RECYCLER && LV_USE_LABEL && LV_BUILD_EXAMPLES
+
+#define MSG_CNT 10000
+
+static const char * texts[] = {
+    "Hi!",
+    "How are you?",
+    "Fine, thanks. I'm scrolling through a really long chat history.",
+    "Only the visible messages have a widget, the others are just data.",
+    "OK",
+};
+
+static lv_obj_t * create_cb(lv_obj_t * recycler)
+{
+    lv_obj_t * label = lv_label_create(recycler);
+    lv_obj_set_width(label, lv_pct(80));
+    lv_obj_set_style_bg_opa(label, LV_OPA_COVER, 0);
+    lv_obj_set_style_radius(label, 8, 0);
+    lv_obj_set_style_pad_all(label, 8, 0);
+    return label;
+}
+
+static void bind_cb(lv_obj_t * recycler, lv_obj_t * item, uint32_t index)
+{
+    LV_UNUSED(recycler);
+
+    /*The messages of the two participants are on different sides*/
+    bool own = index % 2;
+    lv_obj_set_x(item, own ? lv_pct(20) : 0);
+    lv_obj_set_style_bg_color(item, own ? lv_palette_lighten(LV_PALETTE_BLUE, 3) : lv_palette_lighten(LV_PALETTE_GREY, 3),
+                              0);
+    lv_label_set_text_fmt(item, "#%" LV_PRIu32 ": %s", index, texts[index % (sizeof(texts) / sizeof(texts[0]))]);
+}
+
+/**
+ * A chat with a lot of messages of different heights
+ */
+void lv_example_recycler_1(void)
+{
+    lv_obj_t * recycler = lv_recycler_create(lv_screen_active());
+    lv_obj_set_size(recycler, 240, 300);
+    lv_obj_center(recycler);
+    lv_recycler_set_item_cb(recycler, create_cb, bind_cb);
+    lv_recycler_set_item_count(recycler, MSG_CNT);
+
+    /*Show the latest message*/
+    lv_recycler_scroll_to_item(recycler, MSG_CNT - 1, LV_ANIM_OFF);
+}
+
+#endif
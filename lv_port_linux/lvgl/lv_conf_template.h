@@ -151,6 +151,13 @@
  * Set it to 0 to have no limit. */
 #define LV_DRAW_LAYER_MAX_MEMORY 0  /**< No limit by default [bytes]*/
 
+/** Number of texts whose glyphs are cached after positioning and shaping them.
+ *  Unchanged texts are drawn from the cached glyphs without finding the line breaks, bidi processing
+ *  and getting the glyphs again. Only texts shorter than 256 bytes, without recoloring and selection are cached.
+ *  Each cached text takes ~8 bytes per letter and ~60 bytes per different glyph.
+ *  Set it to 0 to disable the cache. */
+#define LV_DRAW_LABEL_RUN_CACHE_CNT 16
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -227,6 +234,19 @@
     /** Enable drawing complex gradients in software: linear at an angle, radial or conical */
     #define LV_USE_DRAW_SW_COMPLEX_GRADIENTS    0
 
+    /** Set number of ThorVG shapes retained by each SW draw unit.
+     *  Paths whose content and style are unchanged reuse their shape and only its
+     *  transformation is updated. The least recently used shapes are freed first.
+     *  - 0: disables caching */
+    #define LV_DRAW_SW_VECTOR_SHAPE_CACHE_CNT   16
+
+    /** Size (width and height) of the A8 atlas where each SW draw unit caches the
+     *  glyphs of the built-in format fonts.  The glyphs are blended directly from the
+     *  atlas instead of being rendered one by one.
+     *  Costs `LV_DRAW_SW_GLYPH_ATLAS_SIZE^2` RAM per draw unit.
+     *  - 0: disables the atlas */
+    #define LV_DRAW_SW_GLYPH_ATLAS_SIZE     256
+
 #endif
 
 /*Use TSi's aka (Think Silicon) NemaGFX */
@@ -657,6 +677,21 @@
 /** Enables/disables support for compressed fonts. */
 #define LV_USE_FONT_COMPRESSED 0
 
+/** Number of cached code points and kerning pairs per font to find the glyphs of built-in format fonts faster.
+ *  On the first use of a font a table is also allocated for the code points below U+0250.
+ *  It takes ~1.2 kB + 16 bytes per cache entry for each font with lookup tables. Must be a power of 2.
+ *  0: disable the lookup tables */
+#define LV_FONT_FMT_TXT_LOOKUP_SIZE 128
+
+/** Maximum number of fonts with lookup tables.
+ *  When more fonts are used the tables of a font which wasn't used recently are reused.
+ *  Depends on LV_FONT_FMT_TXT_LOOKUP_SIZE. */
+#define LV_FONT_FMT_TXT_LOOKUP_FONT_CNT 4
+
+/** Enable fonts made of signed distance fields which can be drawn at any size.
+ *  The software renderer can also rotate and scale their glyphs. See `scripts/font_sdf_conv`. */
+#define LV_USE_FONT_SDF 0
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #define LV_USE_FONT_PLACEHOLDER 1
 
@@ -766,6 +801,7 @@
 #if LV_USE_LABEL
     #define LV_LABEL_TEXT_SELECTION 1   /**< Enable selecting text of the label */
     #define LV_LABEL_LONG_TXT_HINT 1    /**< Store some extra info in labels to speed up drawing of very long text */
+    #define LV_LABEL_LINE_TABLE 1       /**< Store the line breaks of labels to not find them again on every redraw */
     #define LV_LABEL_WAIT_CHAR_COUNT 3  /**< The count of wait chart */
 #endif
 
@@ -781,6 +817,8 @@
 
 #define LV_USE_MSGBOX     1
 
+#define LV_USE_RECYCLER   1
+
 #define LV_USE_ROLLER     1   /**< Requires: lv_label */
 
 #define LV_USE_SCALE      1
@@ -1237,7 +1275,7 @@
     #define LV_WAYLAND_BUF_COUNT            1    /**< Use 1 for single buffer with partial render mode or 2 for double buffer with full render mode*/
     #define LV_WAYLAND_USE_DMABUF           0    /**< Use DMA buffers for frame buffers. Requires LV_DRAW_USE_G2D */
     #define LV_WAYLAND_RENDER_MODE          LV_DISPLAY_RENDER_MODE_PARTIAL   /**< DMABUF supports LV_DISPLAY_RENDER_MODE_FULL and LV_DISPLAY_RENDER_MODE_DIRECT*/
-                                                                             /**< When LV_WAYLAND_USE_DMABUF is disabled, only LV_DISPLAY_RENDER_MODE_PARTIAL is supported*/
+                                                                             /**< When LV_WAYLAND_USE_DMABUF is disabled, LV_DISPLAY_RENDER_MODE_PARTIAL and LV_DISPLAY_RENDER_MODE_DIRECT are supported*/
     #define LV_WAYLAND_WINDOW_DECORATIONS   0    /**< Draw client side window decorations only necessary on Mutter/GNOME. Not supported using DMABUF*/
 #endif
 
@@ -1303,6 +1341,10 @@
      * it supports the major GPU vendors - This option requires linking with libgbm */
     #define LV_USE_LINUX_DRM_GBM_BUFFERS 0
 
+    /** Number of scanout buffers (2 or 3).
+     *  With 3 buffers LVGL can render the next frame while a page flip is pending */
+    #define LV_LINUX_DRM_BUFFER_CNT  2
+
     #define LV_LINUX_DRM_USE_EGL     0
 #endif
 
@@ -1375,6 +1417,11 @@
 #define LV_USE_OPENGLES   0
 #if LV_USE_OPENGLES
     #define LV_USE_OPENGLES_DEBUG        1    /**< Enable or disable debug for opengles */
+
+    /** Number of pixel buffer objects used to upload the rendered areas to the texture asynchronously.
+     *  Requires OpenGL ES 3.0 or OpenGL 3.2 at runtime, otherwise the areas are uploaded directly.
+     *  0: always upload directly */
+    #define LV_OPENGLES_PBO_CNT          2
 #endif
 
 /** Use GLFW to open window on PC and handle mouse and keyboard. Requires*/
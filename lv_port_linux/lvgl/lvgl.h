@@ -51,6 +51,7 @@ extern "C" {
 #include "src/font/lv_font.h"
 #include "src/font/lv_binfont_loader.h"
 #include "src/font/lv_font_fmt_txt.h"
+#include "src/font/lv_font_sdf.h"
 
 #include "src/widgets/animimage/lv_animimage.h"
 #include "src/widgets/arc/lv_arc.h"
@@ -73,6 +74,7 @@ extern "C" {
 #include "src/widgets/lottie/lv_lottie.h"
 #include "src/widgets/menu/lv_menu.h"
 #include "src/widgets/msgbox/lv_msgbox.h"
+#include "src/widgets/recycler/lv_recycler.h"
 #include "src/widgets/roller/lv_roller.h"
 #include "src/widgets/scale/lv_scale.h"
 #include "src/widgets/slider/lv_slider.h"
@@ -48,6 +48,7 @@ extern "C" {
 #include "src/drivers/libinput/lv_libinput_private.h"
 #include "src/drivers/evdev/lv_evdev_private.h"
 #include "src/font/lv_font_fmt_txt_private.h"
+#include "src/font/lv_font_sdf_private.h"
 #include "src/themes/lv_theme_private.h"
 #include "src/core/lv_refr_private.h"
 #include "src/core/lv_obj_style_private.h"
@@ -67,6 +68,7 @@ extern "C" {
 #include "src/misc/lv_style_private.h"
 #include "src/misc/lv_color_op_private.h"
 #include "src/misc/lv_anim_private.h"
+#include "src/misc/lv_fenwick.h"
 #include "src/widgets/msgbox/lv_msgbox_private.h"
 #include "src/widgets/buttonmatrix/lv_buttonmatrix_private.h"
 #include "src/widgets/slider/lv_slider_private.h"
@@ -79,6 +81,7 @@ extern "C" {
 #include "src/widgets/table/lv_table_private.h"
 #include "src/widgets/checkbox/lv_checkbox_private.h"
 #include "src/widgets/roller/lv_roller_private.h"
+#include "src/widgets/recycler/lv_recycler_private.h"
 #include "src/widgets/win/lv_win_private.h"
 #include "src/widgets/keyboard/lv_keyboard_private.h"
 #include "src/widgets/line/lv_line_private.h"
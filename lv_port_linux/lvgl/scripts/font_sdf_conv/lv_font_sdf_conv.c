@@ -0,0 +1,385 @@
+/**
+ * @file lv_font_sdf_conv.c
+ *
+ * Convert a TTF/OTF font to signed distance fields which can be used by `lv_font_sdf_create`
+ * to draw the font at any size.
+ *
+ * Build it on the host with:
+ *     cc lv_font_sdf_conv.c -o lv_font_sdf_conv -lm
+ *
+ * Example:
+ *     ./lv_font_sdf_conv --font ../built_in_font/Montserrat-Medium.ttf --size 32 -r 0x20-0x7E
+ *                        --name my_font_sdf -o my_font_sdf.c
+ *
+ * The generated C file defines `const lv_font_sdf_dsc_t my_font_sdf` and needs `LV_USE_FONT_SDF 1`.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+#define STB_RECT_PACK_IMPLEMENTATION
+#define STBRP_STATIC
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "../../src/libs/tiny_ttf/stb_rect_pack.h"
+#include "../../src/libs/tiny_ttf/stb_truetype_htcw.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MAX_RANGES      64
+#define ATLAS_MAX_H     8192
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t first;
+    uint32_t last;
+} range_t;
+
+typedef struct {
+    uint32_t unicode;
+    uint8_t * field;
+    int w;
+    int h;
+    int xoff;
+    int yoff;
+    int x;
+    int y;
+    uint16_t adv_w;
+} glyph_t;
+
+typedef struct {
+    const char * font_path;
+    const char * out_path;
+    const char * name;
+    int size;
+    int padding;
+    int edge_value;
+    float pixel_dist_scale;
+    int atlas_w;
+    range_t ranges[MAX_RANGES];
+    int range_cnt;
+} options_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static int parse_args(int argc, char ** argv, options_t * opts);
+static int parse_range(const char * str, options_t * opts);
+static uint8_t * read_file(const char * path);
+static int compare_glyphs(const void * a, const void * b);
+static void print_usage(void);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    options_t opts;
+    if(parse_args(argc, argv, &opts) != 0) {
+        print_usage();
+        return 1;
+    }
+
+    uint8_t * ttf = read_file(opts.font_path);
+    if(ttf == NULL) {
+        fprintf(stderr, "Couldn't read %s\n", opts.font_path);
+        return 1;
+    }
+
+    stbtt_fontinfo info;
+    if(stbtt_InitFont(&info, ttf, stbtt_GetFontOffsetForIndex(ttf, 0)) == 0) {
+        fprintf(stderr, "%s is not a valid font\n", opts.font_path);
+        return 1;
+    }
+
+    /*Use the same scaling as Tiny TTF so the fonts have the same size*/
+    float scale = stbtt_ScaleForMappingEmToPixels(&info, (float)opts.size);
+
+    /*Collect the glyphs which exist in the font*/
+    uint32_t glyph_cap = 0;
+    for(int i = 0; i < opts.range_cnt; i++) glyph_cap += opts.ranges[i].last - opts.ranges[i].first + 1;
+    glyph_t * glyphs = calloc(glyph_cap, sizeof(glyph_t));
+    uint32_t glyph_cnt = 0;
+
+    for(int i = 0; i < opts.range_cnt; i++) {
+        for(uint32_t unicode = opts.ranges[i].first; unicode <= opts.ranges[i].last; unicode++) {
+            int index = stbtt_FindGlyphIndex(&info, (int)unicode);
+            if(index == 0) continue;
+
+            bool duplicate = false;
+            for(uint32_t j = 0; j < glyph_cnt; j++) {
+                if(glyphs[j].unicode == unicode) duplicate = true;
+            }
+            if(duplicate) continue;
+
+            glyph_t * g = &glyphs[glyph_cnt++];
+            g->unicode = unicode;
+
+            int adv;
+            int lsb;
+            stbtt_GetGlyphHMetrics(&info, index, &adv, &lsb);
+            g->adv_w = (uint16_t)lroundf(adv * scale * 16.0f);
+
+            /*NULL for empty glyphs, e.g. space*/
+            g->field = stbtt_GetGlyphSDF(&info, scale, index, opts.padding, (unsigned char)opts.edge_value,
+                                         opts.pixel_dist_scale, &g->w, &g->h, &g->xoff, &g->yoff);
+            if(g->field == NULL) {
+                g->w = 0;
+                g->h = 0;
+                g->xoff = 0;
+                g->yoff = 0;
+            }
+        }
+    }
+
+    if(glyph_cnt == 0) {
+        fprintf(stderr, "None of the characters are in the font\n");
+        return 1;
+    }
+
+    qsort(glyphs, glyph_cnt, sizeof(glyph_t), compare_glyphs);
+
+    /*Pack the distance fields into an atlas*/
+    stbrp_context ctx;
+    stbrp_node * nodes = calloc((size_t)opts.atlas_w, sizeof(stbrp_node));
+    stbrp_rect * rects = calloc(glyph_cnt, sizeof(stbrp_rect));
+    stbrp_init_target(&ctx, opts.atlas_w, ATLAS_MAX_H, nodes, opts.atlas_w);
+    for(uint32_t i = 0; i < glyph_cnt; i++) {
+        rects[i].id = (int)i;
+        rects[i].w = glyphs[i].w;
+        rects[i].h = glyphs[i].h;
+    }
+
+    if(!stbrp_pack_rects(&ctx, rects, (int)glyph_cnt)) {
+        fprintf(stderr, "The glyphs don't fit into the atlas, use a larger --atlas-width\n");
+        return 1;
+    }
+
+    int atlas_h = 1;
+    for(uint32_t i = 0; i < glyph_cnt; i++) {
+        glyph_t * g = &glyphs[rects[i].id];
+        g->x = rects[i].x;
+        g->y = rects[i].y;
+        if(g->h > 0 && g->y + g->h > atlas_h) atlas_h = g->y + g->h;
+    }
+
+    uint8_t * atlas = calloc((size_t)opts.atlas_w * atlas_h, 1);
+    for(uint32_t i = 0; i < glyph_cnt; i++) {
+        glyph_t * g = &glyphs[i];
+        for(int y = 0; y < g->h; y++) {
+            memcpy(&atlas[(g->y + y) * opts.atlas_w + g->x], &g->field[y * g->w], (size_t)g->w);
+        }
+    }
+
+    /*The metrics of the whole font*/
+    int ascent;
+    int descent;
+    int line_gap;
+    stbtt_GetFontVMetrics(&info, &ascent, &descent, &line_gap);
+    int line_height = (int)lroundf(scale * (ascent - descent + line_gap));
+    int base_line = (int)lroundf(scale * -descent);
+    /*The underline is not stored in the tables read by stb_truetype so use the usual proportions*/
+    int underline_position = -(int)lroundf(opts.size * 0.1f);
+    int underline_thickness = opts.size / 16 > 1 ? opts.size / 16 : 1;
+
+    FILE * f = fopen(opts.out_path, "w");
+    if(f == NULL) {
+        fprintf(stderr, "Couldn't open %s\n", opts.out_path);
+        return 1;
+    }
+
+    fprintf(f, "/*******************************************************************************\n");
+    fprintf(f, " * Signed distance fields of %s\n", opts.font_path);
+    fprintf(f, " * Size: %d px, padding: %d px, edge: %d, pixel distance scale: %g\n", opts.size, opts.padding,
+            opts.edge_value, opts.pixel_dist_scale);
+    fprintf(f, " * Opts:");
+    for(int i = 1; i < argc; i++) fprintf(f, " %s", argv[i]);
+    fprintf(f, "\n ******************************************************************************/\n\n");
+
+    fprintf(f, "#ifdef LV_LVGL_H_INCLUDE_SIMPLE\n");
+    fprintf(f, "    #include \"lvgl.h\"\n");
+    fprintf(f, "#else\n");
+    fprintf(f, "    #include \"lvgl/lvgl.h\"\n");
+    fprintf(f, "#endif\n\n");
+    fprintf(f, "#if LV_USE_FONT_SDF\n\n");
+
+    fprintf(f, "/*Store the distance fields of the glyphs*/\n");
+    fprintf(f, "static LV_ATTRIBUTE_LARGE_CONST const uint8_t %s_atlas[] = {\n", opts.name);
+    size_t atlas_size = (size_t)opts.atlas_w * atlas_h;
+    for(size_t i = 0; i < atlas_size; i++) {
+        if(i % 16 == 0) fprintf(f, "    ");
+        fprintf(f, "0x%02x,", atlas[i]);
+        fprintf(f, i % 16 == 15 || i == atlas_size - 1 ? "\n" : " ");
+    }
+    fprintf(f, "};\n\n");
+
+    fprintf(f, "static const lv_font_sdf_glyph_dsc_t %s_glyph_dsc[] = {\n", opts.name);
+    for(uint32_t i = 0; i < glyph_cnt; i++) {
+        glyph_t * g = &glyphs[i];
+        fprintf(f, "    {.unicode = 0x%04x, .adv_w = %u, .atlas_x = %d, .atlas_y = %d, .box_w = %d, .box_h = %d, "
+                ".ofs_x = %d, .ofs_y = %d},\n", g->unicode, g->adv_w, g->x, g->y, g->w, g->h, g->xoff,
+                -(g->yoff + g->h));
+    }
+    fprintf(f, "};\n\n");
+
+    fprintf(f, "const lv_font_sdf_dsc_t %s = {\n", opts.name);
+    fprintf(f, "    .atlas = %s_atlas,\n", opts.name);
+    fprintf(f, "    .atlas_w = %d,\n", opts.atlas_w);
+    fprintf(f, "    .atlas_h = %d,\n", atlas_h);
+    fprintf(f, "    .glyph_dsc = %s_glyph_dsc,\n", opts.name);
+    fprintf(f, "    .glyph_cnt = %u,\n", glyph_cnt);
+    fprintf(f, "    .size = %d,\n", opts.size);
+    fprintf(f, "    .line_height = %d,\n", line_height);
+    fprintf(f, "    .base_line = %d,\n", base_line);
+    fprintf(f, "    .underline_position = %d,\n", underline_position);
+    fprintf(f, "    .underline_thickness = %d,\n", underline_thickness);
+    fprintf(f, "    .padding = %d,\n", opts.padding);
+    fprintf(f, "    .edge_value = %d,\n", opts.edge_value);
+    fprintf(f, "    .pixel_dist_scale = %d,\n", (int)lroundf(opts.pixel_dist_scale));
+    fprintf(f, "};\n\n");
+    fprintf(f, "#endif /*LV_USE_FONT_SDF*/\n");
+    fclose(f);
+
+    for(uint32_t i = 0; i < glyph_cnt; i++) {
+        if(glyphs[i].field) stbtt_FreeSDF(glyphs[i].field, NULL);
+    }
+    free(atlas);
+    free(rects);
+    free(nodes);
+    free(glyphs);
+    free(ttf);
+
+    printf("%u glyphs, %dx%d atlas written to %s\n", glyph_cnt, opts.atlas_w, atlas_h, opts.out_path);
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static int parse_args(int argc, char ** argv, options_t * opts)
+{
+    memset(opts, 0, sizeof(*opts));
+    opts->name = "font_sdf";
+    opts->size = 32;
+    opts->padding = 4;
+    opts->edge_value = 128;
+    opts->atlas_w = 256;
+
+    for(int i = 1; i < argc; i++) {
+        const char * arg = argv[i];
+        const char * val = i + 1 < argc ? argv[i + 1] : NULL;
+        if(val == NULL) return -1;
+
+        if(strcmp(arg, "--font") == 0) opts->font_path = val;
+        else if(strcmp(arg, "-o") == 0 || strcmp(arg, "--output") == 0) opts->out_path = val;
+        else if(strcmp(arg, "--name") == 0) opts->name = val;
+        else if(strcmp(arg, "-s") == 0 || strcmp(arg, "--size") == 0) opts->size = atoi(val);
+        else if(strcmp(arg, "--padding") == 0) opts->padding = atoi(val);
+        else if(strcmp(arg, "--edge") == 0) opts->edge_value = atoi(val);
+        else if(strcmp(arg, "--atlas-width") == 0) opts->atlas_w = atoi(val);
+        else if(strcmp(arg, "-r") == 0 || strcmp(arg, "--range") == 0) {
+            if(parse_range(val, opts) != 0) return -1;
+        }
+        else return -1;
+        i++;
+    }
+
+    if(opts->font_path == NULL || opts->out_path == NULL) return -1;
+    if(opts->size <= 0 || opts->padding < 1 || opts->atlas_w <= 0) return -1;
+    if(opts->edge_value < 1 || opts->edge_value > 254) return -1;
+
+    /*Default to ASCII*/
+    if(opts->range_cnt == 0) parse_range("0x20-0x7E", opts);
+
+    /*The values reach 0 and 255 at the end of the padding*/
+    int range = opts->edge_value < 255 - opts->edge_value ? opts->edge_value : 255 - opts->edge_value;
+    opts->pixel_dist_scale = (float)range / (float)opts->padding;
+    if(opts->pixel_dist_scale < 1.0f) opts->pixel_dist_scale = 1.0f;
+
+    return 0;
+}
+
+/**
+ * Parse a comma separated list of characters and ranges, e.g. "0x20-0x7E,0xB0"
+ */
+static int parse_range(const char * str, options_t * opts)
+{
+    const char * p = str;
+    while(*p) {
+        if(opts->range_cnt >= MAX_RANGES) return -1;
+
+        char * end;
+        uint32_t first = (uint32_t)strtoul(p, &end, 0);
+        if(end == p) return -1;
+        uint32_t last = first;
+        p = end;
+        if(*p == '-') {
+            p++;
+            last = (uint32_t)strtoul(p, &end, 0);
+            if(end == p || last < first) return -1;
+            p = end;
+        }
+
+        opts->ranges[opts->range_cnt].first = first;
+        opts->ranges[opts->range_cnt].last = last;
+        opts->range_cnt++;
+
+        if(*p == ',') p++;
+        else if(*p != '\0') return -1;
+    }
+
+    return 0;
+}
+
+static uint8_t * read_file(const char * path)
+{
+    FILE * f = fopen(path, "rb");
+    if(f == NULL) return NULL;
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    uint8_t * buf = malloc((size_t)size);
+    if(buf && fread(buf, 1, (size_t)size, f) != (size_t)size) {
+        free(buf);
+        buf = NULL;
+    }
+
+    fclose(f);
+    return buf;
+}
+
+static int compare_glyphs(const void * a, const void * b)
+{
+    const glyph_t * ga = a;
+    const glyph_t * gb = b;
+    if(ga->unicode < gb->unicode) return -1;
+    if(ga->unicode > gb->unicode) return 1;
+    return 0;
+}
+
+static void print_usage(void)
+{
+    printf("Usage: lv_font_sdf_conv --font <file> -o <file> [options]\n"
+           "  --font <file>         TTF or OTF file\n"
+           "  -o, --output <file>   The C file to generate\n"
+           "  --name <name>         Name of the generated lv_font_sdf_dsc_t (default: font_sdf)\n"
+           "  -s, --size <px>       Size of the distance fields (default: 32)\n"
+           "  --padding <px>        Distance encoded around the glyphs (default: 4)\n"
+           "  --edge <0..255>       Value on the outline of the glyphs (default: 128)\n"
+           "  --atlas-width <px>    Width of the atlas (default: 256)\n"
+           "  -r, --range <list>    Characters and ranges, e.g. 0x20-0x7E,0xB0 (default: 0x20-0x7E)\n");
+}
@@ -31,7 +31,7 @@ extern "C" {
 #include "../others/sysmon/lv_sysmon.h"
 #include "../stdlib/builtin/lv_tlsf.h"
 
-#if LV_USE_FONT_COMPRESSED
+#if LV_USE_FONT_COMPRESSED || LV_FONT_FMT_TXT_LOOKUP_SIZE > 0
 #include "../font/lv_font_fmt_txt_private.h"
 #endif
 
@@ -133,6 +133,8 @@ typedef struct _lv_global_t {
 
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
+    lv_cache_t * draw_label_run_cache;
+    uint32_t draw_label_font_gen;
 
     lv_draw_global_info_t draw_info;
     lv_ll_t draw_sw_blend_handler_ll;
@@ -142,6 +144,12 @@ typedef struct _lv_global_t {
 #if LV_DRAW_SW_COMPLEX
     lv_draw_sw_mask_radius_circle_dsc_arr_t sw_circle_cache;
 #endif
+#if LV_USE_DRAW_SW && LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+    lv_draw_sw_vector_state_t sw_vector_state;
+#endif
+#if defined(LV_DRAW_SW_GLYPH_ATLAS_SIZE) && LV_DRAW_SW_GLYPH_ATLAS_SIZE > 0
+    lv_draw_sw_glyph_atlas_state_t sw_glyph_atlas_state;
+#endif
 
 #if LV_USE_LOG
     lv_log_print_g_cb_t custom_log_print_cb;
@@ -211,6 +219,12 @@ typedef struct _lv_global_t {
     lv_font_fmt_rle_t font_fmt_rle;
 #endif
 
+#if LV_FONT_FMT_TXT_LOOKUP_SIZE > 0
+    lv_font_fmt_txt_lookup_t * font_fmt_txt_lookups[LV_FONT_FMT_TXT_LOOKUP_FONT_CNT];
+    lv_mutex_t font_fmt_txt_lookup_mutex;
+    uint32_t font_fmt_txt_lookup_evict_idx;
+#endif
+
 #if LV_USE_SPAN != 0
     struct _snippet_stack * span_snippet_stack;
 #endif
@@ -550,7 +550,7 @@ void lv_obj_get_scrollbar_area(lv_obj_t * obj, lv_area_t * hor_area, lv_area_t *
             ver_area->y2 = obj->coords.y2 - bottom_space - hor_req_space - 1;
         }
         else {
-            int32_t sb_y = (rem * sb) / scroll_h;
+            int32_t sb_y = (int32_t)(((int64_t)rem * sb) / scroll_h);
             sb_y = rem - sb_y;
 
             ver_area->y1 = obj->coords.y1 + sb_y + top_space;
@@ -595,7 +595,7 @@ void lv_obj_get_scrollbar_area(lv_obj_t * obj, lv_area_t * hor_area, lv_area_t *
             }
         }
         else {
-            int32_t sb_x = (rem * sr) / scroll_w;
+            int32_t sb_x = (int32_t)(((int64_t)rem * sr) / scroll_w);
             sb_x = rem - sb_x;
 
             if(rtl) {
@@ -17,6 +17,7 @@
 #include "../display/lv_display_private.h"
 #include "../tick/lv_tick.h"
 #include "../misc/lv_timer_private.h"
+#include "../misc/lv_anim_private.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_profiler.h"
 #include "../misc/lv_types.h"
@@ -39,9 +40,12 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static bool refr_pacing_start(lv_timer_t * tmr);
+static void refr_pacing_frame_rendered(void);
 static void lv_refr_join_area(void);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
+static void refr_sync_areas_update(void);
 static void refr_area(const lv_area_t * area_p, int32_t y_offset);
 static void refr_configured_layer(lv_layer_t * layer);
 static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj);
@@ -317,6 +321,9 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     lv_result_t res = lv_display_send_event(disp, LV_EVENT_INVALIDATE_AREA, &com_area);
     if(res != LV_RESULT_OK) return;
 
+    /*The event handler can make the area empty if it doesn't need to be redrawn*/
+    if(lv_area_get_width(&com_area) <= 0 || lv_area_get_height(&com_area) <= 0) return;
+
     /*Save only if this area is not in one of the saved areas*/
     uint16_t i;
     for(i = 0; i < disp->inv_p; i++) {
@@ -384,6 +391,12 @@ void lv_display_refr_timer(lv_timer_t * tmr)
         return;
     }
 
+    if(refr_pacing_start(tmr)) {
+        LV_TRACE_REFR("delayed to the next vblank");
+        LV_PROFILER_REFR_END;
+        return;
+    }
+
     lv_result_t res = lv_display_send_event(disp_refr, LV_EVENT_REFR_START, NULL);
     if(res == LV_RESULT_INVALID) {
         LV_TRACE_REFR("deleted");
@@ -413,19 +426,14 @@ void lv_display_refr_timer(lv_timer_t * tmr)
     refr_invalid_areas();
 
     if(disp_refr->inv_p == 0) goto refr_finish;
-    /*In double buffered direct mode save the updated areas.
-     *They will be used on the next call to synchronize the buffers.*/
+    /*In double or triple buffered direct mode save the updated areas.
+     *They will be used on the next calls to synchronize the buffers.*/
     if(lv_display_is_double_buffered(disp_refr) && disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT) {
-        uint32_t i;
-        for(i = 0; i < disp_refr->inv_p; i++) {
-            if(disp_refr->inv_area_joined[i])
-                continue;
-
-            lv_area_t * sync_area = lv_ll_ins_tail(&disp_refr->sync_areas);
-            *sync_area = disp_refr->inv_areas[i];
-        }
+        refr_sync_areas_update();
     }
 
+    refr_pacing_frame_rendered();
+
     lv_memzero(disp_refr->inv_areas, sizeof(disp_refr->inv_areas));
     lv_memzero(disp_refr->inv_area_joined, sizeof(disp_refr->inv_area_joined));
     disp_refr->inv_p = 0;
@@ -602,6 +610,66 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Plan the presentation of the frame. With frame pacing delay the refresh to finish just
+ * before the next vblank and evaluate the animations at the time of that vblank.
+ * @param tmr   the refresh timer
+ * @return      true: the refresh was delayed
+ */
+static bool refr_pacing_start(lv_timer_t * tmr)
+{
+    lv_display_pacing_t * pacing = &disp_refr->pacing;
+
+    pacing->refr_start = lv_tick_get();
+    pacing->target_valid = lv_display_get_next_vblank(disp_refr, &pacing->target_vblank);
+
+    if(pacing->refr_delayed && tmr) {
+        pacing->refr_delayed = 0;
+        lv_timer_set_period(tmr, pacing->refr_period);
+    }
+
+    if(!pacing->enabled || !pacing->target_valid) return false;
+
+    /*Delay only if called by the timer handler and not e.g. by `lv_refr_now()`*/
+    if(tmr && lv_timer_get_running() == tmr) {
+        uint32_t budget = pacing->stats.render_time_avg_ms + LV_DISPLAY_PACING_MARGIN;
+        int32_t wait = (int32_t)lv_tick_diff(pacing->target_vblank - budget, pacing->refr_start);
+        if(wait > 0) {
+            pacing->refr_period = tmr->period;
+            pacing->refr_delayed = 1;
+            lv_timer_set_period(tmr, wait);
+            lv_timer_resume(tmr);
+            return true;
+        }
+    }
+
+    lv_anim_refr_at(pacing->target_vblank);
+
+    return false;
+}
+
+/**
+ * Update the render time statistics after rendering a frame
+ */
+static void refr_pacing_frame_rendered(void)
+{
+    lv_display_pacing_t * pacing = &disp_refr->pacing;
+    lv_display_frame_stats_t * stats = &pacing->stats;
+
+    /*Round the average up to not underestimate the budget of the next frame*/
+    uint32_t t = lv_tick_elaps(pacing->refr_start);
+    stats->render_time_avg_ms = stats->render_time_avg_ms ? (stats->render_time_avg_ms * 7 + t + 7) / 8 : t;
+    if(t > stats->render_time_max_ms) stats->render_time_max_ms = t;
+
+    pacing->frame_pending = 1;
+
+    /*A synchronous driver presented the frame already in the last flush*/
+    if(pacing->presented_early) {
+        pacing->presented_early = 0;
+        lv_display_report_presented(disp_refr, pacing->present_time);
+    }
+}
+
 /**
  * Join the areas which has got common parts
  */
@@ -642,7 +710,10 @@ static void lv_refr_join_area(void)
 }
 
 /**
- * Refresh the sync areas
+ * Refresh the sync areas.
+ * The active buffer misses the areas rendered since it was flushed the last time (buffer age),
+ * i.e. the areas of the last frame with 2 buffers and the areas of the last 2 frames with 3 buffers.
+ * Copy them from the buffer flushed last, except the areas which will be redrawn anyway.
  */
 static void refr_sync_areas(void)
 {
@@ -655,40 +726,39 @@ static void refr_sync_areas(void)
     /*Do not sync if no sync areas*/
     if(lv_ll_is_empty(&disp_refr->sync_areas)) return;
 
+    /*Do not sync if nothing will be rendered. The sync areas are kept for the next refresh*/
+    if(disp_refr->inv_p == 0) return;
+
     LV_PROFILER_REFR_BEGIN;
-    /*With double buffered direct mode synchronize the rendered areas to the other buffer*/
-    /*We need to wait for ready here to not mess up the active screen*/
-    wait_for_flushing(disp_refr);
+    /*With double buffered direct mode we need to wait for ready here to not mess up the active screen.
+     *With triple buffering the active buffer was flushed before the last flush, so it's not used anymore.*/
+    if(disp_refr->buf_3 == NULL) wait_for_flushing(disp_refr);
 
     /*The buffers are already swapped.
      *So the active buffer is the off screen buffer where LVGL will render*/
     lv_draw_buf_t * off_screen = disp_refr->buf_act;
-    /*Triple buffer sync buffer for off-screen2 updates.*/
-    lv_draw_buf_t * off_screen2;
     lv_draw_buf_t * on_screen;
 
     if(disp_refr->buf_act == disp_refr->buf_1) {
-        off_screen2 = disp_refr->buf_2;
         on_screen = disp_refr->buf_3 ? disp_refr->buf_3 : disp_refr->buf_2;
     }
     else if(disp_refr->buf_act == disp_refr->buf_2) {
-        off_screen2 = disp_refr->buf_3 ? disp_refr->buf_3 : disp_refr->buf_1;
         on_screen = disp_refr->buf_1;
     }
     else {
-        off_screen2 = disp_refr->buf_1;
         on_screen = disp_refr->buf_2;
     }
 
     uint32_t hor_res = lv_display_get_horizontal_resolution(disp_refr);
     uint32_t ver_res = lv_display_get_vertical_resolution(disp_refr);
 
-    /*Iterate through invalidated areas to see if sync area should be copied*/
+    /*Iterate through invalidated areas to see if sync area should be copied.
+     *The newer sync areas will contain the removed parts, so they can be removed permanently.*/
     uint16_t i;
     int8_t j;
     lv_area_t res[4] = {0};
     int8_t res_c;
-    lv_area_t * sync_area, * new_area, * next_area;
+    lv_display_sync_area_t * sync_area, * new_area, * next_area;
     for(i = 0; i < disp_refr->inv_p; i++) {
         /*Skip joined areas*/
         if(disp_refr->inv_area_joined[i]) continue;
@@ -700,14 +770,15 @@ static void refr_sync_areas(void)
             next_area = lv_ll_get_next(&disp_refr->sync_areas, sync_area);
 
             /*Remove intersect of redraw area from sync area and get remaining areas*/
-            res_c = lv_area_diff(res, sync_area, &disp_refr->inv_areas[i]);
+            res_c = lv_area_diff(res, &sync_area->area, &disp_refr->inv_areas[i]);
 
             /*New sub areas created after removing intersect*/
             if(res_c != -1) {
                 /*Replace old sync area with new areas*/
                 for(j = 0; j < res_c; j++) {
                     new_area = lv_ll_ins_prev(&disp_refr->sync_areas, sync_area);
-                    *new_area = res[j];
+                    new_area->area = res[j];
+                    new_area->age = sync_area->age;
                 }
                 lv_ll_remove(&disp_refr->sync_areas, sync_area);
                 lv_free(sync_area);
@@ -725,24 +796,54 @@ static void refr_sync_areas(void)
         /**
          * @todo Resize SDL window will trigger crash because of sync_area is larger than disp_area
          */
-        if(!lv_area_intersect(sync_area, sync_area, &disp_area)) {
+        lv_area_t copy_area;
+        if(!lv_area_intersect(&copy_area, &sync_area->area, &disp_area)) {
             continue;
         }
 #if LV_DRAW_TRANSFORM_USE_MATRIX
         if(lv_display_get_matrix_rotation(disp_refr)) {
-            lv_display_rotate_area(disp_refr, sync_area);
+            lv_display_rotate_area(disp_refr, &copy_area);
         }
 #endif
-        lv_draw_buf_copy(off_screen, sync_area, on_screen, sync_area);
-        if(off_screen2 != on_screen)
-            lv_draw_buf_copy(off_screen2, sync_area, on_screen, sync_area);
+        lv_draw_buf_copy(off_screen, &copy_area, on_screen, &copy_area);
     }
 
-    /*Clear sync areas*/
-    lv_ll_clear(&disp_refr->sync_areas);
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Save the areas rendered in this refresh as sync areas and
+ * remove the sync areas which are already rendered into all the buffers.
+ */
+static void refr_sync_areas_update(void)
+{
+    /*With 2 buffers the areas of the last frame are needed, with 3 buffers of the last 2 frames*/
+    uint32_t max_age = disp_refr->buf_3 ? 2 : 1;
+
+    lv_display_sync_area_t * sync_area = lv_ll_get_head(&disp_refr->sync_areas);
+    while(sync_area != NULL) {
+        lv_display_sync_area_t * next_area = lv_ll_get_next(&disp_refr->sync_areas, sync_area);
+        sync_area->age++;
+        if(sync_area->age >= max_age) {
+            lv_ll_remove(&disp_refr->sync_areas, sync_area);
+            lv_free(sync_area);
+        }
+        sync_area = next_area;
+    }
+
+    uint32_t i;
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(disp_refr->inv_area_joined[i])
+            continue;
+
+        sync_area = lv_ll_ins_tail(&disp_refr->sync_areas);
+        LV_ASSERT_MALLOC(sync_area);
+        if(sync_area == NULL) break;
+        sync_area->area = disp_refr->inv_areas[i];
+        sync_area->age = 0;
+    }
+}
+
 /**
  * Refresh the joined areas
  */
@@ -1414,6 +1515,9 @@ static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t *
 
     lv_display_send_event(disp, LV_EVENT_FLUSH_START, &offset_area);
 
+    /*The presentation latency is measured from here*/
+    if(lv_display_flush_is_last(disp)) disp->pacing.refr_end = lv_tick_get();
+
     /*For backward compatibility support LV_COLOR_16_SWAP (from v8)*/
 #if defined(LV_COLOR_16_SWAP) && LV_COLOR_16_SWAP
     lv_draw_sw_rgb565_swap(px_map, lv_area_get_size(&offset_area));
@@ -46,6 +46,8 @@ static void set_y_anim(void * obj, int32_t v);
 static void scr_anim_completed(lv_anim_t * a);
 static bool is_out_anim(lv_screen_load_anim_t a);
 static void disp_event_cb(lv_event_t * e);
+static void vblank_period_update(lv_display_frame_stats_t * stats, uint32_t diff_us);
+static void frame_presented(lv_display_pacing_t * pacing, uint32_t timestamp);
 
 /**********************
  *  STATIC VARIABLES
@@ -99,7 +101,7 @@ lv_display_t * lv_display_create(int32_t hor_res, int32_t ver_res)
     disp->inv_en_cnt = 1;
     disp->last_activity_time = lv_tick_get();
 
-    lv_ll_init(&disp->sync_areas, sizeof(lv_area_t));
+    lv_ll_init(&disp->sync_areas, sizeof(lv_display_sync_area_t));
 
     lv_display_t * disp_def_tmp = disp_def;
     disp_def                 = disp; /*Temporarily change the default screen to create the default screens on the
@@ -1106,6 +1108,133 @@ bool lv_display_unregister_vsync_event(lv_display_t * disp, lv_event_cb_t event_
     return true;
 }
 
+void lv_display_report_vblank(lv_display_t * disp, uint32_t timestamp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return;
+
+    lv_display_pacing_t * pacing = &disp->pacing;
+    lv_display_frame_stats_t * stats = &pacing->stats;
+
+    if(pacing->vblank_valid) {
+        int32_t diff = (int32_t)lv_tick_diff(timestamp, pacing->last_vblank);
+        if(diff <= 0) return; /*Reported twice or out of order*/
+
+        if(!pacing->period_fixed) vblank_period_update(stats, (uint32_t)diff * 1000);
+    }
+
+    pacing->last_vblank = timestamp;
+    pacing->vblank_valid = 1;
+
+    /*Consider the first vblank after rendering as the presentation of the frame*/
+    if(pacing->frame_pending) {
+        frame_presented(pacing, timestamp);
+
+        uint32_t period = stats->vblank_period_us;
+        int32_t late = (int32_t)lv_tick_diff(timestamp, pacing->target_vblank);
+        if(pacing->target_valid && period && late > 0 && (uint32_t)late * 1000 > period / 2) {
+            stats->dropped_cnt += ((uint32_t)late * 1000 + period / 2) / period;
+        }
+    }
+}
+
+void lv_display_report_presented(lv_display_t * disp, uint32_t timestamp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return;
+
+    lv_display_pacing_t * pacing = &disp->pacing;
+    if(pacing->frame_pending) {
+        frame_presented(pacing, timestamp);
+    }
+    /*Reported from the flush callback, count it when the refresh is finished*/
+    else if(lv_refr_get_disp_refreshing() == disp) {
+        pacing->present_time = timestamp;
+        pacing->presented_early = 1;
+    }
+}
+
+void lv_display_set_vblank_period(lv_display_t * disp, uint32_t period_us)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return;
+
+    disp->pacing.stats.vblank_period_us = period_us;
+    disp->pacing.period_fixed = period_us ? 1 : 0;
+}
+
+void lv_display_set_frame_pacing(lv_display_t * disp, bool en)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return;
+
+    lv_display_pacing_t * pacing = &disp->pacing;
+    pacing->enabled = en;
+
+    /*Restore the refresh period if the refresh was delayed*/
+    if(!en && pacing->refr_delayed) {
+        pacing->refr_delayed = 0;
+        if(disp->refr_timer) lv_timer_set_period(disp->refr_timer, pacing->refr_period);
+    }
+}
+
+bool lv_display_get_frame_pacing(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return false;
+
+    return disp->pacing.enabled;
+}
+
+bool lv_display_get_next_vblank(lv_display_t * disp, uint32_t * vblank)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return false;
+
+    const lv_display_pacing_t * pacing = &disp->pacing;
+    uint32_t period = pacing->stats.vblank_period_us;
+    if(!pacing->vblank_valid || period == 0) return false;
+
+    /*Expect the rendering to take as long as usually*/
+    uint32_t ready = lv_tick_get() + pacing->stats.render_time_avg_ms + LV_DISPLAY_PACING_MARGIN;
+    int32_t elapsed = (int32_t)lv_tick_diff(ready, pacing->last_vblank);
+    if(elapsed < 0) elapsed = 0;
+
+    /*The period is not precise enough to predict too far*/
+    if(elapsed > LV_DISPLAY_PACING_MAX_PREDICT) return false;
+
+    /*The first vblank not earlier than `ready`*/
+    uint64_t n = ((uint64_t)elapsed * 1000 + period - 1) / period;
+    if(n == 0) n = 1;
+    *vblank = pacing->last_vblank + (uint32_t)((n * period + 500) / 1000);
+    return true;
+}
+
+void lv_display_get_frame_stats(lv_display_t * disp, lv_display_frame_stats_t * stats)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) {
+        lv_memzero(stats, sizeof(*stats));
+        return;
+    }
+
+    *stats = disp->pacing.stats;
+}
+
+void lv_display_reset_frame_stats(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return;
+
+    lv_display_frame_stats_t * stats = &disp->pacing.stats;
+    stats->frame_cnt = 0;
+    stats->dropped_cnt = 0;
+    stats->render_time_avg_ms = 0;
+    stats->render_time_max_ms = 0;
+    stats->present_latency_avg_ms = 0;
+    stats->present_latency_max_ms = 0;
+}
+
 void lv_display_set_user_data(lv_display_t * disp, void * user_data)
 {
     if(!disp) disp = lv_display_get_default();
@@ -1370,3 +1499,44 @@ static void disp_event_cb(lv_event_t * e)
             break;
     }
 }
+
+/**
+ * Refine the measured vblank period with the time between two reported vblanks
+ * @param stats     the statistics storing the vblank period
+ * @param diff_us   time between the last two vblank reports in microseconds
+ */
+static void vblank_period_update(lv_display_frame_stats_t * stats, uint32_t diff_us)
+{
+    uint32_t period = stats->vblank_period_us;
+
+    /*Start over if the period is shorter, e.g. the first two reports weren't on adjacent vblanks*/
+    if(period == 0 || diff_us < period * 3 / 4) {
+        stats->vblank_period_us = diff_us;
+        return;
+    }
+
+    /*There can be vblanks without report, e.g. if nothing was rendered*/
+    uint32_t n = (diff_us + period / 2) / period;
+    if(n > 4) return;
+
+    /*The timestamps are in milliseconds, average them*/
+    stats->vblank_period_us = (period * 7 + diff_us / n) / 8;
+}
+
+/**
+ * Count the pending frame as presented and update the presentation latency
+ * @param pacing    the frame pacing state of the display
+ * @param timestamp the time of the presentation
+ */
+static void frame_presented(lv_display_pacing_t * pacing, uint32_t timestamp)
+{
+    lv_display_frame_stats_t * stats = &pacing->stats;
+
+    pacing->frame_pending = 0;
+    stats->frame_cnt++;
+
+    int32_t latency = (int32_t)lv_tick_diff(timestamp, pacing->refr_end);
+    uint32_t t = latency > 0 ? (uint32_t)latency : 0;
+    stats->present_latency_avg_ms = stats->frame_cnt > 1 ? (stats->present_latency_avg_ms * 7 + t) / 8 : t;
+    if(t > stats->present_latency_max_ms) stats->present_latency_max_ms = t;
+}
@@ -81,6 +81,17 @@ typedef enum {
 typedef void (*lv_display_flush_cb_t)(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 typedef void (*lv_display_flush_wait_cb_t)(lv_display_t * disp);
 
+/** Statistics of the frames presented on a display, see `lv_display_get_frame_stats()`*/
+typedef struct {
+    uint32_t frame_cnt;                 /**< Number of presented frames*/
+    uint32_t dropped_cnt;               /**< Number of vblanks missed because a frame was presented later than planned*/
+    uint32_t vblank_period_us;          /**< Time between two vblanks in microseconds, 0 if not known yet*/
+    uint32_t render_time_avg_ms;        /**< Average time of refreshing the display in milliseconds (`lv_tick` resolution)*/
+    uint32_t render_time_max_ms;        /**< The longest refresh of the display in milliseconds*/
+    uint32_t present_latency_avg_ms;    /**< Average time from the end of rendering to the presentation in milliseconds*/
+    uint32_t present_latency_max_ms;    /**< The longest time from the end of rendering to the presentation in milliseconds*/
+} lv_display_frame_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -636,6 +647,73 @@ bool lv_display_unregister_vsync_event(lv_display_t * disp, lv_event_cb_t event_
  */
 lv_result_t lv_display_send_vsync_event(lv_display_t * disp, void * param);
 
+/**
+ * Tell LVGL that a vblank happened or a frame was presented on the display.
+ * Display drivers call it e.g. on DRM page flip events, Wayland frame callbacks or after
+ * `FBIO_WAITFORVSYNC`. The time between the reports is used to measure the vblank period
+ * (unless it's set by `lv_display_set_vblank_period()`), to schedule the refresh with frame
+ * pacing, and to count the dropped frames.
+ * @param disp          pointer to a display
+ * @param timestamp     the time of the vblank as returned by `lv_tick_get()`
+ */
+void lv_display_report_vblank(lv_display_t * disp, uint32_t timestamp);
+
+/**
+ * Tell LVGL that the last rendered frame was presented, for display drivers which don't know
+ * the vblanks, e.g. when the window system has finished copying the frame to the window.
+ * It counts the frame and its presentation latency in the frame statistics, but it doesn't
+ * affect the vblank period and frame pacing.
+ * @param disp          pointer to a display
+ * @param timestamp     the time of the presentation as returned by `lv_tick_get()`
+ */
+void lv_display_report_presented(lv_display_t * disp, uint32_t timestamp);
+
+/**
+ * Set the time between two vblanks if the driver knows it, e.g. from the refresh rate of the display mode.
+ * @param disp          pointer to a display
+ * @param period_us     the vblank period in microseconds, or 0 to measure it from the reported vblanks
+ */
+void lv_display_set_vblank_period(lv_display_t * disp, uint32_t period_us);
+
+/**
+ * Enable or disable frame pacing. With frame pacing the refresh timer is delayed to finish
+ * rendering just before the next vblank, and the animations are evaluated at the time the
+ * frame is expected to be presented. It has effect only if the display driver reports the
+ * vblanks with `lv_display_report_vblank()`.
+ * @param disp          pointer to a display
+ * @param en            true: enable frame pacing
+ */
+void lv_display_set_frame_pacing(lv_display_t * disp, bool en);
+
+/**
+ * Get whether frame pacing is enabled
+ * @param disp          pointer to a display
+ * @return              true: frame pacing is enabled
+ */
+bool lv_display_get_frame_pacing(lv_display_t * disp);
+
+/**
+ * Predict when a frame rendered now would be presented, i.e. the first vblank after the
+ * expected end of rendering.
+ * @param disp          pointer to a display
+ * @param vblank        store the predicted time here (in `lv_tick_get()` time)
+ * @return              true: `vblank` is set; false: the vblanks aren't known
+ */
+bool lv_display_get_next_vblank(lv_display_t * disp, uint32_t * vblank);
+
+/**
+ * Get the statistics of the frames presented since the display was created or the last reset.
+ * @param disp          pointer to a display
+ * @param stats         the statistics are copied here
+ */
+void lv_display_get_frame_stats(lv_display_t * disp, lv_display_frame_stats_t * stats);
+
+/**
+ * Reset the frame and dropped frame counters, the render times and the presentation latencies.
+ * @param disp          pointer to a display
+ */
+void lv_display_reset_frame_stats(lv_display_t * disp);
+
 void lv_display_set_user_data(lv_display_t * disp, void * user_data);
 void lv_display_set_driver_data(lv_display_t * disp, void * driver_data);
 void * lv_display_get_user_data(lv_display_t * disp);
@@ -29,10 +29,40 @@ extern "C" {
 #define LV_INV_BUF_SIZE 32 /**< Buffer size for invalid areas */
 #endif
 
+/** Extra time to finish rendering before the vblank with frame pacing [ms]*/
+#define LV_DISPLAY_PACING_MARGIN 2
+
+/** Don't predict vblanks farther than this from the last reported one [ms]*/
+#define LV_DISPLAY_PACING_MAX_PREDICT 1000
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/** An area which was rendered into some buffers but not into all of them */
+typedef struct {
+    lv_area_t area;
+    uint32_t age;   /**< Number of frames rendered since this area was rendered*/
+} lv_display_sync_area_t;
+
+/** State of the frame pacing of a display */
+typedef struct {
+    lv_display_frame_stats_t stats;
+    uint32_t last_vblank;       /**< Time of the last reported vblank*/
+    uint32_t target_vblank;     /**< The vblank the last rendered frame was planned to be presented at*/
+    uint32_t refr_start;        /**< Time when the refreshing of the current frame started*/
+    uint32_t refr_end;          /**< Time when the last area of the last frame was flushed*/
+    uint32_t present_time;      /**< Time of a presentation reported before the end of the refresh*/
+    uint32_t refr_period;       /**< The original period of the refresh timer while it's delayed*/
+    uint32_t enabled : 1;
+    uint32_t period_fixed : 1;  /**< The vblank period was set by the driver*/
+    uint32_t vblank_valid : 1;  /**< `last_vblank` is set*/
+    uint32_t frame_pending : 1; /**< A frame was rendered, its presentation wasn't reported yet*/
+    uint32_t target_valid : 1;  /**< `target_vblank` is set*/
+    uint32_t refr_delayed : 1;  /**< The refresh timer runs with a shortened period to start in time*/
+    uint32_t presented_early : 1; /**< The frame was presented in the flush, `present_time` is set*/
+} lv_display_pacing_t;
+
 struct _lv_display_t {
 
     /*---------------------
@@ -107,7 +137,7 @@ struct _lv_display_t {
     uint32_t inv_p;
     int32_t inv_en_cnt;
 
-    /** Double buffer sync areas (redrawn during last refresh) */
+    /** Double or triple buffer sync areas (`lv_display_sync_area_t` redrawn during the last refreshes) */
     lv_ll_t sync_areas;
 
     lv_draw_buf_t _static_buf1; /**< Used when user pass in a raw buffer as display draw buffer */
@@ -161,6 +191,8 @@ struct _lv_display_t {
     lv_area_t refreshed_area;
     uint32_t vsync_count;
 
+    lv_display_pacing_t pacing;
+
 #if LV_USE_PERF_MONITOR
     lv_obj_t * perf_label;
     lv_sysmon_backend_data_t perf_sysmon_backend;
@@ -16,6 +16,7 @@
 #include "lv_draw_private.h"
 #include "lv_draw_mask_private.h"
 #include "lv_draw_vector_private.h"
+#include "lv_draw_label_private.h"
 #include "lv_draw_3d.h"
 #include "sw/lv_draw_sw.h"
 #include "../display/lv_display_private.h"
@@ -64,6 +65,8 @@ void lv_draw_init(void)
 #if LV_USE_OS
     lv_thread_sync_init(&_draw_info.sync);
 #endif
+
+    lv_draw_label_run_cache_init();
 }
 
 void lv_draw_deinit(void)
@@ -81,6 +84,8 @@ void lv_draw_deinit(void)
         lv_free(cur_unit);
     }
     _draw_info.unit_head = NULL;
+
+    lv_draw_label_run_cache_deinit();
 }
 
 void * lv_draw_create_unit(size_t size)
@@ -20,14 +20,20 @@
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_string.h"
 #include "../core/lv_global.h"
+#include "../misc/cache/lv_cache.h"
+#include "../misc/lv_iter.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define LABEL_RECOLOR_PAR_LENGTH 6
 #define LV_LABEL_HINT_UPDATE_TH 1024 /*Update the "hint" if the label's y coordinates have changed more then this*/
+#define LINE_NOT_FOUND UINT32_MAX
 
 #define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
+#define run_cache LV_GLOBAL_DEFAULT()->draw_label_run_cache
+
+#define RUN_TEXT_MAX_LEN 256 /*Longer texts are not cached in runs. They can use a line table.*/
 
 /**********************
  *      TYPEDEFS
@@ -39,10 +45,70 @@ enum {
 };
 typedef unsigned char cmd_state_t;
 
+#if LV_DRAW_LABEL_RUN_CACHE_CNT > 0
+/** A different glyph of a run. The glyphs of the same letter share it unless kerning changes them.*/
+typedef struct {
+    /** The glyph descriptor as returned by `lv_font_get_glyph_dsc()`. `entry` is always NULL.*/
+    lv_font_glyph_dsc_t g;
+    uint32_t letter;
+} run_glyph_dsc_t;
+
+/** A positioned glyph of a run*/
+typedef struct {
+    int16_t x;              /**< x coordinate relative to the start of the text area*/
+    int16_t y;              /**< y coordinate relative to the start of the text area*/
+    uint8_t id;             /**< Index of the glyph in `glyph_dscs`*/
+
+    /** 1: it's the last glyph of its line so the underline and strikethrough end here*/
+    uint8_t line_end : 1;
+} run_glyph_t;
+
+/** The glyphs of a text broken to lines, aligned and shaped with the parameters in the key fields.
+ * When used as a search key `text` points to the text to draw and `glyphs` and `glyph_dscs` are NULL.*/
+typedef struct {
+    uint32_t hash;
+    uint32_t text_len;
+    const char * text;
+    const lv_font_t * font;
+    uint32_t fallback_hash;     /**< Hash of the fallback fonts as they can be changed any time*/
+    lv_font_kerning_t kerning;
+    int32_t max_width;
+    int32_t area_width;
+    int32_t letter_space;
+    int32_t line_space;
+    lv_text_flag_t flag;
+    lv_text_align_t align;
+    lv_base_dir_t base_dir;
+    uint8_t has_bided;
+
+    /** The glyphs ordered by lines. Markers are not stored as they are not drawn.*/
+    run_glyph_t * glyphs;
+    uint32_t glyph_cnt;
+    run_glyph_dsc_t * glyph_dscs;
+    uint32_t glyph_dsc_cnt;
+} run_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static uint8_t hex_char_to_num(char hex);
+static int32_t lines_get_max_width(const lv_draw_label_dsc_t * dsc, const lv_area_t * coords);
+static bool lines_are_valid(const lv_draw_label_lines_t * lines, const lv_draw_label_dsc_t * dsc,
+                            const lv_area_t * coords);
+static bool lines_reserve(lv_draw_label_lines_t * lines, uint32_t cnt);
+static uint32_t lines_add_next(const lv_draw_label_lines_t * lines, lv_draw_label_line_t * dest, uint32_t idx,
+                               const char * text, uint32_t line_start, uint32_t remaining_len);
+static uint32_t lines_find(const lv_draw_label_lines_t * lines, uint32_t first, uint32_t start);
+#if LV_DRAW_LABEL_RUN_CACHE_CNT > 0
+    static bool run_draw(lv_draw_task_t * t, const lv_draw_label_dsc_t * dsc, const lv_area_t * coords,
+                         const lv_draw_label_lines_t * lines, int32_t w, lv_text_align_t align, lv_base_dir_t base_dir,
+                         lv_draw_glyph_cb_t cb);
+    static bool run_create_cb(run_t * run, void * user_data);
+    static void run_free_cb(run_t * run, void * user_data);
+    static lv_cache_compare_res_t run_compare_cb(const run_t * lhs, const run_t * rhs);
+    static bool run_uses_font(const run_t * run, const lv_font_t * font);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -95,6 +161,8 @@ lv_draw_label_dsc_t * lv_draw_task_get_label_dsc(lv_draw_task_t * task)
 void lv_draw_glyph_dsc_init(lv_draw_glyph_dsc_t * dsc)
 {
     lv_memzero(dsc, sizeof(lv_draw_glyph_dsc_t));
+    dsc->scale_x = LV_SCALE_NONE;
+    dsc->scale_y = LV_SCALE_NONE;
 }
 
 void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_layer_t * layer, const lv_draw_label_dsc_t * dsc,
@@ -215,7 +283,15 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
 
     lv_bidi_calculate_align(&align, &base_dir, dsc->text);
 
-    if((dsc->flag & LV_TEXT_FLAG_EXPAND) == 0) {
+    /*Use the stored line breaks if they were found with the same parameters*/
+    const lv_draw_label_lines_t * lines = dsc->lines;
+    if(lines && !lines_are_valid(lines, dsc, coords)) lines = NULL;
+
+    if(lines) {
+        /*Only needed to find the line breaks*/
+        w = lines->max_width;
+    }
+    else if((dsc->flag & LV_TEXT_FLAG_EXPAND) == 0) {
         /*Normally use the label's width as width*/
         w = lv_area_get_width(coords);
     }
@@ -252,11 +328,17 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
     y_ofs = dsc->ofs_y;
     pos.y += y_ofs;
 
+#if LV_DRAW_LABEL_RUN_CACHE_CNT > 0
+    /*Draw the glyphs positioned earlier if the text hasn't changed*/
+    if(run_draw(t, dsc, coords, lines, w, align, base_dir, cb)) return;
+#endif
+
     uint32_t line_start     = 0;
     int32_t last_line_start = -1;
+    uint32_t line_idx       = 0;
 
     /*Check the hint to use the cached info*/
-    if(dsc->hint && y_ofs == 0 && coords->y1 < 0) {
+    if(dsc->hint && lines == NULL && y_ofs == 0 && coords->y1 < 0) {
         /*If the label changed too much recalculate the hint.*/
         if(LV_ABS(dsc->hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
             dsc->hint->line_start = -1;
@@ -276,10 +358,26 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
     attributes.text_flags = dsc->flag;
     attributes.max_width = w;
 
-    uint32_t line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, NULL, &attributes);
+    uint32_t line_end;
+    if(lines) {
+        /*Jump to the first visible line*/
+        if(pos.y + line_height_font < t->clip_area.y1) {
+            if(line_height <= 0) return;
+            line_idx = (t->clip_area.y1 - line_height_font - pos.y + line_height - 1) / line_height;
+            if(line_idx >= lines->line_cnt) return;
+            pos.y += (int32_t)line_idx * line_height;
+        }
+        if(lines->line_cnt == 0) return;
+        line_start = lines->lines[line_idx].start;
+        line_end = lines->lines[line_idx + 1].start;
+        remaining_len -= line_start;
+    }
+    else {
+        line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, NULL, &attributes);
+    }
 
     /*Go the first visible line*/
-    while(pos.y + line_height_font < t->clip_area.y1) {
+    while(lines == NULL && pos.y + line_height_font < t->clip_area.y1) {
         /*Go to next line*/
         remaining_len -= line_end - line_start;
         line_start = line_end;
@@ -298,13 +396,15 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &attributes);
+        if(lines) line_width = lines->lines[line_idx].width;
+        else line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &attributes);
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &attributes);
+        if(lines) line_width = lines->lines[line_idx].width;
+        else line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &attributes);
         pos.x += lv_area_get_width(coords) - line_width;
     }
 
@@ -532,22 +632,29 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
         /*Go to next line*/
         remaining_len -= line_end - line_start;
         line_start = line_end;
-        if(remaining_len) {
+        if(lines) {
+            line_idx++;
+            /*After the last line `line_start` is the end of the text so the loop ends*/
+            if(line_idx < lines->line_cnt) line_end = lines->lines[line_idx + 1].start;
+        }
+        else if(remaining_len) {
             line_end += lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, NULL, &text_attributes);
         }
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &text_attributes);
+            if(lines) line_width = line_idx < lines->line_cnt ? lines->lines[line_idx].width : 0;
+            else line_width =
+                    lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &text_attributes);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &text_attributes);
+            if(lines) line_width = line_idx < lines->line_cnt ? lines->lines[line_idx].width : 0;
+            else line_width =
+                    lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &text_attributes);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -562,6 +669,272 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
     LV_ASSERT_MEM_INTEGRITY();
 }
 
+void lv_draw_label_lines_update(lv_draw_label_lines_t * lines, const lv_draw_label_dsc_t * dsc,
+                                const lv_area_t * coords)
+{
+    LV_ASSERT_NULL(lines);
+    LV_ASSERT_NULL(dsc);
+
+    if(dsc->text == NULL || dsc->font == NULL) {
+        lv_draw_label_lines_reset(lines);
+        return;
+    }
+
+    if(lines_are_valid(lines, dsc, coords)) return;
+
+    LV_PROFILER_DRAW_BEGIN;
+
+    lines->text = NULL;
+    lines->line_cnt = 0;
+    lines->font = dsc->font;
+    lines->text_length = dsc->text_length;
+    lines->max_width = lines_get_max_width(dsc, coords);
+    lines->letter_space = dsc->letter_space;
+    lines->flag = dsc->flag;
+
+    const char * text = dsc->text;
+    uint32_t remaining_len = dsc->text_length;
+    uint32_t line_start = 0;
+    while(remaining_len && text[line_start] != '\0') {
+        /*Keep place for the end of the text too*/
+        if(!lines_reserve(lines, lines->line_cnt + 2)) {
+            lv_draw_label_lines_reset(lines);
+            LV_PROFILER_DRAW_END;
+            return;
+        }
+
+        uint32_t line_len = lines_add_next(lines, lines->lines, lines->line_cnt, text, line_start, remaining_len);
+        lines->line_cnt++;
+
+        remaining_len -= line_len;
+        line_start += line_len;
+    }
+
+    if(!lines_reserve(lines, lines->line_cnt + 1)) {
+        lv_draw_label_lines_reset(lines);
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+
+    lines->lines[lines->line_cnt].start = line_start;
+    lines->lines[lines->line_cnt].width = 0;
+    lines->text = text;
+
+    LV_PROFILER_DRAW_END;
+}
+
+void lv_draw_label_lines_edit(lv_draw_label_lines_t * lines, const char * text, uint32_t pos, int32_t diff)
+{
+    LV_ASSERT_NULL(lines);
+
+    if(lines->text == NULL) return;
+
+    uint32_t old_len = lines->lines[lines->line_cnt].start;
+    uint32_t removed = diff < 0 ? (uint32_t)(-diff) : 0;
+    if(text == NULL || lines->text_length != LV_TEXT_LEN_MAX || pos > old_len || removed > old_len - pos) {
+        lv_draw_label_lines_reset(lines);
+        return;
+    }
+
+    /*The lines of a paragraph don't depend on the other paragraphs so start at the beginning
+     *of the changed one. The text is the same before `pos`.*/
+    uint32_t line_start = pos;
+    while(line_start > 0 && text[line_start - 1] != '\n' && text[line_start - 1] != '\r') line_start--;
+
+    uint32_t first = lines_find(lines, 0, line_start);
+    if(first == LINE_NOT_FOUND) {
+        lv_draw_label_lines_reset(lines);
+        return;
+    }
+
+    LV_PROFILER_DRAW_BEGIN;
+
+    /*Find the lines until the end of the paragraph of the edit, the next lines only move*/
+    uint32_t edit_end = pos + (diff > 0 ? (uint32_t)diff : 0);
+    lv_draw_label_line_t * new_lines = NULL;
+    uint32_t new_cnt = 0;
+    uint32_t new_cap = 0;
+    uint32_t tail = LINE_NOT_FOUND;
+    bool to_end = false;
+    while(text[line_start] != '\0') {
+        if(new_cnt >= new_cap) {
+            new_cap = new_cap ? new_cap * 2 : 8;
+            lv_draw_label_line_t * tmp = lv_realloc(new_lines, new_cap * sizeof(lv_draw_label_line_t));
+            LV_ASSERT_MALLOC(tmp);
+            if(tmp == NULL) {
+                lv_free(new_lines);
+                lv_draw_label_lines_reset(lines);
+                LV_PROFILER_DRAW_END;
+                return;
+            }
+            new_lines = tmp;
+        }
+
+        line_start += lines_add_next(lines, new_lines, new_cnt, text, line_start, LV_TEXT_LEN_MAX);
+        new_cnt++;
+
+        if(!to_end && line_start > edit_end &&
+           (text[line_start - 1] == '\n' || text[line_start - 1] == '\r')) {
+            /*The rest of the text is the same so the same lines should start there*/
+            tail = lines_find(lines, first, (uint32_t)((int64_t)line_start - diff));
+            if(tail != LINE_NOT_FOUND) break;
+            to_end = true;
+        }
+    }
+
+    /*Only the end of the text remains if all the lines were found again*/
+    uint32_t tail_cnt = tail == LINE_NOT_FOUND ? 1 : lines->line_cnt - tail + 1;
+    if(!lines_reserve(lines, first + new_cnt + tail_cnt)) {
+        lv_free(new_lines);
+        lv_draw_label_lines_reset(lines);
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+
+    if(tail == LINE_NOT_FOUND) {
+        lines->lines[first + new_cnt].start = line_start;
+        lines->lines[first + new_cnt].width = 0;
+    }
+    else {
+        lv_memmove(&lines->lines[first + new_cnt], &lines->lines[tail], tail_cnt * sizeof(lv_draw_label_line_t));
+        for(uint32_t i = first + new_cnt; i < first + new_cnt + tail_cnt; i++) {
+            lines->lines[i].start = (uint32_t)((int64_t)lines->lines[i].start + diff);
+        }
+    }
+
+    if(new_cnt) lv_memcpy(&lines->lines[first], new_lines, new_cnt * sizeof(lv_draw_label_line_t));
+    lv_free(new_lines);
+
+    lines->line_cnt = first + new_cnt + tail_cnt - 1;
+    lines->text = text;
+
+    LV_PROFILER_DRAW_END;
+}
+
+void lv_draw_label_lines_get_size(const lv_draw_label_lines_t * lines, int32_t line_space, lv_point_t * size_res)
+{
+    LV_ASSERT_NULL(lines);
+    LV_ASSERT_NULL(size_res);
+
+    size_res->x = 0;
+    size_res->y = 0;
+    if(lines->text == NULL) return;
+
+    int32_t letter_height = lv_font_get_line_height(lines->font);
+    uint32_t i;
+    for(i = 0; i < lines->line_cnt; i++) {
+        size_res->x = LV_MAX(size_res->x, lines->lines[i].width);
+    }
+
+    /*The same as `lv_text_get_size_attributes()`*/
+    uint32_t line_cnt = lines->line_cnt;
+    uint32_t text_end = lines->lines[lines->line_cnt].start;
+    if(text_end != 0 && (lines->text[text_end - 1] == '\n' || lines->text[text_end - 1] == '\r')) line_cnt++;
+
+    int64_t h = (int64_t)line_cnt * (letter_height + line_space);
+    if(h > INT32_MAX) {
+        LV_LOG_WARN("integer overflow while calculating text height");
+        h = INT32_MAX;
+    }
+
+    if(h == 0) size_res->y = letter_height;
+    else size_res->y = (int32_t)h - line_space;
+}
+
+uint32_t lv_draw_label_lines_get_line(const lv_draw_label_lines_t * lines, uint32_t byte_id)
+{
+    LV_ASSERT_NULL(lines);
+
+    if(lines->text == NULL || lines->line_cnt == 0) return 0;
+
+    /*Find the last line starting before `byte_id`*/
+    uint32_t min = 0;
+    uint32_t max = lines->line_cnt - 1;
+    while(min < max) {
+        uint32_t mid = min + (max - min + 1) / 2;
+        if(lines->lines[mid].start <= byte_id) min = mid;
+        else max = mid - 1;
+    }
+
+    return min;
+}
+
+void lv_draw_label_lines_reset(lv_draw_label_lines_t * lines)
+{
+    LV_ASSERT_NULL(lines);
+
+    lv_free(lines->lines);
+    lv_memzero(lines, sizeof(lv_draw_label_lines_t));
+}
+
+void lv_draw_label_run_cache_drop(void)
+{
+#if LV_DRAW_LABEL_RUN_CACHE_CNT > 0
+    if(run_cache) lv_cache_drop_all(run_cache, NULL);
+#endif
+
+    /*Let the draw units know that the glyphs they cached might be invalid*/
+    LV_GLOBAL_DEFAULT()->draw_label_font_gen++;
+}
+
+void lv_draw_label_run_cache_drop_font(const lv_font_t * font)
+{
+#if LV_DRAW_LABEL_RUN_CACHE_CNT > 0
+    if(run_cache == NULL) return;
+
+    /*The iterator copies the whole cache entry, starting with the run*/
+    run_t * run = lv_malloc(lv_cache_entry_get_size(sizeof(run_t)));
+    LV_ASSERT_MALLOC(run);
+    if(run == NULL) {
+        lv_cache_drop_all(run_cache, NULL);
+        return;
+    }
+
+    /*The entries can't be dropped while iterating, so start over after each drop*/
+    while(1) {
+        lv_iter_t * iter = lv_cache_iter_create(run_cache);
+        if(iter == NULL) break;
+
+        bool found = false;
+        while(!found && lv_iter_next(iter, run) == LV_RESULT_OK) {
+            found = run_uses_font(run, font);
+        }
+        lv_iter_destroy(iter);
+
+        if(!found) break;
+        lv_cache_drop(run_cache, run, NULL);
+    }
+
+    lv_free(run);
+#else
+    LV_UNUSED(font);
+#endif
+}
+
+void lv_draw_label_run_cache_init(void)
+{
+#if LV_DRAW_LABEL_RUN_CACHE_CNT > 0
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)run_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)run_create_cb,
+        .free_cb = (lv_cache_free_cb_t)run_free_cb,
+    };
+
+    run_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(run_t), LV_DRAW_LABEL_RUN_CACHE_CNT, ops);
+    lv_cache_set_name(run_cache, "LABEL_RUN");
+#endif
+}
+
+void lv_draw_label_run_cache_deinit(void)
+{
+#if LV_DRAW_LABEL_RUN_CACHE_CNT > 0
+    if(run_cache) {
+        lv_cache_destroy(run_cache, NULL);
+        run_cache = NULL;
+    }
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -578,6 +951,462 @@ static uint8_t hex_char_to_num(char hex)
     return 'A' <= hex && hex <= 'F' ? hex - 'A' + 10 : 0;
 }
 
+/**
+ * Get the width to break the lines at
+ * @param dsc       pointer to a label draw descriptor
+ * @param coords    the coordinates of the text
+ * @return          the width of `coords`, or `LV_COORD_MAX` if the lines are not wrapped
+ */
+static int32_t lines_get_max_width(const lv_draw_label_dsc_t * dsc, const lv_area_t * coords)
+{
+    /*The lines are broken only at the new line characters in these cases*/
+    if(dsc->flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) return LV_COORD_MAX;
+    return lv_area_get_width(coords);
+}
+
+/**
+ * Check if a line table was built with the parameters of a label draw descriptor
+ * @param lines     pointer to a line table
+ * @param dsc       pointer to a label draw descriptor
+ * @param coords    the coordinates of the text
+ * @return          true: the stored lines can be used to draw the text
+ */
+static bool lines_are_valid(const lv_draw_label_lines_t * lines, const lv_draw_label_dsc_t * dsc,
+                            const lv_area_t * coords)
+{
+    return lines->text != NULL &&
+           lines->text == dsc->text &&
+           lines->font == dsc->font &&
+           lines->text_length == dsc->text_length &&
+           lines->letter_space == dsc->letter_space &&
+           lines->flag == dsc->flag &&
+           lines->max_width == lines_get_max_width(dsc, coords);
+}
+
+/**
+ * Make sure that a line table has place for the given number of lines
+ * @param lines     pointer to a line table
+ * @param cnt       the required number of lines
+ * @return          false if the memory couldn't be allocated
+ */
+static bool lines_reserve(lv_draw_label_lines_t * lines, uint32_t cnt)
+{
+    if(cnt <= lines->line_cap) return true;
+
+    uint32_t new_cap = LV_MAX(cnt, lines->line_cap ? lines->line_cap * 2 : 8);
+    lv_draw_label_line_t * new_lines = lv_realloc(lines->lines, new_cap * sizeof(lv_draw_label_line_t));
+    LV_ASSERT_MALLOC(new_lines);
+    if(new_lines == NULL) return false;
+
+    lines->lines = new_lines;
+    lines->line_cap = new_cap;
+    return true;
+}
+
+/**
+ * Find the next line of a text with the parameters of a line table
+ * @param lines         pointer to a line table whose parameters should be used
+ * @param dest          store the line in `dest[idx]`
+ * @param idx           index of the line in `dest`
+ * @param text          the text
+ * @param line_start    byte index of the start of the line in `text`
+ * @param remaining_len the maximum number of bytes to use from `line_start`
+ * @return              the length of the line in bytes
+ */
+static uint32_t lines_add_next(const lv_draw_label_lines_t * lines, lv_draw_label_line_t * dest, uint32_t idx,
+                               const char * text, uint32_t line_start, uint32_t remaining_len)
+{
+    lv_text_attributes_t attributes = {0};
+    attributes.letter_space = lines->letter_space;
+    attributes.text_flags = lines->flag;
+    attributes.max_width = lines->max_width;
+
+    uint32_t line_len = lv_text_get_next_line(&text[line_start], remaining_len, lines->font, NULL, &attributes);
+    dest[idx].start = line_start;
+    dest[idx].width = lv_text_get_width(&text[line_start], line_len, lines->font, &attributes);
+
+    return line_len;
+}
+
+/**
+ * Find the line which starts at a given byte index
+ * @param lines     pointer to a line table
+ * @param first     index of the first line to check
+ * @param start     the byte index to find
+ * @return          index of the line or `LINE_NOT_FOUND`. The end of the text is found too.
+ */
+static uint32_t lines_find(const lv_draw_label_lines_t * lines, uint32_t first, uint32_t start)
+{
+    uint32_t min = first;
+    uint32_t max = lines->line_cnt + 1;
+    while(min < max) {
+        uint32_t mid = min + (max - min) / 2;
+        if(lines->lines[mid].start < start) min = mid + 1;
+        else max = mid;
+    }
+
+    if(min <= lines->line_cnt && lines->lines[min].start == start) return min;
+    return LINE_NOT_FOUND;
+}
+
+#if LV_DRAW_LABEL_RUN_CACHE_CNT > 0
+/**
+ * Draw a text from its run, i.e. from the glyphs positioned when the text was drawn earlier
+ * with the same parameters. If there is no such run it's created now.
+ * @param t         pointer to a draw task
+ * @param dsc       pointer to the label draw descriptor
+ * @param coords    coordinates of the text
+ * @param lines     a valid line table of the text or NULL
+ * @param w         the width to break the lines at
+ * @param align     the alignment of the text after handling the base direction
+ * @param base_dir  the base direction of the text
+ * @param cb        the callback to draw the glyphs
+ * @return          true: the text was drawn; false: the text can't be drawn from a run
+ */
+static bool run_draw(lv_draw_task_t * t, const lv_draw_label_dsc_t * dsc, const lv_area_t * coords,
+                     const lv_draw_label_lines_t * lines, int32_t w, lv_text_align_t align, lv_base_dir_t base_dir,
+                     lv_draw_glyph_cb_t cb)
+{
+    lv_cache_t * cache = run_cache;
+    if(cache == NULL) return false;
+
+    /*The color of the letters depend on more than the glyphs in these cases*/
+    if(dsc->flag & LV_TEXT_FLAG_RECOLOR) return false;
+    if(dsc->sel_start != LV_DRAW_LABEL_NO_TXT_SEL && dsc->sel_end != LV_DRAW_LABEL_NO_TXT_SEL) return false;
+
+    /*The glyphs are searched by their y coordinate which needs increasing lines*/
+    const lv_font_t * font = dsc->font;
+    int32_t line_height_font = lv_font_get_line_height(font);
+    int32_t line_height = line_height_font + dsc->line_space;
+    if(line_height <= 0) return false;
+
+    /*FNV-1a hash of the text which also finds its length*/
+    const char * text = dsc->text;
+    uint32_t hash = 2166136261u;
+    uint32_t len = 0;
+    while(len < dsc->text_length && text[len] != '\0') {
+        if(len >= RUN_TEXT_MAX_LEN) return false;
+        hash = (hash ^ (uint8_t)text[len]) * 16777619u;
+        len++;
+    }
+
+    LV_PROFILER_DRAW_BEGIN;
+
+    run_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.hash = hash;
+    search_key.text_len = len;
+    search_key.text = text;
+    search_key.font = dsc->font;
+    const lv_font_t * fallback;
+    for(fallback = dsc->font->fallback; fallback; fallback = fallback->fallback) {
+        search_key.fallback_hash = (search_key.fallback_hash ^ (uint32_t)(lv_uintptr_t)fallback) * 16777619u;
+    }
+    search_key.kerning = dsc->font->kerning;
+    search_key.max_width = w;
+    search_key.area_width = lv_area_get_width(coords);
+    search_key.letter_space = dsc->letter_space;
+    search_key.line_space = dsc->line_space;
+    search_key.flag = dsc->flag;
+    search_key.align = align;
+    search_key.base_dir = base_dir;
+    search_key.has_bided = dsc->has_bided;
+
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(cache, &search_key, (void *)lines);
+    if(entry == NULL) {
+        LV_PROFILER_DRAW_END;
+        return false;
+    }
+
+    const run_t * run = lv_cache_entry_get_data(entry);
+    int32_t x_start = coords->x1 + dsc->ofs_x;
+    int32_t y_start = coords->y1 + dsc->ofs_y;
+
+    /*Jump to the first glyph of the first visible line*/
+    int32_t y_min = t->clip_area.y1 - line_height_font - y_start;
+    uint32_t min = 0;
+    uint32_t max = run->glyph_cnt;
+    while(min < max) {
+        uint32_t mid = min + (max - min) / 2;
+        if(run->glyphs[mid].y < y_min) min = mid + 1;
+        else max = mid;
+    }
+
+    lv_area_t bg_coords;
+    lv_draw_glyph_dsc_t draw_letter_dsc;
+    lv_font_glyph_dsc_t glyph_dsc;
+    lv_draw_glyph_dsc_init(&draw_letter_dsc);
+    draw_letter_dsc.opa = dsc->opa;
+    draw_letter_dsc.bg_coords = &bg_coords;
+    draw_letter_dsc.color = dsc->color;
+    draw_letter_dsc.rotation = dsc->rotation;
+    draw_letter_dsc.g = &glyph_dsc;
+    draw_letter_dsc.outline_stroke_width = dsc->outline_stroke_width;
+    draw_letter_dsc.outline_stroke_opa = dsc->outline_stroke_opa;
+    draw_letter_dsc.outline_stroke_color = dsc->outline_stroke_color;
+
+    lv_draw_fill_dsc_t fill_dsc;
+    lv_draw_fill_dsc_init(&fill_dsc);
+    fill_dsc.opa = dsc->opa;
+    fill_dsc.color = dsc->color;
+    int32_t underline_width = font->underline_thickness ? font->underline_thickness : 1;
+
+    lv_point_t pos;
+    int32_t line_x1 = 0;
+    uint32_t i;
+    for(i = min; i < run->glyph_cnt; i++) {
+        const run_glyph_t * glyph = &run->glyphs[i];
+        const run_glyph_dsc_t * glyph_dsc_run = &run->glyph_dscs[glyph->id];
+        pos.y = y_start + glyph->y;
+        if(pos.y > t->clip_area.y2) break;
+
+        pos.x = x_start + glyph->x;
+        if(i == min || glyph->y != run->glyphs[i - 1].y) line_x1 = pos.x;
+
+        int32_t letter_w = glyph_dsc_run->g.adv_w;
+        bg_coords.x1 = pos.x - dsc->letter_space / 2;
+        bg_coords.y1 = pos.y;
+        bg_coords.x2 = pos.x + letter_w - 1 + (dsc->letter_space + 1) / 2;
+        bg_coords.y2 = pos.y + line_height - 1;
+
+        if(glyph->line_end) {
+            lv_area_t fill_area;
+            fill_area.x1 = line_x1;
+            fill_area.x2 = pos.x + letter_w - 1;
+            if(dsc->decor & LV_TEXT_DECOR_UNDERLINE) {
+                fill_area.y1 = pos.y + font->line_height - font->base_line - font->underline_position;
+                fill_area.y2 = fill_area.y1 + underline_width - 1;
+                cb(t, NULL, &fill_dsc, &fill_area);
+            }
+            if(dsc->decor & LV_TEXT_DECOR_STRIKETHROUGH) {
+                fill_area.y1 = pos.y + (font->line_height - font->base_line) * 2 / 3 + font->underline_thickness / 2;
+                fill_area.y2 = fill_area.y1 + underline_width - 1;
+                cb(t, NULL, &fill_dsc, &fill_area);
+            }
+        }
+
+        /*The glyph can be changed while drawing, e.g. its draw data is stored in it*/
+        glyph_dsc = glyph_dsc_run->g;
+        lv_draw_unit_draw_letter(t, &draw_letter_dsc, &pos, font, glyph_dsc_run->letter, cb);
+    }
+
+    if(draw_letter_dsc._draw_buf) lv_draw_buf_destroy(draw_letter_dsc._draw_buf);
+
+    lv_cache_release(cache, entry, NULL);
+
+    LV_PROFILER_DRAW_END;
+    return true;
+}
+
+/**
+ * Break the text of a run to lines and position its glyphs the same way as
+ * `lv_draw_label_iterate_characters()` does.
+ * @param run           the run to create. Its key fields are set and `text` points to the text to draw.
+ * @param user_data     a valid line table of the text or NULL
+ * @return              false if the memory couldn't be allocated or the glyphs are too far to store them
+ */
+static bool run_create_cb(run_t * run, void * user_data)
+{
+    const lv_draw_label_lines_t * lines = user_data;
+
+    LV_PROFILER_DRAW_BEGIN;
+
+    /*The key points into the text to draw, keep a copy for later comparisons*/
+    char * text = lv_malloc(run->text_len + 1);
+    LV_ASSERT_MALLOC(text);
+    if(text == NULL) {
+        LV_PROFILER_DRAW_END;
+        return false;
+    }
+    lv_memcpy(text, run->text, run->text_len);
+    text[run->text_len] = '\0';
+
+    /*There is at most a glyph for each letter and as the text is short, at most 256 different glyphs*/
+    uint32_t glyph_max = LV_MAX(lv_text_get_encoded_length(text), 1);
+    run_glyph_t * glyphs = lv_malloc(glyph_max * sizeof(run_glyph_t));
+    LV_ASSERT_MALLOC(glyphs);
+    run_glyph_dsc_t * glyph_dscs = lv_malloc(LV_MIN(glyph_max, 256) * sizeof(run_glyph_dsc_t));
+    LV_ASSERT_MALLOC(glyph_dscs);
+    if(glyphs == NULL || glyph_dscs == NULL) {
+        lv_free(text);
+        lv_free(glyphs);
+        lv_free(glyph_dscs);
+        LV_PROFILER_DRAW_END;
+        return false;
+    }
+
+    /*From now on the run owns these and they are freed by `run_free_cb` even if the creation fails*/
+    run->text = text;
+    run->glyphs = glyphs;
+    run->glyph_cnt = 0;
+    run->glyph_dscs = glyph_dscs;
+    run->glyph_dsc_cnt = 0;
+
+    const lv_font_t * font = run->font;
+    int32_t line_height = lv_font_get_line_height(font) + run->line_space;
+    lv_text_attributes_t attributes = {0};
+    attributes.letter_space = run->letter_space;
+    attributes.text_flags = run->flag;
+    attributes.max_width = run->max_width;
+
+    uint32_t remaining_len = run->text_len;
+    uint32_t line_start = 0;
+    uint32_t line_idx = 0;
+    uint32_t line_end;
+    if(lines) line_end = lines->line_cnt ? lines->lines[1].start : 0;
+    else line_end = lv_text_get_next_line(text, remaining_len, font, NULL, &attributes);
+
+    bool fits = true;
+    int32_t y = 0;
+    while(remaining_len && text[line_start] != '\0' && line_idx < glyph_max && fits) {
+        int32_t x = 0;
+        if(run->align == LV_TEXT_ALIGN_CENTER || run->align == LV_TEXT_ALIGN_RIGHT) {
+            int32_t line_width;
+            if(lines) line_width = lines->lines[line_idx].width;
+            else line_width = lv_text_get_width(&text[line_start], line_end - line_start, font, &attributes);
+
+            if(run->align == LV_TEXT_ALIGN_CENTER) x = (run->area_width - line_width) / 2;
+            else x = run->area_width - line_width;
+        }
+
+#if LV_USE_BIDI
+        size_t bidi_size = line_end - line_start;
+        char * bidi_txt = lv_malloc(bidi_size + 1);
+        LV_ASSERT_MALLOC(bidi_txt);
+
+        if(run->has_bided) {
+            lv_memcpy(bidi_txt, &text[line_start], bidi_size);
+        }
+        else {
+            lv_bidi_process_paragraph(text + line_start, bidi_txt, bidi_size, run->base_dir, NULL, 0);
+        }
+#else
+        const char * bidi_txt = text + line_start;
+#endif
+
+        uint32_t line_first_glyph = run->glyph_cnt;
+        uint32_t next_char_offset = 0;
+        while(next_char_offset < remaining_len && next_char_offset < line_end - line_start &&
+              run->glyph_cnt < glyph_max) {
+            uint32_t letter;
+            uint32_t letter_next;
+            lv_text_encoded_letter_next_2(bidi_txt, &letter, &letter_next, &next_char_offset);
+            if(lv_text_is_marker(letter)) continue;
+
+            /*The glyphs are stored in a compact form so they need to fit into their fields*/
+            if(x < INT16_MIN || x > INT16_MAX || y > INT16_MAX) {
+                fits = false;
+                break;
+            }
+
+            run_glyph_dsc_t new_dsc;
+            lv_font_get_glyph_dsc(font, &new_dsc.g, letter, letter_next);
+            new_dsc.g.entry = NULL;
+            new_dsc.letter = letter;
+
+            uint32_t id;
+            for(id = 0; id < run->glyph_dsc_cnt; id++) {
+                if(glyph_dscs[id].letter == letter &&
+                   lv_memcmp(&glyph_dscs[id].g, &new_dsc.g, sizeof(new_dsc.g)) == 0) break;
+            }
+            if(id == run->glyph_dsc_cnt) {
+                if(id >= 256) {
+                    fits = false;
+                    break;
+                }
+                glyph_dscs[id] = new_dsc;
+                run->glyph_dsc_cnt++;
+            }
+
+            run_glyph_t * glyph = &glyphs[run->glyph_cnt];
+            run->glyph_cnt++;
+            glyph->x = (int16_t)x;
+            glyph->y = (int16_t)y;
+            glyph->id = (uint8_t)id;
+            glyph->line_end = 0;
+
+            if(new_dsc.g.adv_w > 0) x += new_dsc.g.adv_w + run->letter_space;
+        }
+        if(run->glyph_cnt > line_first_glyph) glyphs[run->glyph_cnt - 1].line_end = 1;
+
+#if LV_USE_BIDI
+        lv_free(bidi_txt);
+#endif
+
+        /*Go to next line*/
+        remaining_len -= line_end - line_start;
+        line_start = line_end;
+        line_idx++;
+        y += line_height;
+        if(lines) {
+            if(line_idx < lines->line_cnt) line_end = lines->lines[line_idx + 1].start;
+        }
+        else if(remaining_len) {
+            line_end += lv_text_get_next_line(&text[line_start], remaining_len, font, NULL, &attributes);
+        }
+    }
+
+    if(!fits) {
+        LV_PROFILER_DRAW_END;
+        return false;
+    }
+
+    /*Usually there are much less different glyphs than letters*/
+    run_glyph_dsc_t * glyph_dscs_fit = lv_realloc(glyph_dscs, LV_MAX(run->glyph_dsc_cnt, 1) * sizeof(run_glyph_dsc_t));
+    if(glyph_dscs_fit) run->glyph_dscs = glyph_dscs_fit;
+
+    LV_PROFILER_DRAW_END;
+    return true;
+}
+
+static void run_free_cb(run_t * run, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    /*If the creation failed early `text` still points to the text to draw*/
+    if(run->glyphs == NULL) return;
+
+    lv_free((void *)run->text);
+    lv_free(run->glyphs);
+    lv_free(run->glyph_dscs);
+}
+
+static lv_cache_compare_res_t run_compare_cb(const run_t * lhs, const run_t * rhs)
+{
+    if(lhs->hash != rhs->hash) return lhs->hash > rhs->hash ? 1 : -1;
+    if(lhs->text_len != rhs->text_len) return lhs->text_len > rhs->text_len ? 1 : -1;
+    if(lhs->font != rhs->font) return lhs->font > rhs->font ? 1 : -1;
+    if(lhs->fallback_hash != rhs->fallback_hash) return lhs->fallback_hash > rhs->fallback_hash ? 1 : -1;
+    if(lhs->kerning != rhs->kerning) return lhs->kerning > rhs->kerning ? 1 : -1;
+    if(lhs->max_width != rhs->max_width) return lhs->max_width > rhs->max_width ? 1 : -1;
+    if(lhs->area_width != rhs->area_width) return lhs->area_width > rhs->area_width ? 1 : -1;
+    if(lhs->letter_space != rhs->letter_space) return lhs->letter_space > rhs->letter_space ? 1 : -1;
+    if(lhs->line_space != rhs->line_space) return lhs->line_space > rhs->line_space ? 1 : -1;
+    if(lhs->flag != rhs->flag) return lhs->flag > rhs->flag ? 1 : -1;
+    if(lhs->align != rhs->align) return lhs->align > rhs->align ? 1 : -1;
+    if(lhs->base_dir != rhs->base_dir) return lhs->base_dir > rhs->base_dir ? 1 : -1;
+    if(lhs->has_bided != rhs->has_bided) return lhs->has_bided > rhs->has_bided ? 1 : -1;
+
+    int cmp = lv_memcmp(lhs->text, rhs->text, lhs->text_len);
+    if(cmp != 0) return cmp > 0 ? 1 : -1;
+
+    return 0;
+}
+
+static bool run_uses_font(const run_t * run, const lv_font_t * font)
+{
+    if(run->font == font) return true;
+
+    /*The glyphs can come from the fallback fonts too*/
+    uint32_t i;
+    for(i = 0; i < run->glyph_dsc_cnt; i++) {
+        if(run->glyph_dscs[i].g.resolved_font == font) return true;
+    }
+
+    return false;
+}
+#endif /*LV_DRAW_LABEL_RUN_CACHE_CNT > 0*/
+
 void lv_draw_unit_draw_letter(lv_draw_task_t * t, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
                               const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb)
 {
@@ -107,6 +107,10 @@ typedef struct {
     /**Pointer to an externally stored struct where some data can be cached to speed up rendering*/
     lv_draw_label_hint_t * hint;
 
+    /**Pointer to an externally stored line table of the text (see `lv_draw_label_lines_update()`).
+     * If it's valid for the descriptor the line breaks are not searched again.*/
+    lv_draw_label_lines_t * lines;
+
     /* Properties of the letter outlines */
     lv_color_t outline_stroke_color;
     int32_t outline_stroke_width;
@@ -237,6 +241,21 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
 void lv_draw_unit_draw_letter(lv_draw_task_t * t, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
                               const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb);
 
+/**
+ * Drop the cached glyph runs of all texts and invalidate the glyphs cached by the draw units.
+ * The caches store the glyphs of the fonts so it needs to be called when a font is deleted
+ * or changed (e.g. its fallback is set).
+ */
+void lv_draw_label_run_cache_drop(void);
+
+/**
+ * Drop only the cached glyph runs which use a font, e.g. when the size of a scalable font is changed.
+ * Unlike `lv_draw_label_run_cache_drop()` it doesn't invalidate the glyphs cached by the draw units,
+ * so use it only for fonts whose glyphs are not cached by them, like SDF fonts.
+ * @param font          pointer to a font
+ */
+void lv_draw_label_run_cache_drop_font(const lv_font_t * font);
+
 /***********************
  * GLOBAL VARIABLES
  ***********************/
@@ -41,6 +41,37 @@ struct _lv_draw_label_hint_t {
     int32_t coord_y;
 };
 
+/** A line in `lv_draw_label_lines_t`*/
+typedef struct {
+    /** Byte index of the first character of the line*/
+    uint32_t start;
+
+    /** Width of the line in px. Used to align the line to the center or right*/
+    int32_t width;
+} lv_draw_label_line_t;
+
+/** Store the line breaks of a text to not find them again when the text is drawn.
+ * It's valid only for the text, font, width, letter space and flags it was built with,
+ * for other parameters the line breaks are calculated as usual.*/
+struct _lv_draw_label_lines_t {
+    /** `line_cnt + 1` lines. The `start` of the last one is the end of the text*/
+    lv_draw_label_line_t * lines;
+
+    /** Number of lines in the text*/
+    uint32_t line_cnt;
+
+    /** Number of allocated items in `lines`*/
+    uint32_t line_cap;
+
+    /** The parameters the lines were calculated with. `text == NULL` means the lines are invalid.*/
+    const char * text;
+    const lv_font_t * font;
+    uint32_t text_length;
+    int32_t max_width;
+    int32_t letter_space;
+    lv_text_flag_t flag;
+};
+
 struct _lv_draw_glyph_dsc_t {
     /** Depends on `format` field, it could be image source or draw buf of bitmap or vector data. */
     const void * glyph_data;
@@ -54,6 +85,8 @@ struct _lv_draw_glyph_dsc_t {
     lv_opa_t outline_stroke_opa;
     int32_t outline_stroke_width;
     int32_t rotation;
+    int32_t scale_x;           /**< Horizontal scale (256: no scale), only SDF fonts can be scaled*/
+    int32_t scale_y;           /**< Vertical scale (256: no scale), only SDF fonts can be scaled*/
     lv_point_t pivot;          /**< Rotation pivot point associated with total glyph including line_height */
     lv_draw_buf_t * _draw_buf; /**< a shared draw buf for get_bitmap, do not use it directly, use glyph_data instead */
 };
@@ -63,6 +96,58 @@ struct _lv_draw_glyph_dsc_t {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Find the line breaks of a label draw descriptor's text and store them in a line table.
+ * Nothing happens if the table is already valid for the descriptor.
+ * @param lines     pointer to a line table, e.g. stored in a widget
+ * @param dsc       pointer to an initialized label draw descriptor
+ * @param coords    the coordinates of the text, as it will be passed to `lv_draw_label()`
+ */
+void lv_draw_label_lines_update(lv_draw_label_lines_t * lines, const lv_draw_label_dsc_t * dsc,
+                                const lv_area_t * coords);
+
+/**
+ * Update a line table after its text was edited. Only the lines of the changed paragraph are found again,
+ * the next ones are only moved. If the table was not valid, it remains invalid.
+ * @param lines     pointer to a line table which was valid for the text before the edit
+ * @param text      the edited text. Can be reallocated since the last update.
+ * @param pos       byte index of the edit
+ * @param diff      `diff > 0`: `diff` bytes were inserted at `pos`, `diff < 0`: `-diff` bytes were removed from `pos`
+ */
+void lv_draw_label_lines_edit(lv_draw_label_lines_t * lines, const char * text, uint32_t pos, int32_t diff);
+
+/**
+ * Get the size of the text from its lines the same way as `lv_text_get_size_attributes()` does
+ * @param lines         pointer to a valid line table
+ * @param line_space    the space between the lines
+ * @param size_res      store the width of the longest line and the height of the text here
+ */
+void lv_draw_label_lines_get_size(const lv_draw_label_lines_t * lines, int32_t line_space, lv_point_t * size_res);
+
+/**
+ * Get the line which contains a byte of the text
+ * @param lines     pointer to a valid line table
+ * @param byte_id   byte index in the text
+ * @return          index of the line. The last line if `byte_id` is after the text.
+ */
+uint32_t lv_draw_label_lines_get_line(const lv_draw_label_lines_t * lines, uint32_t byte_id);
+
+/**
+ * Free the lines of a line table and mark it invalid. Call it when the text changes.
+ * @param lines     pointer to a line table
+ */
+void lv_draw_label_lines_reset(lv_draw_label_lines_t * lines);
+
+/**
+ * Create the cache of the shaped text runs
+ */
+void lv_draw_label_run_cache_init(void);
+
+/**
+ * Free the cache of the shaped text runs
+ */
+void lv_draw_label_run_cache_deinit(void);
+
 /**********************
  *      MACROS
  **********************/
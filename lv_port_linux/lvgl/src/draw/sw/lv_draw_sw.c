@@ -107,6 +107,11 @@ void lv_draw_sw_init(void)
     else {
         tvg_engine_init(TVG_ENGINE_SW, 0);
     }
+    lv_draw_sw_vector_init();
+#endif
+
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE > 0
+    lv_draw_sw_glyph_atlas_init();
 #endif
 
     lv_ll_init(&LV_GLOBAL_DEFAULT()->draw_sw_blend_handler_ll, sizeof(lv_draw_sw_custom_blend_handler_t));
@@ -115,9 +120,14 @@ void lv_draw_sw_init(void)
 void lv_draw_sw_deinit(void)
 {
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+    lv_draw_sw_vector_deinit();
     tvg_engine_term(TVG_ENGINE_SW);
 #endif
 
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE > 0
+    lv_draw_sw_glyph_atlas_deinit();
+#endif
+
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_deinit();
 #endif
@@ -18,21 +18,51 @@
 
 #endif
 
+#if LV_USE_FONT_SDF
+    #include "../../font/lv_font_sdf_private.h"
+    #include "../../stdlib/lv_mem.h"
+#endif
+
 #if LV_USE_DRAW_SW
 
 #include "../../display/lv_display.h"
 #include "../../misc/lv_math.h"
 #include "../../misc/lv_assert.h"
-#include "../../misc/lv_area.h"
+#include "../../misc/lv_area_private.h"
 #include "../../misc/lv_style.h"
 #include "../../font/lv_font.h"
 #include "../../core/lv_refr_private.h"
 #include "../../stdlib/lv_string.h"
 
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE > 0
+    #include "lv_draw_sw_private.h"
+    #include "../../core/lv_global.h"
+    #include "../../font/lv_font_fmt_txt.h"
+
+    #define STB_RECT_PACK_IMPLEMENTATION
+    #define STBRP_STATIC
+    #include "../../libs/tiny_ttf/stb_rect_pack.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
 
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE > 0
+#define _atlas_state LV_GLOBAL_DEFAULT()->sw_glyph_atlas_state
+
+/*Larger glyphs are not stored in the atlas to not fill it up quickly*/
+#define ATLAS_GLYPH_MAX_SIZE    (LV_DRAW_SW_GLYPH_ATLAS_SIZE / 4)
+
+/*Size of the hash table of the glyphs. It's reset when it's 3/4 full*/
+#define ATLAS_ENTRY_CNT         LV_MAX(LV_DRAW_SW_GLYPH_ATLAS_SIZE * LV_DRAW_SW_GLYPH_ATLAS_SIZE / 64, 16)
+#endif
+
+#if LV_USE_FONT_SDF
+/*Transformed SDF glyphs are rendered in bands of at most this many pixels*/
+#define SDF_MASK_MAX_SIZE       4096
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -46,6 +76,13 @@ typedef struct {
 
 #endif /* LV_USE_FREETYPE && LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG */
 
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE > 0
+typedef struct {
+    stbrp_context ctx;
+    stbrp_node nodes[LV_DRAW_SW_GLYPH_ATLAS_SIZE];
+} glyph_packer_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -60,6 +97,20 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ draw_letter_cb(lv_draw_task_t * t, lv_dr
 
 #endif
 
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE > 0
+    static lv_draw_sw_glyph_atlas_t * atlas_take(lv_draw_task_t * t);
+    static void atlas_give_back(lv_draw_sw_glyph_atlas_t * atlas);
+    static lv_draw_sw_glyph_atlas_t * atlas_find(lv_draw_task_t * t);
+    static void atlas_reset(lv_draw_sw_glyph_atlas_t * atlas);
+    static const uint8_t * atlas_get_glyph(lv_draw_sw_glyph_atlas_t * atlas, lv_draw_glyph_dsc_t * dsc,
+                                           int32_t * stride);
+    static bool atlas_draw_glyph(lv_draw_task_t * t, lv_draw_sw_glyph_atlas_t * atlas, lv_draw_glyph_dsc_t * dsc);
+#endif
+
+#if LV_USE_FONT_SDF
+    static void draw_letter_sdf(lv_draw_task_t * t, lv_draw_glyph_dsc_t * dsc);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -76,6 +127,31 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ draw_letter_cb(lv_draw_task_t * t, lv_dr
  *   GLOBAL FUNCTIONS
  **********************/
 
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE > 0
+void lv_draw_sw_glyph_atlas_init(void)
+{
+    lv_memzero(&_atlas_state, sizeof(_atlas_state));
+#if LV_USE_OS
+    lv_mutex_init(&_atlas_state.lock);
+#endif
+}
+
+void lv_draw_sw_glyph_atlas_deinit(void)
+{
+    for(uint32_t i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        lv_draw_sw_glyph_atlas_t * atlas = &_atlas_state.atlases[i];
+        lv_free(atlas->buf);
+        lv_free(atlas->packer);
+        lv_free(atlas->entries);
+    }
+
+#if LV_USE_OS
+    lv_mutex_delete(&_atlas_state.lock);
+#endif
+    lv_memzero(&_atlas_state, sizeof(_atlas_state));
+}
+#endif
+
 void lv_draw_sw_letter(lv_draw_task_t * t, const lv_draw_letter_dsc_t * dsc, const lv_area_t * coords)
 {
     if(dsc->opa <= LV_OPA_MIN)
@@ -89,6 +165,8 @@ void lv_draw_sw_letter(lv_draw_task_t * t, const lv_draw_letter_dsc_t * dsc, con
     glyph_dsc.bg_coords = NULL;
     glyph_dsc.color = dsc->color;
     glyph_dsc.rotation = dsc->rotation;
+    glyph_dsc.scale_x = dsc->scale_x;
+    glyph_dsc.scale_y = dsc->scale_y;
     glyph_dsc.pivot = dsc->pivot;
 
     lv_draw_unit_draw_letter(t, &glyph_dsc, &(lv_point_t) {
@@ -118,7 +196,16 @@ void lv_draw_sw_label(lv_draw_task_t * t, const lv_draw_label_dsc_t * dsc, const
     }
 #endif
 
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE > 0
+    /*Only labels use the atlas, so `lv_draw_sw_letter` keeps rendering the glyphs one by one*/
+    lv_draw_sw_glyph_atlas_t * atlas = atlas_take(t);
+#endif
+
     lv_draw_label_iterate_characters(t, dsc, coords, draw_letter_cb);
+
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE > 0
+    if(atlas) atlas_give_back(atlas);
+#endif
     LV_PROFILER_DRAW_END;
 }
 
@@ -129,6 +216,13 @@ void lv_draw_sw_label(lv_draw_task_t * t, const lv_draw_label_dsc_t * dsc, const
 static void LV_ATTRIBUTE_FAST_MEM draw_letter_cb(lv_draw_task_t * t, lv_draw_glyph_dsc_t * glyph_draw_dsc,
                                                  lv_draw_fill_dsc_t * fill_draw_dsc, const lv_area_t * fill_area)
 {
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE > 0
+    if(glyph_draw_dsc && fill_draw_dsc == NULL) {
+        lv_draw_sw_glyph_atlas_t * atlas = atlas_find(t);
+        if(atlas && atlas_draw_glyph(t, atlas, glyph_draw_dsc)) return;
+    }
+#endif
+
     if(glyph_draw_dsc) {
         switch(glyph_draw_dsc->format) {
             case LV_FONT_GLYPH_FORMAT_NONE: {
@@ -150,6 +244,15 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_cb(lv_draw_task_t * t, lv_draw_gly
             case LV_FONT_GLYPH_FORMAT_A4:
             case LV_FONT_GLYPH_FORMAT_A8:
             case LV_FONT_GLYPH_FORMAT_IMAGE: {
+#if LV_USE_FONT_SDF
+                    /*SDF glyphs are rendered directly with the transformation to keep them sharp*/
+                    if(lv_font_is_sdf(glyph_draw_dsc->g->resolved_font) &&
+                       (glyph_draw_dsc->rotation % 3600 != 0 ||
+                        glyph_draw_dsc->scale_x != LV_SCALE_NONE || glyph_draw_dsc->scale_y != LV_SCALE_NONE)) {
+                        draw_letter_sdf(t, glyph_draw_dsc);
+                        break;
+                    }
+#endif
                     if(glyph_draw_dsc->rotation % 3600 == 0 && glyph_draw_dsc->format != LV_FONT_GLYPH_FORMAT_IMAGE) {
                         lv_area_t mask_area = *glyph_draw_dsc->letter_coords;
 
@@ -224,6 +327,252 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_cb(lv_draw_task_t * t, lv_draw_gly
     }
 }
 
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE > 0
+
+static lv_draw_sw_glyph_atlas_t * atlas_take(lv_draw_task_t * t)
+{
+    lv_draw_sw_glyph_atlas_t * atlas = NULL;
+
+#if LV_USE_OS
+    lv_mutex_lock(&_atlas_state.lock);
+#endif
+    for(uint32_t i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        if(_atlas_state.atlases[i].task == NULL) {
+            atlas = &_atlas_state.atlases[i];
+            atlas->task = t;
+            break;
+        }
+    }
+#if LV_USE_OS
+    lv_mutex_unlock(&_atlas_state.lock);
+#endif
+
+    if(atlas == NULL) return NULL;
+
+    if(atlas->buf == NULL) {
+        atlas->buf = lv_malloc(LV_DRAW_SW_GLYPH_ATLAS_SIZE * LV_DRAW_SW_GLYPH_ATLAS_SIZE);
+        atlas->packer = lv_malloc(sizeof(glyph_packer_t));
+        atlas->entries = lv_malloc(ATLAS_ENTRY_CNT * sizeof(lv_draw_sw_glyph_atlas_entry_t));
+        if(atlas->buf == NULL || atlas->packer == NULL || atlas->entries == NULL) {
+            LV_LOG_WARN("Couldn't allocate the glyph atlas");
+            lv_free(atlas->buf);
+            lv_free(atlas->packer);
+            lv_free(atlas->entries);
+            atlas->buf = NULL;
+            atlas->packer = NULL;
+            atlas->entries = NULL;
+            atlas_give_back(atlas);
+            return NULL;
+        }
+        atlas_reset(atlas);
+    }
+    else if(atlas->font_gen != LV_GLOBAL_DEFAULT()->draw_label_font_gen) {
+        /*A font was deleted, so its glyphs can't be identified by the font's address anymore*/
+        atlas_reset(atlas);
+    }
+
+    return atlas;
+}
+
+static void atlas_give_back(lv_draw_sw_glyph_atlas_t * atlas)
+{
+#if LV_USE_OS
+    lv_mutex_lock(&_atlas_state.lock);
+#endif
+    atlas->task = NULL;
+#if LV_USE_OS
+    lv_mutex_unlock(&_atlas_state.lock);
+#endif
+}
+
+static lv_draw_sw_glyph_atlas_t * atlas_find(lv_draw_task_t * t)
+{
+    lv_draw_sw_glyph_atlas_t * atlas = NULL;
+
+    /*`task` is written by the other draw units too while they take or give back an atlas*/
+#if LV_USE_OS
+    lv_mutex_lock(&_atlas_state.lock);
+#endif
+    for(uint32_t i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        if(_atlas_state.atlases[i].task == t) {
+            atlas = &_atlas_state.atlases[i];
+            break;
+        }
+    }
+#if LV_USE_OS
+    lv_mutex_unlock(&_atlas_state.lock);
+#endif
+
+    return atlas;
+}
+
+static void atlas_reset(lv_draw_sw_glyph_atlas_t * atlas)
+{
+    glyph_packer_t * packer = atlas->packer;
+    stbrp_init_target(&packer->ctx, LV_DRAW_SW_GLYPH_ATLAS_SIZE, LV_DRAW_SW_GLYPH_ATLAS_SIZE,
+                      packer->nodes, LV_DRAW_SW_GLYPH_ATLAS_SIZE);
+    lv_memzero(atlas->entries, ATLAS_ENTRY_CNT * sizeof(lv_draw_sw_glyph_atlas_entry_t));
+    atlas->entry_cnt = 0;
+    atlas->font_gen = LV_GLOBAL_DEFAULT()->draw_label_font_gen;
+}
+
+/**
+ * Get the A8 pixels of a glyph which stay valid until the atlas is reset.
+ * Static A8 bitmaps are used directly, the glyphs of the built-in format fonts are rendered to the atlas.
+ * @param atlas     pointer to the atlas of the draw task
+ * @param dsc       the glyph to get
+ * @param stride    store the stride of the returned pixels here
+ * @return          pointer to the top left pixel of the glyph or NULL if it can't be stored
+ */
+static const uint8_t * atlas_get_glyph(lv_draw_sw_glyph_atlas_t * atlas, lv_draw_glyph_dsc_t * dsc,
+                                       int32_t * stride)
+{
+    lv_font_glyph_dsc_t * g = dsc->g;
+    const lv_font_t * font = g->resolved_font;
+
+    if(lv_font_has_static_bitmap(font) && g->format == LV_FONT_GLYPH_FORMAT_A8) {
+        g->req_raw_bitmap = 1;
+        *stride = g->stride ? g->stride : g->box_w;
+        return lv_font_get_glyph_static_bitmap(g);
+    }
+
+    /*Only the bitmaps of the built-in format depend on nothing else but the font and the glyph index*/
+    if(font->get_glyph_bitmap != lv_font_get_bitmap_fmt_txt || font->subpx != LV_FONT_SUBPX_NONE) return NULL;
+    if(g->box_w > ATLAS_GLYPH_MAX_SIZE || g->box_h > ATLAS_GLYPH_MAX_SIZE) return NULL;
+
+    uint32_t gid = g->gid.index;
+    uint32_t hash = ((uint32_t)(lv_uintptr_t)font ^ (gid * 2654435761u)) % ATLAS_ENTRY_CNT;
+    uint32_t i = hash;
+    while(atlas->entries[i].font) {
+        if(atlas->entries[i].font == font && atlas->entries[i].gid == gid) {
+            *stride = LV_DRAW_SW_GLYPH_ATLAS_SIZE;
+            return &atlas->buf[atlas->entries[i].y * LV_DRAW_SW_GLYPH_ATLAS_SIZE + atlas->entries[i].x];
+        }
+        i = (i + 1) % ATLAS_ENTRY_CNT;
+    }
+
+    glyph_packer_t * packer = atlas->packer;
+    stbrp_rect rect;
+    lv_memzero(&rect, sizeof(rect));
+    rect.w = g->box_w;
+    rect.h = g->box_h;
+    if(atlas->entry_cnt < ATLAS_ENTRY_CNT * 3 / 4) stbrp_pack_rects(&packer->ctx, &rect, 1);
+
+    if(!rect.was_packed) {
+        /*The atlas is full. The glyphs are already blended so nothing refers to it, just start over.*/
+        atlas_reset(atlas);
+        stbrp_pack_rects(&packer->ctx, &rect, 1);
+        if(!rect.was_packed) return NULL;
+        i = hash;
+    }
+
+    const lv_draw_buf_t * draw_buf = lv_font_get_glyph_bitmap(g, dsc->_draw_buf);
+    if(draw_buf == NULL) return NULL;
+
+    uint8_t * dest = &atlas->buf[rect.y * LV_DRAW_SW_GLYPH_ATLAS_SIZE + rect.x];
+    const uint8_t * src = draw_buf->data;
+    for(int32_t y = 0; y < g->box_h; y++) {
+        lv_memcpy(dest, src, g->box_w);
+        dest += LV_DRAW_SW_GLYPH_ATLAS_SIZE;
+        src += draw_buf->header.stride;
+    }
+
+    atlas->entries[i].font = font;
+    atlas->entries[i].gid = gid;
+    atlas->entries[i].x = (uint16_t)rect.x;
+    atlas->entries[i].y = (uint16_t)rect.y;
+    atlas->entry_cnt++;
+
+    *stride = LV_DRAW_SW_GLYPH_ATLAS_SIZE;
+    return &atlas->buf[rect.y * LV_DRAW_SW_GLYPH_ATLAS_SIZE + rect.x];
+}
+
+/**
+ * Blend a glyph using its pixels in the atlas as mask directly, without rendering it to a draw buffer.
+ * @param t         pointer to a draw task
+ * @param atlas     pointer to the atlas of the draw task
+ * @param dsc       the glyph to draw
+ * @return          true: the glyph was drawn (or it's invisible); false: it needs to be drawn normally
+ */
+static bool atlas_draw_glyph(lv_draw_task_t * t, lv_draw_sw_glyph_atlas_t * atlas, lv_draw_glyph_dsc_t * dsc)
+{
+    if(dsc->format < LV_FONT_GLYPH_FORMAT_A1 || dsc->format > LV_FONT_GLYPH_FORMAT_A8) return false;
+    if(dsc->rotation % 3600 != 0) return false;
+    if(dsc->scale_x != LV_SCALE_NONE || dsc->scale_y != LV_SCALE_NONE) return false;
+
+    lv_area_t area;
+    if(!lv_area_intersect(&area, dsc->letter_coords, &t->clip_area)) return true;
+
+    int32_t stride;
+    const uint8_t * src = atlas_get_glyph(atlas, dsc, &stride);
+    if(src == NULL) return false;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.mask_buf = src;
+    blend_dsc.mask_area = dsc->letter_coords;
+    blend_dsc.mask_stride = stride;
+    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+    blend_dsc.blend_area = &area;
+    lv_draw_sw_blend(t, &blend_dsc);
+
+    return true;
+}
+
+#endif /*LV_DRAW_SW_GLYPH_ATLAS_SIZE > 0*/
+
+#if LV_USE_FONT_SDF
+
+/**
+ * Render a rotated and/or scaled glyph of an SDF font from its distance field and blend it.
+ * It's sampled at the final resolution so it's as sharp as a not transformed glyph.
+ * @param t         pointer to a draw task
+ * @param dsc       the glyph to draw
+ */
+static void draw_letter_sdf(lv_draw_task_t * t, lv_draw_glyph_dsc_t * dsc)
+{
+    const lv_font_glyph_dsc_t * g = dsc->g;
+    const lv_area_t * letter_coords = dsc->letter_coords;
+
+    /*The pen position on the base line and the pivot are the same as for the image based glyphs*/
+    lv_point_t pen = {letter_coords->x1 - g->ofs_x, letter_coords->y1 + g->box_h + g->ofs_y};
+    lv_point_t pivot = {letter_coords->x1 + dsc->pivot.x, pen.y};
+
+    lv_area_t area;
+    lv_font_sdf_get_transformed_area(g, &pen, &pivot, dsc->rotation, dsc->scale_x, dsc->scale_y, &area);
+    if(!lv_area_intersect(&area, &area, &t->clip_area)) return;
+
+    int32_t w = lv_area_get_width(&area);
+    int32_t band_h = LV_CLAMP(1, SDF_MASK_MAX_SIZE / w, lv_area_get_height(&area));
+    uint8_t * mask_buf = lv_malloc((size_t)w * band_h);
+    LV_ASSERT_MALLOC(mask_buf);
+    if(mask_buf == NULL) return;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.mask_buf = mask_buf;
+    blend_dsc.mask_stride = w;
+    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+
+    lv_area_t band = area;
+    for(band.y1 = area.y1; band.y1 <= area.y2; band.y1 += band_h) {
+        band.y2 = LV_MIN(band.y1 + band_h - 1, area.y2);
+        lv_font_sdf_render_transformed(g, &pen, &pivot, dsc->rotation, dsc->scale_x, dsc->scale_y,
+                                       &band, mask_buf, w);
+        blend_dsc.mask_area = &band;
+        blend_dsc.blend_area = &band;
+        lv_draw_sw_blend(t, &blend_dsc);
+    }
+
+    lv_free(mask_buf);
+}
+
+#endif /*LV_USE_FONT_SDF*/
+
 #if LV_USE_FREETYPE && LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
 
 /*
@@ -50,6 +50,50 @@ struct _lv_draw_sw_unit_t {
 #endif
 };
 
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+typedef struct {
+    void * canvas;              /**< ThorVG SW canvas, re-targeted for every vector task*/
+    lv_draw_buf_t * scratch;    /**< ARGB8888 buffer to render to if the layer is not 32 bit*/
+    bool busy;                  /**< The canvas is being used by a vector task*/
+    lv_cache_t * shapes;        /**< Shapes bound to this canvas, keyed by the content and style of their path*/
+    uint32_t draw_id;           /**< Incremented for every vector task drawn on the canvas*/
+    uint32_t shape_hit_cnt;     /**< Number of shapes reused from `shapes`*/
+    uint32_t shape_miss_cnt;    /**< Number of shapes built because they weren't in `shapes`*/
+} lv_draw_sw_vector_canvas_t;
+
+typedef struct {
+    lv_draw_sw_vector_canvas_t canvases[LV_DRAW_SW_DRAW_UNIT_CNT];
+#if LV_USE_OS
+    lv_mutex_t lock;
+#endif
+} lv_draw_sw_vector_state_t;
+#endif
+
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE > 0
+typedef struct {
+    const lv_font_t * font;     /**< The resolved font of the glyph, NULL if the entry is free*/
+    uint32_t gid;               /**< Glyph index in the font*/
+    uint16_t x;                 /**< Position of the glyph in the atlas*/
+    uint16_t y;
+} lv_draw_sw_glyph_atlas_entry_t;
+
+typedef struct {
+    lv_draw_task_t * task;      /**< The label task using the atlas, NULL if it's free*/
+    uint8_t * buf;              /**< A8 atlas of `LV_DRAW_SW_GLYPH_ATLAS_SIZE` x `LV_DRAW_SW_GLYPH_ATLAS_SIZE` pixels*/
+    void * packer;              /**< Rectangle packer to allocate the place of the glyphs in `buf`*/
+    lv_draw_sw_glyph_atlas_entry_t * entries;  /**< Hash table of the glyphs in the atlas*/
+    uint32_t entry_cnt;
+    uint32_t font_gen;          /**< Font generation of the glyphs, see `lv_draw_label_run_cache_drop`*/
+} lv_draw_sw_glyph_atlas_t;
+
+typedef struct {
+    lv_draw_sw_glyph_atlas_t atlases[LV_DRAW_SW_DRAW_UNIT_CNT];
+#if LV_USE_OS
+    lv_mutex_t lock;
+#endif
+} lv_draw_sw_glyph_atlas_state_t;
+#endif
+
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
 typedef struct {
     uint8_t cache[LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE];
@@ -62,6 +106,30 @@ typedef struct {
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+/**
+ * Initialize the retained ThorVG canvases of the vector renderer
+ */
+void lv_draw_sw_vector_init(void);
+
+/**
+ * Free the retained ThorVG canvases
+ */
+void lv_draw_sw_vector_deinit(void);
+#endif
+
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE > 0
+/**
+ * Initialize the glyph atlases of the label renderer
+ */
+void lv_draw_sw_glyph_atlas_init(void);
+
+/**
+ * Free the glyph atlases of the label renderer
+ */
+void lv_draw_sw_glyph_atlas_deinit(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
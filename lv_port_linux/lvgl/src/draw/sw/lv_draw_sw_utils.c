@@ -64,6 +64,11 @@
     #define LV_DRAW_SW_ROTATE270_L8(...) LV_RESULT_INVALID
 #endif
 
+/*Rotating by 90 or 270 degrees reads the source column by column. It's done in
+ *square tiles so that the source lines of a tile are still cached when the next
+ *column reads them again and the destination lines are written in short runs.*/
+#define ROTATE_TILE_SIZE 32
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -360,12 +365,18 @@ static void rotate270_argb8888(const uint32_t * src, uint32_t * dst, int32_t src
     src_stride /= sizeof(uint32_t);
     dst_stride /= sizeof(uint32_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        const int32_t y_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            const int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < x_end; ++x) {
+                uint32_t * dst_line = dst + x * dst_stride;
+                const uint32_t * src_px = src + ty * src_stride + x;
+                for(int32_t y = ty; y < y_end; ++y) {
+                    dst_line[src_height - y - 1] = *src_px;
+                    src_px += src_stride;
+                }
+            }
         }
     }
 }
@@ -400,12 +411,18 @@ static void rotate90_argb8888(const uint32_t * src, uint32_t * dst, int32_t src_
     src_stride /= sizeof(uint32_t);
     dst_stride /= sizeof(uint32_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        const int32_t y_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            const int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < x_end; ++x) {
+                uint32_t * dst_line = dst + (src_width - x - 1) * dst_stride;
+                const uint32_t * src_px = src + ty * src_stride + x;
+                for(int32_t y = ty; y < y_end; ++y) {
+                    dst_line[y] = *src_px;
+                    src_px += src_stride;
+                }
+            }
         }
     }
 }
@@ -422,13 +439,21 @@ static void rotate90_rgb888(const uint8_t * src, uint8_t * dst, int32_t src_widt
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        for(int32_t y = 0; y < src_height; ++y) {
-            int32_t srcIndex = y * src_stride + x * 3;
-            int32_t dstIndex = (src_width - x - 1) * dst_stride + y * 3;
-            dst[dstIndex] = src[srcIndex];       /*Red*/
-            dst[dstIndex + 1] = src[srcIndex + 1]; /*Green*/
-            dst[dstIndex + 2] = src[srcIndex + 2]; /*Blue*/
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        const int32_t y_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            const int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < x_end; ++x) {
+                uint8_t * dst_line = dst + (src_width - x - 1) * dst_stride;
+                const uint8_t * src_px = src + ty * src_stride + x * 3;
+                for(int32_t y = ty; y < y_end; ++y) {
+                    uint8_t * dst_px = dst_line + y * 3;
+                    dst_px[0] = src_px[0];     /*Red*/
+                    dst_px[1] = src_px[1];     /*Green*/
+                    dst_px[2] = src_px[2];     /*Blue*/
+                    src_px += src_stride;
+                }
+            }
         }
     }
 }
@@ -451,20 +476,29 @@ static void rotate180_rgb888(const uint8_t * src, uint8_t * dst, int32_t width,
     }
 }
 
-static void rotate270_rgb888(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
+static void rotate270_rgb888(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                             int32_t src_stride,
                              int32_t dst_stride)
 {
     if(LV_RESULT_OK == LV_DRAW_SW_ROTATE270_RGB888(src, dst, src_width, src_height, src_stride, dst_stride)) {
         return ;
     }
 
-    for(int32_t x = 0; x < width; ++x) {
-        for(int32_t y = 0; y < height; ++y) {
-            int32_t srcIndex = y * src_stride + x * 3;
-            int32_t dstIndex = x * dst_stride + (height - y - 1) * 3;
-            dst[dstIndex] = src[srcIndex];       /*Red*/
-            dst[dstIndex + 1] = src[srcIndex + 1]; /*Green*/
-            dst[dstIndex + 2] = src[srcIndex + 2]; /*Blue*/
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        const int32_t y_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            const int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < x_end; ++x) {
+                uint8_t * dst_line = dst + x * dst_stride;
+                const uint8_t * src_px = src + ty * src_stride + x * 3;
+                for(int32_t y = ty; y < y_end; ++y) {
+                    uint8_t * dst_px = dst_line + (src_height - y - 1) * 3;
+                    dst_px[0] = src_px[0];     /*Red*/
+                    dst_px[1] = src_px[1];     /*Green*/
+                    dst_px[2] = src_px[2];     /*Blue*/
+                    src_px += src_stride;
+                }
+            }
         }
     }
 }
@@ -484,12 +518,18 @@ static void rotate270_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_w
     src_stride /= sizeof(uint16_t);
     dst_stride /= sizeof(uint16_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        const int32_t y_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            const int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < x_end; ++x) {
+                uint16_t * dst_line = dst + x * dst_stride;
+                const uint16_t * src_px = src + ty * src_stride + x;
+                for(int32_t y = ty; y < y_end; ++y) {
+                    dst_line[src_height - y - 1] = *src_px;
+                    src_px += src_stride;
+                }
+            }
         }
     }
 }
@@ -524,12 +564,18 @@ static void rotate90_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_wi
     src_stride /= sizeof(uint16_t);
     dst_stride /= sizeof(uint16_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        const int32_t y_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            const int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < x_end; ++x) {
+                uint16_t * dst_line = dst + (src_width - x - 1) * dst_stride;
+                const uint16_t * src_px = src + ty * src_stride + x;
+                for(int32_t y = ty; y < y_end; ++y) {
+                    dst_line[y] = *src_px;
+                    src_px += src_stride;
+                }
+            }
         }
     }
 }
@@ -547,12 +593,18 @@ static void rotate90_l8(const uint8_t * src, uint8_t * dst, int32_t src_width, i
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        const int32_t y_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            const int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < x_end; ++x) {
+                uint8_t * dst_line = dst + (src_width - x - 1) * dst_stride;
+                const uint8_t * src_px = src + ty * src_stride + x;
+                for(int32_t y = ty; y < y_end; ++y) {
+                    dst_line[y] = *src_px;
+                    src_px += src_stride;
+                }
+            }
         }
     }
 }
@@ -581,12 +633,18 @@ static void rotate270_l8(const uint8_t * src, uint8_t * dst, int32_t src_width,
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        const int32_t y_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            const int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < x_end; ++x) {
+                uint8_t * dst_line = dst + x * dst_stride;
+                const uint8_t * src_px = src + ty * src_stride + x;
+                for(int32_t y = ty; y < y_end; ++y) {
+                    dst_line[src_height - y - 1] = *src_px;
+                    src_px += src_stride;
+                }
+            }
         }
     }
 }
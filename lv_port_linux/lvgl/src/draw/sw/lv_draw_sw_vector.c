@@ -9,7 +9,7 @@
 #include "../lv_image_decoder_private.h"
 #include "../lv_draw_vector_private.h"
 #include "../lv_draw_private.h"
-#include "lv_draw_sw.h"
+#include "lv_draw_sw_private.h"
 
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
 #if LV_USE_THORVG_EXTERNAL
@@ -18,13 +18,15 @@
     #include "../../libs/thorvg/thorvg_capi.h"
 #endif
 #include "../../stdlib/lv_string.h"
+#include "../../core/lv_global.h"
+#include "../../misc/cache/lv_cache.h"
+#include "../../misc/lv_area_private.h"
 #include "blend/lv_draw_sw_blend_private.h"
-#include "blend/lv_draw_sw_blend_to_rgb565.h"
-#include "blend/lv_draw_sw_blend_to_rgb888.h"
 
 /*********************
  *      DEFINES
  *********************/
+#define _vector_state LV_GLOBAL_DEFAULT()->sw_vector_state
 
 /**********************
  *      TYPEDEFS
@@ -49,11 +51,58 @@ typedef struct {
     int32_t translate_x;
     int32_t translate_y;
     lv_opa_t opa;
+    lv_draw_sw_vector_canvas_t * slot;
 } _tvg_draw_state;
+
+/**
+ * Everything that is set on a retained shape besides its geometry and transformation.
+ * It's zeroed and filled field by field so that it can be hashed and compared as bytes.
+ */
+typedef struct {
+    lv_vector_draw_style_t fill_style;
+    lv_color32_t fill_color;
+    lv_opa_t fill_opa;
+    lv_vector_fill_t fill_rule;
+    lv_vector_gradient_t fill_gradient;
+    lv_matrix_t fill_matrix;
+    lv_vector_draw_style_t stroke_style;
+    lv_color32_t stroke_color;
+    lv_opa_t stroke_opa;
+    float stroke_width;
+    lv_vector_stroke_cap_t stroke_cap;
+    lv_vector_stroke_join_t stroke_join;
+    uint16_t stroke_miter_limit;
+    lv_vector_gradient_t stroke_gradient;
+    lv_matrix_t stroke_matrix;
+    lv_vector_blend_t blend_mode;
+} _tvg_shape_style_t;
+
+/**
+ * A ThorVG shape retained by a canvas. Only its transformation changes when it's drawn again.
+ * When used as a search key `ops`, `points` and `dashes` point into the task to draw.
+ */
+typedef struct {
+    uint32_t hash;
+    uint32_t op_cnt;
+    uint32_t point_cnt;
+    uint32_t dash_cnt;
+    lv_vector_path_op_t * ops;
+    lv_fpoint_t * points;
+    float * dashes;
+    _tvg_shape_style_t style;
+    uint32_t draw_id;       /**< `draw_id` of the canvas when the shape was last pushed*/
+    Tvg_Paint * shape;
+    Tvg_Paint * holder;     /**< Empty shape which keeps a reference to `shape`*/
+} _tvg_shape_item_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
+static bool shape_create_cb(_tvg_shape_item_t * item, void * user_data);
+static void shape_free_cb(_tvg_shape_item_t * item, void * user_data);
+static lv_cache_compare_res_t shape_compare_cb(const _tvg_shape_item_t * lhs, const _tvg_shape_item_t * rhs);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -96,30 +145,29 @@ static void _set_paint_matrix(Tvg_Paint * obj, const Tvg_Matrix * m)
     tvg_paint_set_transform(obj, m);
 }
 
-static void _set_paint_shape(Tvg_Paint * obj, const lv_vector_path_t * p)
+static void _set_paint_shape(Tvg_Paint * obj, const lv_vector_path_op_t * op, uint32_t size,
+                             const lv_fpoint_t * points)
 {
     uint32_t pidx = 0;
-    lv_vector_path_op_t * op = lv_array_front(&p->ops);
-    uint32_t size = lv_array_size(&p->ops);
     for(uint32_t i = 0; i < size; i++) {
         switch(op[i]) {
             case LV_VECTOR_PATH_OP_MOVE_TO: {
-                    lv_fpoint_t * pt = lv_array_at(&p->points, pidx);
+                    const lv_fpoint_t * pt = &points[pidx];
                     tvg_shape_move_to(obj, pt->x, pt->y);
                     pidx += 1;
                 }
                 break;
             case LV_VECTOR_PATH_OP_LINE_TO: {
-                    lv_fpoint_t * pt = lv_array_at(&p->points, pidx);
+                    const lv_fpoint_t * pt = &points[pidx];
                     tvg_shape_line_to(obj, pt->x, pt->y);
                     pidx += 1;
                 }
                 break;
             case LV_VECTOR_PATH_OP_QUAD_TO: {
-                    lv_fpoint_t * pt1 = lv_array_at(&p->points, pidx);
-                    lv_fpoint_t * pt2 = lv_array_at(&p->points, pidx + 1);
+                    const lv_fpoint_t * pt1 = &points[pidx];
+                    const lv_fpoint_t * pt2 = &points[pidx + 1];
 
-                    lv_fpoint_t * last_pt = lv_array_at(&p->points, pidx - 1);
+                    const lv_fpoint_t * last_pt = &points[pidx - 1];
 
                     lv_fpoint_t cp[2];
                     cp[0].x = (last_pt->x + 2 * pt1->x) * (1.0f / 3.0f);
@@ -132,9 +180,9 @@ static void _set_paint_shape(Tvg_Paint * obj, const lv_vector_path_t * p)
                 }
                 break;
             case LV_VECTOR_PATH_OP_CUBIC_TO: {
-                    lv_fpoint_t * pt1 = lv_array_at(&p->points, pidx);
-                    lv_fpoint_t * pt2 = lv_array_at(&p->points, pidx + 1);
-                    lv_fpoint_t * pt3 = lv_array_at(&p->points, pidx + 2);
+                    const lv_fpoint_t * pt1 = &points[pidx];
+                    const lv_fpoint_t * pt2 = &points[pidx + 1];
+                    const lv_fpoint_t * pt3 = &points[pidx + 2];
 
                     tvg_shape_cubic_to(obj, pt1->x, pt1->y, pt2->x, pt2->y, pt3->x, pt3->y);
                     pidx += 3;
@@ -148,6 +196,92 @@ static void _set_paint_shape(Tvg_Paint * obj, const lv_vector_path_t * p)
     }
 }
 
+static Tvg_Canvas * _canvas_take(lv_draw_sw_vector_canvas_t ** slot)
+{
+    *slot = NULL;
+
+#if LV_USE_OS
+    lv_mutex_lock(&_vector_state.lock);
+#endif
+    for(uint32_t i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        lv_draw_sw_vector_canvas_t * c = &_vector_state.canvases[i];
+        if(!c->busy) {
+            c->busy = true;
+            *slot = c;
+            break;
+        }
+    }
+#if LV_USE_OS
+    lv_mutex_unlock(&_vector_state.lock);
+#endif
+
+    /*All retained canvases are in use, fall back to a temporary one*/
+    if(*slot == NULL) return tvg_swcanvas_create();
+
+    if((*slot)->canvas == NULL) (*slot)->canvas = tvg_swcanvas_create();
+    return (*slot)->canvas;
+}
+
+/**
+ * Get the part of the clip area which can be touched by the vector tasks,
+ * i.e. the clip area limited to the union of the tasks' scissor areas.
+ */
+static bool _get_touched_area(lv_ll_t * task_list, const lv_area_t * clip_area, lv_area_t * touched_area)
+{
+    bool first = true;
+    lv_area_t scissor_union = {0};
+    lv_draw_vector_subtask_t * task;
+    LV_LL_READ(task_list, task) {
+        if(first) {
+            scissor_union = task->ctx.scissor_area;
+            first = false;
+        }
+        else {
+            lv_area_join(&scissor_union, &scissor_union, &task->ctx.scissor_area);
+        }
+    }
+
+    if(first) return false;
+    return lv_area_intersect(touched_area, &scissor_union, clip_area);
+}
+
+/**
+ * Get an ARGB8888 scratch buffer. The buffer of a retained canvas is reused and
+ * only reallocated when it's too small for the requested size.
+ */
+static lv_draw_buf_t * _scratch_get(lv_draw_sw_vector_canvas_t * slot, uint32_t w, uint32_t h)
+{
+    if(slot == NULL) return lv_draw_buf_create(w, h, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+
+    if(slot->scratch) {
+        if(lv_draw_buf_reshape(slot->scratch, LV_COLOR_FORMAT_ARGB8888, w, h, LV_STRIDE_AUTO)) return slot->scratch;
+        lv_draw_buf_destroy(slot->scratch);
+    }
+
+    slot->scratch = lv_draw_buf_create(w, h, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    return slot->scratch;
+}
+
+static void _canvas_give(Tvg_Canvas * canvas, lv_draw_sw_vector_canvas_t * slot)
+{
+    /*Release the pushed shapes and reset the canvas state so that it can be re-targeted.
+     *The retained shapes are kept alive by their holders.*/
+    tvg_canvas_clear(canvas, true);
+
+    if(slot == NULL) {
+        tvg_canvas_destroy(canvas);
+        return;
+    }
+
+#if LV_USE_OS
+    lv_mutex_lock(&_vector_state.lock);
+#endif
+    slot->busy = false;
+#if LV_USE_OS
+    lv_mutex_unlock(&_vector_state.lock);
+#endif
+}
+
 static Tvg_Stroke_Cap lv_stroke_cap_to_tvg(lv_vector_stroke_cap_t cap)
 {
     switch(cap) {
@@ -391,42 +525,123 @@ static void _set_paint_blend_mode(Tvg_Paint * obj, lv_vector_blend_t blend)
     tvg_paint_set_blend_method(obj, lv_blend_to_tvg(blend));
 }
 
-static void _blend_draw_buf(lv_draw_buf_t * draw_buf, const lv_area_t * dst_area, const lv_draw_buf_t * new_buf,
-                            const lv_area_t * src_area)
+static uint32_t _hash_bytes(uint32_t hash, const void * data, size_t len)
 {
-    lv_draw_sw_blend_image_dsc_t fill_dsc;
-    fill_dsc.dest_w = src_area->x2;
-    fill_dsc.dest_h = src_area->y2;
-    fill_dsc.dest_stride = draw_buf->header.stride;
-    fill_dsc.dest_buf = draw_buf->data;
+    /*FNV-1a*/
+    const uint8_t * p = data;
+    for(size_t i = 0; i < len; i++) {
+        hash = (hash ^ p[i]) * 16777619u;
+    }
 
-    fill_dsc.opa = LV_OPA_100;
-    fill_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
-    fill_dsc.src_stride = new_buf->header.stride;
-    fill_dsc.src_color_format = new_buf->header.cf;
-    fill_dsc.src_buf = new_buf->data;
+    return hash;
+}
 
-    fill_dsc.mask_buf = NULL;
-    fill_dsc.mask_stride = 0;
+static void _gradient_key_init(lv_vector_gradient_t * key, const lv_vector_gradient_t * g)
+{
+    key->style = g->style;
+    key->stops_count = LV_MIN(g->stops_count, LV_GRADIENT_MAX_STOPS);
+    for(uint16_t i = 0; i < key->stops_count; i++) {
+        key->stops[i] = g->stops[i];
+    }
+    key->x1 = g->x1;
+    key->y1 = g->y1;
+    key->x2 = g->x2;
+    key->y2 = g->y2;
+    key->cx = g->cx;
+    key->cy = g->cy;
+    key->cr = g->cr;
+    key->spread = g->spread;
+}
 
-    fill_dsc.relative_area = *dst_area;
-    fill_dsc.src_area  = *src_area;
+static void _style_key_init(_tvg_shape_style_t * key, const lv_vector_path_ctx_t * dsc)
+{
+    /*Only the fields used by `_set_paint_fill`, `_set_paint_stroke` and `_set_paint_blend_mode`*/
+    const lv_vector_fill_dsc_t * fill = &dsc->fill_dsc;
+    key->fill_style = fill->style;
+    key->fill_rule = fill->fill_rule;
+    if(fill->style == LV_VECTOR_DRAW_STYLE_GRADIENT) {
+        _gradient_key_init(&key->fill_gradient, &fill->gradient);
+        key->fill_matrix = fill->matrix;
+    }
+    else {
+        key->fill_color = fill->color;
+        key->fill_opa = fill->opa;
+    }
 
-    switch(draw_buf->header.cf) {
-#if LV_DRAW_SW_SUPPORT_RGB565
-        case LV_COLOR_FORMAT_RGB565:
-        case LV_COLOR_FORMAT_RGB565A8:
-            lv_draw_sw_blend_image_to_rgb565(&fill_dsc);
-            break;
-#endif
-#if LV_DRAW_SW_SUPPORT_RGB888
-        case LV_COLOR_FORMAT_RGB888:
-            lv_draw_sw_blend_image_to_rgb888(&fill_dsc, 3);
-            break;
-#endif
-        default:
-            break;
+    const lv_vector_stroke_dsc_t * stroke = &dsc->stroke_dsc;
+    key->stroke_style = stroke->style;
+    if(stroke->style == LV_VECTOR_DRAW_STYLE_SOLID) {
+        key->stroke_color = stroke->color;
+        key->stroke_opa = stroke->opa;
+    }
+    else {
+        _gradient_key_init(&key->stroke_gradient, &stroke->gradient);
+        key->stroke_matrix = stroke->matrix;
+    }
+    key->stroke_width = stroke->width;
+    key->stroke_cap = stroke->cap;
+    key->stroke_join = stroke->join;
+    key->stroke_miter_limit = stroke->miter_limit;
+
+    key->blend_mode = dsc->blend_mode;
+}
+
+/**
+ * Get the retained shape of a path with the fill, stroke and blend mode of `dsc` already set.
+ * @return      the shape or NULL if it can't be retained; the caller should build a new shape then
+ */
+static Tvg_Paint * _shape_get(_tvg_draw_state * state, const lv_vector_path_t * path,
+                              const lv_vector_path_ctx_t * dsc, const lv_matrix_t * matrix)
+{
+    lv_draw_sw_vector_canvas_t * slot = state->slot;
+    if(slot == NULL || slot->shapes == NULL) return NULL;
+
+    /*Patterns push an extra picture which refers to the decoded image*/
+    if(dsc->fill_dsc.style == LV_VECTOR_DRAW_STYLE_PATTERN) return NULL;
+
+    _tvg_shape_item_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.ops = lv_array_front(&path->ops);
+    search_key.op_cnt = lv_array_size(&path->ops);
+    search_key.points = lv_array_front(&path->points);
+    search_key.point_cnt = lv_array_size(&path->points);
+    search_key.dashes = lv_array_front(&dsc->stroke_dsc.dash_pattern);
+    search_key.dash_cnt = lv_array_size(&dsc->stroke_dsc.dash_pattern);
+    _style_key_init(&search_key.style, dsc);
+
+    uint32_t hash = 2166136261u;
+    hash = _hash_bytes(hash, search_key.ops, search_key.op_cnt * sizeof(lv_vector_path_op_t));
+    hash = _hash_bytes(hash, search_key.points, search_key.point_cnt * sizeof(lv_fpoint_t));
+    hash = _hash_bytes(hash, search_key.dashes, search_key.dash_cnt * sizeof(float));
+    search_key.hash = _hash_bytes(hash, &search_key.style, sizeof(search_key.style));
+
+    bool created = false;
+    lv_cache_entry_t * entry = lv_cache_acquire(slot->shapes, &search_key, NULL);
+    if(entry == NULL) {
+        entry = lv_cache_acquire_or_create(slot->shapes, &search_key, NULL);
+        if(entry == NULL) return NULL;
+        created = true;
+    }
+
+    _tvg_shape_item_t * item = lv_cache_entry_get_data(entry);
+    Tvg_Paint * obj = NULL;
+    /*A shape can be pushed only once per task as its transformation is shared*/
+    if(item->draw_id != slot->draw_id) {
+        item->draw_id = slot->draw_id;
+        obj = item->shape;
+        if(created) {
+            _set_paint_fill(obj, state->canvas, &dsc->fill_dsc, matrix, state->opa);
+            _set_paint_stroke(obj, &dsc->stroke_dsc);
+            _set_paint_blend_mode(obj, dsc->blend_mode);
+            slot->shape_miss_cnt++;
+        }
+        else {
+            slot->shape_hit_cnt++;
+        }
     }
+    lv_cache_release(slot->shapes, entry, NULL);
+
+    return obj;
 }
 
 static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_vector_path_ctx_t * dsc)
@@ -434,12 +649,13 @@ static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_ve
     _tvg_draw_state * state = (_tvg_draw_state *)ctx;
     Tvg_Canvas * canvas = (Tvg_Canvas *)state->canvas;
 
-    Tvg_Paint * obj = tvg_shape_new();
+    Tvg_Paint * obj;
 
     _tvg_rect rc;
     lv_area_to_tvg(&rc, &dsc->scissor_area);
 
     if(!path) {  /*clear*/
+        obj = tvg_shape_new();
         _tvg_color c;
         lv_color_to_tvg(&c, &dsc->fill_dsc.color, dsc->fill_dsc.opa);
 
@@ -462,13 +678,21 @@ static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_ve
         lv_matrix_multiply(&matrix, &dsc->matrix);
         Tvg_Matrix mtx;
         lv_matrix_to_tvg(&mtx, &matrix);
-        _set_paint_matrix(obj, &mtx);
 
-        _set_paint_shape(obj, path);
-
-        _set_paint_fill(obj, canvas, &dsc->fill_dsc, &matrix, state->opa);
-        _set_paint_stroke(obj, &dsc->stroke_dsc);
-        _set_paint_blend_mode(obj, dsc->blend_mode);
+        obj = _shape_get(state, path, dsc, &matrix);
+        if(obj) {
+            /*Only the transformation of a retained shape can change*/
+            _set_paint_matrix(obj, &mtx);
+        }
+        else {
+            obj = tvg_shape_new();
+            _set_paint_matrix(obj, &mtx);
+            _set_paint_shape(obj, lv_array_front(&path->ops), lv_array_size(&path->ops), lv_array_front(&path->points));
+
+            _set_paint_fill(obj, canvas, &dsc->fill_dsc, &matrix, state->opa);
+            _set_paint_stroke(obj, &dsc->stroke_dsc);
+            _set_paint_blend_mode(obj, dsc->blend_mode);
+        }
     }
     tvg_paint_set_opacity(obj, state->opa);
     tvg_canvas_push(canvas, obj);
@@ -478,6 +702,45 @@ static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_ve
  *   GLOBAL FUNCTIONS
  **********************/
 
+void lv_draw_sw_vector_init(void)
+{
+    lv_memzero(&_vector_state, sizeof(_vector_state));
+#if LV_USE_OS
+    lv_mutex_init(&_vector_state.lock);
+#endif
+
+#if LV_DRAW_SW_VECTOR_SHAPE_CACHE_CNT > 0
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)shape_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)shape_create_cb,
+        .free_cb = (lv_cache_free_cb_t)shape_free_cb,
+    };
+
+    for(uint32_t i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        lv_draw_sw_vector_canvas_t * c = &_vector_state.canvases[i];
+        c->shapes = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(_tvg_shape_item_t),
+                                    LV_DRAW_SW_VECTOR_SHAPE_CACHE_CNT, ops);
+        lv_cache_set_name(c->shapes, "SW_VECTOR_SHAPE");
+    }
+#endif
+}
+
+void lv_draw_sw_vector_deinit(void)
+{
+    for(uint32_t i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        lv_draw_sw_vector_canvas_t * c = &_vector_state.canvases[i];
+        /*The shapes refer to the renderer of the canvas, free them first*/
+        if(c->shapes) lv_cache_destroy(c->shapes, NULL);
+        if(c->canvas) tvg_canvas_destroy(c->canvas);
+        if(c->scratch) lv_draw_buf_destroy(c->scratch);
+    }
+
+#if LV_USE_OS
+    lv_mutex_delete(&_vector_state.lock);
+#endif
+    lv_memzero(&_vector_state, sizeof(_vector_state));
+}
+
 void lv_draw_sw_vector(lv_draw_task_t * t, lv_draw_vector_dsc_t * dsc)
 {
     if(dsc->task_list == NULL)
@@ -488,32 +751,52 @@ void lv_draw_sw_vector(lv_draw_task_t * t, lv_draw_vector_dsc_t * dsc)
     if(draw_buf == NULL)
         return;
 
-    void * buf = draw_buf->data;
-    int32_t width = lv_area_get_width(&layer->buf_area);
-    int32_t height = lv_area_get_height(&layer->buf_area);
-    uint32_t stride = draw_buf->header.stride;
-
     lv_color_format_t cf = draw_buf->header.cf;
+    lv_draw_sw_vector_canvas_t * slot;
+    Tvg_Canvas * canvas = _canvas_take(&slot);
 
-    bool allow_buffer = false;
-    lv_draw_buf_t * new_buf = NULL;
+    _tvg_draw_state state = {canvas, layer->partial_y_offset, -layer->buf_area.x1, -layer->buf_area.y1, t->opa, slot};
+    if(slot) slot->draw_id++;
+
+    lv_draw_buf_t * scratch = NULL;
+    lv_area_t scratch_area;
 
     if(cf != LV_COLOR_FORMAT_ARGB8888 && \
        cf != LV_COLOR_FORMAT_XRGB8888) {
-        allow_buffer = true;
-        new_buf = lv_draw_buf_create(width, height, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
-        lv_draw_buf_clear(new_buf, NULL);
-        buf = new_buf->data;
-        stride = new_buf->header.stride;
-    }
-    Tvg_Canvas * canvas = tvg_swcanvas_create();
-    tvg_swcanvas_set_target(canvas, buf, stride / 4, width, height, TVG_COLORSPACE_ARGB8888);
+        /*ThorVG can render only to 32 bit buffers, so render the touched part of the clip area
+         *to an ARGB8888 scratch buffer and blend only that area to the layer*/
+        if(_get_touched_area(dsc->task_list, &t->clip_area, &scratch_area)) {
+            scratch = _scratch_get(slot, lv_area_get_width(&scratch_area), lv_area_get_height(&scratch_area));
+        }
 
-    _tvg_rect rc;
-    lv_area_to_tvg(&rc, &t->clip_area);
-    tvg_canvas_set_viewport(canvas, (int32_t)rc.x, (int32_t)(rc.y - layer->partial_y_offset), (int32_t)rc.w, (int32_t)rc.h);
+        if(scratch == NULL) {
+            lv_vector_for_each_destroy_tasks(dsc->task_list, NULL, NULL);
+            dsc->task_list = NULL;
+            _canvas_give(canvas, slot);
+            return;
+        }
 
-    _tvg_draw_state state = {canvas, layer->partial_y_offset, -layer->buf_area.x1, -layer->buf_area.y1, t->opa};
+        lv_draw_buf_clear(scratch, NULL);
+        int32_t width = lv_area_get_width(&scratch_area);
+        int32_t height = lv_area_get_height(&scratch_area);
+        tvg_swcanvas_set_target(canvas, (uint32_t *)scratch->data, scratch->header.stride / 4, width, height,
+                                TVG_COLORSPACE_ARGB8888);
+        tvg_canvas_set_viewport(canvas, 0, 0, width, height);
+
+        state.translate_x = -scratch_area.x1;
+        state.translate_y = -scratch_area.y1;
+    }
+    else {
+        int32_t width = lv_area_get_width(&layer->buf_area);
+        int32_t height = lv_area_get_height(&layer->buf_area);
+        tvg_swcanvas_set_target(canvas, (uint32_t *)draw_buf->data, draw_buf->header.stride / 4, width, height,
+                                TVG_COLORSPACE_ARGB8888);
+
+        _tvg_rect rc;
+        lv_area_to_tvg(&rc, &t->clip_area);
+        tvg_canvas_set_viewport(canvas, (int32_t)rc.x, (int32_t)(rc.y - layer->partial_y_offset), (int32_t)rc.w,
+                                (int32_t)rc.h);
+    }
 
     lv_ll_t * task_list = dsc->task_list;
     lv_vector_for_each_destroy_tasks(task_list, _task_draw_cb, &state);
@@ -523,17 +806,84 @@ void lv_draw_sw_vector(lv_draw_task_t * t, lv_draw_vector_dsc_t * dsc)
         tvg_canvas_sync(canvas);
     }
 
-    if(allow_buffer) {
-        lv_area_t src_area = {0, 0, width, height};
-        _blend_draw_buf(draw_buf, &layer->buf_area, new_buf, &src_area);
-        lv_draw_buf_destroy(new_buf);
+    if(scratch) {
+        lv_draw_sw_blend_dsc_t blend_dsc;
+        lv_memzero(&blend_dsc, sizeof(blend_dsc));
+        blend_dsc.blend_area = &scratch_area;
+        blend_dsc.src_area = &scratch_area;
+        blend_dsc.src_buf = scratch->data;
+        blend_dsc.src_stride = scratch->header.stride;
+        blend_dsc.src_color_format = LV_COLOR_FORMAT_ARGB8888;
+        blend_dsc.opa = LV_OPA_COVER;
+        blend_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+        lv_draw_sw_blend(t, &blend_dsc);
+
+        if(slot == NULL) lv_draw_buf_destroy(scratch);
     }
 
-    tvg_canvas_destroy(canvas);
+    _canvas_give(canvas, slot);
 }
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+static bool shape_create_cb(_tvg_shape_item_t * item, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    /*The key points into the task to draw, keep a copy for later comparisons*/
+    size_t points_size = item->point_cnt * sizeof(lv_fpoint_t);
+    size_t dashes_size = item->dash_cnt * sizeof(float);
+    size_t ops_size = item->op_cnt * sizeof(lv_vector_path_op_t);
+    size_t size = points_size + dashes_size + ops_size;
+    uint8_t * data = NULL;
+    if(size) {
+        data = lv_malloc(size);
+        if(data == NULL) return false;
+        if(points_size) lv_memcpy(data, item->points, points_size);
+        if(dashes_size) lv_memcpy(data + points_size, item->dashes, dashes_size);
+        if(ops_size) lv_memcpy(data + points_size + dashes_size, item->ops, ops_size);
+    }
+
+    item->points = (lv_fpoint_t *)data;
+    item->dashes = (float *)(data + points_size);
+    item->ops = (lv_vector_path_op_t *)(data + points_size + dashes_size);
+
+    item->shape = tvg_shape_new();
+    _set_paint_shape(item->shape, item->ops, item->op_cnt, item->points);
+
+    /*The C API can't reference a paint. Clip an empty shape with it
+     *so that clearing the canvas doesn't free the shape.*/
+    item->holder = tvg_shape_new();
+    tvg_paint_set_clip(item->holder, item->shape);
+
+    return true;
+}
+
+static void shape_free_cb(_tvg_shape_item_t * item, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    /*Frees the shape too unless it's still pushed to the canvas*/
+    tvg_paint_del(item->holder);
+    lv_free(item->points);
+}
+
+static lv_cache_compare_res_t shape_compare_cb(const _tvg_shape_item_t * lhs, const _tvg_shape_item_t * rhs)
+{
+    if(lhs->hash != rhs->hash) return lhs->hash > rhs->hash ? 1 : -1;
+    if(lhs->op_cnt != rhs->op_cnt) return lhs->op_cnt > rhs->op_cnt ? 1 : -1;
+    if(lhs->point_cnt != rhs->point_cnt) return lhs->point_cnt > rhs->point_cnt ? 1 : -1;
+    if(lhs->dash_cnt != rhs->dash_cnt) return lhs->dash_cnt > rhs->dash_cnt ? 1 : -1;
+
+    int cmp = lv_memcmp(&lhs->style, &rhs->style, sizeof(lhs->style));
+    if(cmp == 0 && lhs->op_cnt) cmp = lv_memcmp(lhs->ops, rhs->ops, lhs->op_cnt * sizeof(lv_vector_path_op_t));
+    if(cmp == 0 && lhs->point_cnt) cmp = lv_memcmp(lhs->points, rhs->points, lhs->point_cnt * sizeof(lv_fpoint_t));
+    if(cmp == 0 && lhs->dash_cnt) cmp = lv_memcmp(lhs->dashes, rhs->dashes, lhs->dash_cnt * sizeof(float));
+    if(cmp == 0) return 0;
+
+    return cmp > 0 ? 1 : -1;
+}
+
 #endif /*LV_USE_DRAW_SW*/
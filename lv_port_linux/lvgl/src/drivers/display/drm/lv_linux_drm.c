@@ -24,6 +24,12 @@
 
 #include "../../../stdlib/lv_sprintf.h"
 #include "../../../draw/lv_draw_buf.h"
+#include "../../../draw/lv_draw_image.h"
+#include "../../../display/lv_display_private.h"
+#include "../../../widgets/image/lv_image.h"
+#include "../../../core/lv_obj_private.h"
+#include "../../../core/lv_refr_private.h"
+#include "../../../misc/lv_area_private.h"
 
 #if LV_USE_LINUX_DRM_GBM_BUFFERS
 
@@ -44,7 +50,17 @@
     #error LV_COLOR_DEPTH not supported
 #endif
 
-#define BUFFER_CNT 2
+#define BUFFER_CNT LV_LINUX_DRM_BUFFER_CNT
+
+#if BUFFER_CNT != 2 && BUFFER_CNT != 3
+    #error LV_LINUX_DRM_BUFFER_CNT must be 2 or 3
+#endif
+
+/* Max number of damaged rectangles passed with FB_DAMAGE_CLIPS, above this the whole plane is updated */
+#define DAMAGE_CLIP_MAX 32
+
+/* Retry period of a cursor or overlay plane update if the previous commit is still pending */
+#define PLANES_RETRY_PERIOD 4
 
 /**********************
  *      TYPEDEFS
@@ -58,6 +74,13 @@ typedef struct {
     uint32_t fb_handle;
 } drm_buffer_t;
 
+/* A plane used besides the primary plane */
+typedef struct {
+    uint32_t id;
+    uint32_t count_props;
+    drmModePropertyPtr props[128];
+} drm_plane_t;
+
 typedef struct {
     int fd;
     uint32_t conn_id, enc_id, crtc_id, plane_id, crtc_idx;
@@ -79,7 +102,33 @@ typedef struct {
     drmModePropertyPtr crtc_props[128];
     drmModePropertyPtr conn_props[128];
     drm_buffer_t drm_bufs[BUFFER_CNT];
+    lv_draw_buf_t draw_bufs[BUFFER_CNT];
     drm_buffer_t * act_buf;
+    bool damage_clips_supported;
+    struct drm_mode_rect damage[DAMAGE_CLIP_MAX];
+    uint32_t damage_cnt;
+    bool damage_full;
+    bool crtc_active;
+    lv_display_t * disp;
+    lv_linux_drm_vblank_cb_t vblank_cb;
+    lv_timer_t * planes_timer;
+    /* Hardware cursor */
+    drm_plane_t cursor_plane;
+    drm_buffer_t cursor_buf;
+    uint32_t cursor_width, cursor_height;
+    lv_obj_t * cursor_obj;
+    int32_t cursor_x, cursor_y;
+    bool cursor_dirty;
+    /* Widget shown on an overlay plane */
+    drm_plane_t overlay_plane;
+    drm_buffer_t overlay_bufs[2];
+    uint32_t overlay_buf_idx;       /* The buffer to draw into next */
+    int32_t overlay_buf_w, overlay_buf_h;
+    lv_obj_t * overlay_obj;
+    lv_area_t overlay_area;         /* The area of the screen covered by the overlay plane */
+    bool overlay_shown;
+    bool overlay_dirty;
+    bool overlay_hidden;            /* Hidden while the primary plane is rendered */
 #if LV_USE_LINUX_DRM_GBM_BUFFERS
     struct gbm_device * gbm_device;
 #endif
@@ -93,6 +142,8 @@ static uint32_t get_crtc_property_id(drm_dev_t * drm_dev, const char * name);
 static uint32_t get_conn_property_id(drm_dev_t * drm_dev, const char * name);
 static void page_flip_handler(int fd, unsigned int sequence, unsigned int tv_sec, unsigned int tv_usec,
                               void * user_data);
+static void vblank_handler(int fd, unsigned int sequence, unsigned int tv_sec, unsigned int tv_usec,
+                           void * user_data);
 static int drm_get_plane_props(drm_dev_t * drm_dev);
 static int drm_get_crtc_props(drm_dev_t * drm_dev);
 static int drm_get_conn_props(drm_dev_t * drm_dev);
@@ -116,8 +167,32 @@ static uint32_t tick_get_cb(void);
 static int drm_setup_buffers(drm_dev_t * drm_dev);
 static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf);
 static void drm_flush_wait(lv_display_t * drm_dev);
+static void drm_wait_commit(drm_dev_t * drm_dev);
 static void drm_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 static void drm_dmabuf_set_active_buf(lv_event_t * event);
+static int find_extra_plane(drm_dev_t * drm_dev, uint64_t type, uint32_t fourcc, drm_plane_t * extra_plane);
+static int drm_add_extra_plane_property(drm_dev_t * drm_dev, drm_plane_t * extra_plane, const char * name,
+                                        uint64_t value);
+static int drm_allocate_extra_buffer(drm_dev_t * drm_dev, drm_buffer_t * buf, uint32_t width, uint32_t height,
+                                     uint32_t fourcc);
+static void drm_free_extra_buffer(drm_dev_t * drm_dev, drm_buffer_t * buf);
+static void drm_draw_to_buffer(lv_layer_t * layer, lv_draw_buf_t * draw_buf, drm_buffer_t * buf, lv_color_format_t cf,
+                               const lv_area_t * buf_area);
+static void drm_finish_layer(drm_dev_t * drm_dev, lv_layer_t * layer);
+static void drm_cursor_draw(drm_dev_t * drm_dev);
+static void drm_cursor_release(drm_dev_t * drm_dev);
+static int drm_overlay_draw(drm_dev_t * drm_dev);
+static void drm_overlay_release(drm_dev_t * drm_dev);
+static int drm_planes_commit(drm_dev_t * drm_dev);
+static void drm_planes_schedule(drm_dev_t * drm_dev);
+static void drm_planes_update(drm_dev_t * drm_dev);
+static void cursor_event_cb(lv_event_t * e);
+static void drm_premultiply_buffer(drm_buffer_t * buf, uint32_t width, uint32_t height);
+static void drm_set_overlay_zpos(drm_dev_t * drm_dev);
+static void overlay_event_cb(lv_event_t * e);
+static void overlay_render_cb(lv_event_t * e);
+static void overlay_invalidate_cb(lv_event_t * e);
+static void planes_timer_cb(lv_timer_t * t);
 
 /**********************
  *  STATIC VARIABLES
@@ -151,6 +226,7 @@ lv_display_t * lv_linux_drm_create(void)
         lv_free(drm_dev);
         return NULL;
     }
+    drm_dev->disp = disp;
     lv_display_set_driver_data(disp, drm_dev);
     lv_display_set_flush_wait_cb(disp, drm_flush_wait);
     lv_display_set_flush_cb(disp, drm_flush);
@@ -230,13 +306,26 @@ void lv_linux_drm_set_file(lv_display_t * disp, const char * file, int64_t conne
 
     int32_t width = drm_dev->mmWidth;
 
-    size_t buf_size = LV_MIN(drm_dev->drm_bufs[1].size, drm_dev->drm_bufs[0].size);
     /* Resolution must be set first because if the screen is smaller than the size passed
      * to lv_display_create then the buffers aren't big enough for LV_DISPLAY_RENDER_MODE_DIRECT.
      */
     lv_display_set_resolution(disp, hor_res, ver_res);
-    lv_display_set_buffers(disp, drm_dev->drm_bufs[1].map, drm_dev->drm_bufs[0].map, buf_size,
-                           LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_display_set_vblank_period(disp, lv_linux_drm_mode_get_frame_period(&drm_dev->mode));
+
+    /* Render directly into the scanout buffers using the pitch of the DRM buffers.
+     * LVGL keeps them in sync by copying only the areas a buffer missed since it was shown the last time */
+    lv_color_format_t cf = lv_display_get_color_format(disp);
+    int i;
+    for(i = 0; i < BUFFER_CNT; i++) {
+        drm_buffer_t * buf = &drm_dev->drm_bufs[i];
+        lv_draw_buf_init(&drm_dev->draw_bufs[i], hor_res, ver_res, cf, buf->pitch, buf->map, buf->size);
+    }
+
+    lv_display_set_draw_buffers(disp, &drm_dev->draw_bufs[0], &drm_dev->draw_bufs[1]);
+#if BUFFER_CNT == 3
+    lv_display_set_3rd_draw_buffer(disp, &drm_dev->draw_bufs[2]);
+#endif
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_DIRECT);
 
 
     /* Set the handler that is called before a redraw occurs to set the active buffer/plane
@@ -257,6 +346,130 @@ void lv_linux_drm_set_mode_cb(lv_display_t * disp, lv_linux_drm_select_mode_cb_t
     LV_UNUSED(callback);
     LV_LOG_WARN("DRM without EGL support doesn't currently support setting a mode selection callback");
 }
+
+int lv_linux_drm_get_fd(lv_display_t * disp)
+{
+    drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
+    if(drm_dev == NULL) return -1;
+    return drm_dev->fd;
+}
+
+void lv_linux_drm_handle_events(lv_display_t * disp)
+{
+    drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
+    if(drm_dev == NULL || drm_dev->fd < 0) return;
+
+    /* drmHandleEvent blocks if there is nothing to read */
+    struct pollfd pfd = {.fd = drm_dev->fd, .events = POLLIN};
+    if(poll(&pfd, 1, 0) > 0) drmHandleEvent(drm_dev->fd, &drm_dev->drm_event_ctx);
+}
+
+void lv_linux_drm_set_vblank_cb(lv_display_t * disp, lv_linux_drm_vblank_cb_t callback)
+{
+    drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
+    if(drm_dev == NULL) return;
+    drm_dev->vblank_cb = callback;
+}
+
+lv_result_t lv_linux_drm_set_cursor(lv_display_t * disp, lv_indev_t * indev)
+{
+    if(disp == NULL || disp->flush_cb != drm_flush) return LV_RESULT_INVALID;
+
+    drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
+    if(drm_dev->fd < 0) return LV_RESULT_INVALID;
+
+    lv_obj_t * cursor = indev ? lv_indev_get_cursor(indev) : NULL;
+
+    if(drm_dev->cursor_obj) {
+        lv_obj_t * old_cursor = drm_dev->cursor_obj;
+        drm_cursor_release(drm_dev);
+        lv_obj_remove_flag(old_cursor, LV_OBJ_FLAG_HIDDEN);
+    }
+
+    if(cursor == NULL) return LV_RESULT_OK;
+
+    if(!lv_obj_check_type(cursor, &lv_image_class)) {
+        LV_LOG_WARN("Only image cursors can be shown on the cursor plane");
+        return LV_RESULT_INVALID;
+    }
+
+    if(drm_dev->cursor_plane.id == 0) {
+        uint64_t cap;
+        drm_dev->cursor_width = drmGetCap(drm_dev->fd, DRM_CAP_CURSOR_WIDTH, &cap) == 0 && cap ? cap : 64;
+        drm_dev->cursor_height = drmGetCap(drm_dev->fd, DRM_CAP_CURSOR_HEIGHT, &cap) == 0 && cap ? cap : 64;
+
+        if(find_extra_plane(drm_dev, DRM_PLANE_TYPE_CURSOR, DRM_FORMAT_ARGB8888, &drm_dev->cursor_plane) ||
+           drm_allocate_extra_buffer(drm_dev, &drm_dev->cursor_buf, drm_dev->cursor_width, drm_dev->cursor_height,
+                                     DRM_FORMAT_ARGB8888)) {
+            LV_LOG_WARN("No usable cursor plane, the cursor is drawn by software");
+            drm_dev->cursor_plane.id = 0;
+            return LV_RESULT_INVALID;
+        }
+    }
+
+    if(lv_image_get_src_width(cursor) > (int32_t)drm_dev->cursor_width ||
+       lv_image_get_src_height(cursor) > (int32_t)drm_dev->cursor_height) {
+        LV_LOG_WARN("The cursor image is larger than the cursor plane (%" PRIu32 "x%" PRIu32 ")",
+                    drm_dev->cursor_width, drm_dev->cursor_height);
+        return LV_RESULT_INVALID;
+    }
+
+    drm_dev->cursor_obj = cursor;
+    drm_cursor_draw(drm_dev);
+
+    drm_dev->cursor_x = lv_obj_get_style_x(cursor, LV_PART_MAIN);
+    drm_dev->cursor_y = lv_obj_get_style_y(cursor, LV_PART_MAIN);
+    drm_dev->cursor_dirty = true;
+
+    /* The indev keeps moving the hidden object which costs no rendering,
+     * its new position is mirrored to the cursor plane */
+    lv_obj_add_flag(cursor, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_event_cb(cursor, cursor_event_cb, LV_EVENT_STYLE_CHANGED, drm_dev);
+    lv_obj_add_event_cb(cursor, cursor_event_cb, LV_EVENT_DELETE, drm_dev);
+
+    drm_planes_schedule(drm_dev);
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_linux_drm_set_overlay_obj(lv_display_t * disp, lv_obj_t * obj)
+{
+    if(disp == NULL || disp->flush_cb != drm_flush) return LV_RESULT_INVALID;
+
+    drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
+    if(drm_dev->fd < 0) return LV_RESULT_INVALID;
+
+    if(drm_dev->overlay_obj) drm_overlay_release(drm_dev);
+
+    if(obj == NULL) return LV_RESULT_OK;
+
+    if(lv_obj_get_display(obj) != disp) {
+        LV_LOG_WARN("The Widget is not on this display");
+        return LV_RESULT_INVALID;
+    }
+
+    if(drm_dev->overlay_plane.id == 0) {
+        if(find_extra_plane(drm_dev, DRM_PLANE_TYPE_OVERLAY, DRM_FORMAT_ARGB8888, &drm_dev->overlay_plane)) {
+            LV_LOG_WARN("No usable overlay plane, the Widget is drawn by software");
+            return LV_RESULT_INVALID;
+        }
+    }
+
+    drm_dev->overlay_obj = obj;
+    drm_dev->overlay_dirty = true;
+
+    /* Instead of drawing the Widget and its children on the primary plane, draw them to the
+     * overlay plane. The areas covered by the overlay plane are not redrawn on the primary plane. */
+    lv_obj_add_event_cb(obj, overlay_event_cb, LV_EVENT_DELETE, drm_dev);
+    lv_display_add_event_cb(disp, overlay_render_cb, LV_EVENT_RENDER_START, drm_dev);
+    lv_display_add_event_cb(disp, overlay_render_cb, LV_EVENT_RENDER_READY, drm_dev);
+    lv_display_add_event_cb(disp, overlay_invalidate_cb, LV_EVENT_INVALIDATE_AREA, drm_dev);
+
+    drm_planes_schedule(drm_dev);
+
+    return LV_RESULT_OK;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -311,14 +524,38 @@ static void page_flip_handler(int fd, unsigned int sequence, unsigned int tv_sec
 {
     LV_UNUSED(fd);
     LV_UNUSED(sequence);
-    LV_UNUSED(tv_sec);
-    LV_UNUSED(tv_usec);
     LV_LOG_TRACE("flip");
     drm_dev_t * drm_dev = user_data;
+    drm_dev->crtc_active = true;
     if(drm_dev->req) {
         drmModeAtomicFree(drm_dev->req);
         drm_dev->req = NULL;
     }
+
+    /* The plane updates which were waiting for this commit can be done now */
+    if(drm_dev->planes_timer && (drm_dev->cursor_dirty || drm_dev->overlay_dirty)) {
+        drm_planes_schedule(drm_dev);
+    }
+
+    /* The event is handled later than the flip happened, convert its CLOCK_MONOTONIC time to tick */
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    int64_t age_us = ((int64_t)now.tv_sec - tv_sec) * 1000000 + now.tv_nsec / 1000 - tv_usec;
+    lv_display_report_vblank(drm_dev->disp, lv_tick_get() - (uint32_t)(LV_MAX(age_us, 0) / 1000));
+}
+
+static void vblank_handler(int fd, unsigned int sequence, unsigned int tv_sec, unsigned int tv_usec,
+                           void * user_data)
+{
+    LV_UNUSED(fd);
+    LV_UNUSED(sequence);
+    LV_UNUSED(tv_sec);
+    LV_UNUSED(tv_usec);
+
+    /* Requested by lv_linux_drm_request_vblank() with the display as user data */
+    lv_display_t * disp = user_data;
+    drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
+    if(drm_dev && drm_dev->vblank_cb) drm_dev->vblank_cb(disp);
 }
 
 static int drm_get_plane_props(drm_dev_t * drm_dev)
@@ -458,6 +695,10 @@ static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf)
 
 #endif
 
+    /* A cursor or overlay plane update can still be pending, its request can't be replaced
+     * and the kernel would reject a new commit with EBUSY anyway */
+    drm_wait_commit(drm_dev);
+
     drm_dev->req = drmModeAtomicAlloc();
 
     /* On first Atomic commit, do a modeset */
@@ -483,10 +724,34 @@ static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf)
     drm_add_plane_property(drm_dev, "CRTC_W", drm_dev->width);
     drm_add_plane_property(drm_dev, "CRTC_H", drm_dev->height);
 
+    /* Tell the driver which parts of the framebuffer have changed since the last page flip,
+     * so it can upload only those (e.g. to a display with its own memory) */
+    uint32_t damage_blob_id = 0;
+    if(!(flags & DRM_MODE_ATOMIC_ALLOW_MODESET) && drm_dev->damage_clips_supported &&
+       !drm_dev->damage_full && drm_dev->damage_cnt > 0) {
+        ret = drmModeCreatePropertyBlob(drm_dev->fd, drm_dev->damage,
+                                        drm_dev->damage_cnt * sizeof(struct drm_mode_rect), &damage_blob_id);
+        if(ret) {
+            LV_LOG_WARN("Failed to create FB_DAMAGE_CLIPS blob: %s", strerror(errno));
+            damage_blob_id = 0;
+        }
+        else {
+            drm_add_plane_property(drm_dev, "FB_DAMAGE_CLIPS", damage_blob_id);
+        }
+    }
+
+    drm_dev->damage_cnt = 0;
+    drm_dev->damage_full = false;
+
     ret = drmModeAtomicCommit(drm_dev->fd, drm_dev->req, flags, drm_dev);
+
+    /* The commit holds a reference to the blob, it's not needed anymore */
+    if(damage_blob_id) drmModeDestroyPropertyBlob(drm_dev->fd, damage_blob_id);
+
     if(ret) {
         LV_LOG_ERROR("drmModeAtomicCommit failed: %s (%d)", strerror(errno), errno);
         drmModeAtomicFree(drm_dev->req);
+        drm_dev->req = NULL;
         return ret;
     }
 
@@ -800,8 +1065,12 @@ static int drm_setup(drm_dev_t * drm_dev, const char * device_path, int64_t conn
         goto err;
     }
 
+    drm_dev->damage_clips_supported = get_plane_property_id(drm_dev, "FB_DAMAGE_CLIPS") != 0;
+    LV_LOG_INFO("drm: FB_DAMAGE_CLIPS %ssupported", drm_dev->damage_clips_supported ? "" : "not ");
+
     drm_dev->drm_event_ctx.version = DRM_EVENT_CONTEXT_VERSION;
     drm_dev->drm_event_ctx.page_flip_handler = page_flip_handler;
+    drm_dev->drm_event_ctx.vblank_handler = vblank_handler;
     drm_dev->fourcc = fourcc;
 
     LV_LOG_INFO("drm: Found plane_id: %u connector_id: %d crtc_id: %d",
@@ -981,39 +1250,33 @@ static int create_gbm_buffer(drm_dev_t * drm_dev, drm_buffer_t * buf)
 static int drm_setup_buffers(drm_dev_t * drm_dev)
 {
     int ret;
+    int i;
 
+    for(i = 0; i < BUFFER_CNT; i++) {
 #if LV_USE_LINUX_DRM_GBM_BUFFERS
-
-    ret = create_gbm_buffer(drm_dev, &drm_dev->drm_bufs[0]);
-    if(ret < 0) {
-        return ret;
-    }
-
-    ret = create_gbm_buffer(drm_dev, &drm_dev->drm_bufs[1]);
-    if(ret < 0) {
-        return ret;
-    }
-
+        ret = create_gbm_buffer(drm_dev, &drm_dev->drm_bufs[i]);
+        if(ret < 0) {
+            return ret;
+        }
 #else
-
-    /* Use dumb buffers */
-    ret = drm_allocate_dumb(drm_dev, &drm_dev->drm_bufs[0]);
-    if(ret)
-        return ret;
-
-    ret = drm_allocate_dumb(drm_dev, &drm_dev->drm_bufs[1]);
-    if(ret)
-        return ret;
-
+        /* Use dumb buffers */
+        ret = drm_allocate_dumb(drm_dev, &drm_dev->drm_bufs[i]);
+        if(ret)
+            return ret;
 #endif
+    }
 
     return 0;
 }
 
 static void drm_flush_wait(lv_display_t * disp)
 {
-    drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
+    drm_wait_commit(lv_display_get_driver_data(disp));
+}
 
+/* Block until the pending atomic commit (page flip or plane update) is completed */
+static void drm_wait_commit(drm_dev_t * drm_dev)
+{
     struct pollfd pfd;
     pfd.fd = drm_dev->fd;
     pfd.events = POLLIN;
@@ -1035,13 +1298,24 @@ static void drm_flush_wait(lv_display_t * disp)
 
 static void drm_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
 {
-
-    if(!lv_display_flush_is_last(disp)) return;
-
-    LV_UNUSED(area);
     LV_UNUSED(px_map);
     drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
 
+    /* Collect the rendered areas of the frame for FB_DAMAGE_CLIPS */
+    if(drm_dev->damage_cnt < DAMAGE_CLIP_MAX) {
+        struct drm_mode_rect * rect = &drm_dev->damage[drm_dev->damage_cnt];
+        rect->x1 = LV_MAX(area->x1, 0);
+        rect->y1 = LV_MAX(area->y1, 0);
+        rect->x2 = LV_MIN(area->x2 + 1, (int32_t)drm_dev->width);
+        rect->y2 = LV_MIN(area->y2 + 1, (int32_t)drm_dev->height);
+        if(rect->x1 < rect->x2 && rect->y1 < rect->y2) drm_dev->damage_cnt++;
+    }
+    else {
+        drm_dev->damage_full = true;
+    }
+
+    if(!lv_display_flush_is_last(disp)) return;
+
     LV_ASSERT(drm_dev->act_buf != NULL);
 
     if(drm_dmabuf_set_plane(drm_dev, drm_dev->act_buf)) {
@@ -1053,6 +1327,534 @@ static void drm_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * px_
 
 }
 
+static int find_extra_plane(drm_dev_t * drm_dev, uint64_t type, uint32_t fourcc, drm_plane_t * extra_plane)
+{
+    drmModePlaneResPtr planes;
+    unsigned int i;
+    unsigned int j;
+
+    planes = drmModeGetPlaneResources(drm_dev->fd);
+    if(!planes) {
+        LV_LOG_ERROR("drmModeGetPlaneResources failed");
+        return -1;
+    }
+
+    extra_plane->id = 0;
+
+    for(i = 0; i < planes->count_planes && extra_plane->id == 0; i++) {
+        uint32_t plane_id = planes->planes[i];
+        if(plane_id == drm_dev->plane_id || plane_id == drm_dev->cursor_plane.id ||
+           plane_id == drm_dev->overlay_plane.id) {
+            continue;
+        }
+
+        drmModePlanePtr plane = drmModeGetPlane(drm_dev->fd, plane_id);
+        if(!plane) continue;
+
+        bool usable = false;
+        if(plane->possible_crtcs & (1 << drm_dev->crtc_idx)) {
+            for(j = 0; j < plane->count_formats; j++) {
+                if(plane->formats[j] == fourcc) {
+                    usable = true;
+                    break;
+                }
+            }
+        }
+        drmModeFreePlane(plane);
+
+        drmModeObjectPropertiesPtr props = NULL;
+        if(usable) props = drmModeObjectGetProperties(drm_dev->fd, plane_id, DRM_MODE_OBJECT_PLANE);
+        if(!props) continue;
+
+        uint32_t count = 0;
+        bool type_match = false;
+        for(j = 0; j < props->count_props && count < 128; j++) {
+            drmModePropertyPtr prop = drmModeGetProperty(drm_dev->fd, props->props[j]);
+            if(!prop) continue;
+            if(lv_strcmp(prop->name, "type") == 0 && props->prop_values[j] == type) {
+                type_match = true;
+            }
+            extra_plane->props[count++] = prop;
+        }
+        drmModeFreeObjectProperties(props);
+
+        if(type_match) {
+            extra_plane->id = plane_id;
+            extra_plane->count_props = count;
+        }
+        else {
+            for(j = 0; j < count; j++) drmModeFreeProperty(extra_plane->props[j]);
+        }
+    }
+
+    drmModeFreePlaneResources(planes);
+
+    if(extra_plane->id == 0) {
+        LV_LOG_INFO("drm: no plane of type %" PRIu64 " found", type);
+        return -1;
+    }
+
+    LV_LOG_INFO("drm: Found plane_id: %u of type %" PRIu64, extra_plane->id, type);
+    return 0;
+}
+
+static int drm_add_extra_plane_property(drm_dev_t * drm_dev, drm_plane_t * extra_plane, const char * name,
+                                        uint64_t value)
+{
+    int ret;
+    uint32_t prop_id = 0;
+    uint32_t i;
+
+    for(i = 0; i < extra_plane->count_props; ++i) {
+        if(!lv_strcmp(extra_plane->props[i]->name, name)) {
+            prop_id = extra_plane->props[i]->prop_id;
+            break;
+        }
+    }
+
+    if(!prop_id) {
+        LV_LOG_ERROR("Couldn't find plane prop %s", name);
+        return -1;
+    }
+
+    ret = drmModeAtomicAddProperty(drm_dev->req, extra_plane->id, prop_id, value);
+    if(ret < 0) {
+        LV_LOG_ERROR("drmModeAtomicAddProperty (%s:%" PRIu64 ") failed: %d", name, value, ret);
+        return ret;
+    }
+
+    return 0;
+}
+
+/* Allocate a 32 bit dumb buffer for a cursor or overlay plane */
+static int drm_allocate_extra_buffer(drm_dev_t * drm_dev, drm_buffer_t * buf, uint32_t width, uint32_t height,
+                                     uint32_t fourcc)
+{
+    struct drm_mode_create_dumb creq;
+    struct drm_mode_map_dumb mreq;
+    uint32_t handles[4] = {0}, pitches[4] = {0}, offsets[4] = {0};
+    int ret;
+
+    lv_memzero(buf, sizeof(*buf));
+
+    lv_memzero(&creq, sizeof(creq));
+    creq.width = width;
+    creq.height = height;
+    creq.bpp = 32;
+    ret = drmIoctl(drm_dev->fd, DRM_IOCTL_MODE_CREATE_DUMB, &creq);
+    if(ret < 0) {
+        LV_LOG_ERROR("DRM_IOCTL_MODE_CREATE_DUMB fail");
+        return -1;
+    }
+
+    buf->handle = creq.handle;
+    buf->pitch = creq.pitch;
+    buf->size = creq.size;
+
+    lv_memzero(&mreq, sizeof(mreq));
+    mreq.handle = creq.handle;
+    ret = drmIoctl(drm_dev->fd, DRM_IOCTL_MODE_MAP_DUMB, &mreq);
+    if(ret) {
+        LV_LOG_ERROR("DRM_IOCTL_MODE_MAP_DUMB fail");
+        drm_free_extra_buffer(drm_dev, buf);
+        return -1;
+    }
+
+    buf->offset = mreq.offset;
+    buf->map = mmap(0, creq.size, PROT_READ | PROT_WRITE, MAP_SHARED, drm_dev->fd, mreq.offset);
+    if(buf->map == MAP_FAILED) {
+        LV_LOG_ERROR("mmap fail");
+        buf->map = NULL;
+        drm_free_extra_buffer(drm_dev, buf);
+        return -1;
+    }
+
+    handles[0] = creq.handle;
+    pitches[0] = creq.pitch;
+    ret = drmModeAddFB2(drm_dev->fd, width, height, fourcc, handles, pitches, offsets, &buf->fb_handle, 0);
+    if(ret) {
+        LV_LOG_ERROR("drmModeAddFB fail");
+        drm_free_extra_buffer(drm_dev, buf);
+        return -1;
+    }
+
+    LV_LOG_INFO("drm: plane buffer %" PRIu32 "x%" PRIu32 " pitch %u", width, height, buf->pitch);
+
+    return 0;
+}
+
+static void drm_free_extra_buffer(drm_dev_t * drm_dev, drm_buffer_t * buf)
+{
+    if(buf->fb_handle) drmModeRmFB(drm_dev->fd, buf->fb_handle);
+    if(buf->map) munmap(buf->map, buf->size);
+    if(buf->handle) {
+        struct drm_mode_destroy_dumb dreq;
+        lv_memzero(&dreq, sizeof(dreq));
+        dreq.handle = buf->handle;
+        drmIoctl(drm_dev->fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
+    }
+    lv_memzero(buf, sizeof(*buf));
+}
+
+/* Prepare a layer to draw into a plane buffer. `buf_area` is the area of the screen the buffer shows. */
+static void drm_draw_to_buffer(lv_layer_t * layer, lv_draw_buf_t * draw_buf, drm_buffer_t * buf, lv_color_format_t cf,
+                               const lv_area_t * buf_area)
+{
+    lv_memzero(buf->map, buf->size);
+    lv_draw_buf_init(draw_buf, lv_area_get_width(buf_area), lv_area_get_height(buf_area), cf, buf->pitch, buf->map,
+                     buf->size);
+
+    lv_layer_init(layer);
+    layer->draw_buf = draw_buf;
+    layer->color_format = cf;
+    layer->buf_area = *buf_area;
+    layer->_clip_area = *buf_area;
+    layer->phy_clip_area = *buf_area;
+}
+
+static void drm_finish_layer(drm_dev_t * drm_dev, lv_layer_t * layer)
+{
+    while(layer->draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        if(!lv_draw_dispatch_layer(drm_dev->disp, layer)) {
+            lv_draw_wait_for_finish();
+            lv_draw_dispatch_request();
+        }
+    }
+}
+
+/* Draw the image of the cursor object into the cursor buffer */
+static void drm_cursor_draw(drm_dev_t * drm_dev)
+{
+    drm_buffer_t * buf = &drm_dev->cursor_buf;
+    lv_draw_buf_t draw_buf;
+    lv_layer_t layer;
+
+    lv_area_t buf_area = {0, 0, drm_dev->cursor_width - 1, drm_dev->cursor_height - 1};
+    drm_draw_to_buffer(&layer, &draw_buf, buf, LV_COLOR_FORMAT_ARGB8888, &buf_area);
+
+    lv_obj_t * cursor = drm_dev->cursor_obj;
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.src = lv_image_get_src(cursor);
+    lv_area_t coords = {0, 0, lv_image_get_src_width(cursor) - 1, lv_image_get_src_height(cursor) - 1};
+    lv_draw_image(&layer, &dsc, &coords);
+    drm_finish_layer(drm_dev, &layer);
+
+    drm_premultiply_buffer(buf, drm_dev->cursor_width, drm_dev->cursor_height);
+}
+
+/* The planes blend premultiplied pixels by default */
+static void drm_premultiply_buffer(drm_buffer_t * buf, uint32_t width, uint32_t height)
+{
+    uint32_t y;
+    for(y = 0; y < height; y++) {
+        lv_color32_t * px = (lv_color32_t *)(buf->map + y * buf->pitch);
+        uint32_t x;
+        for(x = 0; x < width; x++) {
+            px[x].red = LV_UDIV255(px[x].red * px[x].alpha);
+            px[x].green = LV_UDIV255(px[x].green * px[x].alpha);
+            px[x].blue = LV_UDIV255(px[x].blue * px[x].alpha);
+        }
+    }
+}
+
+/* Stop mirroring the cursor object, the plane is hidden with the next commit */
+static void drm_cursor_release(drm_dev_t * drm_dev)
+{
+    lv_obj_remove_event_cb_with_user_data(drm_dev->cursor_obj, cursor_event_cb, drm_dev);
+    drm_dev->cursor_obj = NULL;
+    drm_dev->cursor_dirty = true;
+    drm_planes_schedule(drm_dev);
+}
+
+/* Draw the overlay Widget and its children into the next overlay buffer */
+static int drm_overlay_draw(drm_dev_t * drm_dev)
+{
+    lv_obj_t * obj = drm_dev->overlay_obj;
+    int32_t w = lv_obj_get_width(obj);
+    int32_t h = lv_obj_get_height(obj);
+    if(w <= 0 || h <= 0) return 0;
+
+    /* Allocate the buffers with the size of the Widget */
+    if(w != drm_dev->overlay_buf_w || h != drm_dev->overlay_buf_h) {
+        int i;
+        for(i = 0; i < 2; i++) {
+            drm_free_extra_buffer(drm_dev, &drm_dev->overlay_bufs[i]);
+        }
+        drm_dev->overlay_buf_w = 0;
+        drm_dev->overlay_buf_h = 0;
+        for(i = 0; i < 2; i++) {
+            if(drm_allocate_extra_buffer(drm_dev, &drm_dev->overlay_bufs[i], w, h, DRM_FORMAT_ARGB8888)) return -1;
+        }
+        drm_dev->overlay_buf_w = w;
+        drm_dev->overlay_buf_h = h;
+    }
+
+    /* Keep the transparent parts of the Widget transparent, the primary plane is visible through them */
+    drm_buffer_t * buf = &drm_dev->overlay_bufs[drm_dev->overlay_buf_idx];
+    lv_draw_buf_t draw_buf;
+    lv_layer_t layer;
+    drm_draw_to_buffer(&layer, &draw_buf, buf, LV_COLOR_FORMAT_ARGB8888, &obj->coords);
+
+    lv_obj_redraw(&layer, obj);
+    drm_finish_layer(drm_dev, &layer);
+
+    drm_premultiply_buffer(buf, w, h);
+
+    return 0;
+}
+
+/* Draw the Widget by software again, the plane is hidden with the next commit */
+static void drm_overlay_release(drm_dev_t * drm_dev)
+{
+    lv_obj_t * obj = drm_dev->overlay_obj;
+    lv_obj_remove_event_cb_with_user_data(obj, overlay_event_cb, drm_dev);
+    lv_display_remove_event_cb_with_user_data(drm_dev->disp, overlay_render_cb, drm_dev);
+    lv_display_remove_event_cb_with_user_data(drm_dev->disp, overlay_invalidate_cb, drm_dev);
+    if(drm_dev->overlay_hidden) {
+        obj->flags &= ~LV_OBJ_FLAG_HIDDEN;
+        drm_dev->overlay_hidden = false;
+    }
+    drm_dev->overlay_obj = NULL;
+    drm_dev->overlay_dirty = true;
+
+    if(drm_dev->overlay_shown) lv_inv_area(drm_dev->disp, &drm_dev->overlay_area);
+
+    drm_planes_schedule(drm_dev);
+}
+
+/* Commit the new state of the cursor and overlay planes */
+static int drm_planes_commit(drm_dev_t * drm_dev)
+{
+    int ret;
+
+    drm_dev->req = drmModeAtomicAlloc();
+
+    if(drm_dev->cursor_dirty && drm_dev->cursor_obj) {
+        drm_plane_t * plane = &drm_dev->cursor_plane;
+        drm_add_extra_plane_property(drm_dev, plane, "FB_ID", drm_dev->cursor_buf.fb_handle);
+        drm_add_extra_plane_property(drm_dev, plane, "CRTC_ID", drm_dev->crtc_id);
+        drm_add_extra_plane_property(drm_dev, plane, "SRC_X", 0);
+        drm_add_extra_plane_property(drm_dev, plane, "SRC_Y", 0);
+        drm_add_extra_plane_property(drm_dev, plane, "SRC_W", (uint64_t)drm_dev->cursor_width << 16);
+        drm_add_extra_plane_property(drm_dev, plane, "SRC_H", (uint64_t)drm_dev->cursor_height << 16);
+        drm_add_extra_plane_property(drm_dev, plane, "CRTC_X", (uint64_t)(int64_t)drm_dev->cursor_x);
+        drm_add_extra_plane_property(drm_dev, plane, "CRTC_Y", (uint64_t)(int64_t)drm_dev->cursor_y);
+        drm_add_extra_plane_property(drm_dev, plane, "CRTC_W", drm_dev->cursor_width);
+        drm_add_extra_plane_property(drm_dev, plane, "CRTC_H", drm_dev->cursor_height);
+    }
+    else if(drm_dev->cursor_dirty && drm_dev->cursor_plane.id) {
+        drm_add_extra_plane_property(drm_dev, &drm_dev->cursor_plane, "FB_ID", 0);
+        drm_add_extra_plane_property(drm_dev, &drm_dev->cursor_plane, "CRTC_ID", 0);
+    }
+
+    /* Show only the visible part of the Widget, planes can't be outside of the screen */
+    lv_area_t scr_area = {0, 0, drm_dev->width - 1, drm_dev->height - 1};
+    lv_area_t vis_area;
+    bool overlay_visible = drm_dev->overlay_obj && drm_dev->overlay_buf_w > 0 &&
+                           lv_area_intersect(&vis_area, &drm_dev->overlay_obj->coords, &scr_area);
+
+    if(drm_dev->overlay_dirty && overlay_visible) {
+        drm_plane_t * plane = &drm_dev->overlay_plane;
+        const lv_area_t * coords = &drm_dev->overlay_obj->coords;
+        drm_add_extra_plane_property(drm_dev, plane, "FB_ID", drm_dev->overlay_bufs[drm_dev->overlay_buf_idx].fb_handle);
+        drm_add_extra_plane_property(drm_dev, plane, "CRTC_ID", drm_dev->crtc_id);
+        drm_add_extra_plane_property(drm_dev, plane, "SRC_X", (uint64_t)(vis_area.x1 - coords->x1) << 16);
+        drm_add_extra_plane_property(drm_dev, plane, "SRC_Y", (uint64_t)(vis_area.y1 - coords->y1) << 16);
+        drm_add_extra_plane_property(drm_dev, plane, "SRC_W", (uint64_t)lv_area_get_width(&vis_area) << 16);
+        drm_add_extra_plane_property(drm_dev, plane, "SRC_H", (uint64_t)lv_area_get_height(&vis_area) << 16);
+        drm_add_extra_plane_property(drm_dev, plane, "CRTC_X", vis_area.x1);
+        drm_add_extra_plane_property(drm_dev, plane, "CRTC_Y", vis_area.y1);
+        drm_add_extra_plane_property(drm_dev, plane, "CRTC_W", lv_area_get_width(&vis_area));
+        drm_add_extra_plane_property(drm_dev, plane, "CRTC_H", lv_area_get_height(&vis_area));
+        drm_set_overlay_zpos(drm_dev);
+    }
+    else if(drm_dev->overlay_dirty && drm_dev->overlay_plane.id) {
+        drm_add_extra_plane_property(drm_dev, &drm_dev->overlay_plane, "FB_ID", 0);
+        drm_add_extra_plane_property(drm_dev, &drm_dev->overlay_plane, "CRTC_ID", 0);
+    }
+
+    ret = drmModeAtomicCommit(drm_dev->fd, drm_dev->req, DRM_MODE_PAGE_FLIP_EVENT | DRM_MODE_ATOMIC_NONBLOCK, drm_dev);
+    if(ret) {
+        ret = -errno;
+        drmModeAtomicFree(drm_dev->req);
+        drm_dev->req = NULL;
+        return ret;
+    }
+
+    if(drm_dev->overlay_dirty) {
+        /* The primary plane was not updated under the overlay plane, redraw the uncovered part */
+        lv_area_t old_area = drm_dev->overlay_area;
+        bool old_shown = drm_dev->overlay_shown;
+
+        drm_dev->overlay_shown = overlay_visible;
+        if(overlay_visible) {
+            drm_dev->overlay_area = vis_area;
+            drm_dev->overlay_buf_idx ^= 1;
+        }
+
+        if(old_shown && (!overlay_visible || !lv_area_is_in(&old_area, &vis_area, 0))) {
+            lv_inv_area(drm_dev->disp, &old_area);
+        }
+    }
+
+    drm_dev->cursor_dirty = false;
+    drm_dev->overlay_dirty = false;
+
+    return 0;
+}
+
+/* Update the planes in the next timer handler call */
+static void drm_planes_schedule(drm_dev_t * drm_dev)
+{
+    if(drm_dev->planes_timer == NULL) {
+        drm_dev->planes_timer = lv_timer_create(planes_timer_cb, PLANES_RETRY_PERIOD, drm_dev);
+    }
+    lv_timer_resume(drm_dev->planes_timer);
+    lv_timer_ready(drm_dev->planes_timer);
+}
+
+/* Update the cursor and overlay planes now or retry a little later if another commit is still pending */
+static void drm_planes_update(drm_dev_t * drm_dev)
+{
+    if(!drm_dev->cursor_dirty && !drm_dev->overlay_dirty) {
+        lv_timer_pause(drm_dev->planes_timer);
+        return;
+    }
+
+    /* Process the completed page flip without blocking */
+    if(drm_dev->req) {
+        struct pollfd pfd = {.fd = drm_dev->fd, .events = POLLIN};
+        if(poll(&pfd, 1, 0) > 0) drmHandleEvent(drm_dev->fd, &drm_dev->drm_event_ctx);
+    }
+
+    /* Can't commit before the first mode set or while a commit is pending */
+    if(!drm_dev->crtc_active || drm_dev->req) return;
+
+    int ret = 0;
+    if(drm_dev->overlay_dirty && drm_dev->overlay_obj) ret = drm_overlay_draw(drm_dev);
+    if(ret == 0) ret = drm_planes_commit(drm_dev);
+
+    if(ret == 0) {
+        lv_timer_pause(drm_dev->planes_timer);
+    }
+    else if(ret != -EBUSY) {
+        LV_LOG_WARN("Plane commit failed: %s, falling back to software rendering", strerror(-ret));
+        if(drm_dev->cursor_obj) {
+            lv_obj_t * cursor = drm_dev->cursor_obj;
+            drm_cursor_release(drm_dev);
+            lv_obj_remove_flag(cursor, LV_OBJ_FLAG_HIDDEN);
+        }
+        if(drm_dev->overlay_obj) drm_overlay_release(drm_dev);
+
+        /* Don't retry to hide the planes */
+        drm_dev->cursor_dirty = false;
+        drm_dev->overlay_dirty = false;
+        drm_dev->overlay_shown = false;
+        lv_timer_pause(drm_dev->planes_timer);
+    }
+}
+
+static void cursor_event_cb(lv_event_t * e)
+{
+    drm_dev_t * drm_dev = lv_event_get_user_data(e);
+    lv_obj_t * cursor = lv_event_get_target(e);
+
+    if(lv_event_get_code(e) == LV_EVENT_DELETE) {
+        drm_cursor_release(drm_dev);
+        return;
+    }
+
+    /* Moving the cursor object sets its x and y style properties */
+    int32_t x = lv_obj_get_style_x(cursor, LV_PART_MAIN);
+    int32_t y = lv_obj_get_style_y(cursor, LV_PART_MAIN);
+    if(x == drm_dev->cursor_x && y == drm_dev->cursor_y) return;
+
+    /* x and y are set one after the other, commit them together a little later */
+    drm_dev->cursor_x = x;
+    drm_dev->cursor_y = y;
+    drm_dev->cursor_dirty = true;
+    drm_planes_schedule(drm_dev);
+}
+
+static void overlay_event_cb(lv_event_t * e)
+{
+    drm_dev_t * drm_dev = lv_event_get_user_data(e);
+    drm_overlay_release(drm_dev);
+}
+
+static void overlay_render_cb(lv_event_t * e)
+{
+    drm_dev_t * drm_dev = lv_event_get_user_data(e);
+    lv_obj_t * obj = drm_dev->overlay_obj;
+
+    if(lv_event_get_code(e) == LV_EVENT_RENDER_READY) {
+        if(drm_dev->overlay_hidden) {
+            obj->flags &= ~LV_OBJ_FLAG_HIDDEN;
+            drm_dev->overlay_hidden = false;
+        }
+        return;
+    }
+
+    /* Hidden by the application, nothing to exclude */
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+
+    /* Skip the Widget and its children on the primary plane. Set the flag directly as
+     * lv_obj_add_flag() would invalidate the Widget and the layout is already updated. */
+    obj->flags |= LV_OBJ_FLAG_HIDDEN;
+    drm_dev->overlay_hidden = true;
+
+    /* The Widget was moved or resized, or an area next to it is redrawn */
+    lv_display_t * disp = drm_dev->disp;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(disp->inv_area_joined[i] == 0 && lv_area_is_on(&disp->inv_areas[i], &obj->coords)) {
+            drm_dev->overlay_dirty = true;
+            drm_planes_schedule(drm_dev);
+            break;
+        }
+    }
+}
+
+/* Put the overlay plane above the primary plane if its z-position can be changed.
+ * Stay below the top of the range so that the cursor plane can still be above it. */
+static void drm_set_overlay_zpos(drm_dev_t * drm_dev)
+{
+    drm_plane_t * plane = &drm_dev->overlay_plane;
+    uint32_t i;
+    for(i = 0; i < plane->count_props; i++) {
+        drmModePropertyPtr prop = plane->props[i];
+        if(lv_strcmp(prop->name, "zpos") != 0) continue;
+        if((prop->flags & DRM_MODE_PROP_IMMUTABLE) || !(prop->flags & DRM_MODE_PROP_RANGE) || prop->count_values < 2) return;
+
+        uint64_t zpos_min = prop->values[0];
+        uint64_t zpos_max = prop->values[1];
+        drm_add_extra_plane_property(drm_dev, plane, "zpos", zpos_max > zpos_min ? zpos_max - 1 : zpos_min);
+        return;
+    }
+}
+
+static void overlay_invalidate_cb(lv_event_t * e)
+{
+    drm_dev_t * drm_dev = lv_event_get_user_data(e);
+    lv_area_t * area = lv_event_get_invalidated_area(e);
+
+    if(!drm_dev->overlay_shown || lv_refr_get_disp_refreshing() == drm_dev->disp) return;
+    if(!lv_area_is_in(area, &drm_dev->overlay_area, 0)) return;
+
+    /* The area is covered by the overlay plane. Don't redraw the primary plane there,
+     * just update the overlay plane. */
+    area->x2 = area->x1 - 1;
+    drm_dev->overlay_dirty = true;
+    drm_planes_schedule(drm_dev);
+}
+
+static void planes_timer_cb(lv_timer_t * t)
+{
+    drm_planes_update(lv_timer_get_user_data(t));
+}
+
 static uint32_t tick_get_cb(void)
 {
     struct timespec t;
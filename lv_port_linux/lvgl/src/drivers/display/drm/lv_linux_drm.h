@@ -40,6 +40,12 @@ typedef size_t (*lv_linux_drm_select_mode_cb_t)(lv_display_t * disp,
                                                 const lv_linux_drm_mode_t * modes,
                                                 size_t mode_count);
 
+/**
+ * Callback function type called on a vertical blank requested by `lv_linux_drm_request_vblank()`
+ * @param disp pointer to the display object
+ */
+typedef void (*lv_linux_drm_vblank_cb_t)(lv_display_t * disp);
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -89,6 +95,60 @@ char * lv_linux_drm_find_device_path(void);
  */
 void lv_linux_drm_set_mode_cb(lv_display_t * disp, lv_linux_drm_select_mode_cb_t callback);
 
+/**
+ * Get the file descriptor of the opened DRM device, e.g. to wait for its events in an event loop
+ * @param disp pointer to the display object
+ * @return the file descriptor or -1 if the device is not opened
+ */
+int lv_linux_drm_get_fd(lv_display_t * disp);
+
+/**
+ * Handle the pending events of the DRM device, e.g. when its file descriptor became readable in an
+ * event loop. The events are dispatched to the same handlers the driver uses while waiting for a page flip,
+ * so reading them outside of the driver doesn't lose page flips or vertical blanks.
+ * @param disp pointer to the display object
+ */
+void lv_linux_drm_handle_events(lv_display_t * disp);
+
+/**
+ * Set a callback to call on the vertical blanks requested by `lv_linux_drm_request_vblank()`
+ * @param disp      pointer to the display object
+ * @param callback  function to call, or NULL to ignore the vertical blanks
+ */
+void lv_linux_drm_set_vblank_cb(lv_display_t * disp, lv_linux_drm_vblank_cb_t callback);
+
+/**
+ * Request an event on the next vertical blank. The callback set by `lv_linux_drm_set_vblank_cb()`
+ * is called when the event is handled by `lv_linux_drm_handle_events()` or by the driver itself.
+ * @param disp pointer to the display object
+ * @return     LV_RESULT_OK: the event is requested; LV_RESULT_INVALID: the request failed
+ */
+lv_result_t lv_linux_drm_request_vblank(lv_display_t * disp);
+
+/**
+ * Show the cursor of a pointer input device on a hardware cursor plane.
+ * The cursor object (set by `lv_indev_set_cursor()`) must be an image, it's drawn once into
+ * the cursor buffer and hidden, so moving the cursor doesn't cause any rendering.
+ * Set the cursor again after changing the image of the cursor object.
+ * @param disp  pointer to a DRM display
+ * @param indev pointer to an input device with a cursor, or NULL to stop using the cursor plane
+ * @return      LV_RESULT_OK: the cursor plane is used; LV_RESULT_INVALID: there is no usable cursor plane,
+ *              or the image is too large, so the cursor is drawn by software
+ */
+lv_result_t lv_linux_drm_set_cursor(lv_display_t * disp, lv_indev_t * indev);
+
+/**
+ * Show a Widget and its children on a hardware overlay plane above the other Widgets.
+ * Changes of the Widget redraw only the overlay plane, and the screen below the overlay plane
+ * is not redrawn, e.g. a video or camera view doesn't cause rendering on the primary plane.
+ * Other Widgets overlapping the Widget are hidden by the overlay plane.
+ * @param disp  pointer to a DRM display
+ * @param obj   pointer to a Widget on this display, or NULL to stop using the overlay plane
+ * @return      LV_RESULT_OK: the overlay plane is used; LV_RESULT_INVALID: there is no usable overlay plane,
+ *              so the Widget is drawn by software
+ */
+lv_result_t lv_linux_drm_set_overlay_obj(lv_display_t * disp, lv_obj_t * obj);
+
 /**
  * Get the horizontal resolution of a DRM mode
  * @param mode pointer to the DRM mode object
@@ -110,6 +170,13 @@ int32_t lv_linux_drm_mode_get_vertical_resolution(const lv_linux_drm_mode_t * mo
  */
 int32_t lv_linux_drm_mode_get_refresh_rate(const lv_linux_drm_mode_t * mode);
 
+/**
+ * Get the time between two vblanks of a DRM mode, more precisely than the refresh rate
+ * @param mode pointer to the DRM mode object
+ * @return the frame period in microseconds, or 0 if mode is invalid
+ */
+uint32_t lv_linux_drm_mode_get_frame_period(const lv_linux_drm_mode_t * mode);
+
 /**
  * Check if a DRM mode is the preferred mode for the display
  * @param mode pointer to the DRM mode object
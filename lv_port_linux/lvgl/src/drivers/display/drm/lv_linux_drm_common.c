@@ -12,10 +12,14 @@
 #if LV_USE_LINUX_DRM
 
 #include <dirent.h>
+#include <errno.h>
+#include <string.h>
+#include <xf86drm.h>
 #include <xf86drmMode.h>
 
 #include "lv_linux_drm.h"
 #include "../../../stdlib/lv_sprintf.h"
+#include "../../../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
@@ -51,6 +55,26 @@ char * lv_linux_drm_find_device_path(void)
     return find_by_class();
 }
 
+lv_result_t lv_linux_drm_request_vblank(lv_display_t * disp)
+{
+    int fd = lv_linux_drm_get_fd(disp);
+    if(fd < 0) return LV_RESULT_INVALID;
+
+    /* The display is passed to the vblank handler of the driver's event context */
+    drmVBlank vbl;
+    lv_memzero(&vbl, sizeof(vbl));
+    vbl.request.type = DRM_VBLANK_RELATIVE | DRM_VBLANK_EVENT;
+    vbl.request.sequence = 1;
+    vbl.request.signal = (unsigned long)(uintptr_t)disp;
+
+    if(drmWaitVBlank(fd, &vbl) < 0) {
+        LV_LOG_WARN("drmWaitVBlank failed: %s", strerror(errno));
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -117,6 +141,15 @@ int32_t lv_linux_drm_mode_get_refresh_rate(const lv_linux_drm_mode_t * mode)
     return mode->vrefresh;
 }
 
+uint32_t lv_linux_drm_mode_get_frame_period(const lv_linux_drm_mode_t * mode)
+{
+    if(!mode || mode->clock == 0) {
+        return 0;
+    }
+    /* The pixel clock is in kHz */
+    return (uint32_t)((uint64_t)mode->htotal * mode->vtotal * 1000 / mode->clock);
+}
+
 bool lv_linux_drm_mode_is_preferred(const lv_linux_drm_mode_t * mode)
 {
     if(!mode) {
@@ -57,7 +57,9 @@ static drmModeConnector * drm_get_connector(lv_drm_ctx_t * ctx);
 static drmModeModeInfo * drm_get_mode(lv_drm_ctx_t * ctx);
 static drmModeEncoder * drm_get_encoder(lv_drm_ctx_t * ctx);
 static drmModeCrtc * drm_get_crtc(lv_drm_ctx_t * ctx);
+static int drm_do_page_flip(lv_drm_ctx_t * ctx, int timeout_ms);
 static void drm_on_page_flip(int fd, unsigned int frame, unsigned int sec, unsigned int usec, void * data);
+static void drm_on_vblank(int fd, unsigned int frame, unsigned int sec, unsigned int usec, void * data);
 static drm_fb_state_t * drm_fb_state_create(lv_drm_ctx_t * ctx, struct gbm_bo * bo);
 static void drm_fb_state_destroy_cb(struct gbm_bo * bo, void * data);
 static void drm_flip_cb(void * driver_data, bool vsync);
@@ -114,6 +116,7 @@ void lv_linux_drm_set_file(lv_display_t * display, const char * file, int64_t co
     }
 
     lv_display_set_resolution(display, ctx->drm_mode->hdisplay, ctx->drm_mode->vdisplay);
+    lv_display_set_vblank_period(display, lv_linux_drm_mode_get_frame_period(ctx->drm_mode));
 
     ctx->egl_interface = drm_get_egl_interface(ctx);
     ctx->egl_ctx = lv_opengles_egl_context_create(&ctx->egl_interface);
@@ -151,6 +154,43 @@ void lv_linux_drm_set_mode_cb(lv_display_t * disp, lv_linux_drm_select_mode_cb_t
     ctx->mode_select_cb = callback;
 }
 
+int lv_linux_drm_get_fd(lv_display_t * disp)
+{
+    lv_drm_ctx_t * ctx = lv_display_get_driver_data(disp);
+    if(ctx == NULL || ctx->fd <= 0) return -1;
+    return ctx->fd;
+}
+
+void lv_linux_drm_handle_events(lv_display_t * disp)
+{
+    lv_drm_ctx_t * ctx = lv_display_get_driver_data(disp);
+    if(ctx == NULL || ctx->fd <= 0) return;
+    drm_do_page_flip(ctx, 0);
+}
+
+void lv_linux_drm_set_vblank_cb(lv_display_t * disp, lv_linux_drm_vblank_cb_t callback)
+{
+    lv_drm_ctx_t * ctx = lv_display_get_driver_data(disp);
+    if(ctx == NULL) return;
+    ctx->vblank_cb = callback;
+}
+
+lv_result_t lv_linux_drm_set_cursor(lv_display_t * disp, lv_indev_t * indev)
+{
+    LV_UNUSED(disp);
+    LV_UNUSED(indev);
+    LV_LOG_INFO("DRM with EGL support doesn't currently support hardware cursor planes");
+    return LV_RESULT_INVALID;
+}
+
+lv_result_t lv_linux_drm_set_overlay_obj(lv_display_t * disp, lv_obj_t * obj)
+{
+    LV_UNUSED(disp);
+    LV_UNUSED(obj);
+    LV_LOG_INFO("DRM with EGL support doesn't currently support overlay planes");
+    return LV_RESULT_INVALID;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -313,6 +353,7 @@ static int drm_do_page_flip(lv_drm_ctx_t * ctx, int timeout_ms)
     lv_memset(&event_ctx, 0, sizeof(event_ctx));
     event_ctx.version = 2;
     event_ctx.page_flip_handler = drm_on_page_flip;
+    event_ctx.vblank_handler = drm_on_vblank;
 
     struct timeval timeout;
     int status;
@@ -335,8 +376,6 @@ static void drm_on_page_flip(int fd, unsigned int frame, unsigned int sec, unsig
 {
     LV_UNUSED(fd);
     LV_UNUSED(frame);
-    LV_UNUSED(sec);
-    LV_UNUSED(usec);
     lv_drm_ctx_t * ctx = (lv_drm_ctx_t *) data;
 
     if(ctx->gbm_bo_presented) {
@@ -344,6 +383,25 @@ static void drm_on_page_flip(int fd, unsigned int frame, unsigned int sec, unsig
     }
     ctx->gbm_bo_presented = ctx->gbm_bo_flipped;
     ctx->gbm_bo_flipped = NULL;
+
+    /* The event is handled later than the flip happened, convert its CLOCK_MONOTONIC time to tick */
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    int64_t age_us = ((int64_t)now.tv_sec - sec) * 1000000 + now.tv_nsec / 1000 - usec;
+    lv_display_report_vblank(ctx->display, lv_tick_get() - (uint32_t)(LV_MAX(age_us, 0) / 1000));
+}
+
+static void drm_on_vblank(int fd, unsigned int frame, unsigned int sec, unsigned int usec, void * data)
+{
+    LV_UNUSED(fd);
+    LV_UNUSED(frame);
+    LV_UNUSED(sec);
+    LV_UNUSED(usec);
+
+    /* Requested by lv_linux_drm_request_vblank() with the display as user data */
+    lv_display_t * display = data;
+    lv_drm_ctx_t * ctx = lv_display_get_driver_data(display);
+    if(ctx && ctx->vblank_cb) ctx->vblank_cb(display);
 }
 
 static drm_fb_state_t * drm_fb_state_create(lv_drm_ctx_t * ctx, struct gbm_bo * bo)
@@ -52,6 +52,7 @@ typedef struct {
     struct gbm_bo * gbm_bo_presented;
 
     lv_linux_drm_select_mode_cb_t mode_select_cb;
+    lv_linux_drm_vblank_cb_t vblank_cb;
     int fd;
     bool crtc_isset;
 } lv_drm_ctx_t;
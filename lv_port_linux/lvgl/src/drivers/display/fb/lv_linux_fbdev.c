@@ -16,6 +16,7 @@
 #include <fcntl.h>
 #include <sys/mman.h>
 #include <sys/ioctl.h>
+#include <errno.h>
 #include <time.h>
 
 #if LV_LINUX_FBDEV_BSD
@@ -62,12 +63,14 @@ typedef struct {
 #endif /* LV_LINUX_FBDEV_BSD */
 #if LV_LINUX_FBDEV_MMAP
     char * fbp;
-#endif
+#else
     uint8_t * rotated_buf;
     size_t rotated_buf_size;
+#endif
     long int screensize;
     int fbfd;
     bool force_refresh;
+    bool wait_for_vsync;
 } lv_linux_fb_t;
 
 /**********************
@@ -178,6 +181,13 @@ void lv_linux_fbdev_set_file(lv_display_t * disp, const char * file)
         perror("Error reading variable information");
         return;
     }
+
+    /* The pixel clock is in picoseconds */
+    if(dsc->vinfo.pixclock) {
+        uint64_t htotal = dsc->vinfo.left_margin + dsc->vinfo.xres + dsc->vinfo.right_margin + dsc->vinfo.hsync_len;
+        uint64_t vtotal = dsc->vinfo.upper_margin + dsc->vinfo.yres + dsc->vinfo.lower_margin + dsc->vinfo.vsync_len;
+        lv_display_set_vblank_period(disp, (uint32_t)(htotal * vtotal * dsc->vinfo.pixclock / 1000000));
+    }
 #endif /* LV_LINUX_FBDEV_BSD */
 
     LV_LOG_INFO("%dx%d, %dbpp", dsc->vinfo.xres, dsc->vinfo.yres, dsc->vinfo.bits_per_pixel);
@@ -251,6 +261,17 @@ void lv_linux_fbdev_set_force_refresh(lv_display_t * disp, bool enabled)
     dsc->force_refresh = enabled;
 }
 
+void lv_linux_fbdev_set_wait_for_vsync(lv_display_t * disp, bool enabled)
+{
+    lv_linux_fb_t * dsc = lv_display_get_driver_data(disp);
+#if defined(FBIO_WAITFORVSYNC)
+    dsc->wait_for_vsync = enabled;
+#else
+    LV_UNUSED(dsc);
+    if(enabled) LV_LOG_WARN("FBIO_WAITFORVSYNC is not supported");
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -286,93 +307,82 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
         return;
     }
 
-    const lv_color_format_t cf = lv_display_get_color_format(disp);
-    const uint32_t px_size = lv_color_format_get_size(cf);
-
-    lv_area_t rotated_area;
-    const lv_display_rotation_t rotation = lv_display_get_rotation(disp);
-
-    /* Not all framebuffer kernel drivers support hardware rotation, so we need to handle it in software here */
-    if(rotation != LV_DISPLAY_ROTATION_0) {
-        int32_t src_w;
-        int32_t src_h;
-        uint32_t src_stride;
-
-        /* Direct render mode rotation only works if we rotate the whole screen at the same time
-         * To do that, we use the display's resolution and as the area
-         *  we also grab the current draw buffer so that we can rotate the whole display */
-        if(LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_DIRECT) {
-            if(!is_last_flush) {
-                /* We need to wait for the last flush when using direct render mode with rotation*/
-                lv_display_flush_ready(disp);
-                return;
-            }
-            lv_draw_buf_t * draw_buf = lv_display_get_buf_active(disp);
-            src_w = lv_display_get_horizontal_resolution(disp);
-            src_h = lv_display_get_vertical_resolution(disp);
-            src_stride = lv_draw_buf_width_to_stride(src_w, cf);
-            color_p = draw_buf->data;
-            rotated_area.x1 = rotated_area.y1 =  0;
-            lv_area_set_width(&rotated_area, src_w);
-            lv_area_set_height(&rotated_area, src_h);
+#if defined(FBIO_WAITFORVSYNC)
+    /* Copy the last area right after the vblank to avoid tearing */
+    if(dsc->wait_for_vsync && is_last_flush) {
+        uint32_t crtc = 0;
+        if(ioctl(dsc->fbfd, FBIO_WAITFORVSYNC, &crtc) == 0) {
+            lv_display_report_vblank(disp, lv_tick_get());
         }
         else {
-            /* For partial and full render modes, we need to rotate the current area
-             * In Full mode we will rotate the whole display just like with direct render mode
-             * but we don't need to do anything special since the area is already the full area of the display
-             * For Partial mode we will rotate just the part we're currently displaying*/
-            src_w = lv_area_get_width(area);
-            src_h = lv_area_get_height(area);
-            src_stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), cf);
-            rotated_area = *area;
+            perror("ioctl(FBIO_WAITFORVSYNC)");
+            dsc->wait_for_vsync = false;
         }
+    }
+#endif
 
-        lv_display_rotate_area(disp, &rotated_area);
-        const uint32_t dest_stride = lv_draw_buf_width_to_stride(lv_area_get_width(&rotated_area), cf);
-        const size_t buf_size = dest_stride * lv_area_get_height(&rotated_area);
-        if(!dsc->rotated_buf || dsc->rotated_buf_size != buf_size) {
-            dsc->rotated_buf = lv_realloc(dsc->rotated_buf, buf_size);
-            LV_ASSERT_MALLOC(dsc->rotated_buf);
-            dsc->rotated_buf_size = buf_size;
-        }
-        lv_draw_sw_rotate(color_p, dsc->rotated_buf, src_w, src_h, src_stride, dest_stride, rotation, cf);
-        area = &rotated_area;
-        color_p = dsc->rotated_buf;
+    const lv_color_format_t cf = lv_display_get_color_format(disp);
+    const uint32_t px_size = lv_color_format_get_size(cf);
+
+    /* In direct render mode color_p is the whole screen sized draw buffer, so find the area in it */
+    uint32_t src_stride;
+    if(LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_DIRECT) {
+        src_stride = lv_display_get_buf_active(disp)->header.stride;
+        color_p += area->y1 * src_stride + area->x1 * px_size;
     }
+    else {
+        src_stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), cf);
+    }
+
+    const int32_t src_w = lv_area_get_width(area);
+    const int32_t src_h = lv_area_get_height(area);
+
+    /* Not all framebuffer kernel drivers support hardware rotation, so we need to handle it in software here.
+     * Only the flushed area is rotated, in every render mode */
+    const lv_display_rotation_t rotation = lv_display_get_rotation(disp);
+    lv_area_t fb_area = *area;
+    lv_display_rotate_area(disp, &fb_area);
 
     lv_area_t display_area;
     /* vinfo.xres and vinfo.yres will already be 1 less than the actual resolution. i.e: 1023x767 on a 1024x768 screen */
     lv_area_set(&display_area, 0, 0, dsc->vinfo.xres, dsc->vinfo.yres);
 
     /* TODO: Consider rendering the clipped area*/
-    if(!lv_area_is_in(area, &display_area, 0)) {
+    if(!lv_area_is_in(&fb_area, &display_area, 0)) {
         lv_display_flush_ready(disp);
         return;
     }
 
     uint32_t fb_pos =
-        (area->x1 + dsc->vinfo.xoffset) * px_size +
-        (area->y1 + dsc->vinfo.yoffset) * dsc->finfo.line_length;
-
+        (fb_area.x1 + dsc->vinfo.xoffset) * px_size +
+        (fb_area.y1 + dsc->vinfo.yoffset) * dsc->finfo.line_length;
 
-    const int32_t w = lv_area_get_width(area);
-    if(LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_DIRECT && rotation == LV_DISPLAY_ROTATION_0) {
-        uint32_t color_pos =
-            area->x1 * px_size +
-            area->y1 * disp->hor_res * px_size;
-
-        for(int32_t y = area->y1; y <= area->y2; y++) {
-            write_to_fb(dsc, fb_pos, &color_p[color_pos], w * px_size);
+    if(rotation != LV_DISPLAY_ROTATION_0) {
+#if LV_LINUX_FBDEV_MMAP
+        /* Rotate straight into the mapped framebuffer */
+        lv_draw_sw_rotate(color_p, &dsc->fbp[fb_pos], src_w, src_h, src_stride, dsc->finfo.line_length, rotation, cf);
+#else
+        const uint32_t dest_stride = lv_draw_buf_width_to_stride(lv_area_get_width(&fb_area), cf);
+        const size_t buf_size = dest_stride * lv_area_get_height(&fb_area);
+        if(!dsc->rotated_buf || dsc->rotated_buf_size < buf_size) {
+            dsc->rotated_buf = lv_realloc(dsc->rotated_buf, buf_size);
+            LV_ASSERT_MALLOC(dsc->rotated_buf);
+            dsc->rotated_buf_size = buf_size;
+        }
+        lv_draw_sw_rotate(color_p, dsc->rotated_buf, src_w, src_h, src_stride, dest_stride, rotation, cf);
+        const uint8_t * rotated_p = dsc->rotated_buf;
+        for(int32_t y = fb_area.y1; y <= fb_area.y2; y++) {
+            write_to_fb(dsc, fb_pos, rotated_p, lv_area_get_width(&fb_area) * px_size);
             fb_pos += dsc->finfo.line_length;
-            color_pos += disp->hor_res * px_size;
+            rotated_p += dest_stride;
         }
+#endif
     }
     else {
-        const int32_t stride = lv_draw_buf_width_to_stride(w, cf);
-        for(int32_t y = area->y1; y <= area->y2; y++) {
-            write_to_fb(dsc, fb_pos, color_p, w * px_size);
+        for(int32_t y = fb_area.y1; y <= fb_area.y2; y++) {
+            write_to_fb(dsc, fb_pos, color_p, src_w * px_size);
             fb_pos += dsc->finfo.line_length;
-            color_p += stride;
+            color_p += src_stride;
         }
     }
 
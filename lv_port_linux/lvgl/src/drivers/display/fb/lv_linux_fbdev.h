@@ -39,6 +39,14 @@ void lv_linux_fbdev_set_file(lv_display_t * disp, const char * file);
  */
 void lv_linux_fbdev_set_force_refresh(lv_display_t * disp, bool enabled);
 
+/**
+ * Wait for the vblank before copying the last area of a frame to the framebuffer, and
+ * report the vblanks to LVGL for frame pacing (see `lv_display_set_frame_pacing()`).
+ * Tear-free with LV_DISPLAY_RENDER_MODE_FULL or LV_DISPLAY_RENDER_MODE_DIRECT.
+ * Not all framebuffer drivers support `FBIO_WAITFORVSYNC`.
+ */
+void lv_linux_fbdev_set_wait_for_vsync(lv_display_t * disp, bool enabled);
+
 /**********************
  *      MACROS
  **********************/
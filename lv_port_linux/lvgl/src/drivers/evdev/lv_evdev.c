@@ -16,6 +16,7 @@
 #include <sys/types.h>
 #include <dirent.h>
 #include <sys/stat.h>
+#include <time.h>
 #include <sys/param.h> /*To detect BSD*/
 #ifdef BSD
     #include <dev/evdev/input.h>
@@ -45,6 +46,17 @@
 #define REL_XY_MASK ((1 << REL_X) | (1 << REL_Y))
 #define ABS_XY_MASK ((1 << ABS_X) | (1 << ABS_Y))
 #define MAX_TOUCH_POINTS 5
+#define EVDEV_READ_BATCH_SIZE 32 /*Number of events read by one read() call*/
+#define EVDEV_QUEUE_SIZE 64 /*Number of samples waiting to be reported to LVGL*/
+#define EVDEV_MAX_EVENT_AGE 5000 /*Events older than this [ms] get the current time as timestamp*/
+
+#ifdef input_event_sec
+    #define EVDEV_EVENT_SEC(in) ((in)->input_event_sec)
+    #define EVDEV_EVENT_USEC(in) ((in)->input_event_usec)
+#else
+    #define EVDEV_EVENT_SEC(in) ((in)->time.tv_sec)
+    #define EVDEV_EVENT_USEC(in) ((in)->time.tv_usec)
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -68,6 +80,11 @@ typedef struct {
     int key;
     lv_indev_state_t state;
     bool deleting;
+    bool syn_dropped;
+    /*Clock of the event timestamps and its relation to the LVGL ticks*/
+    clockid_t clock_id;
+    int64_t ref_clock_ms;
+    uint32_t ref_tick;
     /* Multi-touch support */
 #if LV_USE_GESTURE_RECOGNITION
     lv_indev_touch_data_t touch_data[MAX_TOUCH_POINTS]; /* Array of touch points for gesture recognition */
@@ -156,155 +173,256 @@ static void _evdev_async_delete_cb(void * user_data)
     lv_indev_delete(indev);
 }
 
-static void _evdev_read(lv_indev_t * indev, lv_indev_data_t * data)
+/**
+ * Sample the clocks once per batch of events so the kernel timestamps
+ * of the events can be converted to LVGL ticks cheaply
+ */
+static void _evdev_clock_sync(lv_evdev_t * dsc)
 {
-    lv_evdev_t * dsc = lv_indev_get_driver_data(indev);
-    LV_ASSERT_NULL(dsc);
+    struct timespec now;
+    dsc->ref_tick = lv_tick_get();
+    if(clock_gettime(dsc->clock_id, &now) == 0) {
+        dsc->ref_clock_ms = (int64_t)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+    }
+    else {
+        dsc->ref_clock_ms = -1;
+    }
+}
 
-    /*Update dsc with buffered events*/
-    struct input_event in = { 0 };
-    ssize_t br;
-    while((br = read(dsc->fd, &in, sizeof(in))) > 0) {
-        if(in.type == EV_REL) {
-            if(in.code == REL_X) dsc->root_x += in.value;
-            else if(in.code == REL_Y) dsc->root_y += in.value;
-        }
-        else if(in.type == EV_ABS) {
+static uint32_t _evdev_event_tick(lv_evdev_t * dsc, const struct input_event * in)
+{
+    if(dsc->ref_clock_ms < 0) return dsc->ref_tick;
+
+    int64_t ev_ms = (int64_t)EVDEV_EVENT_SEC(in) * 1000 + EVDEV_EVENT_USEC(in) / 1000;
+    int64_t age = dsc->ref_clock_ms - ev_ms;
+
+    /*Don't trust the timestamp if the clocks don't match*/
+    if(age < 0 || age > EVDEV_MAX_EVENT_AGE) age = 0;
+
+    return dsc->ref_tick - (uint32_t)age;
+}
+
+/**
+ * Convert the current state of the device to indev data
+ */
+static void _evdev_get_data(lv_indev_t * indev, lv_evdev_t * dsc, lv_indev_data_t * data)
+{
+    switch(lv_indev_get_type(indev)) {
+        case LV_INDEV_TYPE_KEYPAD:
+            data->state = dsc->state;
+            data->key = dsc->key;
+            break;
+        case LV_INDEV_TYPE_POINTER:
 #if LV_USE_GESTURE_RECOGNITION
-            if(in.code == ABS_MT_SLOT) {
-                if(in.value >= MAX_TOUCH_POINTS) {
-                    dsc->current_slot = MAX_TOUCH_POINTS - 1;
-                    dsc->touch_count = MAX_TOUCH_POINTS;
-                    LV_LOG_WARN("Touch point slot out of range, setting to max: %d", MAX_TOUCH_POINTS - 1);
-                }
-                else {
-                    dsc->current_slot = in.value;
-                    dsc->touch_count = LV_MAX(dsc->touch_count, dsc->current_slot + 1);
-                    LV_LOG_TRACE("Slot changed to %d, touch_count=%d", dsc->current_slot, dsc->touch_count);
-                }
+            if(dsc->touch_count > 0) {
+                data->state = dsc->touch_data[0].state;
+                data->point = _evdev_process_pointer(indev, dsc->touch_data[0].point.x, dsc->touch_data[0].point.y);
             }
-            else
+            else {
+                data->state = dsc->state;
+                data->point = _evdev_process_pointer(indev, dsc->root_x, dsc->root_y);
+            }
+#else
+            data->state = dsc->state;
+            data->point = _evdev_process_pointer(indev, dsc->root_x, dsc->root_y);
 #endif
-                if(in.code == ABS_X || in.code == ABS_MT_POSITION_X) {
-                    dsc->root_x = in.value;
+            break;
+        default:
+            break;
+    }
+}
+
+static void _evdev_process_event(lv_indev_t * indev, lv_evdev_t * dsc, const struct input_event * in)
+{
+    lv_indev_data_t sample;
+
+    if(dsc->syn_dropped) {
+        /*The kernel buffer overflowed, skip the incomplete frame*/
+        if(in->type == EV_SYN && in->code == SYN_REPORT) dsc->syn_dropped = false;
+        return;
+    }
+
+    if(in->type == EV_REL) {
+        if(in->code == REL_X) dsc->root_x += in->value;
+        else if(in->code == REL_Y) dsc->root_y += in->value;
+    }
+    else if(in->type == EV_ABS) {
 #if LV_USE_GESTURE_RECOGNITION
-                    if(in.code == ABS_MT_POSITION_X && dsc->current_slot < MAX_TOUCH_POINTS) {
-                        dsc->touch_data[dsc->current_slot].point.x = in.value;
-                        dsc->touch_data_changed = true;
-                        LV_LOG_TRACE("MT_X update: slot=%d, x=%d", dsc->current_slot, in.value);
-                    }
+        if(in->code == ABS_MT_SLOT) {
+            if(in->value >= MAX_TOUCH_POINTS) {
+                dsc->current_slot = MAX_TOUCH_POINTS - 1;
+                dsc->touch_count = MAX_TOUCH_POINTS;
+                LV_LOG_WARN("Touch point slot out of range, setting to max: %d", MAX_TOUCH_POINTS - 1);
+            }
+            else {
+                dsc->current_slot = in->value;
+                dsc->touch_count = LV_MAX(dsc->touch_count, dsc->current_slot + 1);
+                LV_LOG_TRACE("Slot changed to %d, touch_count=%d", dsc->current_slot, dsc->touch_count);
+            }
+        }
+        else
 #endif
-                }
-                else if(in.code == ABS_Y || in.code == ABS_MT_POSITION_Y) {
-                    dsc->root_y = in.value;
+            if(in->code == ABS_X || in->code == ABS_MT_POSITION_X) {
+                dsc->root_x = in->value;
 #if LV_USE_GESTURE_RECOGNITION
-                    if(in.code == ABS_MT_POSITION_Y && dsc->current_slot < MAX_TOUCH_POINTS) {
-                        dsc->touch_data[dsc->current_slot].point.y = in.value;
-                        dsc->touch_data_changed = true;
-                        LV_LOG_TRACE("MT_Y update: slot=%d, y=%d", dsc->current_slot, in.value);
-                    }
+                if(in->code == ABS_MT_POSITION_X && dsc->current_slot < MAX_TOUCH_POINTS) {
+                    dsc->touch_data[dsc->current_slot].point.x = in->value;
+                    dsc->touch_data_changed = true;
+                    LV_LOG_TRACE("MT_X update: slot=%d, x=%d", dsc->current_slot, in->value);
+                }
 #endif
+            }
+            else if(in->code == ABS_Y || in->code == ABS_MT_POSITION_Y) {
+                dsc->root_y = in->value;
+#if LV_USE_GESTURE_RECOGNITION
+                if(in->code == ABS_MT_POSITION_Y && dsc->current_slot < MAX_TOUCH_POINTS) {
+                    dsc->touch_data[dsc->current_slot].point.y = in->value;
+                    dsc->touch_data_changed = true;
+                    LV_LOG_TRACE("MT_Y update: slot=%d, y=%d", dsc->current_slot, in->value);
                 }
-                else if(in.code == ABS_MT_TRACKING_ID) {
-                    if(in.value == -1) dsc->state = LV_INDEV_STATE_RELEASED;
-                    else dsc->state = LV_INDEV_STATE_PRESSED;
+#endif
+            }
+            else if(in->code == ABS_MT_TRACKING_ID) {
+                if(in->value == -1) dsc->state = LV_INDEV_STATE_RELEASED;
+                else dsc->state = LV_INDEV_STATE_PRESSED;
 #if LV_USE_GESTURE_RECOGNITION
-                    if(in.value == -1) {
-                        if(dsc->current_slot < MAX_TOUCH_POINTS) {
-                            dsc->touch_data[dsc->current_slot].state = LV_INDEV_STATE_RELEASED;
-                            dsc->touch_data_changed = true;
-                            LV_LOG_TRACE("Touch slot %d released", dsc->current_slot);
-
-                            dsc->touch_count = 0;
-                            for(int i = 0; i < MAX_TOUCH_POINTS; i++) {
-                                if(dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED) {
-                                    dsc->touch_count = i + 1;
-                                }
+                if(in->value == -1) {
+                    if(dsc->current_slot < MAX_TOUCH_POINTS) {
+                        dsc->touch_data[dsc->current_slot].state = LV_INDEV_STATE_RELEASED;
+                        dsc->touch_data_changed = true;
+                        LV_LOG_TRACE("Touch slot %d released", dsc->current_slot);
+
+                        dsc->touch_count = 0;
+                        for(int i = 0; i < MAX_TOUCH_POINTS; i++) {
+                            if(dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED) {
+                                dsc->touch_count = i + 1;
                             }
                         }
                     }
-                    else {
-                        if(dsc->current_slot < MAX_TOUCH_POINTS) {
-                            dsc->touch_data[dsc->current_slot].state = LV_INDEV_STATE_PRESSED;
-                            dsc->touch_data[dsc->current_slot].id = dsc->current_slot;
-                            dsc->touch_count = LV_MAX(dsc->touch_count, dsc->current_slot + 1);
-                            dsc->touch_data_changed = true;
-                            LV_LOG_TRACE("Touch slot %d pressed, touch_count=%d", dsc->current_slot, dsc->touch_count);
-                        }
+                }
+                else {
+                    if(dsc->current_slot < MAX_TOUCH_POINTS) {
+                        dsc->touch_data[dsc->current_slot].state = LV_INDEV_STATE_PRESSED;
+                        dsc->touch_data[dsc->current_slot].id = dsc->current_slot;
+                        dsc->touch_count = LV_MAX(dsc->touch_count, dsc->current_slot + 1);
+                        dsc->touch_data_changed = true;
+                        LV_LOG_TRACE("Touch slot %d pressed, touch_count=%d", dsc->current_slot, dsc->touch_count);
                     }
-#endif
                 }
-        }
-        else if(in.type == EV_KEY) {
-            if(in.code == BTN_MOUSE || in.code == BTN_TOUCH) {
-                if(in.value == 0) dsc->state = LV_INDEV_STATE_RELEASED;
-                else if(in.value == 1) dsc->state = LV_INDEV_STATE_PRESSED;
+#endif
             }
-            else {
-                dsc->key = _evdev_process_key(in.code);
-                if(dsc->key) {
-                    dsc->state = in.value ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
-                    data->continue_reading = true; /*Keep following events in buffer for now*/
-                    break;
-                }
+    }
+    else if(in->type == EV_KEY) {
+        if(in->code == BTN_MOUSE || in->code == BTN_TOUCH) {
+            if(in->value == 0) dsc->state = LV_INDEV_STATE_RELEASED;
+            else if(in->value == 1) dsc->state = LV_INDEV_STATE_PRESSED;
+        }
+        else {
+            dsc->key = _evdev_process_key(in->code);
+            if(dsc->key) {
+                dsc->state = in->value ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+                /*Report every key separately even if they are in the same frame*/
+                lv_memzero(&sample, sizeof(sample));
+                _evdev_get_data(indev, dsc, &sample);
+                sample.timestamp = _evdev_event_tick(dsc, in);
+                lv_indev_push_data(indev, &sample);
             }
         }
+    }
+    else if(in->type == EV_SYN && in->code == SYN_DROPPED) {
+        LV_LOG_WARN("evdev events were dropped by the kernel");
+        dsc->syn_dropped = true;
+    }
+    else if(in->type == EV_SYN && in->code == SYN_REPORT) {
+        if(lv_indev_get_type(indev) != LV_INDEV_TYPE_POINTER) return;
+
+        /*Queue the state of every frame with its own timestamp*/
+        lv_memzero(&sample, sizeof(sample));
+        _evdev_get_data(indev, dsc, &sample);
+        sample.timestamp = _evdev_event_tick(dsc, in);
+
 #if LV_USE_GESTURE_RECOGNITION
-        else if(in.type == EV_SYN && in.code == SYN_REPORT) {
-            /* Handle gesture recognition at sync event */
-            if(dsc->touch_count > 0 && dsc->touch_data_changed) {
-                LV_LOG_TRACE("=== SYN_REPORT: touch_count=%d ===", dsc->touch_count);
-                for(int i = 0; i < MAX_TOUCH_POINTS; i++) {
-                    if(dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED || dsc->touch_data[i].state == LV_INDEV_STATE_RELEASED) {
-                        LV_LOG_TRACE("Slot %d: state=%s, raw(%d, %d)",
-                                     i,
-                                     dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED ? "PRESSED" : "RELEASED",
-                                     dsc->touch_data[i].point.x, dsc->touch_data[i].point.y);
-                    }
+        /* Handle gesture recognition at sync event */
+        if(dsc->touch_count > 0 && dsc->touch_data_changed) {
+            LV_LOG_TRACE("=== SYN_REPORT: touch_count=%d ===", dsc->touch_count);
+            for(int i = 0; i < MAX_TOUCH_POINTS; i++) {
+                if(dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED || dsc->touch_data[i].state == LV_INDEV_STATE_RELEASED) {
+                    LV_LOG_TRACE("Slot %d: state=%s, raw(%d, %d)",
+                                 i,
+                                 dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED ? "PRESSED" : "RELEASED",
+                                 dsc->touch_data[i].point.x, dsc->touch_data[i].point.y);
                 }
+            }
 
-                /* Create a temporary array with calibrated coordinates for gesture recognition */
-                lv_indev_touch_data_t calibrated_touch_data[MAX_TOUCH_POINTS];
+            /* Create a temporary array with calibrated coordinates for gesture recognition */
+            lv_indev_touch_data_t calibrated_touch_data[MAX_TOUCH_POINTS];
 
-                int active_touches = 0;
+            int active_touches = 0;
 
-                for(int i = 0; i < MAX_TOUCH_POINTS; i++) {
-                    if(dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED || dsc->touch_data[i].state == LV_INDEV_STATE_RELEASED) {
-                        calibrated_touch_data[active_touches] = dsc->touch_data[i];
+            for(int i = 0; i < MAX_TOUCH_POINTS; i++) {
+                if(dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED || dsc->touch_data[i].state == LV_INDEV_STATE_RELEASED) {
+                    calibrated_touch_data[active_touches] = dsc->touch_data[i];
 
-                        lv_point_t calib_point = _evdev_process_pointer(indev, dsc->touch_data[i].point.x, dsc->touch_data[i].point.y);
-                        calibrated_touch_data[active_touches].point = calib_point;
+                    lv_point_t calib_point = _evdev_process_pointer(indev, dsc->touch_data[i].point.x, dsc->touch_data[i].point.y);
+                    calibrated_touch_data[active_touches].point = calib_point;
 
-                        LV_LOG_TRACE("Touch %d (slot %d): state=%s, raw(%d, %d) -> calib(%d, %d)",
-                                     active_touches, i,
-                                     dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED ? "PRESSED" : "RELEASED",
-                                     dsc->touch_data[i].point.x, dsc->touch_data[i].point.y,
-                                     calib_point.x, calib_point.y);
-                        active_touches++;
-                    }
+                    LV_LOG_TRACE("Touch %d (slot %d): state=%s, raw(%d, %d) -> calib(%d, %d)",
+                                 active_touches, i,
+                                 dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED ? "PRESSED" : "RELEASED",
+                                 dsc->touch_data[i].point.x, dsc->touch_data[i].point.y,
+                                 calib_point.x, calib_point.y);
+                    active_touches++;
                 }
+            }
 
-                LV_LOG_TRACE("Gesture recognition: %d touches detected", active_touches);
-                lv_indev_gesture_recognizers_update(indev, calibrated_touch_data, active_touches);
-                lv_indev_gesture_recognizers_set_data(indev, data);
-
-                /* Clear RELEASED touch points after gesture recognition to prevent duplicate processing */
-                for(int i = 0; i < MAX_TOUCH_POINTS; i++) {
-                    if(dsc->touch_data[i].state == LV_INDEV_STATE_RELEASED) {
-                        /* Mark touch point as invalid by zeroing out the data */
-                        dsc->touch_data[i].point.x = 0;
-                        dsc->touch_data[i].point.y = 0;
-                        dsc->touch_data[i].id = -1; /* Mark as invalid */
-                        /* Note: We keep the RELEASED state for this frame, it will be naturally
-                         * cleared when new touch events come in or when all touches end */
-                        LV_LOG_TRACE("Cleared released touch point slot %d", i);
-                    }
+            LV_LOG_TRACE("Gesture recognition: %d touches detected", active_touches);
+            lv_indev_gesture_recognizers_update(indev, calibrated_touch_data, active_touches);
+            lv_indev_gesture_recognizers_set_data(indev, &sample);
+
+            /* Clear RELEASED touch points after gesture recognition to prevent duplicate processing */
+            for(int i = 0; i < MAX_TOUCH_POINTS; i++) {
+                if(dsc->touch_data[i].state == LV_INDEV_STATE_RELEASED) {
+                    /* Mark touch point as invalid by zeroing out the data */
+                    dsc->touch_data[i].point.x = 0;
+                    dsc->touch_data[i].point.y = 0;
+                    dsc->touch_data[i].id = -1; /* Mark as invalid */
+                    /* Note: We keep the RELEASED state for this frame, it will be naturally
+                     * cleared when new touch events come in or when all touches end */
+                    LV_LOG_TRACE("Cleared released touch point slot %d", i);
                 }
-
-                dsc->touch_data_changed = false;
             }
+
+            dsc->touch_data_changed = false;
         }
 #endif
+
+        /*If the queue is full the frame is lost but the final state is still reported*/
+        lv_indev_push_data(indev, &sample);
+    }
+}
+
+static void _evdev_read(lv_indev_t * indev, lv_indev_data_t * data)
+{
+    lv_evdev_t * dsc = lv_indev_get_driver_data(indev);
+    LV_ASSERT_NULL(dsc);
+
+    /* Read the pending events in batches of EVDEV_READ_BATCH_SIZE (32) events and queue
+     * them frame by frame in the queue of EVDEV_QUEUE_SIZE (64) samples. A batch can add
+     * as many samples as it has events, so read only while a full batch fits in the queue
+     * and leave the rest in the kernel buffer. */
+    struct input_event in[EVDEV_READ_BATCH_SIZE];
+    ssize_t br = 0;
+    while(lv_indev_get_sample_queue_space(indev) >= EVDEV_READ_BATCH_SIZE &&
+          (br = read(dsc->fd, in, sizeof(in))) > 0) {
+        _evdev_clock_sync(dsc);
+
+        size_t cnt = (size_t)br / sizeof(in[0]);
+        for(size_t i = 0; i < cnt; i++) {
+            _evdev_process_event(indev, dsc, &in[i]);
+        }
+
+        /*A partial batch means the kernel buffer is empty*/
+        if(cnt < EVDEV_READ_BATCH_SIZE) break;
     }
 
     if(!dsc->deleting && br == -1 && errno != EAGAIN) {
@@ -318,30 +436,9 @@ static void _evdev_read(lv_indev_t * indev, lv_indev_data_t * data)
         dsc->deleting = true;
     }
 
-    /*Process and store in data*/
-    switch(lv_indev_get_type(indev)) {
-        case LV_INDEV_TYPE_KEYPAD:
-            data->state = dsc->state;
-            data->key = dsc->key;
-            break;
-        case LV_INDEV_TYPE_POINTER:
-#if LV_USE_GESTURE_RECOGNITION
-            if(dsc->touch_count > 0) {
-                data->state = dsc->touch_data[0].state;
-                data->point = _evdev_process_pointer(indev, dsc->touch_data[0].point.x, dsc->touch_data[0].point.y);
-            }
-            else {
-                data->state = dsc->state;
-                data->point = _evdev_process_pointer(indev, dsc->root_x, dsc->root_y);
-            }
-#else
-            data->state = dsc->state;
-            data->point = _evdev_process_pointer(indev, dsc->root_x, dsc->root_y);
-#endif
-            break;
-        default:
-            break;
-    }
+    /* The queued frames are reported by LVGL one by one.
+     * Report the current state too in case nothing was queued. */
+    _evdev_get_data(indev, dsc, data);
 }
 
 static void _evdev_indev_delete_cb(lv_event_t * e)
@@ -544,6 +641,19 @@ lv_indev_t * lv_evdev_create_fd(lv_indev_type_t indev_type, int fd)
         goto err_after_malloc;
     }
 
+    /* The events are timestamped with the realtime clock by default which can jump.
+     * Ask for monotonic timestamps if it's supported. */
+    dsc->clock_id = CLOCK_REALTIME;
+#ifdef EVIOCSCLOCKID
+    int clock_id = CLOCK_MONOTONIC;
+    if(ioctl(dsc->fd, EVIOCSCLOCKID, &clock_id) == 0) {
+        dsc->clock_id = CLOCK_MONOTONIC;
+    }
+    else {
+        LV_LOG_INFO("ioctl EVIOCSCLOCKID failed: %s", strerror(errno));
+    }
+#endif
+
     /* Detect the minimum and maximum values of the input device for calibration. */
 
     if(indev_type == LV_INDEV_TYPE_POINTER) {
@@ -570,6 +680,10 @@ lv_indev_t * lv_evdev_create_fd(lv_indev_type_t indev_type, int fd)
     lv_indev_set_read_cb(indev, _evdev_read);
     lv_indev_set_driver_data(indev, dsc);
     lv_indev_add_event_cb(indev, _evdev_indev_delete_cb, LV_EVENT_DELETE, NULL);
+    if(lv_indev_set_sample_queue_size(indev, EVDEV_QUEUE_SIZE) != LV_RESULT_OK) {
+        lv_indev_delete(indev);
+        return NULL;
+    }
 
     return indev;
 
@@ -668,6 +782,13 @@ void lv_evdev_set_calibration(lv_indev_t * indev, int min_x, int min_y, int max_
     dsc->max_y = max_y;
 }
 
+int lv_evdev_get_fd(lv_indev_t * indev)
+{
+    lv_evdev_t * dsc = lv_indev_get_driver_data(indev);
+    LV_ASSERT_NULL(dsc);
+    return dsc->fd;
+}
+
 void lv_evdev_delete(lv_indev_t * indev)
 {
     lv_indev_delete(indev);
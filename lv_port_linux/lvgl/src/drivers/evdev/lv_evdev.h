@@ -91,6 +91,14 @@ void lv_evdev_set_swap_axes(lv_indev_t * indev, bool swap_axes);
  */
 void lv_evdev_set_calibration(lv_indev_t * indev, int min_x, int min_y, int max_x, int max_y);
 
+/**
+ * Get the file descriptor of the input device, e.g. to read the device
+ * only when it has new events with `LV_INDEV_MODE_EVENT`.
+ * @param indev evdev input device
+ * @return the file descriptor of the device
+ */
+int lv_evdev_get_fd(lv_indev_t * indev);
+
 /**
  * Remove evdev input device.
  * @param indev evdev input device to close and free
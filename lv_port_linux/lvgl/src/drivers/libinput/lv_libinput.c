@@ -55,10 +55,9 @@ static void _reset_scanned_devices(void);
 static void * _poll_thread(void * data);
 
 lv_libinput_event_t * _get_event(lv_libinput_t * state);
-bool _event_pending(lv_libinput_t * state);
 lv_libinput_event_t * _create_event(lv_libinput_t * state);
 
-static void _read(lv_indev_t * indev, lv_indev_data_t * data);
+static void _push_events(lv_indev_t * indev, lv_libinput_t * dsc);
 static void _read_pointer(lv_libinput_t * state, struct libinput_event * event);
 static void _read_keypad(lv_libinput_t * state, struct libinput_event * event);
 
@@ -175,11 +174,17 @@ lv_indev_t * lv_libinput_create(lv_indev_type_t indev_type, const char * dev_pat
         return NULL;
     }
     lv_indev_set_type(indev, indev_type);
-    lv_indev_set_read_cb(indev, _read);
     lv_indev_set_driver_data(indev, dsc);
 
-    /* Set up thread & lock */
-    pthread_mutex_init(&dsc->event_lock, NULL);
+    /* The worker thread pushes the events into the sample queue of the indev, no read_cb is needed */
+    if(lv_indev_set_sample_queue_size(indev, LV_LIBINPUT_MAX_EVENTS) != LV_RESULT_OK) {
+        _delete(dsc);
+        lv_indev_delete(indev);
+        return NULL;
+    }
+    dsc->indev = indev;
+
+    /* Set up thread */
     pthread_create(&dsc->worker_thread, NULL, _poll_thread, dsc);
 
     return indev;
@@ -327,13 +332,12 @@ static void * _poll_thread(void * data)
                 break;
         }
         libinput_dispatch(dsc->libinput_context);
-        pthread_mutex_lock(&dsc->event_lock);
         while((event = libinput_get_event(dsc->libinput_context)) != NULL) {
             _read_pointer(dsc, event);
             _read_keypad(dsc, event);
             libinput_event_destroy(event);
+            _push_events(dsc->indev, dsc);
         }
-        pthread_mutex_unlock(&dsc->event_lock);
         LV_LOG_INFO("libinput: event read");
     }
 
@@ -354,11 +358,6 @@ lv_libinput_event_t * _get_event(lv_libinput_t * dsc)
     return evt;
 }
 
-bool _event_pending(lv_libinput_t * dsc)
-{
-    return dsc->start != dsc->end;
-}
-
 lv_libinput_event_t * _create_event(lv_libinput_t * dsc)
 {
     lv_libinput_event_t * evt = &dsc->points[dsc->end];
@@ -380,30 +379,27 @@ lv_libinput_event_t * _create_event(lv_libinput_t * dsc)
     return evt;
 }
 
-static void _read(lv_indev_t * indev, lv_indev_data_t * data)
+/**
+ * Push the events created for a libinput event into the sample queue of the indev.
+ * Only the worker thread pushes samples, so no locking is needed.
+ */
+static void _push_events(lv_indev_t * indev, lv_libinput_t * dsc)
 {
-    lv_libinput_t * dsc = lv_indev_get_driver_data(indev);
-    LV_ASSERT_NULL(dsc);
-
-    pthread_mutex_lock(&dsc->event_lock);
-
-    lv_libinput_event_t * evt = _get_event(dsc);
-
-    if(!evt)
-        evt = &dsc->last_event; /* indev expects us to report the most recent state */
-
-    data->point = evt->point;
-    data->state = evt->pressed;
-    data->key = evt->key_val;
-    data->continue_reading = _event_pending(dsc);
-
-    dsc->last_event = *evt; /* Remember the last event for the next call */
-
-    pthread_mutex_unlock(&dsc->event_lock);
+    lv_libinput_event_t * evt;
+    while((evt = _get_event(dsc)) != NULL) {
+        lv_indev_data_t data;
+        lv_memzero(&data, sizeof(data));
+        data.point = evt->point;
+        data.state = evt->pressed;
+        data.key = evt->key_val;
+
+        /* The timestamp is set to the time of the push, not when LVGL reads the indev */
+        if(lv_indev_push_data(indev, &data) != LV_RESULT_OK) {
+            LV_LOG_INFO("libinput: sample queue is full, dropping an event");
+        }
 
-    if(evt)
-        LV_LOG_TRACE("libinput_read: (%04d, %04d): %d continue_reading? %d", data->point.x, data->point.y, data->state,
-                     data->continue_reading);
+        LV_LOG_TRACE("libinput: pushed (%04d, %04d): %d", data.point.x, data.point.y, data.state);
+    }
 }
 
 static void _read_pointer(lv_libinput_t * dsc, struct libinput_event * event)
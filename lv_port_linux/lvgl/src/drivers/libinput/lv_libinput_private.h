@@ -40,7 +40,8 @@ struct _lv_libinput_t {
     int fd;
     struct pollfd fds[1];
 
-    /* The points array is implemented as a circular LIFO queue */
+    /* The events created for a libinput event by the worker thread before they are pushed
+     * into the sample queue of the indev. The points array is implemented as a circular FIFO queue */
     lv_libinput_event_t points[LV_LIBINPUT_MAX_EVENTS]; /* Event buffer */
     lv_libinput_event_t slots[2]; /* Realtime state of up to 2 fingers to handle multitouch */
 
@@ -50,11 +51,8 @@ struct _lv_libinput_t {
 
     int start; /* Index of start of event queue */
     int end; /* Index of end of queue*/
-    lv_libinput_event_t last_event; /* Report when no new events
-                                   * to keep indev state consistent
-                                   */
+    lv_indev_t * indev; /* The samples are pushed into the queue of this indev */
     bool deinit; /* Tell worker thread to quit */
-    pthread_mutex_t event_lock;
     pthread_t worker_thread;
 
     struct libinput * libinput_context;
@@ -13,6 +13,7 @@
 #include "lv_opengles_window.h"
 #include "lv_opengles_driver.h"
 #include "lv_opengles_texture.h"
+#include "lv_opengles_texture_private.h"
 #include "lv_opengles_private.h"
 #include "lv_opengles_debug.h"
 
@@ -56,6 +57,10 @@ struct _lv_opengles_window_texture_t {
     unsigned int texture_id; /* 0 if it's a window display */
     lv_display_t * disp; /* non-NULL if it's a display texture or a window display */
     uint8_t * fb; /* non-NULL if it's a window display and !DRAW_OPENGLES */
+#if !LV_USE_DRAW_OPENGLES
+    unsigned int fb_texture_id; /* the texture `fb` is uploaded to if it's a window display */
+    lv_opengles_texture_upload_t upload; /* the areas of `fb` changed since the last upload */
+#endif
     lv_area_t area;
     lv_opa_t opa;
     lv_indev_t * indev;
@@ -85,7 +90,7 @@ static void framebuffer_size_callback(GLFWwindow * window, int width, int height
 static void window_display_delete_cb(lv_event_t * e);
 static void window_display_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 #if !LV_USE_DRAW_OPENGLES
-    static void ensure_init_window_display_texture(void);
+    static void window_display_texture_update(lv_opengles_window_texture_t * texture);
 #endif
 
 /**********************
@@ -95,9 +100,6 @@ static bool glfw_inited;
 static bool glew_inited;
 static lv_timer_t * update_handler_timer;
 static lv_ll_t glfw_window_ll;
-#if !LV_USE_DRAW_OPENGLES
-    static unsigned int window_display_texture;
-#endif
 
 /**********************
  *      MACROS
@@ -188,12 +190,6 @@ void lv_opengles_window_delete(lv_opengles_window_t * window)
 
     if(lv_ll_is_empty(&glfw_window_ll)) {
         lv_glfw_window_quit();
-#if !LV_USE_DRAW_OPENGLES
-        if(window_display_texture) {
-            GL_CALL(glDeleteTextures(1, &window_display_texture));
-            window_display_texture = 0;
-        }
-#endif
     }
 }
 
@@ -506,34 +502,9 @@ static void window_update_handler(lv_timer_t * t)
                 lv_display_set_default(default_save);
 
 #if !LV_USE_DRAW_OPENGLES
-                ensure_init_window_display_texture();
-
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, window_display_texture));
-
-                /* set the dimensions and format to complete the texture */
-                /* Color depth: 8 (L8), 16 (RGB565), 24 (RGB888), 32 (XRGB8888) */
-#if LV_COLOR_DEPTH == 8
-                GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, lv_area_get_width(&texture->area), lv_area_get_height(&texture->area), 0,
-                                     GL_RED, GL_UNSIGNED_BYTE, texture->fb));
-#elif LV_COLOR_DEPTH == 16
-                GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB565, lv_area_get_width(&texture->area), lv_area_get_height(&texture->area),
-                                     0, GL_RGB, GL_UNSIGNED_SHORT_5_6_5,
-                                     texture->fb));
-#elif LV_COLOR_DEPTH == 24
-                GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, lv_area_get_width(&texture->area), lv_area_get_height(&texture->area), 0,
-                                     GL_BGR, GL_UNSIGNED_BYTE, texture->fb));
-#elif LV_COLOR_DEPTH == 32
-                GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, lv_area_get_width(&texture->area), lv_area_get_height(&texture->area),
-                                     0, GL_BGRA, GL_UNSIGNED_BYTE, texture->fb));
-#else
-#error("Unsupported color format")
-#endif
-
-                GL_CALL(glGenerateMipmap(GL_TEXTURE_2D));
+                window_display_texture_update(texture);
 
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, 0));
-
-                lv_opengles_render_texture(window_display_texture, &texture->area, texture->opa, window->hor_res, window->ver_res,
+                lv_opengles_render_texture(texture->fb_texture_id, &texture->area, texture->opa, window->hor_res, window->ver_res,
                                            &texture->area, window->h_flip, window->v_flip);
 #endif
             }
@@ -660,34 +631,82 @@ static void window_display_delete_cb(lv_event_t * e)
     lv_display_t * disp = lv_event_get_target(e);
     lv_opengles_window_texture_t * dsc = lv_display_get_driver_data(disp);
     free(dsc->fb);
+#if !LV_USE_DRAW_OPENGLES
+    lv_opengles_texture_upload_deinit(&dsc->upload);
+    if(dsc->fb_texture_id) {
+        GL_CALL(glDeleteTextures(1, &dsc->fb_texture_id));
+    }
+#endif
     lv_opengles_window_texture_remove(dsc);
 }
 
 static void window_display_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
 {
-    LV_UNUSED(area);
     LV_UNUSED(px_map);
+#if !LV_USE_DRAW_OPENGLES
+    /*Collect the rendered areas, they are uploaded when the window is rendered*/
+    lv_opengles_window_texture_t * dsc = lv_display_get_driver_data(disp);
+    lv_opengles_texture_upload_add_area(&dsc->upload, area);
+#else
+    LV_UNUSED(area);
+#endif
     lv_display_flush_ready(disp);
 }
 
 #if !LV_USE_DRAW_OPENGLES
-static void ensure_init_window_display_texture(void)
-{
-    if(window_display_texture) {
+static void window_display_texture_update(lv_opengles_window_texture_t * texture)
+{
+    int32_t w = lv_area_get_width(&texture->area);
+    int32_t h = lv_area_get_height(&texture->area);
+
+    if(texture->fb_texture_id == 0) {
+        GL_CALL(glGenTextures(1, &texture->fb_texture_id));
+        GL_CALL(glBindTexture(GL_TEXTURE_2D, texture->fb_texture_id));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 20));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+
+        /* allocate the texture once, later only the changed areas are uploaded */
+        /* Color depth: 8 (L8), 16 (RGB565), 24 (RGB888), 32 (XRGB8888) */
+#if LV_COLOR_DEPTH == 8
+        GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, w, h, 0, GL_RED, GL_UNSIGNED_BYTE, NULL));
+#elif LV_COLOR_DEPTH == 16
+        GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB565, w, h, 0, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, NULL));
+#elif LV_COLOR_DEPTH == 24
+        GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, w, h, 0, GL_BGR, GL_UNSIGNED_BYTE, NULL));
+#elif LV_COLOR_DEPTH == 32
+        GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_BGRA, GL_UNSIGNED_BYTE, NULL));
+#else
+#error("Unsupported color format")
+#endif
+
+        lv_area_t full;
+        lv_area_set(&full, 0, 0, w - 1, h - 1);
+        texture->upload.area_cnt = 0;
+        lv_opengles_texture_upload_add_area(&texture->upload, &full);
+    }
+    else if(texture->upload.area_cnt == 0) {
+        /* nothing was rendered since the last upload */
         return;
     }
+    else {
+        GL_CALL(glBindTexture(GL_TEXTURE_2D, texture->fb_texture_id));
+    }
+
+    uint32_t stride = lv_draw_buf_width_to_stride(w, lv_display_get_color_format(texture->disp));
+#if LV_COLOR_DEPTH == 8
+    lv_opengles_texture_upload(&texture->upload, texture->fb, stride, 1, GL_RED, GL_UNSIGNED_BYTE);
+#elif LV_COLOR_DEPTH == 16
+    lv_opengles_texture_upload(&texture->upload, texture->fb, stride, 2, GL_RGB, GL_UNSIGNED_SHORT_5_6_5);
+#elif LV_COLOR_DEPTH == 24
+    lv_opengles_texture_upload(&texture->upload, texture->fb, stride, 3, GL_BGR, GL_UNSIGNED_BYTE);
+#elif LV_COLOR_DEPTH == 32
+    lv_opengles_texture_upload(&texture->upload, texture->fb, stride, 4, GL_BGRA, GL_UNSIGNED_BYTE);
+#endif
 
-    GL_CALL(glGenTextures(1, &window_display_texture));
-    GL_CALL(glBindTexture(GL_TEXTURE_2D, window_display_texture));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
-    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
-
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 20));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+    GL_CALL(glGenerateMipmap(GL_TEXTURE_2D));
 
     GL_CALL(glBindTexture(GL_TEXTURE_2D, 0));
 }
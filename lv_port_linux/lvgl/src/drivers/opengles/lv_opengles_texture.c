@@ -14,7 +14,9 @@
 #include "lv_opengles_driver.h"
 
 #include "../../misc/lv_types.h"
+#include "../../misc/lv_area_private.h"
 #include "../../stdlib/lv_mem.h"
+#include "../../stdlib/lv_string.h"
 #include "lv_opengles_private.h"
 #include "lv_opengles_texture_private.h"
 #include "../../display/lv_display_private.h"
@@ -25,23 +27,78 @@
  *      DEFINES
  *********************/
 
+#if LV_OPENGLES_PBO_CNT > 0
+#if LV_USE_EGL
+/*Pixel buffers and fences are core only since OpenGL ES 3.0, the loaded API is 2.0*/
+#define PBO_APIENTRY GLAD_API_PTR
+#ifndef GL_PIXEL_UNPACK_BUFFER
+#define GL_PIXEL_UNPACK_BUFFER 0x88EC
+#endif
+#ifndef GL_MAP_WRITE_BIT
+#define GL_MAP_WRITE_BIT 0x0002
+#endif
+#ifndef GL_MAP_INVALIDATE_RANGE_BIT
+#define GL_MAP_INVALIDATE_RANGE_BIT 0x0004
+#endif
+#ifndef GL_MAP_UNSYNCHRONIZED_BIT
+#define GL_MAP_UNSYNCHRONIZED_BIT 0x0020
+#endif
+#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#endif
+#ifndef GL_SYNC_FLUSH_COMMANDS_BIT
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#endif
+#ifndef GL_WAIT_FAILED
+#define GL_WAIT_FAILED 0x911D
+#endif
+#else
+#define PBO_APIENTRY GLAPIENTRY
+#endif /*LV_USE_EGL*/
+
+#define PBO_WAIT_TIMEOUT_NS 1000000000ull
+#endif /*LV_OPENGLES_PBO_CNT > 0*/
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_OPENGLES_PBO_CNT > 0
+typedef struct {
+    void * (PBO_APIENTRY * map_buffer_range)(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+    GLboolean(PBO_APIENTRY * unmap_buffer)(GLenum target);
+    GLsync(PBO_APIENTRY * fence_sync)(GLenum condition, GLbitfield flags);
+    GLenum(PBO_APIENTRY * client_wait_sync)(GLsync sync, GLbitfield flags, GLuint64 timeout);
+    void (PBO_APIENTRY * delete_sync)(GLsync sync);
+} pbo_api_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
 static lv_display_t * lv_opengles_texture_create_common(int32_t w, int32_t h);
 static unsigned int create_texture(int32_t w, int32_t h);
+static void set_texture_storage(int32_t w, int32_t h);
 static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 static void release_disp_cb(lv_event_t * e);
+static void upload_direct(lv_opengles_texture_upload_t * upload, const uint8_t * buf, uint32_t stride,
+                          uint32_t px_size, unsigned int format, unsigned int type);
+#if LV_OPENGLES_PBO_CNT > 0
+    static bool pbo_api_init(void);
+    static bool upload_pbo(lv_opengles_texture_upload_t * upload, const uint8_t * buf, uint32_t stride,
+                           uint32_t px_size, unsigned int format, unsigned int type);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 
+#if LV_OPENGLES_PBO_CNT > 0
+    static pbo_api_t pbo_api;
+    static int8_t pbo_api_state = -1; /*-1: not checked yet, 0: not supported, 1: supported*/
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -74,6 +131,13 @@ lv_display_t * lv_opengles_texture_create_from_texture_id(int32_t w, int32_t h,
     lv_opengles_texture_t * dsc = lv_display_get_driver_data(disp);
     dsc->texture_id = texture_id;
     dsc->is_texture_owner = false;
+
+#if !LV_USE_DRAW_OPENGLES
+    /*Only the rendered areas are uploaded, so the texture needs the storage for the whole display*/
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, texture_id));
+    set_texture_storage(w, h);
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, GL_NONE));
+#endif
     return disp;
 }
 
@@ -102,6 +166,14 @@ void lv_opengles_texture_reshape(lv_display_t * disp, int32_t width, int32_t hei
         GL_CALL(glDeleteTextures(1, &dsc->texture_id));
     }
     dsc->texture_id = new_texture;
+
+#if !LV_USE_DRAW_OPENGLES
+    /*The new texture is empty, upload everything*/
+    dsc->upload.area_cnt = 0;
+    lv_area_t full;
+    lv_area_set(&full, 0, 0, width - 1, height - 1);
+    lv_opengles_texture_upload_add_area(&dsc->upload, &full);
+#endif
 }
 
 lv_result_t lv_opengles_texture_create_draw_buffers(lv_opengles_texture_t * texture, lv_display_t * display)
@@ -130,6 +202,7 @@ void lv_opengles_texture_deinit(lv_opengles_texture_t * texture)
 {
 #if !LV_USE_DRAW_OPENGLES
     lv_free(texture->fb1);
+    lv_opengles_texture_upload_deinit(&texture->upload);
 #endif /*!LV_USE_DRAW_OPENGLES*/
 
     if(texture->is_texture_owner && texture->texture_id != 0) {
@@ -137,6 +210,57 @@ void lv_opengles_texture_deinit(lv_opengles_texture_t * texture)
     }
 }
 
+void lv_opengles_texture_upload_add_area(lv_opengles_texture_upload_t * upload, const lv_area_t * area)
+{
+    if(upload->area_cnt < LV_OPENGLES_TEXTURE_UPLOAD_AREA_CNT) {
+        upload->areas[upload->area_cnt] = *area;
+        upload->area_cnt++;
+        return;
+    }
+
+    /*Too many areas, upload their bounding box instead*/
+    uint32_t i;
+    for(i = 1; i < upload->area_cnt; i++) {
+        lv_area_join(&upload->areas[0], &upload->areas[0], &upload->areas[i]);
+    }
+    lv_area_join(&upload->areas[0], &upload->areas[0], area);
+    upload->area_cnt = 1;
+}
+
+void lv_opengles_texture_upload(lv_opengles_texture_upload_t * upload, const uint8_t * buf, uint32_t stride,
+                                uint32_t px_size, unsigned int format, unsigned int type)
+{
+    if(upload->area_cnt == 0) return;
+
+#if LV_OPENGLES_PBO_CNT > 0
+    if(!pbo_api_init() || !upload_pbo(upload, buf, stride, px_size, format, type))
+#endif
+    {
+        upload_direct(upload, buf, stride, px_size, format, type);
+    }
+
+    upload->area_cnt = 0;
+}
+
+void lv_opengles_texture_upload_deinit(lv_opengles_texture_upload_t * upload)
+{
+    upload->area_cnt = 0;
+#if LV_OPENGLES_PBO_CNT > 0
+    uint32_t i;
+    for(i = 0; i < LV_OPENGLES_PBO_CNT; i++) {
+        if(upload->fence[i]) {
+            pbo_api.delete_sync(upload->fence[i]);
+            upload->fence[i] = NULL;
+        }
+        if(upload->pbo[i]) {
+            GL_CALL(glDeleteBuffers(1, &upload->pbo[i]));
+            upload->pbo[i] = 0;
+            upload->pbo_size[i] = 0;
+        }
+    }
+#endif
+}
+
 unsigned int lv_opengles_texture_get_texture_id(lv_display_t * disp)
 {
     lv_opengles_texture_t * dsc = lv_display_get_driver_data(disp);
@@ -200,16 +324,7 @@ static unsigned int create_texture(int32_t w, int32_t h)
     GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
     GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
 
-    /* set the dimensions and format to complete the texture */
-    /* Color depth: 16 (RGB565), 32 (XRGB8888) */
-#if LV_COLOR_DEPTH == 16
-    GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB565, w, h, 0, GL_RGB, GL_UNSIGNED_SHORT_5_6_5,
-                         NULL));
-#elif LV_COLOR_DEPTH == 32
-    GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_BGRA, GL_UNSIGNED_BYTE, NULL));
-#else
-#error("Unsupported color format")
-#endif
+    set_texture_storage(w, h);
 
 #if 0
     GL_CALL(glGenerateMipmap(GL_TEXTURE_2D));
@@ -229,35 +344,50 @@ static unsigned int create_texture(int32_t w, int32_t h)
 
 static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
 {
-    LV_UNUSED(area);
     LV_UNUSED(px_map);
 
 #if !LV_USE_DRAW_OPENGLES
-    if(lv_display_flush_is_last(disp)) {
+    lv_opengles_texture_t * dsc = lv_display_get_driver_data(disp);
+    lv_opengles_texture_upload_add_area(&dsc->upload, area);
 
-        lv_opengles_texture_t * dsc = lv_display_get_driver_data(disp);
+    if(lv_display_flush_is_last(disp)) {
         lv_color_format_t cf = lv_display_get_color_format(disp);
         uint32_t stride = lv_draw_buf_width_to_stride(lv_display_get_horizontal_resolution(disp), cf);
 
         GL_CALL(glBindTexture(GL_TEXTURE_2D, dsc->texture_id));
 
-        GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
-        GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, stride / lv_color_format_get_size(cf)));
-        /*Color depth: 16 (RGB565), 32 (XRGB8888)*/
+        /*Upload only the rendered areas. Color depth: 16 (RGB565), 32 (XRGB8888)*/
 #if LV_COLOR_DEPTH == 16
-        GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB565, disp->hor_res, disp->ver_res, 0, GL_RGB, GL_UNSIGNED_SHORT_5_6_5,
-                             dsc->fb1));
+        lv_opengles_texture_upload(&dsc->upload, dsc->fb1, stride, 2, GL_RGB, GL_UNSIGNED_SHORT_5_6_5);
 #elif LV_COLOR_DEPTH == 32
-        GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, disp->hor_res, disp->ver_res, 0, GL_BGRA, GL_UNSIGNED_BYTE, dsc->fb1));
+        lv_opengles_texture_upload(&dsc->upload, dsc->fb1, stride, 4, GL_BGRA, GL_UNSIGNED_BYTE);
 #else
 #error("Unsupported color format")
 #endif
+
+        GL_CALL(glBindTexture(GL_TEXTURE_2D, GL_NONE));
     }
+#else
+    LV_UNUSED(area);
 #endif /* !LV_USE_DRAW_OPENGLES */
 
     lv_display_flush_ready(disp);
 }
 
+static void set_texture_storage(int32_t w, int32_t h)
+{
+    /* set the dimensions and format to complete the texture */
+    /* Color depth: 16 (RGB565), 32 (XRGB8888) */
+#if LV_COLOR_DEPTH == 16
+    GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB565, w, h, 0, GL_RGB, GL_UNSIGNED_SHORT_5_6_5,
+                         NULL));
+#elif LV_COLOR_DEPTH == 32
+    GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_BGRA, GL_UNSIGNED_BYTE, NULL));
+#else
+#error("Unsupported color format")
+#endif
+}
+
 static void release_disp_cb(lv_event_t * e)
 {
     lv_display_t * disp = lv_event_get_user_data(e);
@@ -266,4 +396,147 @@ static void release_disp_cb(lv_event_t * e)
     lv_free(texture);
 }
 
+static void upload_direct(lv_opengles_texture_upload_t * upload, const uint8_t * buf, uint32_t stride,
+                          uint32_t px_size, unsigned int format, unsigned int type)
+{
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, stride / px_size));
+
+    uint32_t i;
+    for(i = 0; i < upload->area_cnt; i++) {
+        const lv_area_t * a = &upload->areas[i];
+        const uint8_t * px = buf + a->y1 * stride + a->x1 * px_size;
+        GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, a->x1, a->y1, lv_area_get_width(a), lv_area_get_height(a),
+                                format, type, px));
+    }
+
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+}
+
+#if LV_OPENGLES_PBO_CNT > 0
+
+/**
+ * Check once if the current context supports pixel buffers, buffer mapping and fences
+ * @return true if they are supported
+ */
+static bool pbo_api_init(void)
+{
+    if(pbo_api_state >= 0) return pbo_api_state == 1;
+    pbo_api_state = 0;
+
+#if LV_USE_EGL
+    /*E.g. "OpenGL ES 3.2 Mesa 24.0.0"*/
+    const char * version = (const char *)glGetString(GL_VERSION);
+    if(version == NULL || lv_strncmp(version, "OpenGL ES ", 10) != 0 || version[10] < '3' || version[10] > '9') {
+        LV_LOG_INFO("OpenGL ES 3.0 is not available, uploading textures directly");
+        return false;
+    }
+    pbo_api.map_buffer_range = (void * (PBO_APIENTRY *)(GLenum, GLintptr, GLsizeiptr, GLbitfield))
+                               eglGetProcAddress("glMapBufferRange");
+    pbo_api.unmap_buffer = (GLboolean(PBO_APIENTRY *)(GLenum))eglGetProcAddress("glUnmapBuffer");
+    pbo_api.fence_sync = (GLsync(PBO_APIENTRY *)(GLenum, GLbitfield))eglGetProcAddress("glFenceSync");
+    pbo_api.client_wait_sync = (GLenum(PBO_APIENTRY *)(GLsync, GLbitfield, GLuint64))
+                               eglGetProcAddress("glClientWaitSync");
+    pbo_api.delete_sync = (void (PBO_APIENTRY *)(GLsync))eglGetProcAddress("glDeleteSync");
+#else
+    if(!(GLEW_VERSION_3_0 || GLEW_ARB_map_buffer_range) || !(GLEW_VERSION_3_2 || GLEW_ARB_sync)) {
+        LV_LOG_INFO("Buffer mapping or fences are not available, uploading textures directly");
+        return false;
+    }
+    pbo_api.map_buffer_range = glMapBufferRange;
+    pbo_api.unmap_buffer = glUnmapBuffer;
+    pbo_api.fence_sync = glFenceSync;
+    pbo_api.client_wait_sync = glClientWaitSync;
+    pbo_api.delete_sync = glDeleteSync;
+#endif
+
+    if(!pbo_api.map_buffer_range || !pbo_api.unmap_buffer || !pbo_api.fence_sync ||
+       !pbo_api.client_wait_sync || !pbo_api.delete_sync) {
+        LV_LOG_WARN("Failed to load the pixel buffer functions, uploading textures directly");
+        return false;
+    }
+
+    pbo_api_state = 1;
+    return true;
+}
+
+/**
+ * Copy the areas to the next pixel buffer of the ring and let the GPU upload them from there.
+ * Waits only if the GPU hasn't finished reading the buffer `LV_OPENGLES_PBO_CNT` frames ago.
+ * @return false if the areas couldn't be uploaded this way
+ */
+static bool upload_pbo(lv_opengles_texture_upload_t * upload, const uint8_t * buf, uint32_t stride,
+                       uint32_t px_size, unsigned int format, unsigned int type)
+{
+    uint32_t size = 0;
+    uint32_t i;
+    for(i = 0; i < upload->area_cnt; i++) {
+        size += lv_area_get_size(&upload->areas[i]) * px_size;
+    }
+
+    uint32_t idx = upload->pbo_idx;
+    upload->pbo_idx = (idx + 1) % LV_OPENGLES_PBO_CNT;
+
+    if(upload->fence[idx]) {
+        GLenum res = pbo_api.client_wait_sync(upload->fence[idx], GL_SYNC_FLUSH_COMMANDS_BIT, PBO_WAIT_TIMEOUT_NS);
+        if(res == GL_WAIT_FAILED) LV_LOG_WARN("Waiting for the pixel buffer failed");
+        pbo_api.delete_sync(upload->fence[idx]);
+        upload->fence[idx] = NULL;
+    }
+
+    if(upload->pbo[idx] == 0) {
+        GL_CALL(glGenBuffers(1, &upload->pbo[idx]));
+    }
+    GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, upload->pbo[idx]));
+    if(size > upload->pbo_size[idx]) {
+        GL_CALL(glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW));
+        upload->pbo_size[idx] = size;
+    }
+
+    /*The GPU is done with this buffer, so no need to synchronize the mapping*/
+    uint8_t * dst = pbo_api.map_buffer_range(GL_PIXEL_UNPACK_BUFFER, 0, size,
+                                             GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if(dst == NULL) {
+        GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+        return false;
+    }
+
+    uint8_t * dst_act = dst;
+    for(i = 0; i < upload->area_cnt; i++) {
+        const lv_area_t * a = &upload->areas[i];
+        uint32_t line_size = lv_area_get_width(a) * px_size;
+        const uint8_t * src = buf + a->y1 * stride + a->x1 * px_size;
+        int32_t y;
+        for(y = a->y1; y <= a->y2; y++) {
+            lv_memcpy(dst_act, src, line_size);
+            dst_act += line_size;
+            src += stride;
+        }
+    }
+
+    if(!pbo_api.unmap_buffer(GL_PIXEL_UNPACK_BUFFER)) {
+        /*The content of the buffer was lost*/
+        GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+        return false;
+    }
+
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+
+    uintptr_t offset = 0;
+    for(i = 0; i < upload->area_cnt; i++) {
+        const lv_area_t * a = &upload->areas[i];
+        GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, a->x1, a->y1, lv_area_get_width(a), lv_area_get_height(a),
+                                format, type, (const void *)offset));
+        offset += lv_area_get_size(a) * px_size;
+    }
+
+    GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+
+    upload->fence[idx] = pbo_api.fence_sync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    return true;
+}
+
+#endif /*LV_OPENGLES_PBO_CNT > 0*/
+
 #endif /*LV_USE_OPENGLES*/
@@ -24,14 +24,30 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/*If more areas are rendered in a frame their bounding box is uploaded*/
+#define LV_OPENGLES_TEXTURE_UPLOAD_AREA_CNT 16
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*The areas rendered since the last upload and the pixel buffers to upload them*/
+typedef struct {
+    lv_area_t areas[LV_OPENGLES_TEXTURE_UPLOAD_AREA_CNT];
+    uint32_t area_cnt;
+#if LV_OPENGLES_PBO_CNT > 0
+    unsigned int pbo[LV_OPENGLES_PBO_CNT];
+    uint32_t pbo_size[LV_OPENGLES_PBO_CNT];
+    void * fence[LV_OPENGLES_PBO_CNT];  /*Signaled when the GPU has read the pixel buffer*/
+    uint32_t pbo_idx;
+#endif
+} lv_opengles_texture_upload_t;
+
 typedef struct {
     unsigned int texture_id;
 #if !LV_USE_DRAW_OPENGLES
     uint8_t * fb1;
+    lv_opengles_texture_upload_t upload;
 #endif /*!LV_USE_DRAW_OPENGLES*/
     bool is_texture_owner;
 } lv_opengles_texture_t;
@@ -44,6 +60,33 @@ lv_result_t lv_opengles_texture_create_draw_buffers(lv_opengles_texture_t * text
 void lv_opengles_texture_reshape(lv_display_t * disp, int32_t width, int32_t height);
 void lv_opengles_texture_deinit(lv_opengles_texture_t * texture);
 
+/**
+ * Mark an area of the frame buffer to be uploaded by `lv_opengles_texture_upload()`
+ * @param upload    the upload context
+ * @param area      the rendered area
+ */
+void lv_opengles_texture_upload_add_area(lv_opengles_texture_upload_t * upload, const lv_area_t * area);
+
+/**
+ * Upload the marked areas of a frame buffer to the bound GL_TEXTURE_2D.
+ * A pixel buffer object is used if available, so the CPU doesn't have to wait
+ * until the GPU has consumed the pixel data.
+ * @param upload    the upload context
+ * @param buf       the frame buffer
+ * @param stride    stride of the frame buffer in bytes
+ * @param px_size   size of a pixel in bytes
+ * @param format    format of the pixel data (e.g. GL_BGRA)
+ * @param type      type of the pixel data (e.g. GL_UNSIGNED_BYTE)
+ */
+void lv_opengles_texture_upload(lv_opengles_texture_upload_t * upload, const uint8_t * buf, uint32_t stride,
+                                uint32_t px_size, unsigned int format, unsigned int type);
+
+/**
+ * Delete the pixel buffers and fences of an upload context
+ * @param upload    the upload context
+ */
+void lv_opengles_texture_upload_deinit(lv_opengles_texture_upload_t * upload);
+
 /**********************
  *      MACROS
  **********************/
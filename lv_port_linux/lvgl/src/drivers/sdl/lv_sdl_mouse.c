@@ -21,6 +21,8 @@
     #define KEYBOARD_BUFFER_SIZE 32
 #endif
 
+#define MOUSE_QUEUE_SIZE 32 /*Events waiting to be reported to LVGL*/
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -64,6 +66,9 @@ lv_indev_t * lv_sdl_mouse_create(void)
     lv_indev_set_mode(indev, LV_INDEV_MODE_EVENT);
     lv_indev_add_event_cb(indev, release_indev_cb, LV_EVENT_DELETE, indev);
 
+    /*The events are queued with their SDL timestamps. Without a queue sdl_mouse_read reports the last state*/
+    lv_indev_set_sample_queue_size(indev, MOUSE_QUEUE_SIZE);
+
     return indev;
 }
 
@@ -198,6 +203,19 @@ void lv_sdl_mouse_handler(SDL_Event * event)
 #endif /*LV_SDL_MOUSEWHEEL_MODE == LV_SDL_MOUSEWHEEL_MODE_CROWN*/
             break;
     }
+
+    /*Queue the new state with the time of the event, as the LVGL tick is SDL_GetTicks()*/
+    lv_indev_data_t sample;
+    lv_memzero(&sample, sizeof(sample));
+    sdl_mouse_read(indev, &sample);
+    sample.timestamp = event->common.timestamp;
+    if(lv_indev_push_data(indev, &sample) != LV_RESULT_OK) {
+#if LV_SDL_MOUSEWHEEL_MODE == LV_SDL_MOUSEWHEEL_MODE_CROWN
+        /*Not queued, keep the wheel movement for sdl_mouse_read*/
+        indev_dev->diff = sample.enc_diff;
+#endif
+    }
+
     lv_indev_read(indev);
 }
 
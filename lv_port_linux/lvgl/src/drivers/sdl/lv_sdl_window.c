@@ -19,6 +19,7 @@
 #include "../../display/lv_display_private.h"
 #include "../../lv_init.h"
 #include "../../draw/lv_draw_buf.h"
+#include "../../misc/lv_area_private.h"
 
 /* for aligned_alloc */
 #ifndef __USE_ISOC11
@@ -57,6 +58,8 @@ typedef struct {
     uint8_t * buf2;
     uint8_t * rotated_buf;
     size_t rotated_buf_size;
+    lv_area_t dirty[LV_INV_BUF_SIZE];  /*Areas of `fb_act` to upload to the texture*/
+    uint32_t dirty_cnt;
 #endif
     float zoom;
     uint8_t ignore_size_chg;
@@ -71,6 +74,8 @@ static void window_create(lv_display_t * disp);
 static void window_update(lv_display_t * disp);
 #if LV_USE_DRAW_SDL == 0
     static void texture_resize(lv_display_t * disp);
+    static void texture_update(lv_display_t * disp);
+    static void dirty_area_add(lv_sdl_window_t * dsc, const lv_area_t * area);
     static void * sdl_draw_buf_realloc_aligned(void * ptr, size_t new_size);
     static void sdl_draw_buf_free(void * ptr);
 #endif
@@ -307,6 +312,10 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_m
         else {
             lv_draw_sw_rotate(px_map, fb_start, px_map_w, px_map_h, px_map_stride, fb_stride, rotation, cf);
         }
+        dirty_area_add(dsc, &rotated_area);
+    }
+    else {
+        dirty_area_add(dsc, area);
     }
 
     if(lv_display_flush_is_last(disp)) {
@@ -420,13 +429,7 @@ static void window_update(lv_display_t * disp)
 {
     lv_sdl_window_t * dsc = lv_display_get_driver_data(disp);
 #if LV_USE_DRAW_SDL == 0
-    int32_t hor_res = disp->hor_res;
-    lv_color_format_t cf = lv_display_get_color_format(disp);
-    if(cf == LV_COLOR_FORMAT_I1) {
-        cf = LV_COLOR_FORMAT_ARGB8888;
-    }
-    uint32_t stride = lv_draw_buf_width_to_stride(hor_res, cf);
-    SDL_UpdateTexture(dsc->texture, NULL, dsc->fb_act, stride);
+    texture_update(disp);
 
     SDL_RenderClear(dsc->renderer);
 
@@ -434,6 +437,7 @@ static void window_update(lv_display_t * disp)
     SDL_RenderCopy(dsc->renderer, dsc->texture, NULL, NULL);
 #endif
     SDL_RenderPresent(dsc->renderer);
+    lv_display_report_presented(disp, lv_tick_get());
 }
 
 #if LV_USE_DRAW_SDL == 0
@@ -477,8 +481,69 @@ static void texture_resize(lv_display_t * disp)
 #endif
 
     dsc->texture = SDL_CreateTexture(dsc->renderer, px_format,
-                                     SDL_TEXTUREACCESS_STATIC, disp->hor_res, disp->ver_res);
+                                     SDL_TEXTUREACCESS_STREAMING, disp->hor_res, disp->ver_res);
     SDL_SetTextureBlendMode(dsc->texture, SDL_BLENDMODE_BLEND);
+
+    /*The new texture needs the whole frame buffer*/
+    lv_area_set(&dsc->dirty[0], 0, 0, disp->hor_res - 1, disp->ver_res - 1);
+    dsc->dirty_cnt = 1;
+}
+
+/**
+ * Upload the areas updated since the last upload from the frame buffer to the texture
+ * @param disp      pointer to a display
+ */
+static void texture_update(lv_display_t * disp)
+{
+    lv_sdl_window_t * dsc = lv_display_get_driver_data(disp);
+    lv_color_format_t cf = lv_display_get_color_format(disp);
+    if(cf == LV_COLOR_FORMAT_I1) {
+        cf = LV_COLOR_FORMAT_ARGB8888;
+    }
+    uint32_t px_size = lv_color_format_get_size(cf);
+    uint32_t stride = lv_draw_buf_width_to_stride(disp->hor_res, cf);
+
+    uint32_t i;
+    for(i = 0; i < dsc->dirty_cnt; i++) {
+        lv_area_t * area = &dsc->dirty[i];
+        SDL_Rect rect = {area->x1, area->y1, lv_area_get_width(area), lv_area_get_height(area)};
+        uint8_t * pixels;
+        int pitch;
+        if(SDL_LockTexture(dsc->texture, &rect, (void **)&pixels, &pitch) != 0) {
+            LV_LOG_WARN("SDL_LockTexture failed: %s", SDL_GetError());
+            continue;
+        }
+
+        const uint8_t * src = dsc->fb_act + area->y1 * stride + area->x1 * px_size;
+        int32_t y;
+        for(y = 0; y < rect.h; y++) {
+            lv_memcpy(pixels, src, rect.w * px_size);
+            pixels += pitch;
+            src += stride;
+        }
+        SDL_UnlockTexture(dsc->texture);
+    }
+    dsc->dirty_cnt = 0;
+}
+
+/**
+ * Remember an area of the frame buffer to upload to the texture
+ * @param dsc       the window
+ * @param area      the updated area
+ */
+static void dirty_area_add(lv_sdl_window_t * dsc, const lv_area_t * area)
+{
+    /*Extend the last area if the new one continues it, e.g. the next part of the same area*/
+    lv_area_t * last = dsc->dirty_cnt ? &dsc->dirty[dsc->dirty_cnt - 1] : NULL;
+    if(last && last->x1 == area->x1 && last->x2 == area->x2 && last->y2 + 1 == area->y1) {
+        last->y2 = area->y2;
+    }
+    else if(dsc->dirty_cnt < LV_INV_BUF_SIZE) {
+        dsc->dirty[dsc->dirty_cnt++] = *area;
+    }
+    else {
+        lv_area_join(last, last, area);
+    }
 }
 
 static void * sdl_draw_buf_realloc_aligned(void * ptr, size_t new_size)
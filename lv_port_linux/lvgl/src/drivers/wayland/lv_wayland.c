@@ -51,8 +51,8 @@
     #error "LV_WAYLAND_USE_DMABUF doesn't support LV_DISPLAY_RENDER_MODE_PARTIAL"
 #endif
 
-#if !LV_WAYLAND_USE_DMABUF && LV_WAYLAND_RENDER_MODE != LV_DISPLAY_RENDER_MODE_PARTIAL
-    #error "Wayland without DMABUF only supports LV_DISPLAY_RENDER_MODE_PARTIAL"
+#if !LV_WAYLAND_USE_DMABUF && LV_WAYLAND_RENDER_MODE == LV_DISPLAY_RENDER_MODE_FULL
+    #error "Wayland without DMABUF only supports LV_DISPLAY_RENDER_MODE_PARTIAL and LV_DISPLAY_RENDER_MODE_DIRECT"
 #endif
 
 #if (LV_COLOR_DEPTH == 8 || LV_COLOR_DEPTH == 1)
@@ -373,6 +373,11 @@ void lv_wayland_event_cb(lv_event_t * e)
 #endif
                 break;
             }
+#if !LV_WAYLAND_USE_DMABUF
+        case LV_EVENT_REFR_START:
+            lv_wayland_shm_prepare_direct_frame(&window->wl_ctx->shm_ctx, window);
+            break;
+#endif
         default:
             return;
     }
@@ -343,6 +343,8 @@ void lv_wayland_shm_delete_draw_buffers(shm_ctx_t * context, struct window * win
 void lv_wayland_shm_initalize_context(shm_ctx_t * context);
 void lv_wayland_shm_deinit(shm_ctx_t * context);
 void lv_wayland_shm_flush_partial_mode(lv_display_t * disp, const lv_area_t * area, unsigned char * color_p);
+void lv_wayland_shm_flush_direct_mode(lv_display_t * disp, const lv_area_t * area, unsigned char * color_p);
+void lv_wayland_shm_prepare_direct_frame(shm_ctx_t * context, struct window * window);
 
 struct wl_cursor_theme * lv_wayland_shm_load_cursor_theme(shm_ctx_t * context);
 
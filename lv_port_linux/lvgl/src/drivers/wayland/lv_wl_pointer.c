@@ -14,6 +14,7 @@
 #include <xkbcommon/xkbcommon.h>
 #include <linux/input-event-codes.h>
 #include "lv_wayland_private.h"
+#include "../../stdlib/lv_string.h"
 
 /*********************
  *      INCLUDES
@@ -23,6 +24,8 @@
  *      DEFINES
  *********************/
 
+#define POINTER_QUEUE_SIZE 32 /*Events waiting to be reported to LVGL*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -32,6 +35,7 @@
  **********************/
 
 static void _lv_wayland_pointer_read(lv_indev_t * drv, lv_indev_data_t * data);
+static void pointer_push_sample(struct graphic_object * obj);
 
 static void pointer_handle_enter(void * data, struct wl_pointer * pointer, uint32_t serial, struct wl_surface * surface,
                                  wl_fixed_t sx, wl_fixed_t sy);
@@ -73,6 +77,9 @@ lv_indev_t * lv_wayland_pointer_create(void)
     lv_indev_t * indev = lv_indev_create();
     lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
     lv_indev_set_read_cb(indev, _lv_wayland_pointer_read);
+
+    /*Keep the motion between two reads. Without a queue the last position is reported*/
+    lv_indev_set_sample_queue_size(indev, POINTER_QUEUE_SIZE);
     return indev;
 }
 
@@ -111,6 +118,23 @@ static void _lv_wayland_pointer_read(lv_indev_t * drv, lv_indev_data_t * data)
     data->state   = window->body->input.pointer.left_button;
 }
 
+/* Queue the current state of the pointer on the body of a window */
+static void pointer_push_sample(struct graphic_object * obj)
+{
+    if(obj->type != OBJECT_WINDOW || !obj->window || !obj->window->lv_indev_pointer) {
+        return;
+    }
+
+    lv_indev_data_t sample;
+    lv_memzero(&sample, sizeof(sample));
+    sample.point.x = obj->input.pointer.x;
+    sample.point.y = obj->input.pointer.y;
+    sample.state   = obj->input.pointer.left_button;
+
+    /* If the queue is full the read callback reports the latest state */
+    lv_indev_push_data(obj->window->lv_indev_pointer, &sample);
+}
+
 static void pointer_handle_enter(void * data, struct wl_pointer * pointer, uint32_t serial, struct wl_surface * surface,
                                  wl_fixed_t sx, wl_fixed_t sy)
 {
@@ -166,6 +190,7 @@ static void pointer_handle_motion(void * data, struct wl_pointer * pointer, uint
 
     app->pointer_obj->input.pointer.x = LV_MAX(0, LV_MIN(wl_fixed_to_int(sx), app->pointer_obj->width - 1));
     app->pointer_obj->input.pointer.y = LV_MAX(0, LV_MIN(wl_fixed_to_int(sy), app->pointer_obj->height - 1));
+    pointer_push_sample(app->pointer_obj);
 }
 
 static void pointer_handle_button(void * data, struct wl_pointer * wl_pointer, uint32_t serial, uint32_t time,
@@ -192,6 +217,7 @@ static void pointer_handle_button(void * data, struct wl_pointer * wl_pointer, u
             switch(button) {
                 case BTN_LEFT:
                     app->pointer_obj->input.pointer.left_button = lv_state;
+                    pointer_push_sample(app->pointer_obj);
                     break;
                 case BTN_RIGHT:
                     app->pointer_obj->input.pointer.right_button = lv_state;
@@ -43,6 +43,9 @@ static void sme_free_pool(void * ctx, smm_pool_t * pool);
 static bool sme_new_buffer(void * ctx, smm_buffer_t * buf);
 static bool sme_init_buffer(void * ctx, smm_buffer_t * buf);
 static void sme_free_buffer(void * ctx, smm_buffer_t * buf);
+static void * shm_set_draw_buf_target(struct window * window, smm_buffer_t * buf);
+static void shm_commit_buffer(struct window * window, smm_buffer_t * buf);
+static void shm_drop_buffer(struct window * window, smm_buffer_t * buf);
 
 /**********************
  *  STATIC VARIABLES
@@ -144,6 +147,12 @@ lv_result_t lv_wayland_shm_resize_window(shm_ctx_t * context, struct window * wi
         return LV_RESULT_INVALID;
     }
 
+    /* In direct mode the draw buffer always needs to point to a screen sized buffer,
+     * the buffer to render into is selected on LV_EVENT_REFR_START */
+    if(LV_WAYLAND_RENDER_MODE == LV_DISPLAY_RENDER_MODE_DIRECT && window->lv_disp != NULL) {
+        shm_set_draw_buf_target(window, body_buf1);
+    }
+
     /* Moves the buffers to the unused list of the group */
     smm_release(body_buf1);
     smm_release(body_buf2);
@@ -154,7 +163,7 @@ lv_result_t lv_wayland_shm_resize_window(shm_ctx_t * context, struct window * wi
     width  = window->body->width;
     height = window->body->height;
 
-    if(window->lv_disp != NULL) {
+    if(window->lv_disp != NULL && LV_WAYLAND_RENDER_MODE == LV_DISPLAY_RENDER_MODE_PARTIAL) {
         /* Resize draw buffer */
         const uint32_t stride = lv_draw_buf_width_to_stride(width, lv_display_get_color_format(window->lv_disp));
         window->lv_draw_buf = lv_draw_buf_reshape(window->lv_draw_buf, lv_display_get_color_format(window->lv_disp),
@@ -166,6 +175,14 @@ lv_result_t lv_wayland_shm_resize_window(shm_ctx_t * context, struct window * wi
 lv_result_t lv_wayland_shm_create_draw_buffers(shm_ctx_t * context, struct window * window)
 {
     LV_UNUSED(context);
+
+    if(LV_WAYLAND_RENDER_MODE == LV_DISPLAY_RENDER_MODE_DIRECT) {
+        /* The data of the draw buffer is the mapping of a window body buffer, set on resize and before rendering */
+        window->lv_draw_buf = lv_malloc_zeroed(sizeof(lv_draw_buf_t));
+        LV_ASSERT_MALLOC(window->lv_draw_buf);
+        return window->lv_draw_buf ? LV_RESULT_OK : LV_RESULT_INVALID;
+    }
+
     const uint32_t stride = lv_draw_buf_width_to_stride(window->width, lv_display_get_color_format(window->lv_disp));
 
     window->lv_draw_buf = lv_draw_buf_create(window->width, window->height / LVGL_DRAW_BUFFER_DIV,
@@ -187,7 +204,87 @@ lv_result_t lv_wayland_shm_set_draw_buffers(shm_ctx_t * context, lv_display_t *
 void lv_wayland_shm_delete_draw_buffers(shm_ctx_t * context, struct window * window)
 {
     LV_UNUSED(context);
-    if(window->lv_draw_buf) lv_draw_buf_destroy(window->lv_draw_buf);
+    if(window->lv_draw_buf == NULL) return;
+
+    if(LV_WAYLAND_RENDER_MODE == LV_DISPLAY_RENDER_MODE_DIRECT) {
+        lv_free(window->lv_draw_buf);
+    }
+    else {
+        lv_draw_buf_destroy(window->lv_draw_buf);
+    }
+    window->lv_draw_buf = NULL;
+}
+
+void lv_wayland_shm_prepare_direct_frame(shm_ctx_t * context, struct window * window)
+{
+    LV_UNUSED(context);
+    smm_buffer_t * buf = window->body->pending_buffer;
+
+    /* If window has been / is being closed, keep the previous target */
+    if(window->closed || window->shall_close) {
+        return;
+    }
+
+    /* Acquire a buffer to render into. A reused buffer is brought up to date
+     * with the damage of the buffers attached since it was attached the last time
+     * (see sme_init_buffer), so LVGL needs to render only the invalidated areas */
+    if(buf == NULL) {
+        buf = smm_acquire(window->body->buffer_group);
+        if(buf == NULL) {
+            LV_LOG_ERROR("cannot acquire a window body buffer");
+            return;
+        }
+
+        window->body->pending_buffer = buf;
+        SMM_TAG(buf, TAG_BUFFER_DAMAGE, window->dmg_cache.cache + window->dmg_cache.end);
+    }
+
+    if(shm_set_draw_buf_target(window, buf) == NULL) {
+        LV_LOG_ERROR("cannot map in window body buffer");
+    }
+}
+
+void lv_wayland_shm_flush_direct_mode(lv_display_t * disp, const lv_area_t * area, unsigned char * color_p)
+{
+    struct window * window     = lv_display_get_driver_data(disp);
+    const uint32_t buf_format  = window->wl_ctx->shm_ctx.format;
+    smm_buffer_t * buf         = window->body->pending_buffer;
+    const lv_color_format_t cf = lv_display_get_color_format(disp);
+    const uint32_t stride      = window->lv_draw_buf->header.stride;
+    int32_t src_width          = lv_area_get_width(area);
+    int32_t src_height         = lv_area_get_height(area);
+
+    /* If window has been / is being closed, or is not visible, skip flush */
+    if(window->closed || window->shall_close || buf == NULL) {
+        goto skip;
+    }
+
+    /* The area is already rendered into the buffer, premultiply it in place if required */
+    if(buf_format == WL_SHM_FORMAT_ARGB8888 && cf == LV_COLOR_FORMAT_ARGB8888) {
+        for(int32_t y = area->y1; y <= area->y2; ++y) {
+            lv_color32_t * row = (lv_color32_t *)(color_p + y * stride) + area->x1;
+            for(int32_t x = 0; x < src_width; ++x) {
+                lv_color_premultiply(row + x);
+            }
+        }
+    }
+
+    /* Mark surface damage */
+    wl_surface_damage(window->body->surface, area->x1, area->y1, src_width, src_height);
+
+    lv_wayland_cache_add_area(window, buf, area);
+
+    if(lv_display_flush_is_last(disp)) {
+        shm_commit_buffer(window, buf);
+        /* Return early here, the lv_display_flush_ready will get called in the frame_listener callback */
+        return;
+    }
+    lv_display_flush_ready(disp);
+    return;
+skip:
+    if(buf != NULL) {
+        shm_drop_buffer(window, buf);
+    }
 }
 void lv_wayland_shm_flush_partial_mode(lv_display_t * disp, const lv_area_t * area, unsigned char * color_p)
 {
@@ -252,17 +349,7 @@ void lv_wayland_shm_flush_partial_mode(lv_display_t * disp, const lv_area_t * ar
     lv_wayland_cache_add_area(window, buf, area);
 
     if(lv_display_flush_is_last(disp)) {
-        /* Finally, attach buffer and commit to surface */
-        struct wl_buffer * wl_buf = SMM_BUFFER_PROPERTIES(buf)->tag[TAG_LOCAL];
-        wl_surface_attach(window->body->surface, wl_buf, 0, 0);
-        wl_surface_commit(window->body->surface);
-        window->body->pending_buffer = NULL;
-
-        struct wl_callback * cb = wl_surface_frame(window->body->surface);
-        wl_callback_add_listener(cb, lv_wayland_window_get_wl_surface_frame_listener(), window->body);
-        LV_LOG_TRACE("last flush frame: %d", window->frame_counter);
-
-        window->flush_pending = true;
+        shm_commit_buffer(window, buf);
         /* Return early here, the lv_display_flush_ready will get called in the frame_listener callback */
         return;
     }
@@ -270,13 +357,7 @@ void lv_wayland_shm_flush_partial_mode(lv_display_t * disp, const lv_area_t * ar
     return;
 skip:
     if(buf != NULL) {
-        /* Cleanup any intermediate state (in the event that this flush being
-         * skipped is in the middle of a flush sequence)
-         */
-        lv_wayland_cache_clear(window);
-        SMM_TAG(buf, TAG_BUFFER_DAMAGE, NULL);
-        smm_release(buf);
-        window->body->pending_buffer = NULL;
+        shm_drop_buffer(window, buf);
     }
 }
 
@@ -470,4 +551,46 @@ static void sme_free_buffer(void * ctx, smm_buffer_t * buf)
     wl_buffer_destroy(wl_buf);
 }
 
+/* Let LVGL render directly into a window body buffer */
+static void * shm_set_draw_buf_target(struct window * window, smm_buffer_t * buf)
+{
+    void * buf_base = smm_map(buf);
+    if(buf_base == NULL) {
+        return NULL;
+    }
+
+    const uint8_t bpp     = lv_color_format_get_size(LV_COLOR_FORMAT_NATIVE);
+    const uint32_t stride = window->body->width * bpp;
+    lv_draw_buf_init(window->lv_draw_buf, window->body->width, window->body->height,
+                     lv_display_get_color_format(window->lv_disp), stride, buf_base, stride * window->body->height);
+
+    return buf_base;
+}
+
+static void shm_commit_buffer(struct window * window, smm_buffer_t * buf)
+{
+    /* Finally, attach buffer and commit to surface */
+    struct wl_buffer * wl_buf = SMM_BUFFER_PROPERTIES(buf)->tag[TAG_LOCAL];
+    wl_surface_attach(window->body->surface, wl_buf, 0, 0);
+    wl_surface_commit(window->body->surface);
+    window->body->pending_buffer = NULL;
+
+    struct wl_callback * cb = wl_surface_frame(window->body->surface);
+    wl_callback_add_listener(cb, lv_wayland_window_get_wl_surface_frame_listener(), window->body);
+    LV_LOG_TRACE("last flush frame: %d", window->frame_counter);
+
+    window->flush_pending = true;
+}
+
+static void shm_drop_buffer(struct window * window, smm_buffer_t * buf)
+{
+    /* Cleanup any intermediate state (in the event that this flush being
+     * skipped is in the middle of a flush sequence)
+     */
+    lv_wayland_cache_clear(window);
+    SMM_TAG(buf, TAG_BUFFER_DAMAGE, NULL);
+    smm_release(buf);
+    window->body->pending_buffer = NULL;
+}
+
 #endif /* LV_USE_WAYLAND */
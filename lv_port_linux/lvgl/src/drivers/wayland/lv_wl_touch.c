@@ -8,6 +8,7 @@
 #if LV_USE_WAYLAND
 
 #include "lv_wayland_private.h"
+#include "../../stdlib/lv_string.h"
 
 #include <wayland-client-protocol.h>
 #include <wayland-cursor.h>
@@ -20,6 +21,8 @@
  *      DEFINES
  *********************/
 
+#define TOUCH_QUEUE_SIZE 32 /*Touch frames waiting to be reported to LVGL*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -69,6 +72,11 @@ lv_indev_t * lv_wayland_touch_create(void)
     lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
     lv_indev_set_read_cb(indev, _lv_wayland_touch_read);
 
+#if !LV_USE_GESTURE_RECOGNITION
+    /*Queue every touch frame. Without a queue the last state is reported*/
+    lv_indev_set_sample_queue_size(indev, TOUCH_QUEUE_SIZE);
+#endif
+
     return indev;
 }
 
@@ -288,7 +296,25 @@ static void touch_handle_motion(void * data, struct wl_touch * wl_touch, uint32_
 static void touch_handle_frame(void * data, struct wl_touch * wl_touch)
 {
     LV_UNUSED(wl_touch);
+
+#if LV_USE_GESTURE_RECOGNITION
+    /* The touches are collected for the gesture recognizers until the next read */
     LV_UNUSED(data);
+#else
+    /* A frame completes the changes of the touch, queue its state */
+    struct lv_wayland_context * app = data;
+    struct graphic_object * obj = app->touch_obj;
+
+    if(!obj || obj->type != OBJECT_WINDOW || !obj->window || !obj->window->lv_indev_touch) {
+        return;
+    }
+
+    lv_indev_data_t sample;
+    lv_memzero(&sample, sizeof(sample));
+    sample.point = obj->input.touch.point;
+    sample.state = obj->input.touch.state;
+    lv_indev_push_data(obj->window->lv_indev_touch, &sample);
+#endif
 }
 
 static void touch_handle_cancel(void * data, struct wl_touch * wl_touch)
@@ -137,7 +137,14 @@ lv_display_t * lv_wayland_window_create(uint32_t hor_res, uint32_t ver_res, char
     lv_display_set_flush_cb(window->lv_disp, lv_wayland_dmabuf_flush_full_mode);
 #else
     lv_wayland_shm_set_draw_buffers(&lv_wl_ctx.shm_ctx, window->lv_disp, window);
-    lv_display_set_flush_cb(window->lv_disp, lv_wayland_shm_flush_partial_mode);
+    if(LV_WAYLAND_RENDER_MODE == LV_DISPLAY_RENDER_MODE_DIRECT) {
+        lv_display_set_flush_cb(window->lv_disp, lv_wayland_shm_flush_direct_mode);
+        /* Select the buffer to render into before each refresh */
+        lv_display_add_event_cb(window->lv_disp, lv_wayland_event_cb, LV_EVENT_REFR_START, window);
+    }
+    else {
+        lv_display_set_flush_cb(window->lv_disp, lv_wayland_shm_flush_partial_mode);
+    }
 #endif
 
     lv_display_add_event_cb(window->lv_disp, lv_wayland_event_cb, LV_EVENT_RESOLUTION_CHANGED, window);
@@ -501,6 +508,10 @@ static void lv_window_graphic_obj_flush_done(void * data, struct wl_callback * c
 
     LV_LOG_TRACE("frame: %d done, new frame: %d", window->frame_counter - 1, window->frame_counter);
 
+    /* The compositor presented the previous frame and asks for a new one,
+     * `time` has an undefined base so use the time of receiving it */
+    lv_display_report_vblank(window->lv_disp, lv_tick_get());
+
     lv_display_flush_ready(window->lv_disp);
 }
 
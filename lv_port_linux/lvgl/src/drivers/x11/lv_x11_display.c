@@ -14,9 +14,14 @@
 #include <unistd.h>
 #include <stdlib.h>
 #include <pthread.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
 #include <X11/Xlib.h>
 #include <X11/Xutil.h>
+#include <X11/extensions/XShm.h>
 #include "../../core/lv_obj_pos.h"
+#include "../../misc/lv_area_private.h"
+#include "../../display/lv_display_private.h"
 
 /*********************
  *      DEFINES
@@ -47,10 +52,15 @@ typedef struct {
     XImage     *    ximage;          /**< X11 XImage cache object for updating window content */
     Atom            wmDeleteMessage; /**< X11 atom to window object */
     void      *     xdata;           /**< allocated data for XImage */
+    XShmSegmentInfo shm_info;        /**< shared memory segment of the XImage (MIT-SHM) */
+    bool            use_shm;         /**< the XImage is shared with the X server */
+    int             shm_completion;  /**< event type of a completed XShmPutImage */
+    bool            put_pending;     /**< the last put image wasn't completed by the X server yet */
     /* LVGL related information */
     lv_timer_t   *  timer;           /**< timer object for @ref x11_event_handler */
     uint8_t    *    buffer[2];       /**< (double) lv display buffers, depending on @ref LV_X11_RENDER_MODE */
-    lv_area_t       flush_area;      /**< integrated area for a display update */
+    lv_area_t       dirty[LV_INV_BUF_SIZE]; /**< areas updated in the current display update */
+    uint32_t        dirty_cnt;       /**< number of areas in @ref dirty */
     /* systemtick by thread related information */
     pthread_t       thr_tick;        /**< pthread for SysTick simulation */
     bool            terminated;      /**< flag to germinate SysTick simulation thread */
@@ -62,6 +72,7 @@ typedef struct {
 #if LV_X11_DIRECT_EXIT
     static unsigned int count_windows = 0;
 #endif
+static bool shm_error;
 
 /**********************
  *      MACROS
@@ -103,6 +114,163 @@ static inline lv_color32_t get_px(color_t p)
 #error ("Unsupported LV_COLOR_DEPTH")
 #endif
 
+static int x11_shm_error_handler(Display * disp, XErrorEvent * event)
+{
+    LV_UNUSED(disp);
+    LV_UNUSED(event);
+    shm_error = true;
+    return 0;
+}
+
+/**
+ * create the cache XImage in shared memory with the X server (MIT-SHM)
+ * @param[in] xd       the display data
+ * @param[in] hor_res  width of the image
+ * @param[in] ver_res  height of the image
+ * @return             true on success; false if MIT-SHM can't be used (e.g. on a remote X server)
+ */
+static bool x11_shm_image_create(x11_disp_data_t * xd, int32_t hor_res, int32_t ver_res)
+{
+    if(!XShmQueryExtension(xd->hdr.display)) return false;
+
+    xd->ximage = XShmCreateImage(xd->hdr.display, xd->visual, xd->dplanes, ZPixmap, NULL, &xd->shm_info,
+                                 hor_res, ver_res);
+    if(NULL == xd->ximage) return false;
+    /* the pixels are written as lv_color32_t */
+    if(xd->ximage->bits_per_pixel != 32) {
+        XDestroyImage(xd->ximage);
+        return false;
+    }
+
+    xd->shm_info.shmid = shmget(IPC_PRIVATE, xd->ximage->bytes_per_line * xd->ximage->height, IPC_CREAT | 0600);
+    if(xd->shm_info.shmid < 0) {
+        XDestroyImage(xd->ximage);
+        return false;
+    }
+    xd->shm_info.shmaddr = shmat(xd->shm_info.shmid, NULL, 0);
+    xd->shm_info.readOnly = False;
+
+    /* attaching fails asynchronously with an X error if the server can't access the segment */
+    shm_error = xd->shm_info.shmaddr == (char *) -1;
+    if(!shm_error) {
+        XErrorHandler handler = XSetErrorHandler(x11_shm_error_handler);
+        XShmAttach(xd->hdr.display, &xd->shm_info);
+        XSync(xd->hdr.display, False);
+        XSetErrorHandler(handler);
+        if(shm_error) shmdt(xd->shm_info.shmaddr);
+    }
+    /* the segment is released when both sides detached it */
+    shmctl(xd->shm_info.shmid, IPC_RMID, NULL);
+
+    if(shm_error) {
+        XDestroyImage(xd->ximage);
+        return false;
+    }
+
+    xd->ximage->data = xd->shm_info.shmaddr;
+    xd->xdata = xd->shm_info.shmaddr;
+    return true;
+}
+
+/**
+ * create the cache XImage for updating the window content, shared with the X server if possible
+ * @param[in] xd       the display data
+ * @param[in] hor_res  width of the image
+ * @param[in] ver_res  height of the image
+ */
+static void x11_image_create(x11_disp_data_t * xd, int32_t hor_res, int32_t ver_res)
+{
+    xd->use_shm = x11_shm_image_create(xd, hor_res, ver_res);
+    if(xd->use_shm) return;
+
+    LV_LOG_INFO("MIT-SHM is not available, using XPutImage");
+    size_t sz_buffers = hor_res * ver_res * sizeof(lv_color32_t);
+    xd->xdata = malloc(sz_buffers); /* use clib method here, x11 memory not part of device footprint */
+    xd->ximage = XCreateImage(xd->hdr.display, xd->visual, xd->dplanes, ZPixmap, 0, xd->xdata,
+                              hor_res, ver_res, lv_color_format_get_bpp(LV_COLOR_FORMAT_ARGB8888), 0);
+}
+
+/**
+ * the X server has completed the last put image, i.e. the frame is presented
+ * @param[in] disp  the created X11 display object from @lv_x11_window_create
+ */
+static void x11_put_done(lv_display_t * disp)
+{
+    x11_disp_data_t * xd = lv_display_get_driver_data(disp);
+    xd->put_pending = false;
+    lv_display_report_presented(disp, lv_tick_get());
+}
+
+static int is_put_done_event(Display * disp, XEvent * event, XPointer arg)
+{
+    LV_UNUSED(disp);
+    x11_disp_data_t * xd = (x11_disp_data_t *)arg;
+    return event->type == xd->shm_completion;
+}
+
+/**
+ * wait until the X server doesn't read the shared cache XImage anymore
+ * @param[in] disp  the created X11 display object from @lv_x11_window_create
+ */
+static void x11_wait_for_put(lv_display_t * disp)
+{
+    x11_disp_data_t * xd = lv_display_get_driver_data(disp);
+    if(!xd->put_pending || !xd->use_shm) return;
+
+    XEvent event;
+    XIfEvent(xd->hdr.display, &event, is_put_done_event, (XPointer)xd);
+    x11_put_done(disp);
+}
+
+/**
+ * destroy the cache XImage
+ * @param[in] disp  the created X11 display object from @lv_x11_window_create
+ */
+static void x11_image_destroy(lv_display_t * disp)
+{
+    x11_disp_data_t * xd = lv_display_get_driver_data(disp);
+
+    if(xd->use_shm) {
+        x11_wait_for_put(disp);
+        XShmDetach(xd->hdr.display, &xd->shm_info);
+        xd->ximage->data = NULL; /* not allocated by Xlib */
+        XDestroyImage(xd->ximage);
+        shmdt(xd->shm_info.shmaddr);
+    }
+    else {
+        XDestroyImage(xd->ximage); /* frees xdata too */
+    }
+    xd->ximage = NULL;
+    xd->xdata = NULL;
+}
+
+/**
+ * copy areas of the cache XImage to the window
+ * @param[in] xd     the display data
+ * @param[in] areas  areas to copy
+ * @param[in] cnt    number of areas
+ */
+static void x11_put_areas(x11_disp_data_t * xd, const lv_area_t * areas, uint32_t cnt)
+{
+    if(cnt == 0) return;
+
+    for(uint32_t i = 0; i < cnt; i++) {
+        const lv_area_t * a = &areas[i];
+        LV_LOG_TRACE("(%d/%d), %dx%d)", a->x1, a->y1, lv_area_get_width(a), lv_area_get_height(a));
+        if(xd->use_shm) {
+            /* a completion event is needed only for the last one, the requests are processed in order */
+            XShmPutImage(xd->hdr.display, xd->window, xd->gc, xd->ximage, a->x1, a->y1, a->x1, a->y1,
+                         lv_area_get_width(a), lv_area_get_height(a), i == cnt - 1);
+        }
+        else {
+            XPutImage(xd->hdr.display, xd->window, xd->gc, xd->ximage, a->x1, a->y1, a->x1, a->y1,
+                      lv_area_get_width(a), lv_area_get_height(a));
+        }
+    }
+    XFlush(xd->hdr.display);
+    xd->put_pending = true;
+}
+
 /**
  * Flush the content of the internal buffer the specific area on the display.
  * @param[in] disp    the created X11 display object from @lv_x11_window_create
@@ -115,17 +283,20 @@ static void x11_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t *
     x11_disp_data_t * xd = lv_display_get_driver_data(disp);
     LV_ASSERT_NULL(xd);
 
-    static const lv_area_t inv_area = { .x1 = 0xFFFF,
-                                        .x2 = 0,
-                                        .y1 = 0xFFFF,
-                                        .y2 = 0
-                                      };
+    /* the X server might still read the shared XImage */
+    x11_wait_for_put(disp);
 
-    /* build display update area until lv_display_flush_is_last */
-    xd->flush_area.x1 = MIN(xd->flush_area.x1, area->x1);
-    xd->flush_area.x2 = MAX(xd->flush_area.x2, area->x2);
-    xd->flush_area.y1 = MIN(xd->flush_area.y1, area->y1);
-    xd->flush_area.y2 = MAX(xd->flush_area.y2, area->y2);
+    /* collect the updated areas until lv_display_flush_is_last, extend the last one if it continues it */
+    lv_area_t * last = xd->dirty_cnt ? &xd->dirty[xd->dirty_cnt - 1] : NULL;
+    if(last && last->x1 == area->x1 && last->x2 == area->x2 && last->y2 + 1 == area->y1) {
+        last->y2 = area->y2;
+    }
+    else if(xd->dirty_cnt < LV_INV_BUF_SIZE) {
+        xd->dirty[xd->dirty_cnt++] = *area;
+    }
+    else {
+        lv_area_join(last, last, area);
+    }
 
     int32_t hor_res = lv_display_get_horizontal_resolution(disp);
 
@@ -143,17 +314,9 @@ static void x11_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t *
     }
 
     if(lv_display_flush_is_last(disp)) {
-        LV_LOG_TRACE("(%d/%d), %dx%d)", xd->flush_area.x1, xd->flush_area.y1, xd->flush_area.x2 + 1 - xd->flush_area.x1,
-                     xd->flush_area.y2 + 1 - xd->flush_area.y1);
-
-        /* refresh collected display update area only */
-        int16_t upd_w = xd->flush_area.x2 - xd->flush_area.x1 + 1;
-        int16_t upd_h = xd->flush_area.y2 - xd->flush_area.y1 + 1;
-        XPutImage(xd->hdr.display, xd->window, xd->gc, xd->ximage, xd->flush_area.x1, xd->flush_area.y1, xd->flush_area.x1,
-                  xd->flush_area.y1, upd_w, upd_h);
-
-        /* invalidate collected area */
-        xd->flush_area = inv_area;
+        /* refresh the updated areas only */
+        x11_put_areas(xd, xd->dirty, xd->dirty_cnt);
+        xd->dirty_cnt = 0;
     }
     /* Inform the graphics library that you are ready with the flushing */
     lv_display_flush_ready(disp);
@@ -181,11 +344,8 @@ static void x11_resolution_evt_cb(lv_event_t * e)
     }
 
     /* re-create cache image with new size */
-    XDestroyImage(xd->ximage);
-    size_t sz_buffers = hor_res * ver_res * sizeof(lv_color32_t);
-    xd->xdata = malloc(sz_buffers); /* use clib method here, x11 memory not part of device footprint */
-    xd->ximage = XCreateImage(xd->hdr.display, xd->visual, xd->dplanes, ZPixmap, 0, xd->xdata,
-                              hor_res, ver_res, lv_color_format_get_bpp(LV_COLOR_FORMAT_ARGB8888), 0);
+    x11_image_destroy(disp);
+    x11_image_create(xd, hor_res, ver_res);
 }
 
 /**
@@ -204,7 +364,7 @@ static void x11_disp_delete_evt_cb(lv_event_t * e)
         free(xd->buffer[1]);
     }
 
-    XDestroyImage(xd->ximage);
+    x11_image_destroy(disp);
     XFreeGC(xd->hdr.display, xd->gc);
     XUnmapWindow(xd->hdr.display, xd->window);
     XDestroyWindow(xd->hdr.display, xd->window);
@@ -241,10 +401,11 @@ static void x11_hide_cursor(lv_display_t * disp)
 static int is_disp_event(Display * disp, XEvent * event, XPointer arg)
 {
     LV_UNUSED(disp);
-    LV_UNUSED(arg);
+    x11_disp_data_t * xd = (x11_disp_data_t *)arg;
     return (event->type == Expose
             || (event->type >= DestroyNotify && event->type <= CirculateNotify) /* events from StructureNotifyMask */
-            ||  event->type == ClientMessage);
+            ||  event->type == ClientMessage
+            || (xd->use_shm && event->type == xd->shm_completion));
 }
 static void x11_event_handler(lv_timer_t * t)
 {
@@ -252,14 +413,26 @@ static void x11_event_handler(lv_timer_t * t)
     x11_disp_data_t * xd = lv_display_get_driver_data(disp);
     LV_ASSERT_NULL(xd);
 
+    /* without MIT-SHM there is no completion event, wait for the X server to process the put image */
+    if(xd->put_pending && !xd->use_shm) {
+        XSync(xd->hdr.display, False);
+        x11_put_done(disp);
+    }
+
     /* handle all outstanding X events */
     XEvent event;
-    while(XCheckIfEvent(xd->hdr.display, &event, is_disp_event, NULL)) {
+    while(XCheckIfEvent(xd->hdr.display, &event, is_disp_event, (XPointer)xd)) {
         LV_LOG_TRACE("Display Event %d", event.type);
+        if(xd->use_shm && event.type == xd->shm_completion) {
+            x11_put_done(disp);
+            continue;
+        }
         switch(event.type) {
             case Expose:
                 if(event.xexpose.count == 0) {
-                    XPutImage(xd->hdr.display, xd->window, xd->gc, xd->ximage, 0, 0, 0, 0, event.xexpose.width, event.xexpose.height);
+                    lv_area_t area;
+                    lv_area_set(&area, 0, 0, xd->ximage->width - 1, xd->ximage->height - 1);
+                    x11_put_areas(xd, &area, 1);
                 }
                 break;
             case ConfigureNotify:
@@ -339,11 +512,9 @@ static void x11_window_create(lv_display_t * disp, char const * title)
     x11_hide_cursor(disp);
 
     /* create cache XImage */
-    size_t sz_buffers = hor_res * ver_res * sizeof(lv_color32_t);
     xd->dplanes = XDisplayPlanes(xd->hdr.display, screen);
-    xd->xdata = malloc(sz_buffers); /* use clib method here, x11 memory not part of device footprint */
-    xd->ximage = XCreateImage(xd->hdr.display, xd->visual, xd->dplanes, ZPixmap, 0, xd->xdata,
-                              hor_res, ver_res, lv_color_format_get_bpp(LV_COLOR_FORMAT_ARGB8888), 0);
+    xd->shm_completion = XShmGetEventBase(xd->hdr.display) + ShmCompletion;
+    x11_image_create(xd, hor_res, ver_res);
 
     /* finally bring window on top of the other windows */
     XMapRaised(xd->hdr.display, xd->window);
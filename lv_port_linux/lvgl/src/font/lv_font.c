@@ -151,6 +151,29 @@ bool lv_font_get_glyph_dsc(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_o
     return false;
 }
 
+void lv_font_prefetch(const lv_font_t * font, const char * txt)
+{
+    LV_ASSERT_NULL(font);
+    if(txt == NULL) return;
+
+    uint32_t i = 0;
+    uint32_t letter = lv_text_encoded_next(txt, &i);
+    while(letter) {
+        uint32_t letter_next = lv_text_encoded_next(txt, &i);
+
+        lv_font_glyph_dsc_t g;
+        if(!lv_text_is_marker(letter) && letter != '\n' && letter != '\r' &&
+           lv_font_get_glyph_dsc(font, &g, letter, letter_next)) {
+            const lv_font_t * resolved_font = g.resolved_font;
+            if(resolved_font->prefetch_glyph && g.box_w > 0 && g.box_h > 0) {
+                resolved_font->prefetch_glyph(resolved_font, &g);
+            }
+        }
+
+        letter = letter_next;
+    }
+}
+
 uint16_t lv_font_get_glyph_width(const lv_font_t * font, uint32_t letter, uint32_t letter_next)
 {
     lv_font_glyph_dsc_t g;
@@ -102,6 +102,9 @@ struct _lv_font_t {
     /** Release a glyph*/
     void (*release_glyph)(const lv_font_t *, lv_font_glyph_dsc_t *);
 
+    /** Render a glyph into the font's cache before it's drawn. Optional, used by `lv_font_prefetch`*/
+    void (*prefetch_glyph)(const lv_font_t *, const lv_font_glyph_dsc_t *);
+
     /*Pointer to the font in a font pack (must have the same line height)*/
     int32_t line_height;         /**< The real line height where any text fits*/
     int32_t base_line;           /**< Base line measured from the bottom of the line_height*/
@@ -179,6 +182,17 @@ bool lv_font_get_glyph_dsc(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out
  */
 void lv_font_glyph_release_draw_data(lv_font_glyph_dsc_t * g_dsc);
 
+/**
+ * Render the glyphs of a text into the cache of the font (and its fallback fonts)
+ * so that drawing the text later doesn't need to wait for the glyphs to be rendered.
+ * Useful before showing a text with new letters, e.g. before switching the language.
+ * @param font      pointer to a font
+ * @param txt       a '\0' terminated UTF-8 text
+ * @note            It works only with fonts having a glyph cache (e.g. FreeType and Tiny TTF).
+ *                  FreeType fonts render the glyphs in a background thread if `LV_USE_OS` is enabled.
+ */
+void lv_font_prefetch(const lv_font_t * font, const char * txt);
+
 /**
  * Get the width of a glyph with kerning
  * @param font          pointer to a font
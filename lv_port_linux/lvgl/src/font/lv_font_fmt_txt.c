@@ -14,6 +14,7 @@
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
 #include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
@@ -22,6 +23,33 @@
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_FONT_FMT_TXT_LOOKUP_SIZE > 0
+    #if (LV_FONT_FMT_TXT_LOOKUP_SIZE & (LV_FONT_FMT_TXT_LOOKUP_SIZE - 1)) != 0
+        #error "LV_FONT_FMT_TXT_LOOKUP_SIZE must be a power of 2"
+    #endif
+    #define lookups LV_GLOBAL_DEFAULT()->font_fmt_txt_lookups
+    #define lookup_mutex LV_GLOBAL_DEFAULT()->font_fmt_txt_lookup_mutex
+    #define lookup_evict_idx LV_GLOBAL_DEFAULT()->font_fmt_txt_lookup_evict_idx
+    #define LATIN_GID_UNKNOWN 0xFFFF
+
+    /*The lookup tables are read without locking, their sequence number tells if they were modified meanwhile*/
+    #if defined(__GNUC__) || defined(__clang__)
+        #define SEQ_LOAD(p)             __atomic_load_n(p, __ATOMIC_ACQUIRE)
+        #define SEQ_STORE(p, v)         __atomic_store_n(p, v, __ATOMIC_RELEASE)
+        #define LOOKUP_PTR_LOAD(p)      __atomic_load_n(p, __ATOMIC_ACQUIRE)
+        #define LOOKUP_PTR_STORE(p, v)  __atomic_store_n(p, v, __ATOMIC_RELEASE)
+        #define READ_FENCE()            __atomic_thread_fence(__ATOMIC_ACQUIRE)
+        #define WRITE_FENCE()           __atomic_thread_fence(__ATOMIC_RELEASE)
+    #else
+        #define SEQ_LOAD(p)             (*(volatile uint32_t *)(p))
+        #define SEQ_STORE(p, v)         (*(volatile uint32_t *)(p) = (v))
+        #define LOOKUP_PTR_LOAD(p)      (*(lv_font_fmt_txt_lookup_t * volatile *)(p))
+        #define LOOKUP_PTR_STORE(p, v)  (*(lv_font_fmt_txt_lookup_t * volatile *)(p) = (v))
+        #define READ_FENCE()
+        #define WRITE_FENCE()
+    #endif
+#endif /*LV_FONT_FMT_TXT_LOOKUP_SIZE > 0*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -34,7 +62,16 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
+static int8_t find_kern_value(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid_left, uint32_t gid_right);
+#if LV_FONT_FMT_TXT_LOOKUP_SIZE > 0
+    static lv_font_fmt_txt_lookup_t * lookup_find(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t * seq);
+    static bool lookup_is_unchanged(lv_font_fmt_txt_lookup_t * lookup, uint32_t seq);
+    static lv_font_fmt_txt_lookup_t * lookup_get(const lv_font_fmt_txt_dsc_t * fdsc);
+    static void lookup_write_begin(lv_font_fmt_txt_lookup_t * lookup);
+    static void lookup_write_end(lv_font_fmt_txt_lookup_t * lookup);
+#endif
 static int unicode_list_compare(const void * ref, const void * element);
 static int kern_pair_8_compare(const void * ref, const void * element);
 static int kern_pair_16_compare(const void * ref, const void * element);
@@ -276,6 +313,44 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     return true;
 }
 
+void lv_font_fmt_txt_remove_lookup(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+#if LV_FONT_FMT_TXT_LOOKUP_SIZE > 0
+    /*The tables are not freed as other threads might read them now, they are reused for other fonts*/
+    lv_mutex_lock(&lookup_mutex);
+    uint32_t i;
+    for(i = 0; i < LV_FONT_FMT_TXT_LOOKUP_FONT_CNT && lookups[i]; i++) {
+        if(lookups[i]->fdsc == fdsc) {
+            lookup_write_begin(lookups[i]);
+            lookups[i]->fdsc = NULL;
+            lookup_write_end(lookups[i]);
+        }
+    }
+    lv_mutex_unlock(&lookup_mutex);
+#else
+    LV_UNUSED(fdsc);
+#endif
+}
+
+#if LV_FONT_FMT_TXT_LOOKUP_SIZE > 0
+void lv_font_fmt_txt_lookup_init(void)
+{
+    lv_memzero(lookups, sizeof(lookups));
+    lookup_evict_idx = 0;
+    lv_mutex_init(&lookup_mutex);
+}
+
+void lv_font_fmt_txt_lookup_deinit(void)
+{
+    uint32_t i;
+    for(i = 0; i < LV_FONT_FMT_TXT_LOOKUP_FONT_CNT; i++) {
+        lv_free(lookups[i]);
+        lookups[i] = NULL;
+    }
+    lv_mutex_delete(&lookup_mutex);
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -284,8 +359,51 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 {
     if(letter == '\0') return 0;
 
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+
+#if LV_FONT_FMT_TXT_LOOKUP_SIZE > 0
+    /*The letters of a script are usually close to each other so their low bits are a good hash*/
+    uint32_t idx = letter & (LV_FONT_FMT_TXT_LOOKUP_SIZE - 1);
+    uint32_t seq;
+    lv_font_fmt_txt_lookup_t * lookup = lookup_find(fdsc, &seq);
+    if(lookup) {
+        bool found;
+        uint32_t glyph_id;
+        if(letter < LV_FONT_FMT_TXT_LOOKUP_LATIN_CNT) {
+            glyph_id = lookup->latin_gids[letter];
+            found = glyph_id != LATIN_GID_UNKNOWN;
+        }
+        else {
+            found = lookup->glyphs[idx].letter == letter;
+            glyph_id = lookup->glyphs[idx].glyph_id;
+        }
+        if(found && lookup_is_unchanged(lookup, seq)) return glyph_id;
+    }
 
+    /*Find the glyph without holding the lock and store it for the next time*/
+    uint32_t glyph_id = find_glyph_dsc_id(fdsc, letter);
+    lv_mutex_lock(&lookup_mutex);
+    lookup = lookup_get(fdsc);
+    if(lookup) {
+        lookup_write_begin(lookup);
+        if(letter < LV_FONT_FMT_TXT_LOOKUP_LATIN_CNT) {
+            if(glyph_id < LATIN_GID_UNKNOWN) lookup->latin_gids[letter] = (uint16_t)glyph_id;
+        }
+        else {
+            lookup->glyphs[idx].letter = letter;
+            lookup->glyphs[idx].glyph_id = glyph_id;
+        }
+        lookup_write_end(lookup);
+    }
+    lv_mutex_unlock(&lookup_mutex);
+    return glyph_id;
+#else
+    return find_glyph_dsc_id(fdsc, letter);
+#endif
+}
+
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
@@ -335,8 +453,40 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
 {
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+
+#if LV_FONT_FMT_TXT_LOOKUP_SIZE > 0
+    /*Kern classes are already looked up directly*/
+    if(fdsc->kern_classes == 0 && gid_left <= 0xFFFF && gid_right <= 0xFFFF) {
+        uint32_t gid_pair = (gid_left << 16) | gid_right;
+        uint32_t idx = (gid_left * 31 + gid_right) & (LV_FONT_FMT_TXT_LOOKUP_SIZE - 1);
+        uint32_t seq;
+        lv_font_fmt_txt_lookup_t * lookup = lookup_find(fdsc, &seq);
+        if(lookup) {
+            bool found = lookup->kerns[idx].gid_pair == gid_pair;
+            int8_t value = (int8_t)lookup->kerns[idx].value;
+            if(found && lookup_is_unchanged(lookup, seq)) return value;
+        }
+
+        int8_t value = find_kern_value(fdsc, gid_left, gid_right);
+        lv_mutex_lock(&lookup_mutex);
+        lookup = lookup_get(fdsc);
+        if(lookup) {
+            lookup_write_begin(lookup);
+            lookup->kerns[idx].gid_pair = gid_pair;
+            lookup->kerns[idx].value = value;
+            lookup_write_end(lookup);
+        }
+        lv_mutex_unlock(&lookup_mutex);
+        return value;
+    }
+#endif
 
+    return find_kern_value(fdsc, gid_left, gid_right);
+}
+
+static int8_t find_kern_value(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid_left, uint32_t gid_right)
+{
     int8_t value = 0;
 
     if(fdsc->kern_classes == 0) {
@@ -389,6 +539,104 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     return value;
 }
 
+#if LV_FONT_FMT_TXT_LOOKUP_SIZE > 0
+/**
+ * Find the lookup tables of a font without locking
+ * @param fdsc      pointer to the font descriptor
+ * @param seq       store the sequence number of the tables here. Pass it to `lookup_is_unchanged()`
+ *                  after reading the tables.
+ * @return          the lookup tables or NULL if the font has none or they are being modified
+ */
+static lv_font_fmt_txt_lookup_t * lookup_find(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t * seq)
+{
+    uint32_t i;
+    for(i = 0; i < LV_FONT_FMT_TXT_LOOKUP_FONT_CNT; i++) {
+        lv_font_fmt_txt_lookup_t * lookup = LOOKUP_PTR_LOAD(&lookups[i]);
+        if(lookup == NULL) break;   /*The tables are allocated in order*/
+
+        *seq = SEQ_LOAD(&lookup->seq);
+        if(lookup->fdsc != fdsc) continue;
+        if(*seq & 1) return NULL;
+
+        /*Don't write the shared memory needlessly*/
+        if(!lookup->used) lookup->used = true;
+        return lookup;
+    }
+
+    return NULL;
+}
+
+/**
+ * Check if the values read from the lookup tables are valid
+ * @param lookup    pointer to the lookup tables
+ * @param seq       the sequence number returned by `lookup_find()`
+ * @return          true: the tables were not modified since `lookup_find()`
+ */
+static bool lookup_is_unchanged(lv_font_fmt_txt_lookup_t * lookup, uint32_t seq)
+{
+    READ_FENCE();
+    return SEQ_LOAD(&lookup->seq) == seq;
+}
+
+/**
+ * Get the lookup tables of a font or create them on the first use of the font.
+ * At most `LV_FONT_FMT_TXT_LOOKUP_FONT_CNT` tables are allocated, after that
+ * the tables of a font which wasn't used recently are reused.
+ * Needs to be called with `lookup_mutex` locked.
+ * @param fdsc      pointer to the font descriptor
+ * @return          the lookup tables or NULL on out of memory
+ */
+static lv_font_fmt_txt_lookup_t * lookup_get(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    lv_font_fmt_txt_lookup_t * free_lookup = NULL;
+    uint32_t i;
+    for(i = 0; i < LV_FONT_FMT_TXT_LOOKUP_FONT_CNT && lookups[i]; i++) {
+        if(lookups[i]->fdsc == fdsc) {
+            lookups[i]->used = true;
+            return lookups[i];
+        }
+        if(lookups[i]->fdsc == NULL && free_lookup == NULL) free_lookup = lookups[i];
+    }
+
+    lv_font_fmt_txt_lookup_t * lookup = free_lookup;
+    if(lookup == NULL && i < LV_FONT_FMT_TXT_LOOKUP_FONT_CNT) {
+        lookup = lv_malloc_zeroed(sizeof(lv_font_fmt_txt_lookup_t));
+        LV_ASSERT_MALLOC(lookup);
+        if(lookup == NULL) return NULL;
+        LOOKUP_PTR_STORE(&lookups[i], lookup);
+    }
+
+    /*Give a second chance to the tables used since the last eviction (clock algorithm)*/
+    while(lookup == NULL) {
+        lv_font_fmt_txt_lookup_t * candidate = lookups[lookup_evict_idx];
+        lookup_evict_idx = (lookup_evict_idx + 1) % LV_FONT_FMT_TXT_LOOKUP_FONT_CNT;
+        if(candidate->used) candidate->used = false;
+        else lookup = candidate;
+    }
+
+    lookup_write_begin(lookup);
+    lookup->fdsc = fdsc;
+    lookup->used = true;
+    lv_memset(lookup->latin_gids, 0xFF, sizeof(lookup->latin_gids));
+    lv_memzero(lookup->glyphs, sizeof(lookup->glyphs));
+    lv_memzero(lookup->kerns, sizeof(lookup->kerns));
+    lookup_write_end(lookup);
+    return lookup;
+}
+
+/* Make the readers ignore the tables while they are modified. Needs `lookup_mutex` locked. */
+static void lookup_write_begin(lv_font_fmt_txt_lookup_t * lookup)
+{
+    SEQ_STORE(&lookup->seq, lookup->seq + 1);
+    WRITE_FENCE();
+}
+
+static void lookup_write_end(lv_font_fmt_txt_lookup_t * lookup)
+{
+    SEQ_STORE(&lookup->seq, lookup->seq + 1);
+}
+#endif
+
 static int kern_pair_8_compare(const void * ref, const void * element)
 {
     const kern_pair_ref_t * ref8_p = ref;
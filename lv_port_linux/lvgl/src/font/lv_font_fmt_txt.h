@@ -224,6 +224,13 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+/**
+ * Drop the lookup tables which were built on the first use of a font to find its glyphs faster.
+ * Needs to be called before freeing or modifying a font descriptor created at runtime.
+ * @param fdsc      pointer to the font descriptor
+ */
+void lv_font_fmt_txt_remove_lookup(const lv_font_fmt_txt_dsc_t * fdsc);
+
 /**********************
  *      MACROS
  **********************/
@@ -20,6 +20,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** The code points below this are looked up in a flat table*/
+#define LV_FONT_FMT_TXT_LOOKUP_LATIN_CNT 0x250
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -41,10 +44,44 @@ typedef struct {
 } lv_font_fmt_rle_t;
 #endif
 
+#if LV_FONT_FMT_TXT_LOOKUP_SIZE > 0
+typedef struct {
+    uint32_t letter;        /**< 0: empty entry*/
+    uint32_t glyph_id;      /**< 0: the letter is not in the font*/
+} lv_font_fmt_txt_glyph_lookup_t;
+
+typedef struct {
+    uint32_t gid_pair;      /**< `gid_left << 16 | gid_right`. 0: empty entry*/
+    int32_t value;
+} lv_font_fmt_txt_kern_lookup_t;
+
+/** Lookup tables of a font built on its first use*/
+typedef struct {
+    const lv_font_fmt_txt_dsc_t * fdsc; /**< NULL: the tables are not used by any font*/
+    uint32_t seq;                       /**< Incremented before and after each modification, odd while modified*/
+    bool used;                          /**< The tables were used since the last eviction*/
+    uint16_t latin_gids[LV_FONT_FMT_TXT_LOOKUP_LATIN_CNT];              /**< 0xFFFF: not looked up yet*/
+    lv_font_fmt_txt_glyph_lookup_t glyphs[LV_FONT_FMT_TXT_LOOKUP_SIZE]; /**< Indexed by the letter*/
+    lv_font_fmt_txt_kern_lookup_t kerns[LV_FONT_FMT_TXT_LOOKUP_SIZE];   /**< Indexed by the glyph IDs*/
+} lv_font_fmt_txt_lookup_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_FONT_FMT_TXT_LOOKUP_SIZE > 0
+/**
+ * Initialize the lookup tables of the built-in format fonts
+ */
+void lv_font_fmt_txt_lookup_init(void);
+
+/**
+ * Free the lookup tables of all fonts
+ */
+void lv_font_fmt_txt_lookup_deinit(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,366 @@
+/**
+ * @file lv_font_sdf.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_font_sdf_private.h"
+
+#if LV_USE_FONT_SDF
+
+#include "../draw/lv_draw_label.h"
+#include "../misc/lv_math.h"
+#include "../misc/lv_area_private.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_log.h"
+#include "../stdlib/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Maps the pixels of a mask to the coordinates of a distance field. All values are in 16.16 format.*/
+typedef struct {
+    int32_t u0;     /**< x coordinate in the distance field of the center of the first pixel*/
+    int32_t v0;     /**< y coordinate in the distance field of the center of the first pixel*/
+    int32_t du_x;   /**< Change of `u` when stepping right by one pixel*/
+    int32_t dv_x;   /**< Change of `v` when stepping right by one pixel*/
+    int32_t du_y;   /**< Change of `u` when stepping down by one pixel*/
+    int32_t dv_y;   /**< Change of `v` when stepping down by one pixel*/
+    int32_t gain;   /**< Coverage change per distance value (255: 1 pixel per distance value)*/
+} sdf_map_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool sdf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t letter,
+                                 uint32_t letter_next);
+static const void * sdf_get_glyph_bitmap_cb(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf);
+static const lv_font_sdf_glyph_dsc_t * find_glyph(const lv_font_sdf_dsc_t * dsc, uint32_t letter);
+static void update_metrics(lv_font_sdf_t * sdf);
+static void render(const lv_font_sdf_dsc_t * dsc, const lv_font_sdf_glyph_dsc_t * sg, const sdf_map_t * map,
+                   int32_t w, int32_t h, uint8_t * buf, int32_t stride);
+static void get_sin_cos(int32_t rotation, int32_t * sin_out, int32_t * cos_out);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_font_t * lv_font_sdf_create(const lv_font_sdf_dsc_t * dsc, int32_t size)
+{
+    LV_ASSERT_NULL(dsc);
+    if(size <= 0 || dsc->size == 0 || dsc->pixel_dist_scale == 0) {
+        LV_LOG_WARN("invalid size or distance field descriptor");
+        return NULL;
+    }
+
+    lv_font_sdf_t * sdf = lv_malloc_zeroed(sizeof(lv_font_sdf_t));
+    LV_ASSERT_MALLOC(sdf);
+    if(sdf == NULL) return NULL;
+
+    sdf->dsc = dsc;
+    sdf->size = size;
+
+    lv_font_t * font = &sdf->font;
+    font->get_glyph_dsc = sdf_get_glyph_dsc_cb;
+    font->get_glyph_bitmap = sdf_get_glyph_bitmap_cb;
+    font->subpx = LV_FONT_SUBPX_NONE;
+    font->kerning = LV_FONT_KERNING_NONE;
+    font->dsc = sdf;
+    update_metrics(sdf);
+
+    return font;
+}
+
+void lv_font_sdf_set_size(lv_font_t * font, int32_t size)
+{
+    LV_ASSERT_NULL(font);
+    if(size <= 0) {
+        LV_LOG_WARN("invalid size: %" LV_PRId32, size);
+        return;
+    }
+
+    lv_font_sdf_t * sdf = (lv_font_sdf_t *)font->dsc;
+    if(sdf->size == size) return;
+
+    /*The cached glyph positions of the font are not valid anymore.
+     *The draw units don't cache the glyphs of SDF fonts so they need no invalidation.*/
+    lv_draw_label_run_cache_drop_font(font);
+
+    sdf->size = size;
+    update_metrics(sdf);
+}
+
+int32_t lv_font_sdf_get_size(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+    const lv_font_sdf_t * sdf = (const lv_font_sdf_t *)font->dsc;
+    return sdf->size;
+}
+
+bool lv_font_is_sdf(const lv_font_t * font)
+{
+    return font && font->get_glyph_dsc == sdf_get_glyph_dsc_cb;
+}
+
+void lv_font_sdf_destroy(lv_font_t * font)
+{
+    if(font == NULL) return;
+
+    lv_draw_label_run_cache_drop_font(font);
+
+    /*`font` is the first member of the SDF font*/
+    lv_font_sdf_t * sdf = (lv_font_sdf_t *)font;
+    lv_free(sdf);
+}
+
+void lv_font_sdf_get_transformed_area(const lv_font_glyph_dsc_t * g_dsc, const lv_point_t * pen,
+                                      const lv_point_t * pivot, int32_t rotation, int32_t scale_x, int32_t scale_y,
+                                      lv_area_t * area_out)
+{
+    int32_t sinma;
+    int32_t cosma;
+    get_sin_cos(rotation, &sinma, &cosma);
+
+    const lv_point_t corners[4] = {
+        {pen->x + g_dsc->ofs_x, pen->y - g_dsc->ofs_y - g_dsc->box_h},
+        {pen->x + g_dsc->ofs_x + g_dsc->box_w, pen->y - g_dsc->ofs_y - g_dsc->box_h},
+        {pen->x + g_dsc->ofs_x, pen->y - g_dsc->ofs_y},
+        {pen->x + g_dsc->ofs_x + g_dsc->box_w, pen->y - g_dsc->ofs_y},
+    };
+
+    area_out->x1 = INT32_MAX;
+    area_out->y1 = INT32_MAX;
+    area_out->x2 = INT32_MIN;
+    area_out->y2 = INT32_MIN;
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        int64_t dx = (int64_t)(corners[i].x - pivot->x) * scale_x;
+        int64_t dy = (int64_t)(corners[i].y - pivot->y) * scale_y;
+        int32_t x = pivot->x + (int32_t)((dx * cosma - dy * sinma) >> (LV_TRIGO_SHIFT + 8));
+        int32_t y = pivot->y + (int32_t)((dx * sinma + dy * cosma) >> (LV_TRIGO_SHIFT + 8));
+        area_out->x1 = LV_MIN(area_out->x1, x);
+        area_out->y1 = LV_MIN(area_out->y1, y);
+        area_out->x2 = LV_MAX(area_out->x2, x);
+        area_out->y2 = LV_MAX(area_out->y2, y);
+    }
+
+    /*Let room for the rounding and the anti-aliasing*/
+    lv_area_increase(area_out, 1, 1);
+}
+
+void lv_font_sdf_render_transformed(const lv_font_glyph_dsc_t * g_dsc, const lv_point_t * pen,
+                                    const lv_point_t * pivot, int32_t rotation, int32_t scale_x, int32_t scale_y,
+                                    const lv_area_t * area, uint8_t * buf, int32_t stride)
+{
+    const lv_font_sdf_t * sdf = (const lv_font_sdf_t *)g_dsc->resolved_font->dsc;
+    const lv_font_sdf_dsc_t * dsc = sdf->dsc;
+    const lv_font_sdf_glyph_dsc_t * sg = &dsc->glyph_dsc[g_dsc->gid.index];
+
+    if(scale_x <= 0 || scale_y <= 0) return;
+
+    int32_t sinma;
+    int32_t cosma;
+    get_sin_cos(rotation, &sinma, &cosma);
+
+    /* Distance field pixels per screen pixel without the transformation */
+    int64_t inv_scale = ((int64_t)dsc->size << 16) / sdf->size;
+
+    /* The inverse of the transformation maps the screen pixels back to the not transformed glyph:
+     * x = pivot.x + ( dx * cos + dy * sin) / scale_x
+     * y = pivot.y + (-dx * sin + dy * cos) / scale_y
+     * which is converted to distance field coordinates*/
+    sdf_map_t map;
+    map.du_x = (int32_t)(((int64_t)cosma * inv_scale * 256 / scale_x) >> LV_TRIGO_SHIFT);
+    map.du_y = (int32_t)(((int64_t)sinma * inv_scale * 256 / scale_x) >> LV_TRIGO_SHIFT);
+    map.dv_x = (int32_t)((-(int64_t)sinma * inv_scale * 256 / scale_y) >> LV_TRIGO_SHIFT);
+    map.dv_y = (int32_t)(((int64_t)cosma * inv_scale * 256 / scale_y) >> LV_TRIGO_SHIFT);
+
+    /*Offset of the center of the first pixel from the pivot in 16.16 format*/
+    int64_t dx = (int64_t)(area->x1 - pivot->x) * 65536 + 0x8000;
+    int64_t dy = (int64_t)(area->y1 - pivot->y) * 65536 + 0x8000;
+    int64_t x = (int64_t)(pivot->x - pen->x) * 65536 + ((dx * cosma + dy * sinma) >> LV_TRIGO_SHIFT) * 256 / scale_x;
+    int64_t y = (int64_t)(pivot->y - pen->y) * 65536 + ((-dx * sinma + dy * cosma) >> LV_TRIGO_SHIFT) * 256 / scale_y;
+    map.u0 = (int32_t)((x * inv_scale) >> 16) - (int32_t)sg->ofs_x * 65536;
+    map.v0 = (int32_t)((y * inv_scale) >> 16) + ((int32_t)sg->ofs_y + sg->box_h) * 65536;
+
+    /*The edges are as sharp as on the average scale*/
+    map.gain = (int32_t)((int64_t)255 * sdf->scale * (scale_x + scale_y) / 512 / dsc->pixel_dist_scale);
+
+    render(dsc, sg, &map, lv_area_get_width(area), lv_area_get_height(area), buf, stride);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool sdf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t letter,
+                                 uint32_t letter_next)
+{
+    LV_UNUSED(letter_next);
+
+    const lv_font_sdf_t * sdf = (const lv_font_sdf_t *)font->dsc;
+    const lv_font_sdf_dsc_t * dsc = sdf->dsc;
+    const lv_font_sdf_glyph_dsc_t * sg = find_glyph(dsc, letter);
+    if(sg == NULL) return false;
+
+    /*The padding of the distance field is empty except the anti-aliased edge
+     *which is half screen pixel wide, and 1 more pixel is needed for the interpolation*/
+    int64_t scale = sdf->scale;
+    int32_t fringe = 1 + (int32_t)(((1 << 15) + scale - 1) / scale);
+    int32_t pad = LV_CLAMP(0, dsc->padding - fringe, LV_MIN(sg->box_w / 2, sg->box_h / 2));
+    int32_t x1 = (int32_t)(((int64_t)(sg->ofs_x + pad) * scale) >> 16);
+    int32_t x2 = -(int32_t)((-(int64_t)(sg->ofs_x + sg->box_w - pad) * scale) >> 16);
+    int32_t y1 = (int32_t)(((int64_t)(sg->ofs_y + pad) * scale) >> 16);
+    int32_t y2 = -(int32_t)((-(int64_t)(sg->ofs_y + sg->box_h - pad) * scale) >> 16);
+
+    dsc_out->adv_w = (uint16_t)((sg->adv_w * scale + (1 << 19)) >> 20);
+    dsc_out->box_w = (uint16_t)LV_MAX(x2 - x1, 0);
+    dsc_out->box_h = (uint16_t)LV_MAX(y2 - y1, 0);
+    dsc_out->ofs_x = (int16_t)x1;
+    dsc_out->ofs_y = (int16_t)y1;
+    dsc_out->stride = 0;
+    dsc_out->format = LV_FONT_GLYPH_FORMAT_A8;
+    dsc_out->is_placeholder = false;
+    dsc_out->gid.index = (uint32_t)(sg - dsc->glyph_dsc);
+    dsc_out->entry = NULL;
+
+    return true;
+}
+
+static const void * sdf_get_glyph_bitmap_cb(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf)
+{
+    if(draw_buf == NULL) return NULL;
+
+    const lv_font_sdf_t * sdf = (const lv_font_sdf_t *)g_dsc->resolved_font->dsc;
+    const lv_font_sdf_dsc_t * dsc = sdf->dsc;
+    const lv_font_sdf_glyph_dsc_t * sg = &dsc->glyph_dsc[g_dsc->gid.index];
+
+    /*Map the centers of the pixels to the distance field without rotation*/
+    int64_t inv_scale = ((int64_t)dsc->size << 16) / sdf->size;
+    sdf_map_t map;
+    map.du_x = (int32_t)inv_scale;
+    map.dv_x = 0;
+    map.du_y = 0;
+    map.dv_y = (int32_t)inv_scale;
+    map.u0 = (int32_t)(((2 * g_dsc->ofs_x + 1) * inv_scale) / 2) - (int32_t)sg->ofs_x * 65536;
+    map.v0 = ((int32_t)sg->ofs_y + sg->box_h) * 65536 -
+             (int32_t)(((2 * (g_dsc->ofs_y + g_dsc->box_h) - 1) * inv_scale) / 2);
+    map.gain = (int32_t)((int64_t)255 * sdf->scale / dsc->pixel_dist_scale);
+
+    render(dsc, sg, &map, g_dsc->box_w, g_dsc->box_h, draw_buf->data, draw_buf->header.stride);
+
+    return draw_buf;
+}
+
+static const lv_font_sdf_glyph_dsc_t * find_glyph(const lv_font_sdf_dsc_t * dsc, uint32_t letter)
+{
+    uint32_t min = 0;
+    uint32_t max = dsc->glyph_cnt;
+    while(min < max) {
+        uint32_t mid = (min + max) / 2;
+        uint32_t unicode = dsc->glyph_dsc[mid].unicode;
+        if(unicode == letter) return &dsc->glyph_dsc[mid];
+        if(unicode < letter) min = mid + 1;
+        else max = mid;
+    }
+
+    return NULL;
+}
+
+static void update_metrics(lv_font_sdf_t * sdf)
+{
+    const lv_font_sdf_dsc_t * dsc = sdf->dsc;
+    lv_font_t * font = &sdf->font;
+    int32_t size = sdf->size;
+
+    sdf->scale = (int32_t)(((int64_t)size << 16) / dsc->size);
+    font->line_height = (dsc->line_height * size + dsc->size / 2) / dsc->size;
+    font->base_line = (dsc->base_line * size + dsc->size / 2) / dsc->size;
+    font->underline_position = (int8_t)(dsc->underline_position * size / dsc->size);
+    font->underline_thickness = (int8_t)LV_MAX(dsc->underline_thickness * size / dsc->size, 1);
+}
+
+static void render(const lv_font_sdf_dsc_t * dsc, const lv_font_sdf_glyph_dsc_t * sg, const sdf_map_t * map,
+                   int32_t w, int32_t h, uint8_t * buf, int32_t stride)
+{
+    const uint8_t * field = dsc->atlas + (int32_t)sg->atlas_y * dsc->atlas_w + sg->atlas_x;
+    const int32_t field_stride = dsc->atlas_w;
+    const int32_t field_w = sg->box_w;
+    const int32_t field_h = sg->box_h;
+    const int32_t edge = (int32_t)dsc->edge_value << 8;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        /*Sample between the centers of the distance field pixels*/
+        int32_t u = map->u0 + y * map->du_y - 0x8000;
+        int32_t v = map->v0 + y * map->dv_y - 0x8000;
+        uint8_t * dest = buf + y * stride;
+
+        int32_t x;
+        for(x = 0; x < w; x++, u += map->du_x, v += map->dv_x) {
+            int32_t fx0 = u >> 16;
+            int32_t fy0 = v >> 16;
+            if(fx0 < -1 || fy0 < -1 || fx0 >= field_w || fy0 >= field_h) {
+                dest[x] = 0;
+                continue;
+            }
+
+            int32_t ux = (u >> 8) & 0xFF;
+            int32_t vy = (v >> 8) & 0xFF;
+
+            /*The pixels out of the field are far from the glyph*/
+            const uint8_t * p = field + fy0 * field_stride + fx0;
+            bool in_x0 = fx0 >= 0;
+            bool in_x1 = fx0 + 1 < field_w;
+            bool in_y0 = fy0 >= 0;
+            bool in_y1 = fy0 + 1 < field_h;
+            int32_t v00 = in_y0 && in_x0 ? p[0] : 0;
+            int32_t v01 = in_y0 && in_x1 ? p[1] : 0;
+            int32_t v10 = in_y1 && in_x0 ? p[field_stride] : 0;
+            int32_t v11 = in_y1 && in_x1 ? p[field_stride + 1] : 0;
+
+            int32_t top = v00 * (256 - ux) + v01 * ux;
+            int32_t bottom = v10 * (256 - ux) + v11 * ux;
+            int32_t value = (top * (256 - vy) + bottom * vy) >> 8;
+
+            int32_t cov = 128 + (int32_t)(((int64_t)(value - edge) * map->gain) >> 24);
+            dest[x] = (uint8_t)LV_CLAMP(0, cov, 255);
+        }
+    }
+}
+
+static void get_sin_cos(int32_t rotation, int32_t * sin_out, int32_t * cos_out)
+{
+    rotation = rotation % 3600;
+    if(rotation < 0) rotation += 3600;
+
+    int32_t angle_low = rotation / 10;
+    int32_t angle_high = angle_low + 1;
+    int32_t angle_rem = rotation - (angle_low * 10);
+
+    int32_t s1 = lv_trigo_sin((int16_t)angle_low);
+    int32_t s2 = lv_trigo_sin((int16_t)angle_high);
+    int32_t c1 = lv_trigo_cos((int16_t)angle_low);
+    int32_t c2 = lv_trigo_cos((int16_t)angle_high);
+
+    *sin_out = (s1 * (10 - angle_rem) + s2 * angle_rem) / 10;
+    *cos_out = (c1 * (10 - angle_rem) + c2 * angle_rem) / 10;
+}
+
+#endif /*LV_USE_FONT_SDF*/
@@ -0,0 +1,117 @@
+/**
+ * @file lv_font_sdf.h
+ *
+ */
+
+#ifndef LV_FONT_SDF_H
+#define LV_FONT_SDF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#if LV_USE_FONT_SDF
+
+#include "lv_font.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Describes a glyph of an SDF font.
+ *  The metrics are in pixels at the size the distance fields were generated with.*/
+typedef struct {
+    uint32_t unicode;   /**< The letter*/
+    uint16_t adv_w;     /**< Advance width in 1/16 pixels*/
+    uint16_t atlas_x;   /**< x coordinate of the distance field in the atlas*/
+    uint16_t atlas_y;   /**< y coordinate of the distance field in the atlas*/
+    uint16_t box_w;     /**< Width of the distance field (including the padding)*/
+    uint16_t box_h;     /**< Height of the distance field (including the padding)*/
+    int16_t ofs_x;      /**< x offset of the distance field from the pen position*/
+    int16_t ofs_y;      /**< y offset of the bottom of the distance field from the base line*/
+} lv_font_sdf_glyph_dsc_t;
+
+/** Describes the signed distance fields of the glyphs of a font.
+ *  It's usually generated by `scripts/font_sdf_conv` from a TTF/OTF file.*/
+typedef struct {
+    /** The distance fields of all glyphs packed into one 8 bit per pixel image.
+     *  `edge_value` is on the outline of the glyph, larger values are inside.*/
+    const uint8_t * atlas;
+    uint16_t atlas_w;   /**< Width (and stride) of the atlas*/
+    uint16_t atlas_h;   /**< Height of the atlas*/
+
+    const lv_font_sdf_glyph_dsc_t * glyph_dsc;  /**< The glyphs sorted by `unicode`*/
+    uint32_t glyph_cnt;                         /**< Number of glyphs*/
+
+    uint16_t size;                  /**< The pixel size the distance fields were generated with*/
+    uint16_t line_height;           /**< Line height at `size`*/
+    int16_t base_line;              /**< Base line measured from the bottom of the line at `size`*/
+    int8_t underline_position;      /**< Distance between the top of the underline and base line at `size`*/
+    int8_t underline_thickness;     /**< Thickness of the underline at `size`*/
+
+    uint8_t padding;                /**< Empty pixels around the glyphs in the distance fields*/
+    uint8_t edge_value;             /**< Value of the distance fields on the outline of the glyphs*/
+    uint8_t pixel_dist_scale;       /**< Change of the value per pixel distance from the outline*/
+} lv_font_sdf_dsc_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a font from signed distance fields. The same distance fields can be used for
+ * fonts with any size.
+ * @param dsc       the distance fields and metrics of the glyphs. Only its pointer is saved.
+ * @param size      the pixel size of the font
+ * @return          the created font or NULL on error
+ */
+lv_font_t * lv_font_sdf_create(const lv_font_sdf_dsc_t * dsc, int32_t size);
+
+/**
+ * Change the size of an SDF font. It's cheap as no glyphs need to be rendered in advance,
+ * so it can be used to animate the size of a text.
+ * @param font      a font created by `lv_font_sdf_create`
+ * @param size      the new pixel size of the font
+ */
+void lv_font_sdf_set_size(lv_font_t * font, int32_t size);
+
+/**
+ * Get the size of an SDF font.
+ * @param font      a font created by `lv_font_sdf_create`
+ * @return          the pixel size of the font
+ */
+int32_t lv_font_sdf_get_size(const lv_font_t * font);
+
+/**
+ * Check if a font is an SDF font.
+ * @param font      pointer to a font
+ * @return          true: the font was created by `lv_font_sdf_create`
+ */
+bool lv_font_is_sdf(const lv_font_t * font);
+
+/**
+ * Free the memory allocated by `lv_font_sdf_create`
+ * @param font      a font created by `lv_font_sdf_create`
+ */
+void lv_font_sdf_destroy(lv_font_t * font);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_FONT_SDF*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_FONT_SDF_H*/
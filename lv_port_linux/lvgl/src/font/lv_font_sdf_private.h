@@ -0,0 +1,76 @@
+/**
+ * @file lv_font_sdf_private.h
+ *
+ */
+
+#ifndef LV_FONT_SDF_PRIVATE_H
+#define LV_FONT_SDF_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_font_sdf.h"
+
+#if LV_USE_FONT_SDF
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** An SDF font with a given size. `font.dsc` points to itself.*/
+typedef struct {
+    lv_font_t font;
+    const lv_font_sdf_dsc_t * dsc;
+    int32_t size;
+    int32_t scale;      /**< `size / dsc->size` in 16.16 format*/
+} lv_font_sdf_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Render a glyph of an SDF font rotated and scaled as an A8 mask.
+ * @param g_dsc     the glyph's descriptor, `resolved_font` needs to be an SDF font
+ * @param pen       the pen position on the base line where the glyph is drawn without transformation
+ * @param pivot     the center of the rotation and scaling
+ * @param rotation  rotation angle in 0.1 degree units
+ * @param scale_x   horizontal scale (256: no scale)
+ * @param scale_y   vertical scale (256: no scale)
+ * @param area      the area to render, the mask needs to have the same size
+ * @param buf       the mask buffer
+ * @param stride    stride of `buf` in bytes
+ */
+void lv_font_sdf_render_transformed(const lv_font_glyph_dsc_t * g_dsc, const lv_point_t * pen,
+                                    const lv_point_t * pivot, int32_t rotation, int32_t scale_x, int32_t scale_y,
+                                    const lv_area_t * area, uint8_t * buf, int32_t stride);
+
+/**
+ * Get the area of a rotated and scaled glyph of an SDF font.
+ * The parameters are the same as in `lv_font_sdf_render_transformed`.
+ * @param area_out  store the area here
+ */
+void lv_font_sdf_get_transformed_area(const lv_font_glyph_dsc_t * g_dsc, const lv_point_t * pen,
+                                      const lv_point_t * pivot, int32_t rotation, int32_t scale_x, int32_t scale_y,
+                                      lv_area_t * area_out);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_FONT_SDF*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_FONT_SDF_PRIVATE_H*/
@@ -59,6 +59,15 @@
 #define indev_obj_act LV_GLOBAL_DEFAULT()->indev_obj_active
 #define indev_ll_head &(LV_GLOBAL_DEFAULT()->indev_ll)
 
+/*The sample queue indices are shared between the pushing thread and LVGL*/
+#if defined(__GNUC__) || defined(__clang__)
+    #define SAMPLE_IDX_LOAD(p)      __atomic_load_n(p, __ATOMIC_ACQUIRE)
+    #define SAMPLE_IDX_STORE(p, v)  __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#else
+    #define SAMPLE_IDX_LOAD(p)      (*(volatile uint32_t *)(p))
+    #define SAMPLE_IDX_STORE(p, v)  (*(volatile uint32_t *)(p) = (v))
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -82,6 +91,9 @@ static bool indev_reset_check(lv_indev_t * indev);
 static void indev_read_core(lv_indev_t * indev, lv_indev_data_t * data);
 static void indev_reset_core(lv_indev_t * indev, lv_obj_t * obj);
 static lv_result_t send_event(lv_event_code_t code, void * param);
+static bool indev_sample_pop(lv_indev_t * indev, lv_indev_data_t * data);
+static void indev_point_hist_reset(lv_indev_t * indev);
+static void indev_scroll_throw_vect_update(lv_indev_t * indev);
 
 static void indev_scroll_throw_anim_start(lv_indev_t * indev);
 static void indev_scroll_throw_anim_cb(void * var, int32_t v);
@@ -160,6 +172,8 @@ void lv_indev_delete(lv_indev_t * indev)
     /*Clean up the read timer first*/
     if(indev->read_timer) lv_timer_delete(indev->read_timer);
 
+    lv_free(indev->sample_buf);
+
     /*Remove the input device from the list*/
     lv_ll_remove(indev_ll_head, indev);
     /*Free the memory of the input device*/
@@ -194,13 +208,26 @@ void indev_read_core(lv_indev_t * indev, lv_indev_data_t * data)
         data->key = LV_KEY_ENTER;
     }
 
-    if(indev->read_cb) {
+    /*Report the queued samples first*/
+    if(indev_sample_pop(indev, data)) {
+        LV_TRACE_INDEV("reporting a queued sample");
+    }
+    else if(indev->read_cb) {
         LV_TRACE_INDEV("calling indev_read_cb");
         indev->read_cb(indev, data);
 
+        /*The driver might have queued samples instead of setting `data`*/
+        bool continue_reading = data->continue_reading;
+        if(indev_sample_pop(indev, data)) data->continue_reading |= continue_reading;
+
         /*Set the time stamp to the current time is it was not set in the read_cb*/
         if(data->timestamp == 0) data->timestamp = lv_tick_get();
     }
+    else if(indev->sample_buf) {
+        /*Nothing new was pushed, keep the last state*/
+        data->state = indev->state;
+        data->timestamp = lv_tick_get();
+    }
     else {
         LV_LOG_WARN("indev_read_cb is not registered");
     }
@@ -241,7 +268,7 @@ void lv_indev_read(lv_indev_t * indev)
     do {
         /*Read the data*/
         indev_read_core(indev, &data);
-        continue_reading = indev->mode != LV_INDEV_MODE_EVENT && data.continue_reading;
+        continue_reading = data.continue_reading;
 
         /*The active object might be deleted even in the read function*/
         indev_proc_reset_query_handler(indev);
@@ -282,6 +309,56 @@ void lv_indev_read(lv_indev_t * indev)
     LV_PROFILER_INDEV_END;
 }
 
+lv_result_t lv_indev_set_sample_queue_size(lv_indev_t * indev, uint32_t size)
+{
+    LV_ASSERT_NULL(indev);
+
+    lv_free(indev->sample_buf);
+    indev->sample_buf = NULL;
+    indev->sample_buf_size = 0;
+    indev->sample_head = 0;
+    indev->sample_tail = 0;
+    if(size == 0) return LV_RESULT_OK;
+
+    /*A power of 2 size keeps the free running indices valid when they overflow*/
+    uint32_t buf_size = 1;
+    while(buf_size < size) buf_size <<= 1;
+
+    indev->sample_buf = lv_malloc(buf_size * sizeof(lv_indev_data_t));
+    LV_ASSERT_MALLOC(indev->sample_buf);
+    if(indev->sample_buf == NULL) return LV_RESULT_INVALID;
+
+    indev->sample_buf_size = buf_size;
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_indev_push_data(lv_indev_t * indev, const lv_indev_data_t * data)
+{
+    LV_ASSERT_NULL(indev);
+    LV_ASSERT_NULL(data);
+
+    if(lv_indev_get_sample_queue_space(indev) == 0) return LV_RESULT_INVALID;
+
+    uint32_t tail = indev->sample_tail;
+    lv_indev_data_t * sample = &indev->sample_buf[tail & (indev->sample_buf_size - 1)];
+    *sample = *data;
+    sample->continue_reading = false;
+    if(sample->timestamp == 0) sample->timestamp = lv_tick_get();
+
+    /*Publish the sample only when it's completely written*/
+    SAMPLE_IDX_STORE(&indev->sample_tail, tail + 1);
+    return LV_RESULT_OK;
+}
+
+uint32_t lv_indev_get_sample_queue_space(lv_indev_t * indev)
+{
+    LV_ASSERT_NULL(indev);
+
+    if(indev->sample_buf == NULL) return 0;
+    uint32_t head = SAMPLE_IDX_LOAD(&indev->sample_head);
+    return indev->sample_buf_size - (indev->sample_tail - head);
+}
+
 void lv_indev_enable(lv_indev_t * indev, bool enable)
 {
     if(indev) {
@@ -735,6 +812,8 @@ static void indev_pointer_proc(lv_indev_t * i, lv_indev_data_t * data)
     indev_proc_pointer_diff(i);
 
     if(i->state == LV_INDEV_STATE_PRESSED) {
+        /*Don't mix the points of the previous press into the velocity*/
+        if(i->prev_state != LV_INDEV_STATE_PRESSED) indev_point_hist_reset(i);
         indev_proc_press(i);
     }
     else {
@@ -1174,17 +1253,85 @@ static void indev_button_proc(lv_indev_t * i, lv_indev_data_t * data)
 }
 
 /**
- * Apply time decay to a scroll throw vector, such that there is no decay
- * initially and full decay after a short period of time.
- * @param x scroll throw vector component
- * @param t expired time in milliseconds
- * @return decayed vector component
+ * Forget the recorded points of the pointer, e.g. when a new press starts,
+ * so that the velocity is calculated only from the points of the current press.
+ * @param indev pointer to an input device
+ */
+static void indev_point_hist_reset(lv_indev_t * indev)
+{
+    indev->pointer.point_hist_index = 0;
+    indev->pointer.point_hist_cnt = 0;
+}
+
+/**
+ * Fit a line on the points of the last `LV_INDEV_VELOCITY_WINDOW` ms with least squares
+ * to get the velocity of the pointer. It doesn't depend on how often the
+ * input device is read so high rate samples make it only more accurate.
+ * @param indev pointer to an input device
+ */
+static void indev_scroll_throw_vect_update(lv_indev_t * indev)
+{
+    uint32_t newest = (indev->pointer.point_hist_index + LV_INDEV_POINT_HIST_SIZE - 1) % LV_INDEV_POINT_HIST_SIZE;
+    lv_point_t p0 = indev->pointer.point_hist[newest];
+    uint32_t t0 = indev->pointer.point_hist_timestamp[newest];
+    lv_point_t p_oldest = p0;
+
+    /*Use coordinates relative to the newest point to keep the sums small*/
+    int64_t n = 0;
+    int64_t st = 0, stt = 0;
+    int64_t sx = 0, stx = 0;
+    int64_t sy = 0, sty = 0;
+    uint32_t i;
+    for(i = 0; i < indev->pointer.point_hist_cnt; i++) {
+        uint32_t idx = (newest + LV_INDEV_POINT_HIST_SIZE - i) % LV_INDEV_POINT_HIST_SIZE;
+        int32_t age = lv_tick_diff(t0, indev->pointer.point_hist_timestamp[idx]);
+        if(age > LV_INDEV_VELOCITY_WINDOW) break;
+
+        int64_t t = -age;
+        int64_t x = indev->pointer.point_hist[idx].x - p0.x;
+        int64_t y = indev->pointer.point_hist[idx].y - p0.y;
+        n++;
+        st += t;
+        stt += t * t;
+        sx += x;
+        stx += t * x;
+        sy += y;
+        sty += t * y;
+        p_oldest = indev->pointer.point_hist[idx];
+    }
+
+    int64_t den = n * stt - st * st;
+    if(den == 0) {
+        /*All the points have the same timestamp, use the distance they covered*/
+        indev->pointer.scroll_throw_vect.x = p0.x - p_oldest.x;
+        indev->pointer.scroll_throw_vect.y = p0.y - p_oldest.y;
+    }
+    else {
+        indev->pointer.scroll_throw_vect.x = (int32_t)(((n * stx - st * sx) * LV_INDEV_SCROLL_THROW_TIME) / den);
+        indev->pointer.scroll_throw_vect.y = (int32_t)(((n * sty - st * sy) * LV_INDEV_SCROLL_THROW_TIME) / den);
+    }
+}
+
+/**
+ * Get the oldest sample from the queue of an input device
+ * @param indev pointer to an input device
+ * @param data  store the sample here
+ * @return      true: `data` was set; false: the queue was empty
  */
-static int32_t indev_scroll_throw_decay(int32_t x, int32_t t)
+static bool indev_sample_pop(lv_indev_t * indev, lv_indev_data_t * data)
 {
-    if(t <= 0) return x;
-    if(t >= 99) return 0;
-    return x * (512 - (512 * t) / 99) / 512;
+    if(indev->sample_buf == NULL) return false;
+
+    uint32_t head = indev->sample_head;
+    uint32_t tail = SAMPLE_IDX_LOAD(&indev->sample_tail);
+    if(head == tail) return false;
+
+    *data = indev->sample_buf[head & (indev->sample_buf_size - 1)];
+    head++;
+    SAMPLE_IDX_STORE(&indev->sample_head, head);
+
+    data->continue_reading = head != tail;
+    return true;
 }
 
 /**
@@ -1300,17 +1447,12 @@ static void indev_proc_press(lv_indev_t * indev)
     indev->pointer.vect.x = indev->pointer.act_point.x - indev->pointer.last_point.x;
     indev->pointer.vect.y = indev->pointer.act_point.y - indev->pointer.last_point.y;
 
-    indev->pointer.vect_hist[indev->pointer.vect_hist_index] = indev->pointer.vect;
-    indev->pointer.vect_hist_timestamp[indev->pointer.vect_hist_index] = indev->timestamp;
-    indev->pointer.vect_hist_index = (indev->pointer.vect_hist_index + 1) % LV_INDEV_VECT_HIST_SIZE;
+    indev->pointer.point_hist[indev->pointer.point_hist_index] = indev->pointer.act_point;
+    indev->pointer.point_hist_timestamp[indev->pointer.point_hist_index] = indev->timestamp;
+    indev->pointer.point_hist_index = (indev->pointer.point_hist_index + 1) % LV_INDEV_POINT_HIST_SIZE;
+    if(indev->pointer.point_hist_cnt < LV_INDEV_POINT_HIST_SIZE) indev->pointer.point_hist_cnt++;
 
-    indev->pointer.scroll_throw_vect.x = 0;
-    indev->pointer.scroll_throw_vect.y = 0;
-    for(int i = 0; i < LV_INDEV_VECT_HIST_SIZE; i++) {
-        int32_t t = lv_tick_diff(indev->timestamp, indev->pointer.vect_hist_timestamp[i]);
-        indev->pointer.scroll_throw_vect.x += indev_scroll_throw_decay(indev->pointer.vect_hist[i].x, t);
-        indev->pointer.scroll_throw_vect.y += indev_scroll_throw_decay(indev->pointer.vect_hist[i].y, t);
-    }
+    indev_scroll_throw_vect_update(indev);
 
     indev->pointer.scroll_throw_vect_ori = indev->pointer.scroll_throw_vect;
 
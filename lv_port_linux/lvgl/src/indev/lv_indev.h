@@ -72,7 +72,7 @@ typedef struct {
     int16_t enc_diff; /**< For LV_INDEV_TYPE_ENCODER number of steps since the previous read*/
 
     uint32_t timestamp; /**< Initialized to lv_tick_get(). Driver may provide more accurate timestamp for buffered events*/
-    bool continue_reading;  /**< If set to true, the read callback is invoked again, unless the device is in event-driven mode*/
+    bool continue_reading;  /**< If set to true, the read callback is invoked again to report the buffered data*/
 } lv_indev_data_t;
 
 typedef void (*lv_indev_read_cb_t)(lv_indev_t * indev, lv_indev_data_t * data);
@@ -107,6 +107,33 @@ lv_indev_t * lv_indev_get_next(lv_indev_t * indev);
  */
 void lv_indev_read(lv_indev_t * indev);
 
+/**
+ * Create a queue for the samples added by `lv_indev_push_data()`.
+ * Should be called before anything is pushed.
+ * @param indev     pointer to an input device
+ * @param size      max. number of queued samples, rounded up to a power of 2. 0: delete the queue
+ * @return          LV_RESULT_OK: the queue was created; LV_RESULT_INVALID: out of memory
+ */
+lv_result_t lv_indev_set_sample_queue_size(lv_indev_t * indev, uint32_t size);
+
+/**
+ * Add a sample to the queue of an input device. The queued samples are reported one by one
+ * with their own timestamps by `lv_indev_read()` before `read_cb` is called.
+ * It can be called from any thread or interrupt without locking
+ * as long as only one thread adds samples to the input device.
+ * @param indev     pointer to an input device with a sample queue
+ * @param data      the sample. If its `timestamp` is 0, the current time is used.
+ * @return          LV_RESULT_OK: the sample was queued; LV_RESULT_INVALID: the queue is full or missing
+ */
+lv_result_t lv_indev_push_data(lv_indev_t * indev, const lv_indev_data_t * data);
+
+/**
+ * Get how many samples can be added to the queue of an input device
+ * @param indev     pointer to an input device
+ * @return          number of free slots in the sample queue
+ */
+uint32_t lv_indev_get_sample_queue_space(lv_indev_t * indev);
+
 /**
  * Called periodically to read the input devices
  * @param timer pointer to a timer to read
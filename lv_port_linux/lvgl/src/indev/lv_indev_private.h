@@ -21,7 +21,9 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
-#define LV_INDEV_VECT_HIST_SIZE 8
+#define LV_INDEV_POINT_HIST_SIZE 16
+#define LV_INDEV_VELOCITY_WINDOW 100    /**< [ms] Only the points of this period are used for the velocity*/
+#define LV_INDEV_SCROLL_THROW_TIME 66   /**< [ms] The scroll throw vector is the velocity multiplied by this*/
 
 /**********************
  *      TYPEDEFS
@@ -85,9 +87,10 @@ struct _lv_indev_t {
         lv_point_t last_point; /**< Last point of input device.*/
         lv_point_t last_raw_point; /**< Last point read from read_cb. */
         lv_point_t vect; /**< Difference between `act_point` and `last_point`.*/
-        lv_point_t vect_hist[LV_INDEV_VECT_HIST_SIZE];
-        uint32_t   vect_hist_timestamp[LV_INDEV_VECT_HIST_SIZE];
-        uint8_t    vect_hist_index;
+        lv_point_t point_hist[LV_INDEV_POINT_HIST_SIZE]; /**< The last points of the current press*/
+        uint32_t   point_hist_timestamp[LV_INDEV_POINT_HIST_SIZE];
+        uint8_t    point_hist_index;
+        uint8_t    point_hist_cnt;
         lv_point_t scroll_sum; /*Count the dragged pixels to check LV_INDEV_DEF_SCROLL_LIMIT*/
         lv_point_t scroll_throw_vect;
         lv_point_t scroll_throw_vect_ori;
@@ -123,6 +126,13 @@ struct _lv_indev_t {
     lv_event_list_t event_list;
     lv_anim_t * scroll_throw_anim;
 
+    /*Queue of the samples added by `lv_indev_push_data()`.
+     *`sample_head` is written only by the reader, `sample_tail` only by the writer*/
+    lv_indev_data_t * sample_buf;
+    uint32_t sample_buf_size;   /**< Always a power of 2*/
+    uint32_t sample_head;
+    uint32_t sample_tail;
+
 #if LV_USE_GESTURE_RECOGNITION
     lv_indev_gesture_recognizer_t recognizers[LV_INDEV_GESTURE_CNT];
     lv_indev_gesture_type_t cur_gesture;
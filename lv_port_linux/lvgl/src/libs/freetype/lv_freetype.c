@@ -12,6 +12,7 @@
 
 #include "../../misc/lv_fs_private.h"
 #include "../../core/lv_global.h"
+#include "../../draw/lv_draw_label.h"
 
 /*********************
  *      DEFINES
@@ -45,6 +46,14 @@ static FTC_FaceID lv_freetype_req_face_id(lv_freetype_context_t * ctx, const cha
 static void lv_freetype_drop_face_id(lv_freetype_context_t * ctx, FTC_FaceID face_id);
 static bool freetype_on_font_create(lv_freetype_font_dsc_t * dsc, uint32_t max_glyph_cnt);
 static void freetype_on_font_set_cbs(lv_freetype_font_dsc_t * dsc);
+static void freetype_prefetch_glyph_cb(const lv_font_t * font, const lv_font_glyph_dsc_t * g_dsc);
+static void freetype_prefetch_render(lv_font_glyph_dsc_t * g_dsc);
+#if LV_USE_OS
+    static void freetype_prefetch_init(lv_freetype_context_t * ctx);
+    static void freetype_prefetch_deinit(lv_freetype_context_t * ctx);
+    static void freetype_prefetch_cancel(lv_freetype_context_t * ctx, const lv_font_t * font);
+    static void freetype_prefetch_thread_cb(void * ptr);
+#endif
 
 static bool cache_node_cache_create_cb(lv_freetype_cache_node_t * node, void * user_data);
 static void cache_node_cache_free_cb(lv_freetype_cache_node_t * node, void * user_data);
@@ -111,6 +120,10 @@ lv_result_t lv_freetype_init(uint32_t max_glyph_cnt)
     ctx->cache_node_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(lv_freetype_cache_node_t), INT32_MAX, ops);
     lv_cache_set_name(ctx->cache_node_cache, "FREETYPE_CACHE_NODE");
 
+#if LV_USE_OS
+    freetype_prefetch_init(ctx);
+#endif
+
     return LV_RESULT_OK;
 }
 
@@ -121,6 +134,10 @@ void lv_freetype_uninit(void)
         return;
     }
 
+#if LV_USE_OS
+    freetype_prefetch_deinit(ctx);
+#endif
+
     lv_freetype_cleanup(ctx);
 
     lv_free(ft_ctx);
@@ -245,6 +262,12 @@ void lv_freetype_font_delete(lv_font_t * font)
     lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)(font->dsc);
     LV_ASSERT_FREETYPE_FONT_DSC(dsc);
 
+    lv_draw_label_run_cache_drop();
+
+#if LV_USE_OS
+    freetype_prefetch_cancel(ctx, font);
+#endif
+
     lv_cache_release(ctx->cache_node_cache, dsc->cache_node_entry, NULL);
     if(lv_cache_entry_get_ref(dsc->cache_node_entry) == 0) {
         lv_cache_drop(ctx->cache_node_cache, dsc->cache_node, NULL);
@@ -326,7 +349,132 @@ static void freetype_on_font_set_cbs(lv_freetype_font_dsc_t * dsc)
     else if(dsc->render_mode == LV_FREETYPE_FONT_RENDER_MODE_OUTLINE) {
         lv_freetype_set_cbs_outline_font(dsc);
     }
+    dsc->font.prefetch_glyph = freetype_prefetch_glyph_cb;
+}
+
+/*-----------------
+ * Glyph prefetch
+ *----------------*/
+
+static void freetype_prefetch_glyph_cb(const lv_font_t * font, const lv_font_glyph_dsc_t * g_dsc)
+{
+    LV_UNUSED(font);
+
+#if LV_USE_OS
+    lv_freetype_context_t * ctx = lv_freetype_get_context();
+
+    lv_mutex_lock(&ctx->prefetch_lock);
+    lv_font_glyph_dsc_t * job = lv_ll_ins_tail(&ctx->prefetch_ll);
+    LV_ASSERT_MALLOC(job);
+    if(job) {
+        *job = *g_dsc;
+        job->entry = NULL;
+    }
+    lv_mutex_unlock(&ctx->prefetch_lock);
+
+    if(job) {
+        lv_thread_sync_signal(&ctx->prefetch_sync);
+        return;
+    }
+#endif
+
+    /*Render the glyph right away if it can't be done in the background*/
+    lv_font_glyph_dsc_t g = *g_dsc;
+    g.entry = NULL;
+    freetype_prefetch_render(&g);
+}
+
+static void freetype_prefetch_render(lv_font_glyph_dsc_t * g_dsc)
+{
+    /*Getting the draw data creates the cache entry which is kept after the release*/
+    const lv_font_t * font = g_dsc->resolved_font;
+    if(font->get_glyph_bitmap(g_dsc, NULL)) {
+        font->release_glyph(font, g_dsc);
+    }
+}
+
+#if LV_USE_OS
+static void freetype_prefetch_init(lv_freetype_context_t * ctx)
+{
+    lv_ll_init(&ctx->prefetch_ll, sizeof(lv_font_glyph_dsc_t));
+    lv_mutex_init(&ctx->prefetch_lock);
+    lv_mutex_init(&ctx->prefetch_render_lock);
+    lv_thread_sync_init(&ctx->prefetch_sync);
+    ctx->prefetch_exit = false;
+    lv_thread_init(&ctx->prefetch_thread, "ftprefetch", LV_THREAD_PRIO_LOW, freetype_prefetch_thread_cb,
+                   LV_DRAW_THREAD_STACK_SIZE, ctx);
+}
+
+static void freetype_prefetch_deinit(lv_freetype_context_t * ctx)
+{
+    lv_mutex_lock(&ctx->prefetch_lock);
+    ctx->prefetch_exit = true;
+    lv_mutex_unlock(&ctx->prefetch_lock);
+
+    lv_thread_sync_signal(&ctx->prefetch_sync);
+    lv_thread_delete(&ctx->prefetch_thread);
+
+    lv_ll_clear(&ctx->prefetch_ll);
+    lv_thread_sync_delete(&ctx->prefetch_sync);
+    lv_mutex_delete(&ctx->prefetch_render_lock);
+    lv_mutex_delete(&ctx->prefetch_lock);
+}
+
+static void freetype_prefetch_cancel(lv_freetype_context_t * ctx, const lv_font_t * font)
+{
+    lv_mutex_lock(&ctx->prefetch_lock);
+
+    lv_font_glyph_dsc_t * job = lv_ll_get_head(&ctx->prefetch_ll);
+    while(job) {
+        lv_font_glyph_dsc_t * job_next = lv_ll_get_next(&ctx->prefetch_ll, job);
+        if(job->resolved_font == font) {
+            lv_ll_remove(&ctx->prefetch_ll, job);
+            lv_free(job);
+        }
+        job = job_next;
+    }
+
+    /*Wait until the glyph being rendered (maybe with this font) is ready*/
+    lv_mutex_lock(&ctx->prefetch_render_lock);
+    lv_mutex_unlock(&ctx->prefetch_render_lock);
+
+    lv_mutex_unlock(&ctx->prefetch_lock);
+}
+
+static void freetype_prefetch_thread_cb(void * ptr)
+{
+    lv_freetype_context_t * ctx = ptr;
+
+    while(1) {
+        lv_mutex_lock(&ctx->prefetch_lock);
+        if(ctx->prefetch_exit) {
+            lv_mutex_unlock(&ctx->prefetch_lock);
+            break;
+        }
+
+        lv_font_glyph_dsc_t * job = lv_ll_get_head(&ctx->prefetch_ll);
+        if(job == NULL) {
+            lv_mutex_unlock(&ctx->prefetch_lock);
+            lv_thread_sync_wait(&ctx->prefetch_sync);
+            continue;
+        }
+
+        lv_font_glyph_dsc_t g_dsc = *job;
+        lv_ll_remove(&ctx->prefetch_ll, job);
+        lv_free(job);
+
+        /*Take the render lock before releasing the queue so that a font can't be deleted
+         *between removing its glyph from the queue and rendering it*/
+        lv_mutex_lock(&ctx->prefetch_render_lock);
+        lv_mutex_unlock(&ctx->prefetch_lock);
+
+        freetype_prefetch_render(&g_dsc);
+        lv_mutex_unlock(&ctx->prefetch_render_lock);
+    }
+
+    LV_LOG_INFO("exit FreeType prefetch thread");
 }
+#endif /*LV_USE_OS*/
 
 static void lv_freetype_cleanup(lv_freetype_context_t * ctx)
 {
@@ -21,6 +21,7 @@ extern "C" {
 #include "../../misc/cache/lv_cache.h"
 #include "../../misc/lv_ll.h"
 #include "../../font/lv_font.h"
+#include "../../osal/lv_os_private.h"
 #include "ft2build.h"
 #include FT_FREETYPE_H
 #include FT_GLYPH_H
@@ -109,6 +110,16 @@ typedef struct _lv_freetype_context_t {
     uint32_t max_glyph_cnt;
 
     lv_cache_t * cache_node_cache;
+
+#if LV_USE_OS
+    /*Glyphs waiting to be rendered by the prefetch thread*/
+    lv_ll_t prefetch_ll;                /**< Queue of `lv_font_glyph_dsc_t`s*/
+    lv_mutex_t prefetch_lock;           /**< Protects `prefetch_ll` and `prefetch_exit`*/
+    lv_mutex_t prefetch_render_lock;    /**< Held by the prefetch thread while rendering a glyph*/
+    lv_thread_sync_t prefetch_sync;
+    lv_thread_t prefetch_thread;
+    bool prefetch_exit;
+#endif
 } lv_freetype_context_t;
 
 typedef struct _lv_freetype_font_dsc_t {
@@ -100,6 +100,7 @@ static bool ttf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * d
                                  uint32_t unicode_letter_next);
 static const void * ttf_get_glyph_bitmap_cb(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf);
 static void ttf_release_glyph_cb(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc);
+static void ttf_prefetch_glyph_cb(const lv_font_t * font, const lv_font_glyph_dsc_t * g_dsc);
 static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size_t data_size,
                                       int32_t font_size, lv_font_kerning_t kerning,
                                       size_t cache_size);
@@ -163,6 +164,7 @@ void lv_tiny_ttf_set_size(lv_font_t * font, int32_t font_size)
     font->base_line = (int32_t)(dsc->scale * (line_gap - dsc->descent));
 
     /* size change means cache needs to be invalidated. */
+    lv_draw_label_run_cache_drop();
 
     if(dsc->glyph_cache) {
         lv_cache_destroy(dsc->glyph_cache, NULL);
@@ -185,6 +187,8 @@ void lv_tiny_ttf_destroy(lv_font_t * font)
 {
     LV_ASSERT_NULL(font);
 
+    lv_draw_label_run_cache_drop();
+
     if(font->dsc != NULL) {
         ttf_font_desc_t * ttf = (ttf_font_desc_t *)font->dsc;
 #if LV_TINY_TTF_FILE_SUPPORT != 0
@@ -403,6 +407,20 @@ static void ttf_release_glyph_cb(const lv_font_t * font, lv_font_glyph_dsc_t * g
     g_dsc->entry = NULL;
 }
 
+static void ttf_prefetch_glyph_cb(const lv_font_t * font, const lv_font_glyph_dsc_t * g_dsc)
+{
+    const ttf_font_desc_t * dsc = (const ttf_font_desc_t *)font->dsc;
+    if(!dsc->cache_size) return; /*Nothing to keep the rendered glyph in*/
+
+    /*stb_truetype can't render the same font in parallel, so render the glyph here
+     *into the draw data cache, from where the draw tasks can pick it up later.*/
+    lv_font_glyph_dsc_t g = *g_dsc;
+    g.entry = NULL;
+    if(ttf_get_glyph_bitmap_cb(&g, NULL)) {
+        ttf_release_glyph_cb(font, &g);
+    }
+}
+
 static void lv_tiny_ttf_cache_create(ttf_font_desc_t * dsc)
 {
     /*Init cache*/
@@ -495,6 +513,7 @@ static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size
     out_font->get_glyph_dsc = ttf_get_glyph_dsc_cb;
     out_font->get_glyph_bitmap = ttf_get_glyph_bitmap_cb;
     out_font->release_glyph = ttf_release_glyph_cb;
+    out_font->prefetch_glyph = ttf_prefetch_glyph_cb;
     out_font->dsc = dsc;
     lv_tiny_ttf_set_size(out_font, font_size);
     return out_font;
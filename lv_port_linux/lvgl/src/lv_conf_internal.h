@@ -366,6 +366,19 @@
     #endif
 #endif
 
+/** Number of texts whose glyphs are cached after positioning and shaping them.
+ *  Unchanged texts are drawn from the cached glyphs without finding the line breaks, bidi processing
+ *  and getting the glyphs again. Only texts shorter than 256 bytes, without recoloring and selection are cached.
+ *  Each cached text takes ~8 bytes per letter and ~60 bytes per different glyph.
+ *  Set it to 0 to disable the cache. */
+#ifndef LV_DRAW_LABEL_RUN_CACHE_CNT
+    #ifdef CONFIG_LV_DRAW_LABEL_RUN_CACHE_CNT
+        #define LV_DRAW_LABEL_RUN_CACHE_CNT CONFIG_LV_DRAW_LABEL_RUN_CACHE_CNT
+    #else
+        #define LV_DRAW_LABEL_RUN_CACHE_CNT 16
+    #endif
+#endif
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -642,6 +655,31 @@
         #endif
     #endif
 
+    /** Set number of ThorVG shapes retained by each SW draw unit.
+     *  Paths whose content and style are unchanged reuse their shape and only its
+     *  transformation is updated. The least recently used shapes are freed first.
+     *  - 0: disables caching */
+    #ifndef LV_DRAW_SW_VECTOR_SHAPE_CACHE_CNT
+        #ifdef CONFIG_LV_DRAW_SW_VECTOR_SHAPE_CACHE_CNT
+            #define LV_DRAW_SW_VECTOR_SHAPE_CACHE_CNT CONFIG_LV_DRAW_SW_VECTOR_SHAPE_CACHE_CNT
+        #else
+            #define LV_DRAW_SW_VECTOR_SHAPE_CACHE_CNT   16
+        #endif
+    #endif
+
+    /** Size (width and height) of the A8 atlas where each SW draw unit caches the
+     *  glyphs of the built-in format fonts.  The glyphs are blended directly from the
+     *  atlas instead of being rendered one by one.
+     *  Costs `LV_DRAW_SW_GLYPH_ATLAS_SIZE^2` RAM per draw unit.
+     *  - 0: disables the atlas */
+    #ifndef LV_DRAW_SW_GLYPH_ATLAS_SIZE
+        #ifdef CONFIG_LV_DRAW_SW_GLYPH_ATLAS_SIZE
+            #define LV_DRAW_SW_GLYPH_ATLAS_SIZE CONFIG_LV_DRAW_SW_GLYPH_ATLAS_SIZE
+        #else
+            #define LV_DRAW_SW_GLYPH_ATLAS_SIZE     256
+        #endif
+    #endif
+
 #endif
 
 /*Use TSi's aka (Think Silicon) NemaGFX */
@@ -1956,6 +1994,39 @@
     #endif
 #endif
 
+/** Number of cached code points and kerning pairs per font to find the glyphs of built-in format fonts faster.
+ *  On the first use of a font a table is also allocated for the code points below U+0250.
+ *  It takes ~1.2 kB + 16 bytes per cache entry for each font with lookup tables. Must be a power of 2.
+ *  0: disable the lookup tables */
+#ifndef LV_FONT_FMT_TXT_LOOKUP_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_LOOKUP_SIZE
+        #define LV_FONT_FMT_TXT_LOOKUP_SIZE CONFIG_LV_FONT_FMT_TXT_LOOKUP_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_LOOKUP_SIZE 128
+    #endif
+#endif
+
+/** Maximum number of fonts with lookup tables.
+ *  When more fonts are used the tables of a font which wasn't used recently are reused.
+ *  Depends on LV_FONT_FMT_TXT_LOOKUP_SIZE. */
+#ifndef LV_FONT_FMT_TXT_LOOKUP_FONT_CNT
+    #ifdef CONFIG_LV_FONT_FMT_TXT_LOOKUP_FONT_CNT
+        #define LV_FONT_FMT_TXT_LOOKUP_FONT_CNT CONFIG_LV_FONT_FMT_TXT_LOOKUP_FONT_CNT
+    #else
+        #define LV_FONT_FMT_TXT_LOOKUP_FONT_CNT 4
+    #endif
+#endif
+
+/** Enable fonts made of signed distance fields which can be drawn at any size.
+ *  The software renderer can also rotate and scale their glyphs. See `scripts/font_sdf_conv`. */
+#ifndef LV_USE_FONT_SDF
+    #ifdef CONFIG_LV_USE_FONT_SDF
+        #define LV_USE_FONT_SDF CONFIG_LV_USE_FONT_SDF
+    #else
+        #define LV_USE_FONT_SDF 0
+    #endif
+#endif
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #ifndef LV_USE_FONT_PLACEHOLDER
     #ifdef LV_KCONFIG_PRESENT
@@ -2359,6 +2430,17 @@
             #define LV_LABEL_LONG_TXT_HINT 1    /**< Store some extra info in labels to speed up drawing of very long text */
         #endif
     #endif
+    #ifndef LV_LABEL_LINE_TABLE
+        #ifdef LV_KCONFIG_PRESENT
+            #ifdef CONFIG_LV_LABEL_LINE_TABLE
+                #define LV_LABEL_LINE_TABLE CONFIG_LV_LABEL_LINE_TABLE
+            #else
+                #define LV_LABEL_LINE_TABLE 0
+            #endif
+        #else
+            #define LV_LABEL_LINE_TABLE 1       /**< Store the line breaks of labels to not find them again on every redraw */
+        #endif
+    #endif
     #ifndef LV_LABEL_WAIT_CHAR_COUNT
         #ifdef CONFIG_LV_LABEL_WAIT_CHAR_COUNT
             #define LV_LABEL_WAIT_CHAR_COUNT CONFIG_LV_LABEL_WAIT_CHAR_COUNT
@@ -2436,6 +2518,18 @@
     #endif
 #endif
 
+#ifndef LV_USE_RECYCLER
+    #ifdef LV_KCONFIG_PRESENT
+        #ifdef CONFIG_LV_USE_RECYCLER
+            #define LV_USE_RECYCLER CONFIG_LV_USE_RECYCLER
+        #else
+            #define LV_USE_RECYCLER 0
+        #endif
+    #else
+        #define LV_USE_RECYCLER   1
+    #endif
+#endif
+
 #ifndef LV_USE_ROLLER
     #ifdef LV_KCONFIG_PRESENT
         #ifdef CONFIG_LV_USE_ROLLER
@@ -3992,7 +4086,7 @@
             #define LV_WAYLAND_RENDER_MODE          LV_DISPLAY_RENDER_MODE_PARTIAL   /**< DMABUF supports LV_DISPLAY_RENDER_MODE_FULL and LV_DISPLAY_RENDER_MODE_DIRECT*/
         #endif
     #endif
-                                                                             /**< When LV_WAYLAND_USE_DMABUF is disabled, only LV_DISPLAY_RENDER_MODE_PARTIAL is supported*/
+                                                                             /**< When LV_WAYLAND_USE_DMABUF is disabled, LV_DISPLAY_RENDER_MODE_PARTIAL and LV_DISPLAY_RENDER_MODE_DIRECT are supported*/
     #ifndef LV_WAYLAND_WINDOW_DECORATIONS
         #ifdef CONFIG_LV_WAYLAND_WINDOW_DECORATIONS
             #define LV_WAYLAND_WINDOW_DECORATIONS CONFIG_LV_WAYLAND_WINDOW_DECORATIONS
@@ -4204,6 +4298,16 @@
         #endif
     #endif
 
+    /** Number of scanout buffers (2 or 3).
+     *  With 3 buffers LVGL can render the next frame while a page flip is pending */
+    #ifndef LV_LINUX_DRM_BUFFER_CNT
+        #ifdef CONFIG_LV_LINUX_DRM_BUFFER_CNT
+            #define LV_LINUX_DRM_BUFFER_CNT CONFIG_LV_LINUX_DRM_BUFFER_CNT
+        #else
+            #define LV_LINUX_DRM_BUFFER_CNT  2
+        #endif
+    #endif
+
     #ifndef LV_LINUX_DRM_USE_EGL
         #ifdef CONFIG_LV_LINUX_DRM_USE_EGL
             #define LV_LINUX_DRM_USE_EGL CONFIG_LV_LINUX_DRM_USE_EGL
@@ -4446,6 +4550,17 @@
             #define LV_USE_OPENGLES_DEBUG        1    /**< Enable or disable debug for opengles */
         #endif
     #endif
+
+    /** Number of pixel buffer objects used to upload the rendered areas to the texture asynchronously.
+     *  Requires OpenGL ES 3.0 or OpenGL 3.2 at runtime, otherwise the areas are uploaded directly.
+     *  0: always upload directly */
+    #ifndef LV_OPENGLES_PBO_CNT
+        #ifdef CONFIG_LV_OPENGLES_PBO_CNT
+            #define LV_OPENGLES_PBO_CNT CONFIG_LV_OPENGLES_PBO_CNT
+        #else
+            #define LV_OPENGLES_PBO_CNT          2
+        #endif
+    #endif
 #endif
 
 /** Use GLFW to open window on PC and handle mouse and keyboard. Requires*/
@@ -201,6 +201,10 @@ void lv_init(void)
     lv_span_stack_init();
 #endif
 
+#if LV_FONT_FMT_TXT_LOOKUP_SIZE > 0
+    lv_font_fmt_txt_lookup_init();
+#endif
+
 #if LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN
 #if LV_USE_PROFILER_BUILTIN_POSIX
     lv_profiler_builtin_posix_init();
@@ -447,6 +451,10 @@ void lv_deinit(void)
     lv_span_stack_deinit();
 #endif
 
+#if LV_FONT_FMT_TXT_LOOKUP_SIZE > 0
+    lv_font_fmt_txt_lookup_deinit();
+#endif
+
 #if LV_USE_FREETYPE
     lv_freetype_uninit();
 #endif
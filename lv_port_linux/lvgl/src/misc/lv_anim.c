@@ -30,25 +30,43 @@
 #define LV_ANIM_SPEED_MASK 0x80000000
 
 #define state LV_GLOBAL_DEFAULT()->anim_state
-#define anim_ll_p &(state.anim_ll)
+
+#define ANIM_BUCKET_CNT_MIN 16
+
+/**The animations can be evaluated at most this much ahead of the tick [ms]*/
+#define ANIM_MAX_AHEAD 1000
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/** A started animation. The hash link is kept out of the public `lv_anim_t`.*/
+typedef struct {
+    lv_anim_t anim;             /**< Must be the first member, animations are passed around as `lv_anim_t *`*/
+    lv_anim_t * hash_next;      /**< Next animation with the same hash of `var` */
+} lv_anim_node_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void anim_timer(lv_timer_t * param);
+static void anim_run(lv_anim_t * a);
+static uint32_t anim_time_get(void);
 static void anim_vsync_event(lv_event_t * e);
 static void anim_mark_list_change(void);
 static void anim_completed_handler(lv_anim_t * a);
+static uint32_t anim_hash(const void * var);
+static bool anim_reserve(void);
+static void anim_register(lv_anim_t * a);
+static void anim_unregister(lv_anim_t * a);
+static lv_anim_t * anim_find(void * var, lv_anim_exec_xcb_t exec_cb);
+static void anim_compact(void);
 static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1,
                                          int32_t y1, int32_t x2, int32_t y2);
 static void lv_anim_pause_for_internal(lv_anim_t * a, uint32_t ms);
 static void resolve_time(lv_anim_t * a);
 static bool remove_concurrent_anims(const lv_anim_t * a_current);
-static void remove_anim(void * a);
+static void remove_anim(lv_anim_t * a);
 
 /**********************
  *  STATIC VARIABLES
@@ -63,22 +81,31 @@ static void remove_anim(void * a);
     #define LV_TRACE_ANIM(...)
 #endif
 
+#define ANIM_NODE(a) ((lv_anim_node_t *)(a))
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
 
 void lv_anim_core_init(void)
 {
-    lv_ll_init(anim_ll_p, sizeof(lv_anim_t));
     state.timer = lv_timer_create(anim_timer, LV_DEF_REFR_PERIOD, NULL);
     anim_mark_list_change(); /*Turn off the animation timer*/
-    state.anim_list_changed = false;
     state.anim_run_round = false;
 }
 
 void lv_anim_core_deinit(void)
 {
     lv_anim_delete_all();
+
+    lv_free(state.anims);
+    state.anims = NULL;
+    state.anim_cnt = 0;
+    state.anim_capacity = 0;
+
+    lv_free(state.buckets);
+    state.buckets = NULL;
+    state.bucket_cnt = 0;
 }
 
 void lv_anim_enable_vsync_mode(bool enable)
@@ -125,14 +152,20 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
         remove_concurrent_anims(a);
     }
 
-    /*Add the new animation to the animation linked list*/
-    lv_anim_t * new_anim = lv_ll_ins_head(anim_ll_p);
-    LV_ASSERT_MALLOC(new_anim);
-    if(new_anim == NULL) return NULL;
+    /*Make room for the new animation in the array and in the hash table*/
+    if(!anim_reserve()) return NULL;
+
+    lv_anim_node_t * node = lv_malloc(sizeof(lv_anim_node_t));
+    LV_ASSERT_MALLOC(node);
+    if(node == NULL) return NULL;
+    lv_anim_t * new_anim = &node->anim;
 
     /*Initialize the animation descriptor*/
     lv_memcpy(new_anim, a, sizeof(lv_anim_t));
     if(a->var == a) new_anim->var = new_anim;
+    new_anim->is_deleted = 0;
+    anim_register(new_anim);
+
     new_anim->run_round = state.anim_run_round;
     new_anim->last_timer_run = lv_tick_get();
     new_anim->is_paused = false;
@@ -157,8 +190,7 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
         }
     }
 
-    /*Creating an animation changed the linked list.
-     *It's important if it happens in a ready callback. (see `anim_timer`)*/
+    /*Resume the animation timer if it was paused*/
     anim_mark_list_change();
 
     LV_TRACE_ANIM("finished");
@@ -183,41 +215,51 @@ bool lv_anim_delete(void * var, lv_anim_exec_xcb_t exec_cb)
 {
     lv_anim_t * a;
     bool del_any = false;
-    a        = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        bool del = false;
-        if((a->var == var || var == NULL) && (a->exec_cb == exec_cb || exec_cb == NULL)) {
+
+    if(var != NULL) {
+        /*Look up again after every delete, because `a->deleted_cb` can change the animations*/
+        while((a = anim_find(var, exec_cb)) != NULL) {
             remove_anim(a);
-            anim_mark_list_change(); /*Read by `anim_timer`. It need to know if a delete occurred in
-                                       the linked list*/
             del_any = true;
-            del = true;
         }
 
-        /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
+        return del_any;
+    }
+
+    /*The deleted animations stay in the array until it's iterated*/
+    state.iterate_level++;
+    uint32_t i;
+    for(i = 0; i < state.anim_cnt; i++) {
+        a = state.anims[i];
+        if(a->is_deleted) continue;
+        if(a->exec_cb == exec_cb || exec_cb == NULL) {
+            remove_anim(a);
+            del_any = true;
+        }
     }
+    state.iterate_level--;
+
+    anim_mark_list_change();
 
     return del_any;
 }
 
 void lv_anim_delete_all(void)
 {
-    lv_ll_clear_custom(anim_ll_p, remove_anim);
+    state.iterate_level++;
+    uint32_t i;
+    for(i = 0; i < state.anim_cnt; i++) {
+        lv_anim_t * a = state.anims[i];
+        if(!a->is_deleted) remove_anim(a);
+    }
+    state.iterate_level--;
+
     anim_mark_list_change();
 }
 
 lv_anim_t * lv_anim_get(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) {
-        if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
-            return a;
-        }
-    }
-
-    return NULL;
+    return anim_find(var, exec_cb);
 }
 
 lv_timer_t * lv_anim_get_timer(void)
@@ -227,11 +269,7 @@ lv_timer_t * lv_anim_get_timer(void)
 
 uint16_t lv_anim_count_running(void)
 {
-    uint16_t cnt = 0;
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) cnt++;
-
-    return cnt;
+    return (uint16_t)(state.anim_cnt - state.anim_deleted_cnt);
 }
 
 uint32_t lv_anim_speed_clamped(uint32_t speed, uint32_t min_time, uint32_t max_time)
@@ -279,6 +317,13 @@ void lv_anim_refr_now(void)
     anim_timer(NULL);
 }
 
+void lv_anim_refr_at(uint32_t time)
+{
+    /*Never step back in time*/
+    if(lv_tick_diff(time, anim_time_get()) <= ANIM_MAX_AHEAD) state.time = time;
+    anim_timer(NULL);
+}
+
 int32_t lv_anim_path_linear(const lv_anim_t * a)
 {
     /*Calculate the current step*/
@@ -569,89 +614,98 @@ static void anim_timer(lv_timer_t * param)
 
     /*Flip the run round*/
     state.anim_run_round = state.anim_run_round ? false : true;
+    state.time = anim_time_get();
+
+    /*The animations started meanwhile are appended to the end of the array but they
+     *won't run in this round anyway. The deleted animations are only marked, so
+     *the array can be iterated safely.*/
+    state.iterate_level++;
+    uint32_t i = state.anim_cnt;
+    while(i > 0) {
+        i--;
+        lv_anim_t * a = state.anims[i];
+        if(!a->is_deleted) anim_run(a);
+    }
+    state.iterate_level--;
 
-    lv_anim_t * a = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        uint32_t elaps = lv_tick_elaps(a->last_timer_run);
+    if(state.iterate_level == 0 && state.anim_deleted_cnt > 0) anim_compact();
+}
 
-        if(a->is_paused) {
-            const uint32_t time_paused = lv_tick_elaps(a->pause_time);
-            const bool is_pause_over = a->pause_duration != LV_ANIM_PAUSE_FOREVER && time_paused >= a->pause_duration;
+/**
+ * Advance an animation and apply its new value
+ * @param a pointer to an animation descriptor
+ */
+static void anim_run(lv_anim_t * a)
+{
+    uint32_t elaps = lv_tick_diff(state.time, a->last_timer_run);
 
-            if(is_pause_over) {
-                const uint32_t pause_overrun = time_paused - a->pause_duration;
-                a->is_paused = false;
-                a->act_time += pause_overrun;
-                a->run_round = !state.anim_run_round;
-            }
+    if(a->is_paused) {
+        const uint32_t time_paused = lv_tick_elaps(a->pause_time);
+        const bool is_pause_over = a->pause_duration != LV_ANIM_PAUSE_FOREVER && time_paused >= a->pause_duration;
+
+        if(is_pause_over) {
+            const uint32_t pause_overrun = time_paused - a->pause_duration;
+            a->is_paused = false;
+            a->act_time += pause_overrun;
+            a->run_round = !state.anim_run_round;
         }
-        else {
-            a->act_time += elaps;
+    }
+    else {
+        a->act_time += elaps;
+    }
+    a->last_timer_run = state.time;
+
+    if(a->is_paused || a->run_round == state.anim_run_round) return;
+
+    a->run_round = state.anim_run_round; /*Mark that it has run in this round*/
+    /*The animation will run now for the first time. Call `start_cb`*/
+    if(!a->start_cb_called && a->act_time >= 0) {
+
+        if(a->early_apply == 0 && a->get_value_cb) {
+            int32_t v_ofs = a->get_value_cb(a);
+            a->start_value += v_ofs;
+            a->end_value += v_ofs;
         }
-        a->last_timer_run = lv_tick_get();
 
-        /*It can be set by `lv_anim_delete()` typically in `end_cb`. If set then an animation delete
-         * happened in `anim_completed_handler` which could make this linked list reading corrupt
-         * because the list is changed meanwhile
-         */
-        state.anim_list_changed = false;
+        resolve_time(a);
 
-        if(!a->is_paused && a->run_round != state.anim_run_round) {
-            a->run_round = state.anim_run_round; /*The list readying might be reset so need to know which anim has run already*/
-            /*The animation will run now for the first time. Call `start_cb`*/
-            if(!a->start_cb_called && a->act_time >= 0) {
+        if(a->start_cb) a->start_cb(a);
+        a->start_cb_called = 1;
 
-                if(a->early_apply == 0 && a->get_value_cb) {
-                    int32_t v_ofs = a->get_value_cb(a);
-                    a->start_value += v_ofs;
-                    a->end_value += v_ofs;
-                }
+        /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
+        remove_concurrent_anims(a);
 
-                resolve_time(a);
+        /*It can be deleted in `start_cb` too*/
+        if(a->is_deleted) return;
+    }
 
-                if(a->start_cb) a->start_cb(a);
-                a->start_cb_called = 1;
+    if(a->act_time < 0) return;
 
-                /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
-                remove_concurrent_anims(a);
-            }
+    int32_t act_time_original = a->act_time; /*The unclipped version is used later to correctly repeat the animation*/
+    if(a->act_time > a->duration) a->act_time = a->duration;
 
-            if(a->act_time >= 0) {
-                int32_t act_time_original = a->act_time; /*The unclipped version is used later to correctly repeat the animation*/
-                if(a->act_time > a->duration) a->act_time = a->duration;
-
-                int32_t act_time_before_exec = a->act_time;
-                int32_t new_value;
-                new_value = a->path_cb(a);
-
-                if(new_value != a->current_value) {
-                    a->current_value = new_value;
-                    /*Apply the calculated value*/
-                    if(a->exec_cb) a->exec_cb(a->var, new_value);
-                    if(!state.anim_list_changed && a->custom_exec_cb) a->custom_exec_cb(a, new_value);
-                }
-
-                if(!state.anim_list_changed) {
-                    /*Restore the original time to see is there is over time.
-                     *Restore only if it wasn't changed in the `exec_cb` for some special reasons.*/
-                    if(a->act_time == act_time_before_exec) a->act_time = act_time_original;
-
-                    /*If the time is elapsed the animation is ready*/
-                    if(a->act_time >= a->duration) {
-                        anim_completed_handler(a);
-                    }
-                }
-            }
-        }
+    int32_t act_time_before_exec = a->act_time;
+    int32_t new_value;
+    new_value = a->path_cb(a);
 
-        /*If the linked list changed due to anim. delete then it's not safe to continue
-         *the reading of the list from here -> start from the head*/
-        if(state.anim_list_changed)
-            a = lv_ll_get_head(anim_ll_p);
-        else
-            a = lv_ll_get_next(anim_ll_p, a);
+    if(new_value != a->current_value) {
+        a->current_value = new_value;
+        /*Apply the calculated value*/
+        if(a->exec_cb) a->exec_cb(a->var, new_value);
+        if(!a->is_deleted && a->custom_exec_cb) a->custom_exec_cb(a, new_value);
     }
 
+    /*The animation can be deleted by `lv_anim_delete()` in the `exec_cb`*/
+    if(a->is_deleted) return;
+
+    /*Restore the original time to see is there is over time.
+     *Restore only if it wasn't changed in the `exec_cb` for some special reasons.*/
+    if(a->act_time == act_time_before_exec) a->act_time = act_time_original;
+
+    /*If the time is elapsed the animation is ready*/
+    if(a->act_time >= a->duration) {
+        anim_completed_handler(a);
+    }
 }
 
 /**
@@ -671,16 +725,16 @@ static void anim_completed_handler(lv_anim_t * a)
      * - no repeat, reverse play enabled (reverse_duration != 0) and reverse play is completed. */
     if(a->repeat_cnt == 0 && (a->reverse_duration == 0 || a->reverse_play_in_progress == 1)) {
 
-        /*Delete the animation from the list.
-         * This way the `completed_cb` will see the animations like it's animation is already deleted*/
-        lv_ll_remove(anim_ll_p, a);
-        /*Flag that the list has changed*/
-        anim_mark_list_change();
+        /*Delete the animation from the index.
+         * This way the `completed_cb` will see the animations like it's animation is already deleted.
+         * It will be freed when the animations are not iterated anymore.*/
+        anim_unregister(a);
 
         /*Call the callback function at the end*/
         if(a->completed_cb != NULL) a->completed_cb(a);
         if(a->deleted_cb != NULL) a->deleted_cb(a);
-        lv_free(a);
+
+        anim_mark_list_change();
     }
     /*If the animation is not deleted then restart it*/
     else {
@@ -714,10 +768,31 @@ static void anim_vsync_event(lv_event_t * e)
     anim_timer(NULL);
 }
 
+/**
+ * Get the time to evaluate the animations at
+ * @return the current tick, or the later time of the previous evaluation if it was ahead of the tick
+ */
+static uint32_t anim_time_get(void)
+{
+    uint32_t now = lv_tick_get();
+    return lv_tick_diff(state.time, now) <= ANIM_MAX_AHEAD ? state.time : now;
+}
+
+/**
+ * Free the deleted animations if it's safe and worth it,
+ * and pause or resume the animation timer depending on the number of animations
+ */
 static void anim_mark_list_change(void)
 {
-    state.anim_list_changed = true;
-    if(lv_ll_get_head(anim_ll_p) == NULL) {
+    uint32_t running_cnt = state.anim_cnt - state.anim_deleted_cnt;
+
+    /*Keep some deleted animations as they will be removed by `anim_timer` anyway*/
+    if(state.iterate_level == 0 && state.anim_deleted_cnt > 0 &&
+       (running_cnt == 0 || state.anim_deleted_cnt >= running_cnt)) {
+        anim_compact();
+    }
+
+    if(running_cnt == 0) {
         if(state.timer) {
             lv_timer_pause(state.timer);
             return;
@@ -781,42 +856,167 @@ static void resolve_time(lv_anim_t * a)
 static bool remove_concurrent_anims(const lv_anim_t * a_current)
 {
     if(a_current->exec_cb == NULL && a_current->custom_exec_cb == NULL) return false;
+    if(state.bucket_cnt == 0) return false;
 
-    lv_anim_t * a;
     bool del_any = false;
-    a = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        bool del = false;
-        /*We can't test for custom_exec_cb equality because in the MicroPython binding
-         *a wrapper callback is used here an the real callback data is stored in the `user_data`.
-         *Therefore equality check would remove all animations.*/
-        if(a != a_current &&
-           (a->act_time >= 0 || a->early_apply) &&
-           (a->var == a_current->var) &&
-           ((a->exec_cb && a->exec_cb == a_current->exec_cb)
-            /*|| (a->custom_exec_cb && a->custom_exec_cb == a_current->custom_exec_cb)*/)) {
-            lv_ll_remove(anim_ll_p, a);
-            if(a->deleted_cb != NULL) a->deleted_cb(a);
-            lv_free(a);
-            /*Read by `anim_timer`. It need to know if a delete occurred in the linked list*/
-            anim_mark_list_change();
-
-            del_any = true;
-            del = true;
+    bool del;
+    do {
+        del = false;
+        lv_anim_t * a = state.buckets[anim_hash(a_current->var) & (state.bucket_cnt - 1)];
+        while(a != NULL) {
+            /*We can't test for custom_exec_cb equality because in the MicroPython binding
+             *a wrapper callback is used here an the real callback data is stored in the `user_data`.
+             *Therefore equality check would remove all animations.*/
+            if(a != a_current &&
+               (a->act_time >= 0 || a->early_apply) &&
+               (a->var == a_current->var) &&
+               ((a->exec_cb && a->exec_cb == a_current->exec_cb)
+                /*|| (a->custom_exec_cb && a->custom_exec_cb == a_current->custom_exec_cb)*/)) {
+                remove_anim(a);
+                del_any = true;
+                del = true;
+                /*Look up again from the start of the bucket because
+                 *`a->deleted_cb` might have changed the animations*/
+                break;
+            }
+            a = ANIM_NODE(a)->hash_next;
         }
+    } while(del);
+
+    return del_any;
+}
+
+/**
+ * Delete an animation and call its `deleted_cb`.
+ * It's only marked as deleted and freed later when the animations are not iterated.
+ * @param a     pointer to an animation
+ */
+static void remove_anim(lv_anim_t * a)
+{
+    anim_unregister(a);
+    if(a->deleted_cb != NULL) a->deleted_cb(a);
+    anim_mark_list_change();
+}
 
-        /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
+static uint32_t anim_hash(const void * var)
+{
+    uint32_t h = (uint32_t)((lv_uintptr_t)var >> 3);
+    h ^= h >> 16;
+    h *= 0x45d9f3b;
+    h ^= h >> 16;
+    return h;
+}
+
+/**
+ * Make sure that there is space for one more animation
+ * in the array and that the hash table is large enough
+ * @return      true: success; false: out of memory
+ */
+static bool anim_reserve(void)
+{
+    if(state.anim_cnt >= state.anim_capacity) {
+        uint32_t new_capacity = state.anim_capacity ? state.anim_capacity * 2 : ANIM_BUCKET_CNT_MIN;
+        lv_anim_t ** new_anims = lv_realloc(state.anims, new_capacity * sizeof(lv_anim_t *));
+        LV_ASSERT_MALLOC(new_anims);
+        if(new_anims == NULL) return false;
+        state.anims = new_anims;
+        state.anim_capacity = new_capacity;
     }
 
-    return del_any;
+    uint32_t running_cnt = state.anim_cnt - state.anim_deleted_cnt;
+    if(running_cnt + 1 <= state.bucket_cnt) return true;
+
+    uint32_t new_bucket_cnt = state.bucket_cnt ? state.bucket_cnt * 2 : ANIM_BUCKET_CNT_MIN;
+    lv_anim_t ** new_buckets = lv_malloc_zeroed(new_bucket_cnt * sizeof(lv_anim_t *));
+    LV_ASSERT_MALLOC(new_buckets);
+    if(new_buckets == NULL) return state.bucket_cnt > 0; /*Still works, only slower*/
+
+    lv_free(state.buckets);
+    state.buckets = new_buckets;
+    state.bucket_cnt = new_bucket_cnt;
+
+    /*Insert from the oldest, so the newest animation will be the first in each bucket*/
+    uint32_t i;
+    for(i = 0; i < state.anim_cnt; i++) {
+        lv_anim_t * a = state.anims[i];
+        if(a->is_deleted) continue;
+        uint32_t idx = anim_hash(a->var) & (state.bucket_cnt - 1);
+        ANIM_NODE(a)->hash_next = state.buckets[idx];
+        state.buckets[idx] = a;
+    }
+
+    return true;
 }
 
-static void remove_anim(void * a)
+/**
+ * Add an animation to the end of the array and to the hash table.
+ * `anim_reserve()` needs to be called first.
+ * @param a     pointer to an animation
+ */
+static void anim_register(lv_anim_t * a)
+{
+    state.anims[state.anim_cnt] = a;
+    state.anim_cnt++;
+
+    uint32_t idx = anim_hash(a->var) & (state.bucket_cnt - 1);
+    ANIM_NODE(a)->hash_next = state.buckets[idx];
+    state.buckets[idx] = a;
+}
+
+/**
+ * Remove an animation from the hash table and mark it as deleted
+ * @param a     pointer to an animation
+ */
+static void anim_unregister(lv_anim_t * a)
+{
+    lv_anim_t ** next_p = &state.buckets[anim_hash(a->var) & (state.bucket_cnt - 1)];
+    while(*next_p) {
+        if(*next_p == a) {
+            *next_p = ANIM_NODE(a)->hash_next;
+            break;
+        }
+        next_p = &ANIM_NODE(*next_p)->hash_next;
+    }
+
+    ANIM_NODE(a)->hash_next = NULL;
+    a->is_deleted = 1;
+    state.anim_deleted_cnt++;
+}
+
+/**
+ * Find the newest animation of a variable
+ * @param var       the variable of the animation
+ * @param exec_cb   the exec_cb of the animation or NULL to match any exec_cb
+ * @return          pointer to the animation or NULL if not found
+ */
+static lv_anim_t * anim_find(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * anim = a;
-    lv_ll_remove(anim_ll_p, a);
-    if(anim->deleted_cb != NULL) anim->deleted_cb(anim);
-    lv_free(a);
+    if(state.bucket_cnt == 0) return NULL;
+
+    lv_anim_t * a = state.buckets[anim_hash(var) & (state.bucket_cnt - 1)];
+    while(a != NULL) {
+        if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
+            return a;
+        }
+        a = ANIM_NODE(a)->hash_next;
+    }
+
+    return NULL;
+}
+
+/**
+ * Free the deleted animations and remove them from the array keeping the order of the others
+ */
+static void anim_compact(void)
+{
+    uint32_t i;
+    uint32_t j = 0;
+    for(i = 0; i < state.anim_cnt; i++) {
+        lv_anim_t * a = state.anims[i];
+        if(a->is_deleted) lv_free(ANIM_NODE(a));
+        else state.anims[j++] = a;
+    }
+
+    state.anim_cnt = j;
+    state.anim_deleted_cnt = 0;
 }
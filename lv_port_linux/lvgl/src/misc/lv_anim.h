@@ -155,6 +155,7 @@ struct _lv_anim_t {
                                                * time animation timer executes), indicates this animation needs to be updated. */
     uint8_t start_cb_called : 1;              /**< Indicates that `start_cb` was already called */
     uint8_t early_apply  : 1;                 /**< 1: Apply start value immediately even is there is a `delay` */
+    uint8_t is_deleted : 1;                   /**< Deleted but not freed yet as the animations might be iterated */
 };
 
 /**********************
@@ -25,11 +25,22 @@ extern "C" {
  **********************/
 
 typedef struct {
-    bool anim_list_changed;
     bool anim_run_round;
     bool anim_vsync_registered;
     lv_timer_t * timer;
-    lv_ll_t anim_ll;
+    uint32_t time;              /**< The time of the last evaluation, can be ahead of the tick*/
+
+    /** The started animations in the order of starting them. Deleted animations
+     * stay here until the array is not iterated and they are removed at once. */
+    lv_anim_t ** anims;
+    uint32_t anim_cnt;          /**< Number of elements in `anims` including the deleted ones */
+    uint32_t anim_capacity;
+    uint32_t anim_deleted_cnt;
+    uint32_t iterate_level;     /**< Not zero while `anims` is iterated, deleted anims can't be removed */
+
+    /** Hash table of the not deleted animations by their `var` */
+    lv_anim_t ** buckets;
+    uint32_t bucket_cnt;        /**< Power of 2 */
 } lv_anim_state_t;
 
 /**********************
@@ -52,6 +63,13 @@ void lv_anim_core_deinit(void);
  */
 void lv_anim_enable_vsync_mode(bool enable);
 
+/**
+ * Evaluate the animations at a given time, e.g. when the frame being rendered will be presented.
+ * The time can be ahead of the current tick. The animations never step back in time.
+ * @param time      the time in `lv_tick_get()` time
+ */
+void lv_anim_refr_at(uint32_t time);
+
 /**********************
  *      MACROS
  **********************/
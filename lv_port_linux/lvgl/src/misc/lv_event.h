@@ -99,7 +99,8 @@ typedef enum {
                                    * returns a pointer to an `lv_area_t` object with the coordinates of the
                                    * area to be invalidated.  The area can be freely modified if needed to
                                    * adapt it a special requirement of the display. Usually needed with
-                                   * monochrome displays to invalidate `N x 8` rows or columns in one pass. */
+                                   * monochrome displays to invalidate `N x 8` rows or columns in one pass.
+                                   * If the area is made empty it won't be redrawn. */
     LV_EVENT_RESOLUTION_CHANGED,  /**< Sent when the resolution changes due to `lv_display_set_resolution()` or `lv_display_set_rotation()`. */
     LV_EVENT_COLOR_FORMAT_CHANGED,/**< Sent as a result of any call to `lv_display_set_color_format()`. */
     LV_EVENT_REFR_REQUEST,        /**< Sent when something happened that requires redraw. */
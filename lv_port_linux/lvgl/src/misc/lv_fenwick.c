@@ -0,0 +1,182 @@
+/**
+ * @file lv_fenwick.c
+ * Fenwick tree. The nodes are dynamically allocated by the 'lv_mem' module.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_fenwick.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+
+#include "lv_assert.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*The lowest set bit of i*/
+#define LOWBIT(i) ((i) & (~(i) + 1))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_fenwick_init(lv_fenwick_t * fenwick, bool track_measured)
+{
+    lv_memzero(fenwick, sizeof(lv_fenwick_t));
+    fenwick->track_measured = track_measured;
+}
+
+void lv_fenwick_deinit(lv_fenwick_t * fenwick)
+{
+    lv_free(fenwick->tree);
+    lv_free(fenwick->measured);
+    fenwick->tree = NULL;
+    fenwick->measured = NULL;
+    fenwick->cnt = 0;
+}
+
+bool lv_fenwick_set_count(lv_fenwick_t * fenwick, uint32_t cnt)
+{
+    if(fenwick->cnt == cnt) return true;
+    if(cnt == 0) {
+        lv_fenwick_deinit(fenwick);
+        return true;
+    }
+
+    uint32_t old_cnt = fenwick->cnt;
+    int32_t * tree = lv_realloc(fenwick->tree, cnt * sizeof(fenwick->tree[0]));
+    LV_ASSERT_MALLOC(tree);
+    if(tree == NULL) {
+        lv_fenwick_deinit(fenwick);
+        return false;
+    }
+    fenwick->tree = tree;
+
+    if(fenwick->track_measured) {
+        uint8_t * measured = lv_realloc(fenwick->measured, (cnt + 7) / 8);
+        LV_ASSERT_MALLOC(measured);
+        if(measured == NULL) {
+            lv_fenwick_deinit(fenwick);
+            return false;
+        }
+        fenwick->measured = measured;
+
+        if(old_cnt < cnt) {
+            uint32_t byte_start = (old_cnt + 7) / 8;
+            if(old_cnt % 8) measured[old_cnt / 8] &= (1 << (old_cnt % 8)) - 1;
+            lv_memzero(&measured[byte_start], (cnt + 7) / 8 - byte_start);
+        }
+    }
+
+    /*The nodes of the new values also sum up some of the old values*/
+    uint32_t i;
+    int32_t old_sum = old_cnt < cnt ? lv_fenwick_get_sum(fenwick, old_cnt) : 0;
+    for(i = old_cnt; i < cnt; i++) {
+        uint32_t range_start = (i + 1) - LOWBIT(i + 1);
+        tree[i] = range_start < old_cnt ? old_sum - lv_fenwick_get_sum(fenwick, range_start) : 0;
+    }
+
+    fenwick->cnt = cnt;
+    return true;
+}
+
+void lv_fenwick_clear(lv_fenwick_t * fenwick)
+{
+    if(fenwick->tree) lv_memzero(fenwick->tree, fenwick->cnt * sizeof(fenwick->tree[0]));
+    if(fenwick->measured) lv_memzero(fenwick->measured, (fenwick->cnt + 7) / 8);
+}
+
+void lv_fenwick_add(lv_fenwick_t * fenwick, uint32_t index, int32_t diff)
+{
+    LV_ASSERT(index < fenwick->cnt);
+
+    uint32_t i;
+    for(i = index + 1; i <= fenwick->cnt; i += LOWBIT(i)) {
+        fenwick->tree[i - 1] += diff;
+    }
+}
+
+int32_t lv_fenwick_get(const lv_fenwick_t * fenwick, uint32_t index)
+{
+    LV_ASSERT(index < fenwick->cnt);
+
+    /*Go down in the tree from the node of the value until the nodes of the previous values are reached*/
+    int32_t v = fenwick->tree[index];
+    uint32_t i = index;
+    uint32_t stop = (index + 1) - LOWBIT(index + 1);
+    while(i > stop) {
+        v -= fenwick->tree[i - 1];
+        i -= LOWBIT(i);
+    }
+    return v;
+}
+
+int32_t lv_fenwick_get_sum(const lv_fenwick_t * fenwick, uint32_t index)
+{
+    int32_t sum = 0;
+    uint32_t i;
+    for(i = index; i > 0; i -= LOWBIT(i)) {
+        sum += fenwick->tree[i - 1];
+    }
+    return sum;
+}
+
+uint32_t lv_fenwick_find(const lv_fenwick_t * fenwick, int32_t base, int32_t y, int32_t * sum)
+{
+    uint32_t index = 0;
+    int32_t s = 0;
+
+    /*Binary search in the tree: skip as many items as possible which end before `y`*/
+    uint32_t step = 1;
+    while(step * 2 <= fenwick->cnt) step *= 2;
+    for(; step > 0; step /= 2) {
+        if(index + step > fenwick->cnt) continue;
+
+        int32_t next_s = s + fenwick->tree[index + step - 1] + (int32_t)step * base;
+        if(next_s <= y) {
+            index += step;
+            s = next_s;
+        }
+    }
+
+    *sum = s;
+    return index;
+}
+
+void lv_fenwick_set_measured(lv_fenwick_t * fenwick, uint32_t index, bool measured)
+{
+    LV_ASSERT(fenwick->track_measured && index < fenwick->cnt);
+
+    if(measured) fenwick->measured[index / 8] |= 1 << (index % 8);
+    else fenwick->measured[index / 8] &= ~(1 << (index % 8));
+}
+
+bool lv_fenwick_is_measured(const lv_fenwick_t * fenwick, uint32_t index)
+{
+    LV_ASSERT(fenwick->track_measured && index < fenwick->cnt);
+
+    return (fenwick->measured[index / 8] & (1 << (index % 8))) != 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
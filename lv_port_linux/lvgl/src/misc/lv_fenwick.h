@@ -0,0 +1,125 @@
+/**
+ * @file lv_fenwick.h
+ * Fenwick tree to get the sum of many values which change one by one,
+ * e.g. the position of an item in a long list where only some item heights are known.
+ */
+
+#ifndef LV_FENWICK_H
+#define LV_FENWICK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Description of a Fenwick tree*/
+struct _lv_fenwick_t {
+    int32_t * tree;         /**< The nodes: the sum of a range of values ending at the node's value*/
+    uint8_t * measured;     /**< A bit for each value which is set if the value is measured. NULL if not tracked*/
+    uint32_t cnt;           /**< Number of values*/
+    bool track_measured;    /**< true: allocate `measured` too*/
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Init an empty Fenwick tree.
+ * @param fenwick           pointer to an `lv_fenwick_t` variable to initialize
+ * @param track_measured    true: store a "measured" bit for each value too
+ */
+void lv_fenwick_init(lv_fenwick_t * fenwick, bool track_measured);
+
+/**
+ * Free the memory of a Fenwick tree. It's empty after that.
+ * @param fenwick   pointer to a Fenwick tree
+ */
+void lv_fenwick_deinit(lv_fenwick_t * fenwick);
+
+/**
+ * Change the number of values. The kept values don't change, the new ones are 0 and not measured.
+ * @param fenwick   pointer to a Fenwick tree
+ * @param cnt       the new number of values
+ * @return          false: out of memory, the tree is emptied
+ */
+bool lv_fenwick_set_count(lv_fenwick_t * fenwick, uint32_t cnt);
+
+/**
+ * Set all values to 0 and not measured.
+ * @param fenwick   pointer to a Fenwick tree
+ */
+void lv_fenwick_clear(lv_fenwick_t * fenwick);
+
+/**
+ * Add to a value.
+ * @param fenwick   pointer to a Fenwick tree
+ * @param index     index of the value
+ * @param diff      add this to the value
+ */
+void lv_fenwick_add(lv_fenwick_t * fenwick, uint32_t index, int32_t diff);
+
+/**
+ * Get a value.
+ * @param fenwick   pointer to a Fenwick tree
+ * @param index     index of the value
+ * @return          the value
+ */
+int32_t lv_fenwick_get(const lv_fenwick_t * fenwick, uint32_t index);
+
+/**
+ * Get the sum of the values before an index.
+ * @param fenwick   pointer to a Fenwick tree
+ * @param index     sum the values in [0, `index`)
+ * @return          the sum
+ */
+int32_t lv_fenwick_get_sum(const lv_fenwick_t * fenwick, uint32_t index);
+
+/**
+ * Find the last index where `index * base + sum of the values before it` is not larger than `y`,
+ * i.e. the item at `y` if the values are the items' size difference from `base`.
+ * @param fenwick   pointer to a Fenwick tree
+ * @param base      added to each value
+ * @param y         the position to find
+ * @param sum       store `index * base + sum of the values before it` here
+ * @return          the found index or `cnt` if `y` is after all the items
+ */
+uint32_t lv_fenwick_find(const lv_fenwick_t * fenwick, int32_t base, int32_t y, int32_t * sum);
+
+/**
+ * Mark a value as measured or not measured. The tree needs to be initialized with `track_measured`.
+ * @param fenwick   pointer to a Fenwick tree
+ * @param index     index of the value
+ * @param measured  true: measured
+ */
+void lv_fenwick_set_measured(lv_fenwick_t * fenwick, uint32_t index, bool measured);
+
+/**
+ * Check if a value is measured. The tree needs to be initialized with `track_measured`.
+ * @param fenwick   pointer to a Fenwick tree
+ * @param index     index of the value
+ * @return          true: measured
+ */
+bool lv_fenwick_is_measured(const lv_fenwick_t * fenwick, uint32_t index);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_FENWICK_H*/
@@ -32,8 +32,16 @@
  *  STATIC PROTOTYPES
  **********************/
 static bool lv_timer_exec(lv_timer_t * timer);
-static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
+static int64_t tick_get64(void);
+static void timer_schedule(lv_timer_t * timer);
+static void timer_unschedule(lv_timer_t * timer);
+static bool heap_reserve(lv_timer_t *** array, uint32_t * capacity, uint32_t size);
+static bool heap_less(const lv_timer_t * a, const lv_timer_t * b);
+static void heap_set(uint32_t idx, lv_timer_t * timer);
+static void heap_sift_up(uint32_t idx);
+static void heap_sift_down(uint32_t idx);
+static void heap_remove(lv_timer_t * timer);
 
 /**********************
  *  STATIC VARIABLES
@@ -90,42 +98,40 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    lv_timer_t * timer_active;
-    lv_ll_t * timer_head = timer_ll_p;
-    do {
-        state_p->timer_deleted             = false;
-        state_p->timer_created             = false;
-
-        timer_active = lv_ll_get_head(timer_head);
-        while(timer_active) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = lv_ll_get_next(timer_head, timer_active);
-
-            if(lv_timer_exec(timer_active)) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(state_p->timer_created || state_p->timer_deleted) {
-                    LV_TRACE_TIMER("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
+    /*Run the due timers in the order of their due time. Every timer runs at most once per call,
+     *the timers which became due again while running are re-scheduled after the loop*/
+    state_p->run_id++;
+    int64_t now = tick_get64();
+    while(state_p->heap_size > 0) {
+        lv_timer_t * timer_active = state_p->heap[0];
+        if(timer_active->due > now) break;
+
+        if(timer_active->run_id == state_p->run_id) {
+            /*Reserve first so that the timer stays in the heap if it fails*/
+            if(heap_reserve(&state_p->deferred, &state_p->deferred_capacity, state_p->deferred_size + 1) == false) {
+                break;
             }
-
-            timer_active = next; /*Load the next timer*/
+            heap_remove(timer_active);
+            timer_active->deferred = 1;
+            state_p->deferred[state_p->deferred_size++] = timer_active;
+            continue;
         }
-    } while(timer_active);
 
-    uint32_t time_until_next = LV_NO_TIMER_READY;
-    next = lv_ll_get_head(timer_head);
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_until_next)
-                time_until_next = delay;
-        }
+        lv_timer_exec(timer_active);
+    }
 
-        next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
+    while(state_p->deferred_size > 0) {
+        lv_timer_t * timer_deferred = state_p->deferred[--state_p->deferred_size];
+        timer_deferred->deferred = 0;
+        timer_schedule(timer_deferred);
+    }
+
+    uint32_t time_until_next = LV_NO_TIMER_READY;
+    if(state_p->heap_size > 0) {
+        int64_t delay = state_p->heap[0]->due - tick_get64();
+        if(delay <= 0) time_until_next = 0;
+        else if(delay < LV_NO_TIMER_READY) time_until_next = (uint32_t)delay;
+        else time_until_next = LV_NO_TIMER_READY - 1;
     }
 
     state_p->busy_time += lv_tick_elaps(handler_start);
@@ -166,10 +172,15 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
 {
     lv_timer_t * new_timer = NULL;
 
+    /*Reserve the heap slot of the timer for its whole lifetime so that scheduling can't fail*/
+    if(heap_reserve(&state.heap, &state.heap_capacity, state.timer_cnt + 1) == false) return NULL;
+
     new_timer = lv_ll_ins_head(timer_ll_p);
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
 
+    state.timer_cnt++;
+
     new_timer->period = period;
     new_timer->timer_cb = timer_xcb;
     new_timer->repeat_count = -1;
@@ -177,8 +188,11 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
-
-    state.timer_created = true;
+    new_timer->deferred = 0;
+    new_timer->heap_idx = LV_TIMER_HEAP_IDX_NONE;
+    new_timer->create_id = state.create_id++;
+    new_timer->run_id = state.run_id - 1;
+    timer_schedule(new_timer);
 
     lv_timer_handler_resume();
 
@@ -193,8 +207,11 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+    timer_unschedule(timer);
+    if(state.timer_exec == timer) state.timer_exec = NULL;
+
     lv_ll_remove(timer_ll_p, timer);
-    state.timer_deleted = true;
+    state.timer_cnt--;
 
     lv_free(timer);
 }
@@ -203,12 +220,14 @@ void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = true;
+    if(timer->heap_idx != LV_TIMER_HEAP_IDX_NONE) heap_remove(timer);
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+    timer_schedule(timer);
     lv_timer_handler_resume();
 }
 
@@ -216,18 +235,26 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+    timer_schedule(timer);
 }
 
 void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+    timer_schedule(timer);
 }
 
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     LV_ASSERT_NULL(timer);
     timer->repeat_count = repeat_count;
+
+    /*Let the next lv_timer_handler call delete or pause the timer*/
+    if(repeat_count == 0 && timer->heap_idx != LV_TIMER_HEAP_IDX_NONE) {
+        timer->due = tick_get64();
+        heap_sift_up(timer->heap_idx);
+    }
 }
 
 void lv_timer_set_auto_delete(lv_timer_t * timer, bool auto_delete)
@@ -246,6 +273,7 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+    timer_schedule(timer);
     lv_timer_handler_resume();
 }
 
@@ -260,6 +288,17 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+
+    lv_free(state.heap);
+    state.heap = NULL;
+    state.heap_size = 0;
+    state.heap_capacity = 0;
+    state.timer_cnt = 0;
+
+    lv_free(state.deferred);
+    state.deferred = NULL;
+    state.deferred_size = 0;
+    state.deferred_capacity = 0;
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -278,6 +317,11 @@ lv_timer_t * lv_timer_get_next(lv_timer_t * timer)
     else return lv_ll_get_next(timer_ll_p, timer);
 }
 
+lv_timer_t * lv_timer_get_running(void)
+{
+    return state.timer_exec;
+}
+
 LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler_run_in_period(uint32_t period)
 {
     static uint32_t last_tick = 0;
@@ -304,81 +348,200 @@ bool lv_timer_get_paused(lv_timer_t * timer)
  **********************/
 
 /**
- * Execute timer if its remaining time is zero
+ * Execute a due timer
  * @param timer pointer to lv_timer
- * @return true: execute, false: not executed
+ * @return true: the timer still exists, false: it was deleted
  */
 static bool lv_timer_exec(lv_timer_t * timer)
 {
-    if(timer->paused) return false;
-
-    bool exec = false;
-    if(lv_timer_time_remaining(timer) == 0) {
-        /* Decrement the repeat count before executing the timer_cb.
-         * If any timer is deleted `if(timer->repeat_count == 0)` is not executed below
-         * but at least the repeat count is zero and the timer can be deleted in the next round*/
-        int32_t original_repeat_count = timer->repeat_count;
-        if(timer->repeat_count > 0) timer->repeat_count--;
-        timer->last_run = lv_tick_get();
-        LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
-
-        if(timer->timer_cb && original_repeat_count != 0) {
-            LV_PROFILER_TIMER_BEGIN_TAG("timer_cb");
-            timer->timer_cb(timer);
-            LV_PROFILER_TIMER_END_TAG("timer_cb");
-        }
+    /* Decrement the repeat count before executing the timer_cb.
+     * If the timer is deleted in the timer_cb `if(timer->repeat_count == 0)` is not executed below
+     * but at least the repeat count is zero and the timer can be deleted in the next round*/
+    int32_t original_repeat_count = timer->repeat_count;
+    if(timer->repeat_count > 0) timer->repeat_count--;
+    timer->last_run = lv_tick_get();
+    timer->run_id = state.run_id;
+    timer_schedule(timer);
+    LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
+
+    state.timer_exec = timer;
+    if(timer->timer_cb && original_repeat_count != 0) {
+        LV_PROFILER_TIMER_BEGIN_TAG("timer_cb");
+        timer->timer_cb(timer);
+        LV_PROFILER_TIMER_END_TAG("timer_cb");
+    }
+
+    LV_ASSERT_MEM_INTEGRITY();
 
-        if(!state.timer_deleted) {
-            LV_TRACE_TIMER("timer callback %p finished", *((void **)&timer->timer_cb));
+    /*The timer might be deleted by itself as well*/
+    if(state.timer_exec == NULL) {
+        LV_TRACE_TIMER("timer callback finished");
+        return false;
+    }
+
+    state.timer_exec = NULL;
+    LV_TRACE_TIMER("timer callback %p finished", *((void **)&timer->timer_cb));
+
+    if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
+        if(timer->auto_delete) {
+            LV_TRACE_TIMER("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
+            lv_timer_delete(timer);
+            return false;
         }
         else {
-            LV_TRACE_TIMER("timer callback finished");
+            LV_TRACE_TIMER("pausing timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
+            lv_timer_pause(timer);
         }
-
-        LV_ASSERT_MEM_INTEGRITY();
-        exec = true;
     }
 
-    if(state.timer_deleted == false) { /*The timer might be deleted by itself as well*/
-        if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
-            if(timer->auto_delete) {
-                LV_TRACE_TIMER("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
-                lv_timer_delete(timer);
-            }
-            else {
-                LV_TRACE_TIMER("pausing timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
-                lv_timer_pause(timer);
-            }
-        }
+    return true;
+}
+
+/**
+ * Call the ready lv_timer
+ */
+static void lv_timer_handler_resume(void)
+{
+    /*If there is a timer which is ready to run then resume the timer loop*/
+    state.timer_time_until_next = 0;
+    if(state.resume_cb) {
+        state.resume_cb(state.resume_data);
     }
+}
 
-    return exec;
+/**
+ * Get the tick extended to 64 bit. It's used for the due times, so they can be
+ * compared without worrying about the overflow of the 32 bit tick.
+ * @return the current tick on 64 bit
+ */
+static int64_t tick_get64(void)
+{
+    uint32_t tick = lv_tick_get();
+    state.tick64 += lv_tick_diff(tick, state.tick64_last);
+    state.tick64_last = tick;
+    return state.tick64;
 }
 
 /**
- * Find out how much time remains before a timer must be run.
+ * Update the due time of a timer from its `last_run` and `period`
+ * and move it to its new place in the heap.
+ * Paused timers and the timers which already ran in the current
+ * lv_timer_handler call are not added to the heap.
  * @param timer pointer to lv_timer
- * @return the time remaining, or 0 if it needs to be run again
  */
-static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
+static void timer_schedule(lv_timer_t * timer)
 {
-    /*Check if at least 'period' time elapsed*/
-    uint32_t elp = lv_tick_elaps(timer->last_run);
-    if(elp >= timer->period)
-        return 0;
-    return timer->period - elp;
+    uint32_t tick = lv_tick_get();
+    timer->due = tick_get64() - lv_tick_diff(tick, timer->last_run) + timer->period;
+
+    if(timer->paused || timer->deferred) return;
+
+    if(timer->heap_idx == LV_TIMER_HEAP_IDX_NONE) {
+        /*The slot was reserved when the timer was created*/
+        LV_ASSERT(state.heap_size < state.heap_capacity);
+        heap_set(state.heap_size, timer);
+        state.heap_size++;
+        heap_sift_up(timer->heap_idx);
+    }
+    else {
+        heap_sift_up(timer->heap_idx);
+        heap_sift_down(timer->heap_idx);
+    }
 }
 
 /**
- * Call the ready lv_timer
+ * Remove a timer from the heap or from the deferred timers
+ * @param timer pointer to lv_timer
  */
-static void lv_timer_handler_resume(void)
+static void timer_unschedule(lv_timer_t * timer)
 {
-    /*If there is a timer which is ready to run then resume the timer loop*/
-    state.timer_time_until_next = 0;
-    if(state.resume_cb) {
-        state.resume_cb(state.resume_data);
+    if(timer->heap_idx != LV_TIMER_HEAP_IDX_NONE) {
+        heap_remove(timer);
+    }
+    else if(timer->deferred) {
+        uint32_t i;
+        for(i = 0; i < state.deferred_size; i++) {
+            if(state.deferred[i] == timer) {
+                state.deferred[i] = state.deferred[--state.deferred_size];
+                break;
+            }
+        }
+        timer->deferred = 0;
+    }
+}
+
+/**
+ * Make sure that a timer pointer array can store at least `size` elements
+ * @param array     pointer to the array to reallocate
+ * @param capacity  pointer to the current capacity of the array
+ * @param size      the required number of elements
+ * @return          true: there is enough space; false: out of memory
+ */
+static bool heap_reserve(lv_timer_t *** array, uint32_t * capacity, uint32_t size)
+{
+    if(size <= *capacity) return true;
+
+    uint32_t new_capacity = *capacity ? *capacity * 2 : 16;
+    lv_timer_t ** new_array = lv_realloc(*array, new_capacity * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(new_array);
+    if(new_array == NULL) return false;
+
+    *array = new_array;
+    *capacity = new_capacity;
+    return true;
+}
+
+static bool heap_less(const lv_timer_t * a, const lv_timer_t * b)
+{
+    if(a->due != b->due) return a->due < b->due;
+
+    /*Keep the original order of running the newer timers first*/
+    return (int32_t)(a->create_id - b->create_id) > 0;
+}
+
+static void heap_set(uint32_t idx, lv_timer_t * timer)
+{
+    state.heap[idx] = timer;
+    timer->heap_idx = idx;
+}
+
+static void heap_sift_up(uint32_t idx)
+{
+    lv_timer_t * timer = state.heap[idx];
+    while(idx > 0) {
+        uint32_t parent = (idx - 1) / 2;
+        if(!heap_less(timer, state.heap[parent])) break;
+        heap_set(idx, state.heap[parent]);
+        idx = parent;
+    }
+    heap_set(idx, timer);
+}
+
+static void heap_sift_down(uint32_t idx)
+{
+    lv_timer_t * timer = state.heap[idx];
+    while(true) {
+        uint32_t child = idx * 2 + 1;
+        if(child >= state.heap_size) break;
+        if(child + 1 < state.heap_size && heap_less(state.heap[child + 1], state.heap[child])) child++;
+        if(!heap_less(state.heap[child], timer)) break;
+        heap_set(idx, state.heap[child]);
+        idx = child;
     }
+    heap_set(idx, timer);
+}
+
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t idx = timer->heap_idx;
+    timer->heap_idx = LV_TIMER_HEAP_IDX_NONE;
+
+    state.heap_size--;
+    if(idx == state.heap_size) return;
+
+    heap_set(idx, state.heap[state.heap_size]);
+    heap_sift_up(idx);
+    heap_sift_down(idx);
 }
 
 void lv_timer_handler_set_resume_cb(lv_timer_handler_resume_cb_t cb, void * data)
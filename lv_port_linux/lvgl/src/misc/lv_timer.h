@@ -182,6 +182,12 @@ uint32_t lv_timer_get_time_until_next(void);
  */
 lv_timer_t * lv_timer_get_next(lv_timer_t * timer);
 
+/**
+ * Get the timer whose callback is being called by `lv_timer_handler()`
+ * @return the running timer or NULL if no timer callback is running or the running timer was deleted
+ */
+lv_timer_t * lv_timer_get_running(void);
+
 /**
  * Get the user_data passed when the timer was created
  * @param timer pointer to the lv_timer
@@ -20,6 +20,8 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#define LV_TIMER_HEAP_IDX_NONE UINT32_MAX
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,15 +37,37 @@ struct _lv_timer_t {
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
     volatile int paused;
     uint32_t auto_delete : 1;
+    uint32_t deferred : 1;     /**< Ran in the current timer handler call, waits to be re-scheduled */
+    uint32_t heap_idx;         /**< Index in the scheduler heap or `LV_TIMER_HEAP_IDX_NONE` */
+    uint32_t create_id;        /**< Creation order, newer timers run first if they are due at the same time */
+    uint32_t run_id;           /**< ID of the timer handler call which ran the timer the last time */
+    int64_t due;               /**< When the timer should run next on the extended 64 bit tick */
 };
 
 typedef struct {
     lv_ll_t timer_ll;          /**< Linked list to store the lv_timers */
 
+    /** Min-heap of the running (not paused) timers ordered by their due time.
+     *  Every timer has its slot reserved from its creation until its deletion,
+     *  i.e. `heap_capacity >= timer_cnt` */
+    lv_timer_t ** heap;
+    uint32_t heap_size;
+    uint32_t heap_capacity;
+    uint32_t timer_cnt;        /**< Number of the created timers */
+
+    /** Timers which already ran in the current lv_timer_handler call */
+    lv_timer_t ** deferred;
+    uint32_t deferred_size;
+    uint32_t deferred_capacity;
+
+    lv_timer_t * timer_exec;   /**< The timer whose callback is being called, NULL if it was deleted */
+    uint32_t run_id;
+    uint32_t create_id;
+    int64_t tick64;            /**< The tick extended to 64 bit to avoid overflow when comparing due times */
+    uint32_t tick64_last;
+
     bool lv_timer_run;
     uint8_t idle_last;
-    bool timer_deleted;
-    bool timer_created;
     volatile uint32_t timer_time_until_next;
 
     bool already_running;
@@ -173,6 +173,7 @@ typedef struct _lv_image_header_cache_data_t lv_image_header_cache_data_t;
 typedef struct _lv_draw_mask_t lv_draw_mask_t;
 
 typedef struct _lv_draw_label_hint_t lv_draw_label_hint_t;
+typedef struct _lv_draw_label_lines_t lv_draw_label_lines_t;
 
 typedef struct _lv_draw_glyph_dsc_t lv_draw_glyph_dsc_t;
 
@@ -244,6 +245,8 @@ typedef struct _lv_menu_page_t lv_menu_page_t;
 
 typedef struct _lv_msgbox_t lv_msgbox_t;
 
+typedef struct _lv_recycler_t lv_recycler_t;
+
 typedef struct _lv_roller_t lv_roller_t;
 
 typedef struct _lv_scale_section_t lv_scale_section_t;
@@ -357,6 +360,8 @@ typedef struct _lv_iter_t lv_iter_t;
 
 typedef struct _lv_circle_buf_t lv_circle_buf_t;
 
+typedef struct _lv_fenwick_t lv_fenwick_t;
+
 typedef struct _lv_draw_buf_t lv_draw_buf_t;
 
 #if LV_USE_OBJ_PROPERTY
@@ -71,6 +71,8 @@ void lv_imgfont_destroy(lv_font_t * font)
 {
     LV_ASSERT_NULL(font);
 
+    lv_draw_label_run_cache_drop();
+
     imgfont_dsc_t * dsc = (imgfont_dsc_t *)font->dsc;
     lv_free(dsc);
 }
@@ -15,6 +15,7 @@
 /*********************
  *      DEFINES
  *********************/
+#define MOUSE_SAMPLE_QUEUE_SIZE 256
 
 /**********************
  *      TYPEDEFS
@@ -45,6 +46,7 @@ void lv_test_indev_create_all(void)
     _state.mouse_indev = lv_indev_create();
     lv_indev_set_type(_state.mouse_indev, LV_INDEV_TYPE_POINTER);
     lv_indev_set_read_cb(_state.mouse_indev,  lv_test_mouse_read_cb);
+    lv_indev_set_sample_queue_size(_state.mouse_indev, MOUSE_SAMPLE_QUEUE_SIZE);
 
     _state.keypad_indev = lv_indev_create();
     lv_indev_set_type(_state.keypad_indev, LV_INDEV_TYPE_KEYPAD);
@@ -129,6 +131,35 @@ void lv_test_mouse_click_at(int32_t x, int32_t y)
     lv_test_wait(50);
 }
 
+void lv_test_mouse_swipe_to(int32_t x, int32_t y, uint32_t duration, uint32_t sample_period)
+{
+    int32_t x_start = _state.x_act;
+    int32_t y_start = _state.y_act;
+    if(duration == 0) duration = 1;
+    if(sample_period == 0) sample_period = 1;
+
+    _state.mouse_pressed = true;
+
+    uint32_t t;
+    for(t = 1; t <= duration; t++) {
+        lv_tick_inc(1);
+        if(t % sample_period == 0 || t == duration) {
+            lv_indev_data_t data;
+            lv_memzero(&data, sizeof(data));
+            data.point.x = x_start + (x - x_start) * (int32_t)t / (int32_t)duration;
+            data.point.y = y_start + (y - y_start) * (int32_t)t / (int32_t)duration;
+            data.state = LV_INDEV_STATE_PRESSED;
+            lv_indev_push_data(_state.mouse_indev, &data);
+
+            /*Report the last point if LVGL reads the mouse when no sample is queued*/
+            _state.x_act = data.point.x;
+            _state.y_act = data.point.y;
+        }
+        lv_timer_handler();
+    }
+    lv_refr_now(NULL);
+}
+
 void lv_test_key_press(uint32_t k)
 {
     _state.key_act = k;
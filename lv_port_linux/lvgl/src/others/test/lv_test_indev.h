@@ -94,6 +94,18 @@ void lv_test_mouse_release(void);
  */
 void lv_test_mouse_click_at(int32_t x, int32_t y);
 
+/**
+ * Move the pressed mouse along a straight line like a high rate touch screen.
+ * A sample is queued in every `sample_period` ms and LVGL reads them
+ * at its normal rate, like the samples of a buffered driver.
+ * Internally `lv_timer_handler` is called, meaning all the events will be fired inside this function.
+ * @param x                 the target absolute X coordinate
+ * @param y                 the target absolute Y coordinate
+ * @param duration          time of the movement in milliseconds
+ * @param sample_period     time between the samples in milliseconds
+ */
+void lv_test_mouse_swipe_to(int32_t x, int32_t y, uint32_t duration, uint32_t sample_period);
+
 /**
  * Emulate a key press.
  * This function doesn't wait, but just changes the state and returns immediately.
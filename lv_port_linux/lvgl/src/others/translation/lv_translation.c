@@ -192,6 +192,33 @@ const char * lv_translation_get(const char * tag)
     return tag;
 }
 
+void lv_translation_prefetch(const char * lang, const lv_font_t * font)
+{
+    LV_ASSERT_NULL(lang);
+    LV_ASSERT_NULL(font);
+
+    lv_translation_pack_t * pack;
+    LV_LL_READ(&packs_ll, pack) {
+        int32_t lang_idx = lv_translation_get_language_index(pack, lang);
+        if(lang_idx < 0) continue;
+
+        if(pack->is_static) {
+            uint32_t t;
+            for(t = 0; pack->tag_p[t]; t++) {
+                lv_font_prefetch(font, pack->translation_p[pack->language_cnt * t + lang_idx]);
+            }
+        }
+        else {
+            size_t trans_cnt = lv_array_size(&pack->translation_array);
+            size_t i;
+            for(i = 0; i < trans_cnt; i++) {
+                lv_translation_tag_dsc_t * tag_dsc = lv_array_at(&pack->translation_array, i);
+                lv_font_prefetch(font, tag_dsc->translations[lang_idx]);
+            }
+        }
+    }
+}
+
 lv_result_t lv_translation_add_language(lv_translation_pack_t * pack, const char * lang)
 {
     if(pack->is_static) {
@@ -97,6 +97,15 @@ static inline const char * lv_tr(const char * tag)
     return lv_translation_get(tag);
 }
 
+/**
+ * Render the glyphs of all the translations of a language into the cache of a font
+ * so that the first frames after `lv_translation_set_language(lang)` don't need to wait for the glyphs.
+ * @param lang      the language to prepare, e.g. "de"
+ * @param font      the font (with fallbacks) used to display the translations
+ * @note            see `lv_font_prefetch`
+ */
+void lv_translation_prefetch(const char * lang, const lv_font_t * font);
+
 /**
  * Add a new language to a dynamic language pack.
  * All languages should be added before adding tags
@@ -37,6 +37,9 @@
 #define LV_LABEL_DOT_BEGIN_INV 0xFFFFFFFF
 #define LV_LABEL_HINT_HEIGHT_LIMIT 1024 /*Enable "hint" to buffer info about labels larger than this. (Speed up drawing)*/
 
+/*Arabic and Persian letters depend on their neighbors so with them the whole text is processed again*/
+#define LV_LABEL_EDIT_LINES (LV_LABEL_LINE_TABLE && !LV_USE_ARABIC_PERSIAN_CHARS)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -60,6 +63,11 @@ static void set_ofs_y_anim(void * obj, int32_t v);
 static size_t get_text_length(const char * text);
 static void copy_text_to_label(lv_label_t * label, const char * text);
 static lv_text_flag_t get_label_flags(lv_label_t * label);
+static bool text_reserve(lv_label_t * label, size_t size, bool extra);
+static uint32_t get_append_trim_len(const char * txt, uint32_t len, uint32_t limit);
+#if LV_LABEL_LINE_TABLE
+    static bool lines_are_valid(lv_label_t * label, const lv_font_t * font, const lv_text_attributes_t * attributes);
+#endif
 static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, const char * txt,
                                    uint32_t length, const lv_font_t * font, lv_area_t * txt_coords, lv_text_attributes_t * attributes);
 
@@ -163,6 +171,9 @@ void lv_label_set_text_vfmt(lv_obj_t * obj, const char * fmt, va_list args)
     lv_label_t * label = (lv_label_t *)obj;
 
     lv_label_revert_dots(obj);
+#if LV_LABEL_LINE_TABLE
+    lv_draw_label_lines_reset(&label->lines);
+#endif
 
     /*If text is NULL then refresh*/
     if(fmt == NULL) {
@@ -177,6 +188,7 @@ void lv_label_set_text_vfmt(lv_obj_t * obj, const char * fmt, va_list args)
 
     label->text = lv_text_set_text_vfmt(fmt, args);
     label->static_txt = 0; /*Now the text is dynamically allocated*/
+    label->text_buf_size = 0;
 
     lv_label_refr_text(obj);
 }
@@ -195,8 +207,12 @@ void lv_label_set_text_static(lv_obj_t * obj, const char * text)
     if(text != NULL) {
         label->static_txt = 1;
         label->text       = (char *)text;
+        label->text_buf_size = 0;
     }
 
+#if LV_LABEL_LINE_TABLE
+    lv_draw_label_lines_reset(&label->lines); /*The text might have changed in place*/
+#endif
     lv_label_refr_text(obj);
 }
 
@@ -284,6 +300,14 @@ void lv_label_set_recolor(lv_obj_t * obj, bool en)
     lv_label_refr_text(obj);
 }
 
+void lv_label_set_append_limit(lv_obj_t * obj, uint32_t max_len)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_label_t * label = (lv_label_t *)obj;
+    label->append_limit = max_len;
+}
+
 /*=====================
  * Getter functions
  *====================*/
@@ -350,17 +374,29 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
     int32_t y = 0;
     uint32_t line_start = 0;
     uint32_t new_line_start = 0;
-    while(txt[new_line_start] != '\0') {
-        bool last_line = y + letter_height + attributes.line_space + letter_height > max_h;
-        if(last_line && label->long_mode == LV_LABEL_LONG_MODE_DOTS) attributes.text_flags |= LV_TEXT_FLAG_BREAK_ALL;
+#if LV_LABEL_LINE_TABLE
+    /*In dots mode the last line is broken differently*/
+    if(label->long_mode != LV_LABEL_LONG_MODE_DOTS && lines_are_valid(label, font, &attributes)) {
+        uint32_t line = lv_draw_label_lines_get_line(&label->lines, byte_id);
+        line_start = label->lines.lines[line].start;
+        new_line_start = label->lines.lines[line + 1].start;
+        y = (int32_t)line * (letter_height + attributes.line_space);
+    }
+    else
+#endif
+    {
+        while(txt[new_line_start] != '\0') {
+            bool last_line = y + letter_height + attributes.line_space + letter_height > max_h;
+            if(last_line && label->long_mode == LV_LABEL_LONG_MODE_DOTS) attributes.text_flags |= LV_TEXT_FLAG_BREAK_ALL;
 
-        new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, NULL, &attributes);
+            new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, NULL, &attributes);
 
-        if(byte_id < new_line_start || txt[new_line_start] == '\0')
-            break; /*The line of 'index' letter begins at 'line_start'*/
+            if(byte_id < new_line_start || txt[new_line_start] == '\0')
+                break; /*The line of 'index' letter begins at 'line_start'*/
 
-        y += letter_height + attributes.line_space;
-        line_start = new_line_start;
+            y += letter_height + attributes.line_space;
+            line_start = new_line_start;
+        }
     }
 
     /*If the last character is line break then go to the next line*/
@@ -659,6 +695,14 @@ bool lv_label_get_recolor(const lv_obj_t * obj)
     return label->recolor == 0 ? false : true;
 }
 
+uint32_t lv_label_get_append_limit(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_label_t * label = (lv_label_t *)obj;
+    return label->append_limit;
+}
+
 /*=====================
  * Other functions
  *====================*/
@@ -713,16 +757,67 @@ void lv_label_ins_text(lv_obj_t * obj, uint32_t pos, const char * txt)
     size_t old_len = lv_strlen(label->text);
     size_t ins_len = lv_strlen(txt);
     size_t new_len = ins_len + old_len;
-    label->text        = lv_realloc(label->text, new_len + 1);
-    LV_ASSERT_MALLOC(label->text);
-    if(label->text == NULL) return;
+    if(!text_reserve(label, new_len + 1, false)) return;
 
     if(pos == LV_LABEL_POS_LAST) {
         pos = lv_text_get_encoded_length(label->text);
     }
 
+#if LV_LABEL_EDIT_LINES
+    /*Find only the lines of the changed paragraph again*/
+    uint32_t byte_pos = lv_text_encoded_get_byte_id(label->text, pos);
+    lv_text_ins(label->text, pos, txt);
+    remove_translation_tag(obj);
+    lv_draw_label_lines_edit(&label->lines, label->text, byte_pos, (int32_t)ins_len);
+    lv_label_refr_text(obj);
+#else
     lv_text_ins(label->text, pos, txt);
     lv_label_set_text(obj, NULL);
+#endif
+}
+
+void lv_label_append_text(lv_obj_t * obj, const char * txt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(txt);
+
+    lv_label_t * label = (lv_label_t *)obj;
+
+    /*Cannot append to static text*/
+    if(label->static_txt != 0) return;
+
+    size_t ins_len = lv_strlen(txt);
+    if(ins_len == 0) return;
+
+    lv_obj_invalidate(obj);
+    remove_translation_tag(obj);
+    lv_label_revert_dots(obj);
+
+    /*Allocate some extra space to not reallocate the text for each append*/
+    size_t old_len = lv_strlen(label->text);
+    size_t new_len = old_len + ins_len;
+    if(!text_reserve(label, new_len + 1, true)) return;
+
+    lv_memcpy(&label->text[old_len], txt, ins_len + 1);
+#if LV_LABEL_EDIT_LINES
+    lv_draw_label_lines_edit(&label->lines, label->text, old_len, (int32_t)ins_len);
+#endif
+
+    /*Remove the oldest lines*/
+    if(label->append_limit && new_len > label->append_limit) {
+        uint32_t trim_len = get_append_trim_len(label->text, new_len, label->append_limit);
+        lv_memmove(label->text, &label->text[trim_len], new_len - trim_len + 1);
+#if LV_LABEL_EDIT_LINES
+        if(trim_len == new_len) lv_draw_label_lines_reset(&label->lines);
+        else lv_draw_label_lines_edit(&label->lines, label->text, 0, -(int32_t)trim_len);
+#endif
+    }
+
+#if LV_USE_ARABIC_PERSIAN_CHARS
+    lv_label_set_text(obj, NULL);
+#else
+    lv_label_refr_text(obj);
+#endif
 }
 
 void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
@@ -736,8 +831,19 @@ void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
     lv_obj_invalidate(obj);
 
     char * label_txt = lv_label_get_text(obj);
+#if LV_LABEL_EDIT_LINES
+    /*Find only the lines of the changed paragraph again*/
+    uint32_t byte_pos = lv_text_encoded_get_byte_id(label_txt, pos);
+    size_t old_len = lv_strlen(label_txt);
+    lv_text_cut(label_txt, pos, cnt);
+    lv_draw_label_lines_edit(&label->lines, label_txt, byte_pos, (int32_t)lv_strlen(label_txt) - (int32_t)old_len);
+#else
     /*Delete the characters*/
     lv_text_cut(label_txt, pos, cnt);
+#if LV_LABEL_LINE_TABLE
+    lv_draw_label_lines_reset(&label->lines); /*The text has changed in place*/
+#endif
+#endif
 
     /*Refresh the label*/
     lv_label_refr_text(obj);
@@ -769,6 +875,10 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     label->hint.y          = 0;
 #endif
 
+#if LV_LABEL_LINE_TABLE
+    lv_memzero(&label->lines, sizeof(label->lines));
+#endif
+
 #if LV_LABEL_TEXT_SELECTION
     label->sel_start = LV_DRAW_LABEL_NO_TXT_SEL;
     label->sel_end   = LV_DRAW_LABEL_NO_TXT_SEL;
@@ -788,6 +898,9 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     if(!label->static_txt) lv_free(label->text);
     label->text = NULL;
+#if LV_LABEL_LINE_TABLE
+    lv_draw_label_lines_reset(&label->lines);
+#endif
 #if LV_USE_TRANSLATION
     if(label->translation_tag) lv_free(label->translation_tag);
     label->translation_tag = NULL;
@@ -806,6 +919,10 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
     lv_obj_t * obj = lv_event_get_current_target(e);
 
     if((code == LV_EVENT_STYLE_CHANGED) || (code == LV_EVENT_SIZE_CHANGED)) {
+#if LV_LABEL_LINE_TABLE
+        /*The font might have changed in place, e.g. its size was set*/
+        if(code == LV_EVENT_STYLE_CHANGED) lv_draw_label_lines_reset(&((lv_label_t *)obj)->lines);
+#endif
         lv_label_refr_text(obj);
     }
     else if(code == LV_EVENT_REFR_EXT_DRAW_SIZE) {
@@ -824,27 +941,33 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
             int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
 
             int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
-            lv_text_flag_t flag = LV_TEXT_FLAG_NONE;
-            if(label->recolor != 0) flag |= LV_TEXT_FLAG_RECOLOR;
-            if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
 
             int32_t w;
             if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) w = LV_COORD_MAX;
             else w = lv_obj_get_content_width(obj);
             w = LV_MIN(w, lv_obj_get_style_max_width(obj, LV_PART_MAIN));
 
-            uint32_t dot_begin = label->dot_begin;
-            lv_label_revert_dots(obj);
-
             lv_text_attributes_t attributes = {0};
 
             attributes.letter_space = letter_space;
             attributes.line_space = line_space;
-            attributes.text_flags = flag;
+            /*Use the same flags as for drawing to reuse the lines found there*/
+            attributes.text_flags = get_label_flags(label);
             attributes.max_width = w;
 
-            lv_text_get_size_attributes(&label->size_cache, label->text, font, &attributes);
-            lv_label_set_dots(obj, dot_begin);
+#if LV_LABEL_LINE_TABLE
+            /*Don't measure the text again if its lines were found with the same parameters*/
+            if(label->dot_begin == LV_LABEL_DOT_BEGIN_INV && lines_are_valid(label, font, &attributes)) {
+                lv_draw_label_lines_get_size(&label->lines, line_space, &label->size_cache);
+            }
+            else
+#endif
+            {
+                uint32_t dot_begin = label->dot_begin;
+                lv_label_revert_dots(obj);
+                lv_text_get_size_attributes(&label->size_cache, label->text, font, &attributes);
+                lv_label_set_dots(obj, dot_begin);
+            }
 
             label->size_cache.y = LV_MIN(label->size_cache.y, lv_obj_get_style_max_height(obj, LV_PART_MAIN));
 
@@ -934,6 +1057,12 @@ static void draw_main(lv_event_t * e)
         return;
     }
 
+#if LV_LABEL_LINE_TABLE
+    /*Find the line breaks only if the text, its width or style has changed since the last draw*/
+    lv_draw_label_lines_update(&label->lines, &label_draw_dsc, &txt_coords);
+    label_draw_dsc.lines = &label->lines;
+#endif
+
     if(label->long_mode == LV_LABEL_LONG_MODE_WRAP) {
         int32_t s = lv_obj_get_scroll_top(obj);
         lv_area_move(&txt_coords, 0, -s);
@@ -1022,6 +1151,10 @@ static void set_text_internal(lv_obj_t * obj, const char * text)
         label->static_txt = 0;
     }
 
+    label->text_buf_size = 0;
+#if LV_LABEL_LINE_TABLE
+    lv_draw_label_lines_reset(&label->lines); /*The text might have changed in place*/
+#endif
     lv_label_refr_text(obj);
 }
 
@@ -1088,7 +1221,20 @@ static void lv_label_refr_text(lv_obj_t * obj)
     lv_point_t size;
 
     lv_label_revert_dots(obj);
+#if LV_LABEL_LINE_TABLE
+    /*The lines are found again only if the text, the width or the style has changed*/
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.text = label->text;
+    dsc.font = font;
+    dsc.letter_space = attributes.letter_space;
+    dsc.flag = attributes.text_flags;
+    lv_draw_label_lines_update(&label->lines, &dsc, &txt_coords);
+    if(label->lines.text) lv_draw_label_lines_get_size(&label->lines, attributes.line_space, &size);
+    else lv_text_get_size_attributes(&size, label->text, font, &attributes);
+#else
     lv_text_get_size_attributes(&size, label->text, font, &attributes);
+#endif
     label->text_size = size;
 
     lv_obj_refresh_self_size(obj);
@@ -1342,6 +1488,9 @@ static void lv_label_revert_dots(lv_obj_t * obj)
         for(int i = 0; i < LV_LABEL_DOT_NUM + 1 && label->dot[i]; i++) {
             label->text[label->dot_begin + i] = label->dot[i];
         }
+#if LV_LABEL_LINE_TABLE
+        lv_draw_label_lines_reset(&label->lines);
+#endif
     }
     label->dot_begin = LV_LABEL_DOT_BEGIN_INV;
 }
@@ -1360,6 +1509,9 @@ static void lv_label_set_dots(lv_obj_t * obj, uint32_t dot_begin)
 
         /*Save characters*/
         lv_strncpy(label->dot, &label->text[dot_begin], LV_LABEL_DOT_NUM + 1);
+#if LV_LABEL_LINE_TABLE
+        lv_draw_label_lines_reset(&label->lines);
+#endif
 
         /*Overwrite up to LV_LABEL_DOT_NUM + 1 characters with dots and null terminator*/
         int i = 0;
@@ -1422,6 +1574,72 @@ static lv_text_flag_t get_label_flags(lv_label_t * label)
     return flag;
 }
 
+/**
+ * Make sure that the text of a label has place for a given number of bytes
+ * @param label     pointer to a label with dynamically allocated text
+ * @param size      the required size in bytes, including the terminating `\0`
+ * @param extra     true: allocate some extra space for the next appends
+ * @return          false if the memory couldn't be allocated. The text is unchanged then.
+ */
+static bool text_reserve(lv_label_t * label, size_t size, bool extra)
+{
+    if(size <= label->text_buf_size) return true;
+
+    size_t new_size = extra ? size + size / 2 : size;
+    char * new_text = lv_realloc(label->text, new_size);
+    LV_ASSERT_MALLOC(new_text);
+    if(new_text == NULL) return false;
+
+    label->text = new_text;
+    label->text_buf_size = extra ? new_size : 0;
+    return true;
+}
+
+/**
+ * Get how many bytes to remove from the beginning of the text when the append limit is exceeded
+ * @param txt       the text
+ * @param len       length of the text in bytes
+ * @param limit     the append limit
+ * @return          number of bytes to remove: the whole lines above 3/4 of the limit.
+ *                  `len` if the only line break is the last character.
+ */
+static uint32_t get_append_trim_len(const char * txt, uint32_t len, uint32_t limit)
+{
+    /*Remove more than needed to not move the text for each new line*/
+    uint32_t trim_len = len - (limit - limit / 4);
+    uint32_t i = trim_len;
+    while(i <= len && txt[i - 1] != '\n') i++;
+    if(i <= len) return i;
+
+    /*The text is a single line so cut it at a character boundary*/
+    while(trim_len < len && (txt[trim_len] & 0xC0) == 0x80) trim_len++;
+    return trim_len;
+}
+
+#if LV_LABEL_LINE_TABLE
+/**
+ * Check if the stored lines of a label were found with the given parameters
+ * @param label         pointer to a label
+ * @param font          the font of the text
+ * @param attributes    the text attributes
+ * @return              true: the stored lines can be used
+ */
+static bool lines_are_valid(lv_label_t * label, const lv_font_t * font, const lv_text_attributes_t * attributes)
+{
+    const lv_draw_label_lines_t * lines = &label->lines;
+    int32_t max_width = attributes->max_width;
+    if(attributes->text_flags & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) max_width = LV_COORD_MAX;
+
+    return lines->text != NULL &&
+           lines->text == label->text &&
+           lines->font == font &&
+           lines->text_length == LV_TEXT_LEN_MAX &&
+           lines->letter_space == attributes->letter_space &&
+           lines->flag == attributes->text_flags &&
+           lines->max_width == max_width;
+}
+#endif
+
 /* Function created because of this pattern be used in multiple functions */
 static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, const char * txt, uint32_t length,
                                    const lv_font_t * font, lv_area_t * txt_coords, lv_text_attributes_t * attributes)
@@ -158,6 +158,15 @@ void lv_label_set_text_selection_end(lv_obj_t * obj, uint32_t index);
  */
 void lv_label_set_recolor(lv_obj_t * obj, bool en);
 
+/**
+ * Set the maximum length of the text when text is appended with `lv_label_append_text()`.
+ * If the text gets longer whole lines are removed from its beginning. To not move the text
+ * for every appended line, it's shortened to about 3/4 of the limit at once.
+ * @param obj           pointer to a label object
+ * @param max_len       the maximum length in bytes. 0: no limit
+ */
+void lv_label_set_append_limit(lv_obj_t * obj, uint32_t max_len);
+
 #if LV_USE_TRANSLATION
 
 /**
@@ -237,6 +246,13 @@ uint32_t lv_label_get_text_selection_end(const lv_obj_t * obj);
  */
 bool lv_label_get_recolor(const lv_obj_t * obj);
 
+/**
+ * Get the maximum length of the text when text is appended
+ * @param obj       pointer to a label object
+ * @return          the maximum length in bytes. 0: no limit
+ */
+uint32_t lv_label_get_append_limit(const lv_obj_t * obj);
+
 /*=====================
  * Other functions
  *====================*/
@@ -265,6 +281,15 @@ lv_observer_t * lv_label_bind_text(lv_obj_t * obj, lv_subject_t * subject, const
  */
 void lv_label_ins_text(lv_obj_t * obj, uint32_t pos, const char * txt);
 
+/**
+ * Append a text to the end of a label, e.g. a new line of a log. The label text cannot be static.
+ * Only the last paragraph is measured again and some extra memory is allocated for the next texts.
+ * See `lv_label_set_append_limit()` to remove the oldest lines.
+ * @param obj       pointer to a label object
+ * @param txt       pointer to the text to append
+ */
+void lv_label_append_text(lv_obj_t * obj, const char * txt);
+
 /**
  * Delete characters from a label. The label text cannot be static.
  * @param obj       pointer to a label object
@@ -36,11 +36,17 @@ struct _lv_label_t {
 #endif /*LV_USE_TRANSLATION*/
     char dot[LV_LABEL_DOT_NUM + 1]; /**< Bytes that have been replaced with dots */
     uint32_t dot_begin;  /**< Offset where bytes have been replaced with dots */
+    uint32_t text_buf_size;  /**< Allocated size of `text` if there is place for appending, else 0 */
+    uint32_t append_limit;   /**< Maximum length of the text when appending. 0: no limit */
 
 #if LV_LABEL_LONG_TXT_HINT
     lv_draw_label_hint_t hint;
 #endif
 
+#if LV_LABEL_LINE_TABLE
+    lv_draw_label_lines_t lines;        /**< The line breaks of the text. Updated when the label is drawn */
+#endif
+
 #if LV_LABEL_TEXT_SELECTION
     uint32_t sel_start;
     uint32_t sel_end;
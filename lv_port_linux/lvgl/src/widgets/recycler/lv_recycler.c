@@ -0,0 +1,536 @@
+/**
+ * @file lv_recycler.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_recycler_private.h"
+#include "../../core/lv_obj_private.h"
+#include "../../core/lv_obj_class_private.h"
+#include "../../core/lv_obj_scroll_private.h"
+#include "../../layouts/lv_layout_private.h"
+#if LV_USE_RECYCLER != 0
+
+#include "../../misc/lv_assert.h"
+#include "../../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MY_CLASS (&lv_recycler_class)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void lv_recycler_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_recycler_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_recycler_event(const lv_obj_class_t * class_p, lv_event_t * e);
+static void refr_items(lv_obj_t * obj);
+static lv_obj_t * get_bound_item(lv_obj_t * obj, uint32_t index);
+static void release_items(lv_recycler_t * recycler, uint32_t first, uint32_t last);
+static bool update_item_layout(lv_obj_t * item);
+static void item_delete_event_cb(lv_event_t * e);
+static void scroll_to_target(lv_obj_t * obj);
+static void reset_item_heights(lv_recycler_t * recycler);
+static int32_t get_item_y(lv_recycler_t * recycler, uint32_t index, int32_t gap);
+static int32_t get_item_h(lv_recycler_t * recycler, uint32_t index);
+static uint32_t find_item(lv_recycler_t * recycler, int32_t y, int32_t gap, int32_t * item_y);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+const lv_obj_class_t lv_recycler_class  = {
+    .constructor_cb = lv_recycler_constructor,
+    .destructor_cb = lv_recycler_destructor,
+    .event_cb = lv_recycler_event,
+    .width_def = (LV_DPI_DEF * 3) / 2,
+    .height_def = LV_DPI_DEF * 2,
+    .base_class = &lv_obj_class,
+    .instance_size = sizeof(lv_recycler_t),
+    .name = "lv_recycler",
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * lv_recycler_create(lv_obj_t * parent)
+{
+    LV_LOG_INFO("begin");
+    lv_obj_t * obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+void lv_recycler_set_item_cb(lv_obj_t * obj, lv_recycler_create_cb_t create_cb, lv_recycler_bind_cb_t bind_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+    recycler->create_cb = create_cb;
+    recycler->bind_cb = bind_cb;
+
+    /*The existing items might be unknown for the new callbacks*/
+    while(recycler->item_obj_cnt > 0) {
+        lv_obj_delete(recycler->items[recycler->item_obj_cnt - 1].obj);
+    }
+    reset_item_heights(recycler);
+
+    refr_items(obj);
+    lv_obj_refresh_self_size(obj);
+    lv_obj_invalidate(obj);
+}
+
+void lv_recycler_set_item_count(lv_obj_t * obj, uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+    if(recycler->item_cnt == cnt) return;
+
+    uint32_t old_cnt = recycler->item_cnt;
+    if(!lv_fenwick_set_count(&recycler->item_h_tree, cnt)) {
+        recycler->item_cnt = 0;
+        return;
+    }
+    recycler->item_cnt = cnt;
+
+    if(cnt < old_cnt) {
+        if(cnt > 0) release_items(recycler, 0, cnt - 1);
+        else release_items(recycler, LV_RECYCLER_INDEX_NONE, LV_RECYCLER_INDEX_NONE);
+        lv_obj_refresh_self_size(obj);
+        lv_obj_readjust_scroll(obj, LV_ANIM_OFF);
+    }
+
+    refr_items(obj);
+    lv_obj_refresh_self_size(obj);
+    lv_obj_invalidate(obj);
+}
+
+void lv_recycler_set_item_height(lv_obj_t * obj, int32_t h)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+    recycler->item_h_est_auto = h <= 0;
+    recycler->item_h_est = LV_MAX(h, 0);
+
+    /*The heights are stored as difference from the estimation so measure them again*/
+    reset_item_heights(recycler);
+
+    refr_items(obj);
+    lv_obj_refresh_self_size(obj);
+    lv_obj_invalidate(obj);
+}
+
+void lv_recycler_refresh_items(lv_obj_t * obj, uint32_t index, uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+    if(index >= recycler->item_cnt || cnt == 0) return;
+
+    /*Release the items of the changed data items so they are bound again*/
+    uint32_t last = cnt > recycler->item_cnt - index ? recycler->item_cnt - 1 : index + cnt - 1;
+    uint32_t i;
+    for(i = 0; i < recycler->item_obj_cnt; i++) {
+        lv_recycler_item_t * item = &recycler->items[i];
+        if(item->index != LV_RECYCLER_INDEX_NONE && item->index >= index && item->index <= last) {
+            item->index = LV_RECYCLER_INDEX_NONE;
+            lv_obj_add_flag(item->obj, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+
+    refr_items(obj);
+}
+
+void lv_recycler_scroll_to_item(lv_obj_t * obj, uint32_t index, lv_anim_enable_t anim_en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+    if(index >= recycler->item_cnt) return;
+
+    lv_obj_update_layout(obj);
+
+    recycler->scroll_target = index;
+    if(anim_en == LV_ANIM_ON) {
+        /*Scroll to the estimated position and correct it when the animation ends*/
+        int32_t gap = lv_obj_get_style_pad_row(obj, LV_PART_MAIN);
+        lv_obj_scroll_to_y(obj, get_item_y(recycler, index, gap), LV_ANIM_ON);
+    }
+    else {
+        scroll_to_target(obj);
+    }
+}
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+uint32_t lv_recycler_get_item_count(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+    return recycler->item_cnt;
+}
+
+int32_t lv_recycler_get_item_height(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+    return recycler->item_h_est;
+}
+
+lv_obj_t * lv_recycler_get_item(lv_obj_t * obj, uint32_t index)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+    if(index == LV_RECYCLER_INDEX_NONE) return NULL;
+
+    uint32_t i;
+    for(i = 0; i < recycler->item_obj_cnt; i++) {
+        if(recycler->items[i].index == index) return recycler->items[i].obj;
+    }
+
+    return NULL;
+}
+
+uint32_t lv_recycler_get_item_index(lv_obj_t * obj, lv_obj_t * item)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+    uint32_t i;
+    for(i = 0; i < recycler->item_obj_cnt; i++) {
+        if(recycler->items[i].obj == item) return recycler->items[i].index;
+    }
+
+    return LV_RECYCLER_INDEX_NONE;
+}
+
+uint32_t lv_recycler_get_first_visible_index(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+    return recycler->first_index;
+}
+
+uint32_t lv_recycler_get_last_visible_index(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+    return recycler->last_index;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void lv_recycler_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    LV_TRACE_OBJ_CREATE("begin");
+
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+
+    recycler->first_index = LV_RECYCLER_INDEX_NONE;
+    recycler->last_index = LV_RECYCLER_INDEX_NONE;
+    recycler->scroll_target = LV_RECYCLER_INDEX_NONE;
+    recycler->measured_width = -1;
+    recycler->item_h_est_auto = 1;
+    lv_fenwick_init(&recycler->item_h_tree, false);
+
+    lv_obj_set_scroll_dir(obj, LV_DIR_VER);
+
+    LV_TRACE_OBJ_CREATE("finished");
+}
+
+static void lv_recycler_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+
+    /*The items are already deleted*/
+    if(recycler->items) lv_free(recycler->items);
+    recycler->items = NULL;
+    lv_fenwick_deinit(&recycler->item_h_tree);
+}
+
+static void lv_recycler_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    lv_result_t res;
+
+    /*Call the ancestor's event handler*/
+    res = lv_obj_event_base(MY_CLASS, e);
+    if(res != LV_RESULT_OK) return;
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_current_target(e);
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+
+    if(code == LV_EVENT_SCROLL || code == LV_EVENT_SIZE_CHANGED || code == LV_EVENT_STYLE_CHANGED) {
+        refr_items(obj);
+    }
+    else if(code == LV_EVENT_SCROLL_END) {
+        if(recycler->scroll_target != LV_RECYCLER_INDEX_NONE) scroll_to_target(obj);
+    }
+    else if(code == LV_EVENT_GET_SELF_SIZE) {
+        lv_point_t * p = lv_event_get_param(e);
+        if(recycler->item_cnt > 0) {
+            int32_t gap = lv_obj_get_style_pad_row(obj, LV_PART_MAIN);
+            p->y = LV_MAX(p->y, get_item_y(recycler, recycler->item_cnt, gap) - gap);
+        }
+    }
+}
+
+/* Bind items to the visible data items, position them and measure their height */
+static void refr_items(lv_obj_t * obj)
+{
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+    if(recycler->refreshing) return;
+
+    if(recycler->create_cb == NULL || recycler->bind_cb == NULL || recycler->item_cnt == 0) {
+        release_items(recycler, LV_RECYCLER_INDEX_NONE, LV_RECYCLER_INDEX_NONE);
+        recycler->first_index = LV_RECYCLER_INDEX_NONE;
+        recycler->last_index = LV_RECYCLER_INDEX_NONE;
+        return;
+    }
+
+    recycler->refreshing = 1;
+
+    /*The items might wrap differently on a new width*/
+    int32_t w = lv_obj_get_content_width(obj);
+    if(w != recycler->measured_width) {
+        recycler->measured_width = w;
+        reset_item_heights(recycler);
+    }
+
+    bool changed = false;
+    if(recycler->item_h_est == 0) {
+        /*Use the first data item as estimation for all the others*/
+        lv_obj_t * item = get_bound_item(obj, 0);
+        if(item) {
+            lv_obj_set_y(item, 0);
+            while(update_item_layout(item));
+            recycler->item_h_est = LV_MAX(lv_obj_get_height(item), 1);
+            changed = true;
+        }
+    }
+
+    int32_t gap = lv_obj_get_style_pad_row(obj, LV_PART_MAIN);
+    int32_t y1 = lv_obj_get_scroll_y(obj) - lv_obj_get_style_space_top(obj, LV_PART_MAIN);
+    int32_t y2 = y1 + lv_obj_get_height(obj) - 1;
+    int32_t item_y;
+    int32_t tmp;
+    uint32_t first = find_item(recycler, y1, gap, &item_y);
+    uint32_t last = find_item(recycler, y2, gap, &tmp);
+
+    /*Free the items which are surely not visible to reuse them*/
+    if(first < recycler->item_cnt) release_items(recycler, first, last);
+    else release_items(recycler, LV_RECYCLER_INDEX_NONE, LV_RECYCLER_INDEX_NONE);
+
+    uint32_t i;
+    for(i = first; i < recycler->item_cnt && item_y <= y2; i++) {
+        lv_obj_t * item = get_bound_item(obj, i);
+        if(item == NULL) break;
+
+        lv_obj_set_y(item, item_y);
+        while(update_item_layout(item));
+
+        int32_t h = lv_obj_get_height(item);
+        int32_t diff = h - get_item_h(recycler, i);
+        if(diff != 0) {
+            lv_fenwick_add(&recycler->item_h_tree, i, diff);
+            changed = true;
+
+            /*Keep the previously first visible data item in place if the items above it have changed*/
+            if(recycler->first_index != LV_RECYCLER_INDEX_NONE && i < recycler->first_index) {
+                lv_obj_scroll_by_raw(obj, 0, -diff);
+                y1 += diff;
+                y2 += diff;
+            }
+        }
+        item_y += h + gap;
+    }
+
+    if(i > first && first < recycler->item_cnt) {
+        last = i - 1;
+        release_items(recycler, first, last);
+        recycler->first_index = first;
+        recycler->last_index = last;
+    }
+    else {
+        release_items(recycler, LV_RECYCLER_INDEX_NONE, LV_RECYCLER_INDEX_NONE);
+        recycler->first_index = LV_RECYCLER_INDEX_NONE;
+        recycler->last_index = LV_RECYCLER_INDEX_NONE;
+    }
+
+    recycler->refreshing = 0;
+
+    if(changed) {
+        lv_obj_refresh_self_size(obj);
+        lv_obj_invalidate(obj);
+    }
+}
+
+/* Get the item which shows a data item. Reuse a free item or create a new one if needed. */
+static lv_obj_t * get_bound_item(lv_obj_t * obj, uint32_t index)
+{
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+    lv_recycler_item_t * free_item = NULL;
+    uint32_t i;
+    for(i = 0; i < recycler->item_obj_cnt; i++) {
+        if(recycler->items[i].index == index) return recycler->items[i].obj;
+        if(free_item == NULL && recycler->items[i].index == LV_RECYCLER_INDEX_NONE) free_item = &recycler->items[i];
+    }
+
+    if(free_item == NULL) {
+        lv_obj_t * item_obj = recycler->create_cb(obj);
+        if(item_obj == NULL) return NULL;
+        LV_ASSERT_MSG(lv_obj_get_parent(item_obj) == obj, "The items must be created on the Recycler");
+
+        lv_recycler_item_t * items = lv_realloc(recycler->items, (recycler->item_obj_cnt + 1) * sizeof(recycler->items[0]));
+        LV_ASSERT_MALLOC(items);
+        if(items == NULL) {
+            lv_obj_delete(item_obj);
+            return NULL;
+        }
+
+        recycler->items = items;
+        free_item = &recycler->items[recycler->item_obj_cnt];
+        free_item->obj = item_obj;
+        recycler->item_obj_cnt++;
+        lv_obj_add_event_cb(item_obj, item_delete_event_cb, LV_EVENT_DELETE, NULL);
+    }
+
+    free_item->index = index;
+    lv_obj_remove_flag(free_item->obj, LV_OBJ_FLAG_HIDDEN);
+    recycler->bind_cb(obj, free_item->obj, index);
+
+    return free_item->obj;
+}
+
+/* Hide the items of the data items outside of [first, last] to reuse them later */
+static void release_items(lv_recycler_t * recycler, uint32_t first, uint32_t last)
+{
+    uint32_t i;
+    for(i = 0; i < recycler->item_obj_cnt; i++) {
+        lv_recycler_item_t * item = &recycler->items[i];
+        if(item->index == LV_RECYCLER_INDEX_NONE) continue;
+        if(first != LV_RECYCLER_INDEX_NONE && item->index >= first && item->index <= last) continue;
+
+        item->index = LV_RECYCLER_INDEX_NONE;
+        lv_obj_add_flag(item->obj, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+/* Update the size and position of an item and its children like the screen's layout update does,
+ * but only for the item. It works during the layout update of the screen too.
+ * Return true if something was updated. */
+static bool update_item_layout(lv_obj_t * item)
+{
+    bool updated = false;
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_count(item);
+    for(i = 0; i < child_cnt; i++) {
+        if(update_item_layout(item->spec_attr->children[i])) updated = true;
+    }
+
+    if(item->layout_inv) {
+        item->layout_inv = 0;
+        lv_obj_refr_size(item);
+        lv_obj_refr_pos(item);
+        if(child_cnt > 0) lv_layout_apply(item);
+        updated = true;
+    }
+
+    return updated;
+}
+
+static void item_delete_event_cb(lv_event_t * e)
+{
+    lv_obj_t * item = lv_event_get_current_target(e);
+    lv_obj_t * obj = lv_obj_get_parent(item);
+    if(obj == NULL || obj->is_deleting) return;
+
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+    uint32_t i;
+    for(i = 0; i < recycler->item_obj_cnt; i++) {
+        if(recycler->items[i].obj == item) {
+            recycler->items[i] = recycler->items[recycler->item_obj_cnt - 1];
+            recycler->item_obj_cnt--;
+            return;
+        }
+    }
+}
+
+/* Scroll the target data item to the top. The heights are measured while scrolling,
+ * so scroll again until the item stays in place. */
+static void scroll_to_target(lv_obj_t * obj)
+{
+    lv_recycler_t * recycler = (lv_recycler_t *)obj;
+    uint32_t index = recycler->scroll_target;
+    recycler->scroll_target = LV_RECYCLER_INDEX_NONE;
+    if(index >= recycler->item_cnt) return;
+
+    int32_t gap = lv_obj_get_style_pad_row(obj, LV_PART_MAIN);
+    uint32_t i;
+    for(i = 0; i < 8; i++) {
+        int32_t scroll_y = lv_obj_get_scroll_y(obj);
+        int32_t y = get_item_y(recycler, index, gap);
+        if(y == scroll_y) break;
+
+        lv_obj_scroll_to_y(obj, y, LV_ANIM_OFF);
+
+        /*The end of the list is reached*/
+        if(lv_obj_get_scroll_y(obj) == scroll_y) break;
+    }
+}
+
+static void reset_item_heights(lv_recycler_t * recycler)
+{
+    lv_fenwick_clear(&recycler->item_h_tree);
+    if(recycler->item_h_est_auto) recycler->item_h_est = 0;
+}
+
+/* Get the y coordinate of the top of a data item relative to the first data item */
+static int32_t get_item_y(lv_recycler_t * recycler, uint32_t index, int32_t gap)
+{
+    return (int32_t)index * (recycler->item_h_est + gap) + lv_fenwick_get_sum(&recycler->item_h_tree, index);
+}
+
+static int32_t get_item_h(lv_recycler_t * recycler, uint32_t index)
+{
+    return recycler->item_h_est + lv_fenwick_get(&recycler->item_h_tree, index);
+}
+
+/* Find the data item at a y coordinate relative to the first data item and store the top of it in `item_y`.
+ * Return `item_cnt` if `y` is below the last data item. */
+static uint32_t find_item(lv_recycler_t * recycler, int32_t y, int32_t gap, int32_t * item_y)
+{
+    return lv_fenwick_find(&recycler->item_h_tree, recycler->item_h_est + gap, y, item_y);
+}
+
+#endif
@@ -0,0 +1,160 @@
+/**
+ * @file lv_recycler.h
+ *
+ */
+
+#ifndef LV_RECYCLER_H
+#define LV_RECYCLER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../core/lv_obj.h"
+
+#if LV_USE_RECYCLER
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_RECYCLER_INDEX_NONE 0xFFFFFFFF
+LV_EXPORT_CONST_INT(LV_RECYCLER_INDEX_NONE);
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Create an item which can show any of the data items
+ * @param obj       pointer to a Recycler
+ * @return          the new item. It must be created on `obj`.
+ */
+typedef lv_obj_t * (*lv_recycler_create_cb_t)(lv_obj_t * obj);
+
+/**
+ * Show a data item on an item. The item might have shown an other data item before.
+ * @param obj       pointer to a Recycler
+ * @param item      an item created by the create callback
+ * @param index     index of the data item to show
+ */
+typedef void (*lv_recycler_bind_cb_t)(lv_obj_t * obj, lv_obj_t * item, uint32_t index);
+
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_recycler_class;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a Recycler: a vertically scrollable container which shows a lot of data items
+ * by creating only as many items as visible and binding them to new data items on scroll.
+ * @param parent    pointer to an object, it will be the parent of the new Recycler
+ * @return          pointer to the created Recycler
+ */
+lv_obj_t * lv_recycler_create(lv_obj_t * parent);
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+/**
+ * Set the callbacks which create the items and show the data items on them
+ * @param obj           pointer to a Recycler
+ * @param create_cb     called when a new item is needed
+ * @param bind_cb       called to show a data item on an item
+ */
+void lv_recycler_set_item_cb(lv_obj_t * obj, lv_recycler_create_cb_t create_cb, lv_recycler_bind_cb_t bind_cb);
+
+/**
+ * Set the number of data items. The height of the existing data items is kept,
+ * so new data items can be added to the end of infinite lists.
+ * @param obj       pointer to a Recycler
+ * @param cnt       number of data items
+ */
+void lv_recycler_set_item_count(lv_obj_t * obj, uint32_t cnt);
+
+/**
+ * Set the estimated height of the data items which were not visible yet.
+ * @param obj       pointer to a Recycler
+ * @param h         the estimated height or 0 to use the height of the first data item
+ */
+void lv_recycler_set_item_height(lv_obj_t * obj, int32_t h);
+
+/**
+ * Tell the Recycler that some data items have changed. They are bound and measured again when they are visible.
+ * @param obj       pointer to a Recycler
+ * @param index     index of the first changed data item
+ * @param cnt       number of changed data items
+ */
+void lv_recycler_refresh_items(lv_obj_t * obj, uint32_t index, uint32_t cnt);
+
+/**
+ * Scroll to a data item to show it at the top
+ * @param obj       pointer to a Recycler
+ * @param index     index of the data item
+ * @param anim_en   LV_ANIM_ON: scroll with animation; LV_ANIM_OFF: scroll immediately
+ */
+void lv_recycler_scroll_to_item(lv_obj_t * obj, uint32_t index, lv_anim_enable_t anim_en);
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+/**
+ * Get the number of data items
+ * @param obj       pointer to a Recycler
+ * @return          number of data items
+ */
+uint32_t lv_recycler_get_item_count(lv_obj_t * obj);
+
+/**
+ * Get the estimated height of the data items which were not visible yet
+ * @param obj       pointer to a Recycler
+ * @return          the estimated height
+ */
+int32_t lv_recycler_get_item_height(lv_obj_t * obj);
+
+/**
+ * Get the item which shows a data item
+ * @param obj       pointer to a Recycler
+ * @param index     index of a data item
+ * @return          the item or `NULL` if the data item is not visible
+ */
+lv_obj_t * lv_recycler_get_item(lv_obj_t * obj, uint32_t index);
+
+/**
+ * Get the index of the data item shown on an item
+ * @param obj       pointer to a Recycler
+ * @param item      an item of the Recycler
+ * @return          index of the data item or `LV_RECYCLER_INDEX_NONE` if the item is not used
+ */
+uint32_t lv_recycler_get_item_index(lv_obj_t * obj, lv_obj_t * item);
+
+/**
+ * Get the index of the first visible data item
+ * @param obj       pointer to a Recycler
+ * @return          index of the data item or `LV_RECYCLER_INDEX_NONE` if there are no visible data items
+ */
+uint32_t lv_recycler_get_first_visible_index(lv_obj_t * obj);
+
+/**
+ * Get the index of the last visible data item
+ * @param obj       pointer to a Recycler
+ * @return          index of the data item or `LV_RECYCLER_INDEX_NONE` if there are no visible data items
+ */
+uint32_t lv_recycler_get_last_visible_index(lv_obj_t * obj);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_RECYCLER*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_RECYCLER_H*/
@@ -0,0 +1,70 @@
+/**
+ * @file lv_recycler_private.h
+ *
+ */
+
+#ifndef LV_RECYCLER_PRIVATE_H
+#define LV_RECYCLER_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../core/lv_obj_private.h"
+#include "../../misc/lv_fenwick.h"
+#include "lv_recycler.h"
+
+#if LV_USE_RECYCLER
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** An item created by the create callback */
+typedef struct {
+    lv_obj_t * obj;
+    uint32_t index;         /**< The shown data item or `LV_RECYCLER_INDEX_NONE` if the item is free*/
+} lv_recycler_item_t;
+
+/** Data of Recycler */
+struct _lv_recycler_t {
+    lv_obj_t obj;
+    lv_recycler_create_cb_t create_cb;
+    lv_recycler_bind_cb_t bind_cb;
+    lv_recycler_item_t * items;     /**< The created items*/
+    uint32_t item_obj_cnt;          /**< Number of the created items*/
+    uint32_t item_cnt;              /**< Number of the data items*/
+    lv_fenwick_t item_h_tree;       /**< Fenwick tree of the data items' height difference from `item_h_est`*/
+    int32_t item_h_est;             /**< Height of the data items which are not measured yet. 0: not known yet*/
+    int32_t measured_width;         /**< The content width the data items were measured with*/
+    uint32_t first_index;           /**< The first visible data item*/
+    uint32_t last_index;            /**< The last visible data item*/
+    uint32_t scroll_target;         /**< Scroll to this data item again when the scroll animation ends*/
+    uint8_t item_h_est_auto : 1;    /**< 1: use the height of the first data item as estimation*/
+    uint8_t refreshing : 1;         /**< 1: the items are being refreshed*/
+};
+
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_RECYCLER */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_RECYCLER_PRIVATE_H*/
@@ -75,6 +75,9 @@ static uint32_t lv_get_snippet_count(void);
 static void lv_snippet_push(lv_snippet_t * item);
 static lv_snippet_t * lv_get_snippet(uint32_t index);
 static int32_t convert_indent_pct(lv_obj_t * spans, int32_t width);
+static void layout_update(lv_obj_t * obj, int32_t width);
+static lv_span_fragment_t * layout_add_fragment(lv_span_layout_t * layout);
+static lv_span_line_t * layout_add_line(lv_span_layout_t * layout);
 
 static lv_span_coords_t make_span_coords(const lv_span_t * prev_span, const lv_span_t * curr_span, int32_t width,
                                          lv_area_t padding, int32_t indent);
@@ -201,6 +204,7 @@ void lv_span_set_text(lv_span_t * span, const char * text)
     if(span->txt == NULL) return;
 
     span->static_flag = 0;
+    span->txt_changed = 1;
 
 #if LV_USE_ARABIC_PERSIAN_CHARS
     lv_text_ap_proc(text, span->txt);
@@ -231,6 +235,7 @@ void lv_span_set_text_fmt(lv_span_t * span, const char * fmt, ...)
     }
 
     span->static_flag = 0;
+    span->txt_changed = 1;
     span->txt = text;
 }
 
@@ -252,6 +257,7 @@ void lv_span_set_text_static(lv_span_t * span, const char * text)
         span->txt = NULL;
     }
     span->static_flag = 1;
+    span->txt_changed = 1;
 
 #if LV_USE_ARABIC_PERSIAN_CHARS
     size_t text_alloc_len = lv_text_ap_calc_bytes_count(text);
@@ -292,6 +298,7 @@ void lv_spangroup_set_span_text_fmt(lv_obj_t * obj, lv_span_t * span, const char
     }
 
     span->static_flag = 0;
+    span->txt_changed = 1;
     span->txt = text;
 
     lv_spangroup_refresh(obj);
@@ -545,118 +552,19 @@ int32_t lv_spangroup_get_expand_height(lv_obj_t * obj, int32_t width)
         return 0;
     }
 
-    /* init draw variable */
-    lv_text_flag_t txt_flag = LV_TEXT_FLAG_NONE;
-    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
-    int32_t max_width = width;
-    int32_t indent = convert_indent_pct(obj, max_width);
-    int32_t max_w  = max_width - indent; /* first line need minus indent */
-
-    /* coords of draw span-txt */
-    lv_point_t txt_pos;
-    lv_point_set(&txt_pos, indent, 0); /* first line need add indent */
-
-    lv_span_t * cur_span = lv_ll_get_head(&spans->child_ll);
-    const char * cur_txt = cur_span->txt;
-    span_text_check(&cur_txt);
-    uint32_t cur_txt_ofs = 0;
-    lv_snippet_t snippet;   /* use to save cur_span info and push it to stack */
-    lv_memset(&snippet, 0, sizeof(snippet));
-
-    lv_span_t * prev_span = cur_span;
-    int32_t line_cnt = 0;
-    int32_t lines = spans->lines < 0 ? INT32_MAX : spans->lines;
-    /* the loop control how many lines need to draw */
-    while(cur_span) {
-        int snippet_cnt = 0;
-        int32_t max_line_h = 0;  /* the max height of span-font when a line have a lot of span */
-
-        /* the loop control to find a line and push the relevant span info into stack  */
-        while(1) {
-            /* switch to the next span when current is end */
-            if(cur_txt[cur_txt_ofs] == '\0') {
-                cur_span->trailing_pos = txt_pos;
-
-                cur_span = lv_ll_get_next(&spans->child_ll, cur_span);
-                if(cur_span == NULL) break;
-                cur_txt = cur_span->txt;
-                span_text_check(&cur_txt);
-                cur_txt_ofs = 0;
-                /* maybe also cur_txt[cur_txt_ofs] == '\0' */
-                continue;
-            }
-
-            /* init span info to snippet. */
-            if(cur_txt_ofs == 0) {
-                snippet.span = cur_span;
-                snippet.font = lv_span_get_style_text_font(obj, cur_span);
-                snippet.letter_space = lv_span_get_style_text_letter_space(obj, cur_span);
-                snippet.line_h = lv_font_get_line_height(snippet.font) + line_space;
-            }
-
-            /* get current span text line info */
-            uint32_t next_ofs = 0;
-            int32_t use_width = 0;
-            bool isfill = lv_text_get_snippet(&cur_txt[cur_txt_ofs], snippet.font, snippet.letter_space,
-                                              max_w, txt_flag, &use_width, &next_ofs);
-            if(isfill) txt_pos.x = 0;
-            else txt_pos.x += use_width;
-
-            /* break word deal width */
-            if(isfill && next_ofs > 0 && snippet_cnt > 0) {
-                int32_t drawn_width = use_width;
-                if(lv_ll_get_next(&spans->child_ll, cur_span) == NULL) {
-                    drawn_width -= snippet.letter_space;
-                }
-                if(max_w < drawn_width) {
-                    break;
-                }
-
-                uint32_t tmp_ofs = next_ofs;
-                uint32_t letter = lv_text_encoded_prev(&cur_txt[cur_txt_ofs], &tmp_ofs);
-                uint32_t letter_next = lv_text_encoded_next(&cur_txt[cur_txt_ofs + next_ofs], NULL);
-                if(!(letter == '\0' || letter == '\n' || letter == '\r' || lv_text_is_break_char(letter) ||
-                     lv_text_is_a_word(letter) || lv_text_is_a_word(letter_next))) {
-                    if(!(letter_next == '\0' || letter_next == '\n'  || letter_next == '\r' || lv_text_is_break_char(letter_next))) {
-                        break;
-                    }
-                }
-            }
-
-            snippet.txt = &cur_txt[cur_txt_ofs];
-            snippet.bytes = next_ofs;
-            snippet.txt_w = use_width;
-            cur_txt_ofs += next_ofs;
-            if(max_line_h < snippet.line_h) {
-                max_line_h = snippet.line_h;
-            }
-            snippet_cnt ++;
-            max_w = max_w - use_width;
-            if(isfill  || max_w <= 0) {
-                break;
-            }
-        }
-
-        /* next line init */
-        txt_pos.y += max_line_h;
-
-        /* iterate all the spans in the current line and set the trailing height to the max line height */
-        for(lv_span_t * tmp_span = prev_span;
-            tmp_span && tmp_span != cur_span;
-            tmp_span = lv_ll_get_next(&spans->child_ll, tmp_span))
-            tmp_span->trailing_height = max_line_h;
+    layout_update(obj, width);
 
-        prev_span = cur_span;
+    const lv_span_layout_t * layout = &spans->layout;
+    uint32_t line_cnt = layout->line_cnt;
+    if(spans->lines >= 0) line_cnt = LV_MIN(line_cnt, (uint32_t)LV_MAX(spans->lines, 1));
 
-        max_w = max_width;
-        line_cnt += 1;
-        if(line_cnt >= lines) {
-            break;
-        }
+    int32_t height = 0;
+    uint32_t i;
+    for(i = 0; i < line_cnt; i++) {
+        height += layout->lines[i].line_h;
     }
-    txt_pos.y -= line_space;
 
-    return txt_pos.y;
+    return height - lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
 }
 
 lv_span_coords_t lv_spangroup_get_span_coords(lv_obj_t * obj, const lv_span_t * span)
@@ -675,6 +583,9 @@ lv_span_coords_t lv_spangroup_get_span_coords(lv_obj_t * obj, const lv_span_t *
         0
     };
 
+    /* the trailing position and height of the spans are set by the layout */
+    layout_update(obj, width);
+
     lv_span_t * prev_span = NULL;
     lv_span_t * curr_span;
     LV_LL_READ(spans, curr_span) {
@@ -704,6 +615,9 @@ lv_span_t * lv_spangroup_get_span_by_point(lv_obj_t * obj, const lv_point_t * p)
     point.x = p->x - obj->coords.x1;
     point.y = p->y - obj->coords.y1;
 
+    /* the trailing position and height of the spans are set by the layout */
+    layout_update(obj, width);
+
     /* find previous span */
 
     const lv_span_t * prev_span = NULL;
@@ -735,6 +649,7 @@ void lv_spangroup_refresh(lv_obj_t * obj)
 {
     lv_spangroup_t * spans = (lv_spangroup_t *)obj;
     spans->refresh = 1;
+    spans->layout.valid = 0;
     lv_obj_invalidate(obj);
     lv_obj_refresh_self_size(obj);
 }
@@ -819,6 +734,9 @@ static void lv_spangroup_destructor(const lv_obj_class_t * class_p, lv_obj_t * o
         lv_free(cur_span);
         cur_span = lv_ll_get_head(&spans->child_ll);
     }
+
+    lv_free(spans->layout.lines);
+    lv_free(spans->layout.fragments);
 }
 
 static void lv_spangroup_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -839,7 +757,10 @@ static void lv_spangroup_event(const lv_obj_class_t * class_p, lv_event_t * e)
         lv_spangroup_refresh(obj);
     }
     else if(code == LV_EVENT_SIZE_CHANGED) {
-        lv_spangroup_refresh(obj);
+        /*Keep the layout as it's updated anyway if the width has changed*/
+        spans->refresh = 1;
+        lv_obj_invalidate(obj);
+        lv_obj_refresh_self_size(obj);
     }
     else if(code == LV_EVENT_GET_SELF_SIZE) {
         int32_t width = 0;
@@ -1041,6 +962,186 @@ static int32_t convert_indent_pct(lv_obj_t * obj, int32_t width)
     return indent;
 }
 
+/**
+ * Break the texts of the spans to lines and fragments unless the previous layout is still valid.
+ * Also update the trailing position and height of the spans.
+ * @param obj       pointer to a spangroup
+ * @param width     the width to break the lines at
+ */
+static void layout_update(lv_obj_t * obj, int32_t width)
+{
+    lv_spangroup_t * spans = (lv_spangroup_t *)obj;
+    lv_span_layout_t * layout = &spans->layout;
+
+    /*The texts can be changed without notifying the spangroup*/
+    bool txt_changed = false;
+    lv_span_t * cur_span;
+    LV_LL_READ(&spans->child_ll, cur_span) {
+        if(cur_span->txt_changed) {
+            txt_changed = true;
+            cur_span->txt_changed = 0;
+        }
+    }
+
+    if(layout->valid && layout->width == width && !txt_changed) return;
+
+    layout->valid = 1;
+    layout->width = width;
+    layout->line_cnt = 0;
+    layout->fragment_cnt = 0;
+
+    cur_span = lv_ll_get_head(&spans->child_ll);
+    if(cur_span == NULL || width <= 0) return;
+
+    lv_text_flag_t txt_flag = LV_TEXT_FLAG_NONE;
+    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+    int32_t indent = convert_indent_pct(obj, width);
+    int32_t max_w  = width - indent; /* first line need minus indent */
+
+    /* coords of the span-txt's end */
+    lv_point_t txt_pos;
+    lv_point_set(&txt_pos, indent, 0); /* first line need add indent */
+
+    const char * cur_txt = cur_span->txt;
+    span_text_check(&cur_txt);
+    uint32_t cur_txt_ofs = 0;
+    lv_span_fragment_t fragment;   /* use to save cur_span info and add it to the layout */
+    lv_memzero(&fragment, sizeof(fragment));
+
+    lv_span_t * prev_span = cur_span;
+    /* the loop control how many lines are there */
+    while(cur_span) {
+        uint32_t fragment_start = layout->fragment_cnt;
+        int32_t max_line_h = 0;  /* the max height of span-font when a line have a lot of span */
+        int32_t max_baseline = 0; /*baseline of the highest span*/
+
+        /* the loop control to find a line and add the relevant span info to the layout */
+        while(1) {
+            /* switch to the next span when current is end */
+            if(cur_txt[cur_txt_ofs] == '\0') {
+                cur_span->trailing_pos = txt_pos;
+
+                cur_span = lv_ll_get_next(&spans->child_ll, cur_span);
+                if(cur_span == NULL) break;
+                cur_txt = cur_span->txt;
+                span_text_check(&cur_txt);
+                cur_txt_ofs = 0;
+                /* maybe also cur_txt[cur_txt_ofs] == '\0' */
+                continue;
+            }
+
+            /* init span info to fragment. */
+            if(cur_txt_ofs == 0) {
+                fragment.span = cur_span;
+                fragment.font = lv_span_get_style_text_font(obj, cur_span);
+                fragment.letter_space = lv_span_get_style_text_letter_space(obj, cur_span);
+                fragment.line_h = lv_font_get_line_height(fragment.font) + line_space;
+            }
+
+            /* get current span text line info */
+            uint32_t next_ofs = 0;
+            int32_t use_width = 0;
+            bool isfill = lv_text_get_snippet(&cur_txt[cur_txt_ofs], fragment.font, fragment.letter_space,
+                                              max_w, txt_flag, &use_width, &next_ofs);
+            if(isfill) txt_pos.x = 0;
+            else txt_pos.x += use_width;
+
+            /* break word deal width */
+            if(isfill && next_ofs > 0 && layout->fragment_cnt > fragment_start) {
+                int32_t drawn_width = use_width;
+                if(lv_ll_get_next(&spans->child_ll, cur_span) == NULL) {
+                    drawn_width -= fragment.letter_space;
+                }
+                /* To prevent infinite loops, the lv_text_get_next_line() may return incomplete words, */
+                /* This phenomenon should be avoided when the line has fragments already */
+                if(max_w < drawn_width) {
+                    break;
+                }
+
+                uint32_t tmp_ofs = next_ofs;
+                uint32_t letter = lv_text_encoded_prev(&cur_txt[cur_txt_ofs], &tmp_ofs);
+                uint32_t letter_next = lv_text_encoded_next(&cur_txt[cur_txt_ofs + next_ofs], NULL);
+                if(!(letter == '\0' || letter == '\n' || letter == '\r' || lv_text_is_break_char(letter) ||
+                     lv_text_is_a_word(letter) || lv_text_is_a_word(letter_next))) {
+                    if(!(letter_next == '\0' || letter_next == '\n'  || letter_next == '\r' || lv_text_is_break_char(letter_next))) {
+                        break;
+                    }
+                }
+            }
+
+            fragment.txt_ofs = cur_txt_ofs;
+            fragment.bytes = next_ofs;
+            fragment.txt_w = use_width;
+            cur_txt_ofs += next_ofs;
+            if(max_line_h < fragment.line_h) {
+                max_line_h = fragment.line_h;
+                max_baseline = fragment.font->base_line;
+            }
+
+            lv_span_fragment_t * new_fragment = layout_add_fragment(layout);
+            if(new_fragment == NULL) return;
+            *new_fragment = fragment;
+
+            max_w = max_w - use_width;
+            if(isfill  || max_w <= 0) {
+                break;
+            }
+        }
+
+        if(layout->fragment_cnt > fragment_start) {
+            lv_span_line_t * line = layout_add_line(layout);
+            if(line == NULL) return;
+            line->fragment_start = fragment_start;
+            line->fragment_cnt = layout->fragment_cnt - fragment_start;
+            line->line_h = max_line_h;
+            line->base_line = max_baseline;
+        }
+
+        /* next line init */
+        txt_pos.y += max_line_h;
+
+        /* iterate all the spans in the current line and set the trailing height to the max line height */
+        for(lv_span_t * tmp_span = prev_span;
+            tmp_span && tmp_span != cur_span;
+            tmp_span = lv_ll_get_next(&spans->child_ll, tmp_span))
+            tmp_span->trailing_height = max_line_h;
+
+        prev_span = cur_span;
+
+        max_w = width;
+    }
+}
+
+static lv_span_fragment_t * layout_add_fragment(lv_span_layout_t * layout)
+{
+    if(layout->fragment_cnt == layout->fragment_size) {
+        uint32_t new_size = layout->fragment_size ? layout->fragment_size * 2 : 8;
+        lv_span_fragment_t * fragments = lv_realloc(layout->fragments, new_size * sizeof(lv_span_fragment_t));
+        LV_ASSERT_MALLOC(fragments);
+        if(fragments == NULL) return NULL;
+
+        layout->fragments = fragments;
+        layout->fragment_size = new_size;
+    }
+
+    return &layout->fragments[layout->fragment_cnt++];
+}
+
+static lv_span_line_t * layout_add_line(lv_span_layout_t * layout)
+{
+    if(layout->line_cnt == layout->line_size) {
+        uint32_t new_size = layout->line_size ? layout->line_size * 2 : 4;
+        lv_span_line_t * lines = lv_realloc(layout->lines, new_size * sizeof(lv_span_line_t));
+        LV_ASSERT_MALLOC(lines);
+        if(lines == NULL) return NULL;
+
+        layout->lines = lines;
+        layout->line_size = new_size;
+    }
+
+    return &layout->lines[layout->line_cnt++];
+}
+
 /**
  * draw span group
  * @param spans obj handle
@@ -1067,11 +1168,9 @@ static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
     layer->_clip_area = clip_area;
 
     /* init draw variable */
-    lv_text_flag_t txt_flag = LV_TEXT_FLAG_NONE;
     int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
     int32_t max_width = lv_area_get_width(&coords);
     int32_t indent = convert_indent_pct(obj, max_width);
-    int32_t max_w  = max_width - indent; /* first line need minus indent */
     lv_opa_t obj_opa = lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN);
 
     /* coords of draw span-txt */
@@ -1079,12 +1178,12 @@ static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
     txt_pos.y = coords.y1;
     txt_pos.x = coords.x1 + indent; /* first line need add indent */
 
+    lv_text_align_t align = lv_obj_get_style_text_align(obj, LV_PART_MAIN);
+#if LV_USE_BIDI
     lv_span_t * cur_span = lv_ll_get_head(&spans->child_ll);
     const char * cur_txt = cur_span->txt;
     span_text_check(&cur_txt);
 
-    lv_text_align_t align = lv_obj_get_style_text_align(obj, LV_PART_MAIN);
-#if LV_USE_BIDI
     lv_base_dir_t base_dir = lv_obj_get_style_base_dir(obj, LV_PART_MAIN);
     if(base_dir == LV_BASE_DIR_AUTO) {
         base_dir = lv_bidi_detect_base_dir(cur_txt) == LV_BASE_DIR_RTL ? LV_BASE_DIR_RTL : LV_BASE_DIR_AUTO;
@@ -1100,90 +1199,42 @@ static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
             base_dir = lv_bidi_detect_base_dir(cur_txt) == LV_BASE_DIR_RTL ? LV_BASE_DIR_RTL : LV_BASE_DIR_AUTO;
         }
     }
-    cur_span = lv_ll_get_head(&spans->child_ll);
-    cur_txt = cur_span->txt;
 #endif
 
-    uint32_t cur_txt_ofs = 0;
-    lv_snippet_t snippet;   /* use to save cur_span info and push it to stack */
-    lv_memzero(&snippet, sizeof(snippet));
+    /* the lines are broken only if the texts, the styles or the width have changed */
+    layout_update(obj, max_width);
+    const lv_span_layout_t * layout = &spans->layout;
 
     lv_draw_label_dsc_t label_draw_dsc;
     lv_draw_label_dsc_init(&label_draw_dsc);
 
     bool is_first_line = true;
+    uint32_t line_idx;
     /* the loop control how many lines need to draw */
-    while(cur_span) {
+    for(line_idx = 0; line_idx < layout->line_cnt; line_idx++) {
+        const lv_span_line_t * line = &layout->lines[line_idx];
         bool is_end_line = false;
         bool ellipsis_valid = false;
-        int32_t max_line_h = 0;  /* the max height of span-font when a line have a lot of span */
-        int32_t max_baseline = 0; /*baseline of the highest span*/
+        int32_t max_line_h = line->line_h;  /* the max height of span-font when a line have a lot of span */
+        int32_t max_baseline = line->base_line; /*baseline of the highest span*/
         lv_snippet_clear();
 
-        /* the loop control to find a line and push the relevant span info into stack  */
-        while(1) {
-            /* switch to the next span when current is end */
-            if(cur_txt[cur_txt_ofs] == '\0') {
-                cur_span = lv_ll_get_next(&spans->child_ll, cur_span);
-                if(cur_span == NULL) break;
-                cur_txt = cur_span->txt;
-                span_text_check(&cur_txt);
-                cur_txt_ofs = 0;
-                /* maybe also cur_txt[cur_txt_ofs] == '\0' */
-                continue;
-            }
-
-            /* init span info to snippet. */
-            if(cur_txt_ofs == 0) {
-                snippet.span = cur_span;
-                snippet.font = lv_span_get_style_text_font(obj, cur_span);
-                snippet.letter_space = lv_span_get_style_text_letter_space(obj, cur_span);
-                snippet.line_h = lv_font_get_line_height(snippet.font) + line_space;
-            }
-
-            /* get current span text line info */
-            uint32_t next_ofs = 0;
-            int32_t use_width = 0;
-            bool isfill = lv_text_get_snippet(&cur_txt[cur_txt_ofs], snippet.font, snippet.letter_space,
-                                              max_w, txt_flag, &use_width, &next_ofs);
-
-            if(isfill) {
-                if(next_ofs > 0 && lv_get_snippet_count() > 0) {
-                    int32_t drawn_width = use_width;
-                    if(lv_ll_get_next(&spans->child_ll, cur_span) == NULL) {
-                        drawn_width -= snippet.letter_space;
-                    }
-                    /* To prevent infinite loops, the lv_text_get_next_line() may return incomplete words, */
-                    /* This phenomenon should be avoided when lv_get_snippet_count() > 0 */
-                    if(max_w < drawn_width) {
-                        break;
-                    }
-                    uint32_t tmp_ofs = next_ofs;
-                    uint32_t letter = lv_text_encoded_prev(&cur_txt[cur_txt_ofs], &tmp_ofs);
-                    uint32_t letter_next = lv_text_encoded_next(&cur_txt[cur_txt_ofs + next_ofs], NULL);
-                    if(!(letter == '\0' || letter == '\n' || letter == '\r' || lv_text_is_break_char(letter) ||
-                         lv_text_is_a_word(letter) || lv_text_is_a_word(letter_next))) {
-                        if(!(letter_next == '\0' || letter_next == '\n'  || letter_next == '\r' || lv_text_is_break_char(letter_next))) {
-                            break;
-                        }
-                    }
-                }
-            }
-
-            snippet.txt = &cur_txt[cur_txt_ofs];
-            snippet.bytes = next_ofs;
-            snippet.txt_w = use_width;
-            cur_txt_ofs += next_ofs;
-            if(max_line_h < snippet.line_h) {
-                max_line_h = snippet.line_h;
-                max_baseline = snippet.font->base_line;
-            }
-
+        /* push the fragments of the line to the stack as they might be modified for the ellipsis */
+        uint32_t i_fragment;
+        for(i_fragment = 0; i_fragment < line->fragment_cnt; i_fragment++) {
+            const lv_span_fragment_t * fragment = &layout->fragments[line->fragment_start + i_fragment];
+            const char * fragment_txt = fragment->span->txt;
+            span_text_check(&fragment_txt);
+
+            lv_snippet_t snippet;
+            snippet.span = fragment->span;
+            snippet.txt = &fragment_txt[fragment->txt_ofs];
+            snippet.font = fragment->font;
+            snippet.bytes = fragment->bytes;
+            snippet.txt_w = fragment->txt_w;
+            snippet.line_h = fragment->line_h;
+            snippet.letter_space = fragment->letter_space;
             lv_snippet_push(&snippet);
-            max_w = max_w - use_width;
-            if(isfill || max_w <= 0) {
-                break;
-            }
         }
 
         /* start current line deal with */
@@ -1405,7 +1456,6 @@ Next_line_init:
             layer->_clip_area = clip_area_ori;
             return;
         }
-        max_w = max_width;
     }
     layer->_clip_area = clip_area_ori;
 }
@@ -31,11 +31,43 @@ struct _lv_span_t {
     char * txt;                /**<  a pointer to display text */
     lv_style_t style;          /**<  display text style */
     uint32_t static_flag : 1;  /**<  the text is static flag */
+    uint32_t txt_changed : 1;  /**<  the text was set after the layout was calculated */
 
     lv_point_t trailing_pos;
     int32_t trailing_height;
 };
 
+/** The part of a span's text which is on one line*/
+typedef struct {
+    lv_span_t * span;
+    const lv_font_t * font;
+    uint32_t txt_ofs;       /**<  byte offset of the fragment in the span's text */
+    uint32_t bytes;         /**<  length of the fragment in bytes */
+    int32_t txt_w;
+    int32_t line_h;         /**<  line height of the font plus the line space */
+    int32_t letter_space;
+} lv_span_fragment_t;
+
+/** A line of the spangroup*/
+typedef struct {
+    uint32_t fragment_start;    /**<  index of the first fragment of the line */
+    uint32_t fragment_cnt;
+    int32_t line_h;             /**<  height of the tallest fragment */
+    int32_t base_line;          /**<  base line of the tallest fragment's font */
+} lv_span_line_t;
+
+/** The lines and fragments of the spans. Kept until the texts, the styles or the width change.*/
+typedef struct {
+    lv_span_line_t * lines;
+    lv_span_fragment_t * fragments;
+    uint32_t line_cnt;
+    uint32_t fragment_cnt;
+    uint32_t line_size;         /**<  number of allocated lines */
+    uint32_t fragment_size;     /**<  number of allocated fragments */
+    int32_t width;              /**<  the width the layout was calculated for */
+    uint32_t valid : 1;
+} lv_span_layout_t;
+
 /** Data of label*/
 struct _lv_spangroup_t {
     lv_obj_t obj;
@@ -46,6 +78,7 @@ struct _lv_spangroup_t {
     lv_ll_t  child_ll;
     uint32_t overflow : 1;  /**<  details see lv_span_overflow_t */
     uint32_t refresh : 1;   /**<  the spangroup need refresh cache_w and cache_h */
+    lv_span_layout_t layout;
 };
 
 
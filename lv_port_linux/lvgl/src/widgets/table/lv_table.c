@@ -10,6 +10,7 @@
 #include "../../misc/lv_area_private.h"
 #include "../../core/lv_obj_private.h"
 #include "../../core/lv_obj_class_private.h"
+#include "../../core/lv_obj_scroll_private.h"
 #if LV_USE_TABLE != 0
 
 #include "../../indev/lv_indev.h"
@@ -47,6 +48,11 @@ static size_t get_cell_txt_len(const char * txt);
 static void copy_cell_txt(lv_table_cell_t * dst, const char * txt);
 static void get_cell_area(lv_obj_t * obj, uint32_t row, uint32_t col, lv_area_t * area);
 static void scroll_to_selected_cell(lv_obj_t * obj);
+static int32_t get_row_y(lv_table_t * table, uint32_t row);
+static int32_t get_row_h(lv_table_t * table, uint32_t row);
+static uint32_t find_row(lv_table_t * table, int32_t y, int32_t * row_y);
+static void refr_virtual_rows(lv_obj_t * obj);
+static bool refr_row_styles(lv_obj_t * obj);
 
 static inline bool is_cell_empty(void * cell)
 {
@@ -94,6 +100,10 @@ void lv_table_set_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col, const c
     LV_ASSERT_NULL(txt);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_value_cb) {
+        LV_LOG_WARN("the cells of virtual tables can't be set");
+        return;
+    }
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
@@ -129,6 +139,10 @@ void lv_table_set_cell_value_fmt(lv_obj_t * obj, uint32_t row, uint32_t col, con
     LV_ASSERT_NULL(fmt);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_value_cb) {
+        LV_LOG_WARN("the cells of virtual tables can't be set");
+        return;
+    }
     if(col >= table->col_cnt) {
         lv_table_set_column_count(obj, col + 1);
     }
@@ -211,6 +225,18 @@ void lv_table_set_row_count(lv_obj_t * obj, uint32_t row_cnt)
     uint32_t old_row_cnt = table->row_cnt;
     table->row_cnt         = row_cnt;
 
+    if(table->cell_value_cb) {
+        if(!lv_fenwick_set_count(&table->row_h_tree, row_cnt)) {
+            table->row_cnt = 0;
+            return;
+        }
+
+        refr_virtual_rows(obj);
+        lv_obj_refresh_self_size(obj);
+        lv_obj_invalidate(obj);
+        return;
+    }
+
     table->row_h = lv_realloc(table->row_h, table->row_cnt * sizeof(table->row_h[0]));
     LV_ASSERT_MALLOC(table->row_h);
     if(table->row_h == NULL) return;
@@ -250,36 +276,39 @@ void lv_table_set_column_count(lv_obj_t * obj, uint32_t col_cnt)
     uint32_t old_col_cnt = table->col_cnt;
     table->col_cnt         = col_cnt;
 
-    lv_table_cell_t ** new_cell_data = lv_malloc(table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
-    LV_ASSERT_MALLOC(new_cell_data);
-    if(new_cell_data == NULL) return;
-    uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
-
-    lv_memzero(new_cell_data, new_cell_cnt * sizeof(table->cell_data[0]));
-
-    /*The new column(s) messes up the mapping of `cell_data`*/
-    uint32_t old_col_start;
-    uint32_t new_col_start;
-    uint32_t min_col_cnt = LV_MIN(old_col_cnt, col_cnt);
-    uint32_t row;
-    for(row = 0; row < table->row_cnt; row++) {
-        old_col_start = row * old_col_cnt;
-        new_col_start = row * col_cnt;
-
-        lv_memcpy(&new_cell_data[new_col_start], &table->cell_data[old_col_start],
-                  sizeof(new_cell_data[0]) * min_col_cnt);
-
-        /*Free the old cells (only if the table becomes smaller)*/
-        int32_t i;
-        for(i = 0; i < (int32_t)old_col_cnt - (int32_t)col_cnt; i++) {
-            uint32_t idx = old_col_start + min_col_cnt + i;
-            lv_free(table->cell_data[idx]);
-            table->cell_data[idx] = NULL;
+    /*Virtual tables don't store the cells*/
+    if(table->cell_value_cb == NULL) {
+        lv_table_cell_t ** new_cell_data = lv_malloc(table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
+        LV_ASSERT_MALLOC(new_cell_data);
+        if(new_cell_data == NULL) return;
+        uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
+
+        lv_memzero(new_cell_data, new_cell_cnt * sizeof(table->cell_data[0]));
+
+        /*The new column(s) messes up the mapping of `cell_data`*/
+        uint32_t old_col_start;
+        uint32_t new_col_start;
+        uint32_t min_col_cnt = LV_MIN(old_col_cnt, col_cnt);
+        uint32_t row;
+        for(row = 0; row < table->row_cnt; row++) {
+            old_col_start = row * old_col_cnt;
+            new_col_start = row * col_cnt;
+
+            lv_memcpy(&new_cell_data[new_col_start], &table->cell_data[old_col_start],
+                      sizeof(new_cell_data[0]) * min_col_cnt);
+
+            /*Free the old cells (only if the table becomes smaller)*/
+            int32_t i;
+            for(i = 0; i < (int32_t)old_col_cnt - (int32_t)col_cnt; i++) {
+                uint32_t idx = old_col_start + min_col_cnt + i;
+                lv_free(table->cell_data[idx]);
+                table->cell_data[idx] = NULL;
+            }
         }
-    }
 
-    lv_free(table->cell_data);
-    table->cell_data = new_cell_data;
+        lv_free(table->cell_data);
+        table->cell_data = new_cell_data;
+    }
 
     /*Initialize the new column widths if any*/
     table->col_w = lv_realloc(table->col_w, col_cnt * sizeof(table->col_w[0]));
@@ -312,6 +341,10 @@ void lv_table_set_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_value_cb) {
+        LV_LOG_WARN("the cells of virtual tables can't be set");
+        return;
+    }
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
@@ -338,6 +371,10 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_tab
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_value_cb) {
+        LV_LOG_WARN("the cells of virtual tables can't be set");
+        return;
+    }
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
@@ -363,6 +400,10 @@ void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, voi
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_value_cb) {
+        LV_LOG_WARN("the cells of virtual tables can't be set");
+        return;
+    }
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
@@ -383,6 +424,61 @@ void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, voi
     table->cell_data[cell]->user_data = user_data;
 }
 
+void lv_table_set_cell_value_cb(lv_obj_t * obj, lv_table_cell_value_cb_t cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_value_cb == cb) return;
+
+    if(table->cell_value_cb == NULL) {
+        uint32_t i;
+        for(i = 0; i < table->col_cnt * table->row_cnt; i++) {
+            lv_free(table->cell_data[i]);
+        }
+        lv_free(table->cell_data);
+        lv_free(table->row_h);
+        table->cell_data = NULL;
+        table->row_h = NULL;
+
+        if(!lv_fenwick_set_count(&table->row_h_tree, table->row_cnt)) return;
+    }
+    else if(cb == NULL) {
+        lv_fenwick_deinit(&table->row_h_tree);
+
+        table->row_h = lv_malloc(table->row_cnt * sizeof(table->row_h[0]));
+        LV_ASSERT_MALLOC(table->row_h);
+        table->cell_data = lv_malloc(table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
+        LV_ASSERT_MALLOC(table->cell_data);
+        if(table->row_h == NULL || table->cell_data == NULL) return;
+        lv_memzero(table->cell_data, table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
+    }
+
+    table->cell_value_cb = cb;
+    refr_size_form_row(obj, 0);
+}
+
+void lv_table_refresh_rows(lv_obj_t * obj, uint32_t row, uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_value_cb == NULL || row >= table->row_cnt) return;
+
+    cnt = LV_MIN(cnt, table->row_cnt - row);
+    uint32_t i;
+    for(i = row; i < row + cnt; i++) {
+        if(!lv_fenwick_is_measured(&table->row_h_tree, i)) continue;
+
+        lv_fenwick_set_measured(&table->row_h_tree, i, false);
+        lv_fenwick_add(&table->row_h_tree, i, -lv_fenwick_get(&table->row_h_tree, i));
+    }
+
+    refr_virtual_rows(obj);
+    lv_obj_refresh_self_size(obj);
+    lv_obj_invalidate(obj);
+}
+
 void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -416,6 +512,12 @@ const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col)
         LV_LOG_WARN("invalid row or column");
         return "";
     }
+
+    if(table->cell_value_cb) {
+        const char * txt = table->cell_value_cb(obj, row, col);
+        return txt ? txt : "";
+    }
+
     uint32_t cell = row * table->col_cnt + col;
 
     if(is_cell_empty(table->cell_data[cell])) return "";
@@ -423,6 +525,14 @@ const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col)
     return table->cell_data[cell]->txt;
 }
 
+lv_table_cell_value_cb_t lv_table_get_cell_value_cb(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    return table->cell_value_cb;
+}
+
 uint32_t lv_table_get_row_count(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -462,6 +572,8 @@ bool lv_table_has_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table
         LV_LOG_WARN("invalid row or column");
         return false;
     }
+    if(table->cell_value_cb) return false;
+
     uint32_t cell = row * table->col_cnt + col;
 
     if(is_cell_empty(table->cell_data[cell])) return false;
@@ -484,6 +596,8 @@ void * lv_table_get_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col)
         LV_LOG_WARN("invalid row or column");
         return NULL;
     }
+    if(table->cell_value_cb) return NULL;
+
     uint32_t cell = row * table->col_cnt + col;
 
     if(is_cell_empty(table->cell_data[cell])) return NULL;
@@ -512,6 +626,7 @@ static void lv_table_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     table->cell_data[0] = NULL;
     table->row_act = LV_TABLE_CELL_NONE;
     table->col_act = LV_TABLE_CELL_NONE;
+    lv_fenwick_init(&table->row_h_tree, true);
 
     LV_TRACE_OBJ_CREATE("finished");
 }
@@ -522,7 +637,7 @@ static void lv_table_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_table_t * table = (lv_table_t *)obj;
     /*Free the cell texts*/
     uint32_t i;
-    for(i = 0; i < table->col_cnt * table->row_cnt; i++) {
+    for(i = 0; table->cell_data && i < table->col_cnt * table->row_cnt; i++) {
         if(table->cell_data[i]) {
             lv_free(table->cell_data[i]);
             table->cell_data[i] = NULL;
@@ -532,6 +647,7 @@ static void lv_table_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     if(table->cell_data) lv_free(table->cell_data);
     if(table->row_h) lv_free(table->row_h);
     if(table->col_w) lv_free(table->col_w);
+    lv_fenwick_deinit(&table->row_h_tree);
 }
 
 static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -549,7 +665,9 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
     lv_table_t * table = (lv_table_t *)obj;
 
     if(code == LV_EVENT_STYLE_CHANGED) {
-        refr_size_form_row(obj, 0);
+        /*The state changes when scrolling too, so measure the rows of virtual tables again only if needed*/
+        if(table->cell_value_cb && !refr_row_styles(obj)) lv_obj_invalidate(obj);
+        else refr_size_form_row(obj, 0);
     }
     else if(code == LV_EVENT_GET_SELF_SIZE) {
         lv_point_t * p = lv_event_get_param(e);
@@ -557,8 +675,7 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
         int32_t w = 0;
         for(i = 0; i < table->col_cnt; i++) w += table->col_w[i];
 
-        int32_t h = 0;
-        for(i = 0; i < table->row_cnt; i++) h += table->row_h[i];
+        int32_t h = get_row_y(table, table->row_cnt);
 
         p->x = w - 1;
         p->y = h - 1;
@@ -650,6 +767,9 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
             if(res != LV_RESULT_OK) return;
         }
     }
+    else if(code == LV_EVENT_SCROLL || code == LV_EVENT_SIZE_CHANGED) {
+        if(table->cell_value_cb) refr_virtual_rows(obj);
+    }
     else if(code == LV_EVENT_DRAW_MAIN) {
         draw_main(e);
     }
@@ -693,18 +813,23 @@ static void draw_main(lv_event_t * e)
     obj->skip_trans = 0;
 
     uint32_t col;
-    uint32_t row;
+    uint32_t row = 0;
     uint32_t cell = 0;
+    int32_t row_y = 0;
+    int32_t rows_y1 = obj->coords.y1 + bg_top - lv_obj_get_scroll_y(obj) + border_width;
+
+    /*Start from the first visible row in virtual tables*/
+    if(table->cell_value_cb) row = find_row(table, clip_area.y1 - rows_y1, &row_y);
 
-    cell_area.y2 = obj->coords.y1 + bg_top - 1 - lv_obj_get_scroll_y(obj) + border_width;
+    cell_area.y2 = rows_y1 + row_y - 1;
     cell_area.x1 = 0;
     cell_area.x2 = 0;
     int32_t scroll_x = lv_obj_get_scroll_x(obj) ;
     bool rtl = lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL;
 
     /*Handle custom drawer*/
-    for(row = 0; row < table->row_cnt; row++) {
-        int32_t h_row = table->row_h[row];
+    for(; row < table->row_cnt; row++) {
+        int32_t h_row = get_row_h(table, row);
 
         cell_area.y1 = cell_area.y2 + 1;
         cell_area.y2 = cell_area.y1 + h_row - 1;
@@ -716,7 +841,7 @@ static void draw_main(lv_event_t * e)
 
         for(col = 0; col < table->col_cnt; col++) {
             lv_table_cell_ctrl_t ctrl = 0;
-            if(table->cell_data[cell]) ctrl = table->cell_data[cell]->ctrl;
+            if(table->cell_data && table->cell_data[cell]) ctrl = table->cell_data[cell]->ctrl;
 
             if(rtl) {
                 cell_area.x2 = cell_area.x1 - 1;
@@ -729,7 +854,7 @@ static void draw_main(lv_event_t * e)
 
             uint32_t col_merge = 0;
             for(col_merge = 0; col_merge + col < table->col_cnt - 1; col_merge++) {
-                lv_table_cell_t * next_cell_data = table->cell_data[cell + col_merge];
+                lv_table_cell_t * next_cell_data = table->cell_data ? table->cell_data[cell + col_merge] : NULL;
 
                 if(is_cell_empty(next_cell_data)) break;
 
@@ -802,7 +927,17 @@ static void draw_main(lv_event_t * e)
 
             lv_draw_rect(layer, &rect_dsc_act, &cell_area_border);
 
-            if(table->cell_data[cell]) {
+            const char * txt = NULL;
+            if(table->cell_value_cb) {
+                txt = table->cell_value_cb(obj, row, col);
+                /*The text is valid only until the next call*/
+                label_dsc_act.text_local = 1;
+            }
+            else if(table->cell_data[cell]) {
+                txt = table->cell_data[cell]->txt;
+            }
+
+            if(txt) {
                 const int32_t cell_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
                 const int32_t cell_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
                 const int32_t cell_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
@@ -828,7 +963,7 @@ static void draw_main(lv_event_t * e)
                     label_dsc_act.flag |= LV_TEXT_FLAG_EXPAND;
                 }
 
-                lv_text_get_size_attributes(&txt_size, table->cell_data[cell]->txt, label_dsc_def.font, &attributes);
+                lv_text_get_size_attributes(&txt_size, txt, label_dsc_def.font, &attributes);
 
                 /*Align the content to the middle if not cropped*/
                 if(!crop) {
@@ -841,7 +976,7 @@ static void draw_main(lv_event_t * e)
                 label_mask_ok = lv_area_intersect(&label_clip_area, &clip_area, &cell_area);
                 if(label_mask_ok) {
                     layer->_clip_area = label_clip_area;
-                    label_dsc_act.text = table->cell_data[cell]->txt;
+                    label_dsc_act.text = txt;
                     lv_draw_label(layer, &label_dsc_act, &txt_area);
                     layer->_clip_area = clip_area;
                 }
@@ -871,6 +1006,19 @@ static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row)
     const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
 
     lv_table_t * table = (lv_table_t *)obj;
+
+    /*Virtual tables measure only the visible rows and estimate the others as a single line*/
+    if(table->cell_value_cb) {
+        refr_row_styles(obj);
+        int32_t line_h = lv_font_get_line_height(font) + cell_pad_top + cell_pad_bottom;
+        table->row_h_est = LV_CLAMP(minh, line_h, maxh);
+        lv_fenwick_clear(&table->row_h_tree);
+        refr_virtual_rows(obj);
+        lv_obj_refresh_self_size(obj);
+        lv_obj_invalidate(obj);
+        return;
+    }
+
     uint32_t i;
     for(i = start_row; i < table->row_cnt; i++) {
         int32_t calculated_height = get_row_height(obj, i, font, letter_space, line_space,
@@ -935,6 +1083,18 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
     uint32_t cell;
     uint32_t col;
     for(cell = row_start, col = 0; cell < row_start + table->col_cnt; cell++, col++) {
+        /*The cells of virtual tables are not merged or cropped*/
+        if(table->cell_value_cb) {
+            const char * txt = table->cell_value_cb(obj, row_id, col);
+            if(txt == NULL || txt[0] == '\0') continue;
+
+            lv_point_t txt_size;
+            attributes.max_width = table->col_w[col] - cell_left - cell_right;
+            lv_text_get_size_attributes(&txt_size, txt, font, &attributes);
+            h_max = LV_MAX(txt_size.y + cell_top + cell_bottom, h_max);
+            continue;
+        }
+
         lv_table_cell_t * cell_data = table->cell_data[cell];
 
         if(is_cell_empty(cell_data)) {
@@ -1030,16 +1190,8 @@ static lv_result_t get_pressed_cell(lv_obj_t * obj, uint32_t * row, uint32_t * c
         y -= obj->coords.y1;
         y -= lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
 
-        *row = 0;
-        tmp = 0;
-
-        for(*row = 0; *row < table->row_cnt; (*row)++) {
-            tmp += table->row_h[*row];
-            if(y < tmp) {
-                is_click_on_valid_row = true;
-                break;
-            }
-        }
+        *row = find_row(table, y, &tmp);
+        is_click_on_valid_row = *row < table->row_cnt;
     }
 
     /* If the click was on valid column AND row then return valid result, return invalid otherwise */
@@ -1090,7 +1242,7 @@ static void get_cell_area(lv_obj_t * obj, uint32_t row, uint32_t col, lv_area_t
     uint32_t col_merge = 0;
     int32_t offset = 0;
     for(col_merge = 0; col_merge + col < table->col_cnt - 1; col_merge++) {
-        lv_table_cell_t * next_cell_data = table->cell_data[row * table->col_cnt + col_merge];
+        lv_table_cell_t * next_cell_data = table->cell_data ? table->cell_data[row * table->col_cnt + col_merge] : NULL;
 
         if(is_cell_empty(next_cell_data)) break;
 
@@ -1115,15 +1267,10 @@ static void get_cell_area(lv_obj_t * obj, uint32_t row, uint32_t col, lv_area_t
         area->x2 = area->x1 + (table->col_w[col] + offset) - 1;
     }
 
-    uint32_t r;
-    area->y1 = 0;
-    for(r = 0; r < row; r++) {
-        area->y1 += table->row_h[r];
-    }
-
+    area->y1 = get_row_y(table, row);
     area->y1 += lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
     area->y1 -= lv_obj_get_scroll_y(obj);
-    area->y2 = area->y1 + table->row_h[row] - 1;
+    area->y2 = area->y1 + get_row_h(table, row) - 1;
 
 }
 
@@ -1148,4 +1295,104 @@ static void scroll_to_selected_cell(lv_obj_t * obj)
     }
 
 }
+
+/* Get the y coordinate of the top of a row relative to the first row */
+static int32_t get_row_y(lv_table_t * table, uint32_t row)
+{
+    if(table->cell_value_cb) return (int32_t)row * table->row_h_est + lv_fenwick_get_sum(&table->row_h_tree, row);
+
+    int32_t y = 0;
+    uint32_t r;
+    for(r = 0; r < row; r++) y += table->row_h[r];
+    return y;
+}
+
+static int32_t get_row_h(lv_table_t * table, uint32_t row)
+{
+    if(table->cell_value_cb == NULL) return table->row_h[row];
+    return table->row_h_est + lv_fenwick_get(&table->row_h_tree, row);
+}
+
+/* Find the row at a y coordinate relative to the first row and store the top of that row in `row_y`.
+ * Return `row_cnt` if `y` is below the last row. */
+static uint32_t find_row(lv_table_t * table, int32_t y, int32_t * row_y)
+{
+    if(table->cell_value_cb) return lv_fenwick_find(&table->row_h_tree, table->row_h_est, y, row_y);
+
+    uint32_t row = 0;
+    int32_t sum = 0;
+    while(row < table->row_cnt && sum + table->row_h[row] <= y) {
+        sum += table->row_h[row];
+        row++;
+    }
+
+    *row_y = sum;
+    return row;
+}
+
+/* Measure the visible rows of a virtual table which were not measured yet */
+static void refr_virtual_rows(lv_obj_t * obj)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->row_cnt == 0) return;
+
+    const lv_table_row_styles_t * styles = &table->row_styles;
+    int32_t y1 = lv_obj_get_scroll_y(obj) - lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
+    int32_t y2 = y1 + lv_obj_get_height(obj);
+    int32_t row_y;
+    uint32_t row = find_row(table, y1, &row_y);
+    bool changed = false;
+    int32_t scroll_diff = 0;
+    for(; row < table->row_cnt && row_y <= y2; row++) {
+        if(!lv_fenwick_is_measured(&table->row_h_tree, row)) {
+            int32_t calculated_height = get_row_height(obj, row, styles->font, styles->letter_space, styles->line_space,
+                                                       styles->pad_left, styles->pad_right, styles->pad_top, styles->pad_bottom);
+            int32_t diff = LV_CLAMP(styles->min_height, calculated_height, styles->max_height) - table->row_h_est;
+            if(diff != 0) {
+                lv_fenwick_add(&table->row_h_tree, row, diff);
+                changed = true;
+
+                /*Keep the rows below in place if a row starting above the viewport has changed.
+                 *It happens when scrolling up to rows which were estimated only.*/
+                if(row_y < y1) {
+                    scroll_diff += diff;
+                    y1 += diff;
+                    y2 += diff;
+                }
+            }
+            lv_fenwick_set_measured(&table->row_h_tree, row, true);
+        }
+        row_y += get_row_h(table, row);
+    }
+
+    /*Scroll only at the end as the scroll event measures the rows again*/
+    if(scroll_diff != 0) lv_obj_scroll_by_raw(obj, 0, -scroll_diff);
+
+    if(changed) {
+        lv_obj_refresh_self_size(obj);
+        lv_obj_invalidate(obj);
+    }
+}
+
+/* Save the styles which affect the height of the rows. Return true if they have changed. */
+static bool refr_row_styles(lv_obj_t * obj)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    lv_table_row_styles_t styles;
+    lv_memzero(&styles, sizeof(styles));
+    styles.font = lv_obj_get_style_text_font(obj, LV_PART_ITEMS);
+    styles.letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_ITEMS);
+    styles.line_space = lv_obj_get_style_text_line_space(obj, LV_PART_ITEMS);
+    styles.pad_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
+    styles.pad_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
+    styles.pad_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
+    styles.pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_ITEMS);
+    styles.min_height = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
+    styles.max_height = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
+
+    if(lv_memcmp(&styles, &table->row_styles, sizeof(styles)) == 0) return false;
+
+    table->row_styles = styles;
+    return true;
+}
 #endif
@@ -43,6 +43,16 @@ typedef enum {
     LV_TABLE_CELL_CTRL_CUSTOM_4    = 1 << 7,
 } lv_table_cell_ctrl_t;
 
+/**
+ * Get the text of a cell of a virtual table
+ * @param obj       pointer to a Table object
+ * @param row       id of the row [0 .. row_cnt -1]
+ * @param col       id of the column [0 .. col_cnt -1]
+ * @return          text of the cell. It needs to be valid only until the callback is called again.
+ *                  `NULL` or `""` means empty cell.
+ */
+typedef const char * (*lv_table_cell_value_cb_t)(lv_obj_t * obj, uint32_t row, uint32_t col);
+
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_table_class;
 
 /**********************
@@ -133,6 +143,26 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_tab
  */
 void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, void * user_data);
 
+/**
+ * Make the table virtual: don't store the cells but get their text from a callback when needed.
+ * Only the visible rows are measured and drawn, the height of the other rows is estimated
+ * as the height of a single line, so tables with a lot of rows can be scrolled quickly.
+ * The cells of virtual tables have no control bits and user data, and can't be set.
+ * @param obj       pointer to a Table object
+ * @param cb        callback which gives the text of a cell or `NULL` to store the cells again.
+ *                  The cells are empty after changing the mode.
+ */
+void lv_table_set_cell_value_cb(lv_obj_t * obj, lv_table_cell_value_cb_t cb);
+
+/**
+ * Tell a virtual table that the values of some rows have changed.
+ * They will be measured again when they are visible.
+ * @param obj       pointer to a virtual Table object
+ * @param row       id of the first changed row
+ * @param cnt       number of changed rows
+ */
+void lv_table_refresh_rows(lv_obj_t * obj, uint32_t row, uint32_t cnt);
+
 /**
  * Set the selected cell
  * @param obj       pointer to a table object
@@ -154,6 +184,13 @@ void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col);
  */
 const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col);
 
+/**
+ * Get the callback which gives the cell values of a virtual table.
+ * @param obj       pointer to a Table object
+ * @return          the callback or `NULL` if the table is not virtual
+ */
+lv_table_cell_value_cb_t lv_table_get_cell_value_cb(lv_obj_t * obj);
+
 /**
  * Get the number of rows.
  * @param obj       table pointer to a Table object
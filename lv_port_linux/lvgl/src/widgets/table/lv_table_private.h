@@ -18,6 +18,7 @@ extern "C" {
 
 #if LV_USE_TABLE != 0
 #include "../../core/lv_obj_private.h"
+#include "../../misc/lv_fenwick.h"
 
 /*********************
  *      DEFINES
@@ -34,6 +35,19 @@ struct _lv_table_cell_t {
     char txt[1];      /**< Variable length array */
 };
 
+/** The styles of the cells which affect the height of the rows */
+typedef struct {
+    const lv_font_t * font;
+    int32_t letter_space;
+    int32_t line_space;
+    int32_t pad_left;
+    int32_t pad_right;
+    int32_t pad_top;
+    int32_t pad_bottom;
+    int32_t min_height;
+    int32_t max_height;
+} lv_table_row_styles_t;
+
 /** Table data */
 struct _lv_table_t {
     lv_obj_t obj;
@@ -44,6 +58,11 @@ struct _lv_table_t {
     int32_t * col_w;
     uint32_t col_act;
     uint32_t row_act;
+    lv_table_cell_value_cb_t cell_value_cb; /**< Gives the cell values of virtual tables*/
+    lv_fenwick_t row_h_tree;    /**< Virtual tables: Fenwick tree of the row heights' difference from `row_h_est`
+                                     and a bit for each row which is set if the row is measured*/
+    int32_t row_h_est;          /**< Virtual tables: height of the rows which are not measured yet*/
+    lv_table_row_styles_t row_styles; /**< Virtual tables: the styles the rows were measured with*/
 };
 
 
@@ -0,0 +1,2964 @@
+/*******************************************************************************
+ * Signed distance fields of ../built_in_font/Montserrat-Medium.ttf
+ * Size: 24 px, padding: 3 px, edge: 128, pixel distance scale: 42.3333
+ * Opts: --font ../built_in_font/Montserrat-Medium.ttf --size 24 --padding 3 -r 0x20-0x7E --name test_font_montserrat_ascii_sdf -o test_font_montserrat_ascii_sdf.c
+ ******************************************************************************/
+
+#if LV_BUILD_TEST
+#include "../../../lvgl.h"
+
+#if LV_USE_FONT_SDF
+
+/*Store the distance fields of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t test_font_montserrat_ascii_sdf_atlas[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0e, 0x0b, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0d, 0x0e, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0e, 0x0e, 0x0d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0d,
+    0x0e, 0x0e, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x0e, 0x0e, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x09, 0x10, 0x13, 0x14, 0x13, 0x0f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x11, 0x15, 0x15, 0x12, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x0e, 0x0e, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x0e, 0x0e, 0x0d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x19, 0x1e, 0x1e, 0x1e, 0x13, 0x00,
+    0x00, 0x00, 0x09, 0x1b, 0x1e, 0x1e, 0x1e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x18, 0x1d, 0x17, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0x31, 0x32, 0x32, 0x24, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2d, 0x38, 0x38, 0x35, 0x2d, 0x1d, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x27, 0x32, 0x37, 0x38, 0x34, 0x1f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1c, 0x33, 0x38, 0x38, 0x37, 0x28, 0x0b, 0x00, 0x00, 0x08, 0x26, 0x37,
+    0x38, 0x38, 0x34, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x2d, 0x12, 0x00, 0x00, 0x12, 0x2d, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2c, 0x10, 0x00,
+    0x00, 0x10, 0x2c, 0x38, 0x38, 0x38, 0x2f, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x1d, 0x2a, 0x33, 0x3a, 0x3d, 0x3f, 0x3d, 0x39, 0x33, 0x29, 0x1c, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1a, 0x29, 0x34,
+    0x3b, 0x3f, 0x3f, 0x3c, 0x36, 0x2b, 0x1d, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1a, 0x32, 0x38, 0x38, 0x38, 0x2c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x23,
+    0x36, 0x38, 0x38, 0x37, 0x25, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x40, 0x49, 0x49, 0x48, 0x36, 0x15,
+    0x00, 0x05, 0x29, 0x43, 0x49, 0x49, 0x47, 0x31, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2e, 0x41, 0x47, 0x40, 0x2c, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x3e, 0x5a, 0x5d, 0x5c, 0x44, 0x1e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x4e, 0x62, 0x62, 0x5f, 0x55, 0x43, 0x29, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x39, 0x4e, 0x5c, 0x62, 0x62, 0x5b, 0x38, 0x10,
+    0x00, 0x00, 0x00, 0x11, 0x35, 0x58, 0x62, 0x62, 0x61, 0x46, 0x1f, 0x00, 0x00, 0x1b, 0x42, 0x60,
+    0x62, 0x62, 0x5a, 0x38, 0x14, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4b, 0x62, 0x62, 0x62, 0x62, 0x62,
+    0x62, 0x4d, 0x27, 0x00, 0x00, 0x28, 0x4e, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x4b, 0x25, 0x00,
+    0x00, 0x25, 0x4b, 0x62, 0x62, 0x62, 0x51, 0x2c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
+    0x22, 0x35, 0x45, 0x52, 0x5d, 0x64, 0x68, 0x69, 0x68, 0x63, 0x5c, 0x52, 0x44, 0x34, 0x21, 0x0b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x2e, 0x41, 0x51, 0x5d,
+    0x65, 0x69, 0x6a, 0x66, 0x5f, 0x54, 0x44, 0x32, 0x1c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x32, 0x56, 0x62, 0x62, 0x62, 0x4c, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x3e,
+    0x5e, 0x62, 0x62, 0x5f, 0x41, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x36, 0x5e, 0x73, 0x73, 0x71, 0x4d, 0x23,
+    0x00, 0x11, 0x3b, 0x64, 0x73, 0x73, 0x6d, 0x47, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x2e, 0x4f, 0x68, 0x71, 0x67, 0x4d, 0x2b, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x48, 0x72, 0x87, 0x79, 0x4f, 0x25, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2d, 0x57, 0x81, 0x8d, 0x89, 0x7c, 0x65, 0x46, 0x24, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x38, 0x58, 0x73, 0x85, 0x8c, 0x8d, 0x69, 0x3f, 0x14,
+    0x00, 0x00, 0x00, 0x25, 0x4a, 0x6f, 0x8d, 0x8d, 0x72, 0x4c, 0x22, 0x00, 0x00, 0x1f, 0x48, 0x6f,
+    0x8d, 0x8d, 0x73, 0x4e, 0x28, 0x03, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x8d, 0x8d, 0x8d, 0x8d,
+    0x81, 0x57, 0x2c, 0x02, 0x02, 0x2d, 0x57, 0x81, 0x8d, 0x8d, 0x8d, 0x8d, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0x8d, 0x86, 0x5c, 0x31, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30,
+    0x47, 0x5b, 0x6d, 0x7b, 0x86, 0x8e, 0x92, 0x93, 0x92, 0x8d, 0x85, 0x7a, 0x6c, 0x5a, 0x46, 0x2f,
+    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0x3b, 0x53, 0x67, 0x79, 0x86,
+    0x8f, 0x94, 0x94, 0x90, 0x88, 0x7c, 0x6b, 0x57, 0x3f, 0x25, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0e,
+    0x38, 0x63, 0x8d, 0x8d, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x45,
+    0x6f, 0x8d, 0x8d, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x44, 0x6c, 0x93, 0x97, 0x6f, 0x47, 0x1f,
+    0x00, 0x0e, 0x36, 0x5e, 0x86, 0x9d, 0x7c, 0x55, 0x2d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x40, 0x67, 0x8b, 0x9c, 0x88, 0x64, 0x3c, 0x13,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x20, 0x2d, 0x48, 0x72, 0x9c, 0x79, 0x4f, 0x34, 0x2a,
+    0x1c, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x2d, 0x57, 0x81, 0x9a, 0xa6, 0xa0, 0x82, 0x5d, 0x37, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4d, 0x72, 0x94, 0xad, 0x9d, 0x93, 0x69, 0x3f, 0x14,
+    0x00, 0x00, 0x10, 0x37, 0x5d, 0x83, 0xa9, 0x85, 0x5f, 0x39, 0x14, 0x00, 0x00, 0x11, 0x36, 0x5b,
+    0x81, 0xa8, 0x87, 0x61, 0x3b, 0x14, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x9c, 0x98, 0x98,
+    0x81, 0x57, 0x2c, 0x02, 0x02, 0x2d, 0x57, 0x81, 0x98, 0x98, 0x9c, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x37, 0x52,
+    0x6b, 0x81, 0x94, 0xa0, 0x93, 0x8b, 0x86, 0x84, 0x86, 0x8b, 0x94, 0xa0, 0x92, 0x7f, 0x6a, 0x51,
+    0x36, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3f, 0x5c, 0x76, 0x8d, 0xa0, 0xac,
+    0xa1, 0x9c, 0x9b, 0xa0, 0xaa, 0xa3, 0x90, 0x7a, 0x61, 0x44, 0x26, 0x05, 0x00, 0x00, 0x00, 0x0e,
+    0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x45,
+    0x6f, 0x9a, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2a, 0x52, 0x7a, 0xa1, 0x89, 0x61, 0x39, 0x11,
+    0x00, 0x00, 0x28, 0x50, 0x78, 0xa0, 0x8a, 0x63, 0x3b, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x44, 0x6e, 0x99, 0xb8, 0x95, 0x6b, 0x40, 0x16,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x32, 0x47, 0x56, 0x61, 0x72, 0x9c, 0x79, 0x65, 0x5d, 0x52,
+    0x44, 0x31, 0x1b, 0x00, 0x00, 0x01, 0x2b, 0x53, 0x6e, 0x70, 0x84, 0xa8, 0x95, 0x6c, 0x42, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x30, 0x59, 0x82, 0xab, 0x93, 0x76, 0x6e, 0x63, 0x3c, 0x13,
+    0x00, 0x00, 0x1f, 0x47, 0x6e, 0x95, 0x9a, 0x73, 0x4c, 0x26, 0x00, 0x00, 0x00, 0x00, 0x23, 0x49,
+    0x70, 0x97, 0x99, 0x73, 0x4b, 0x24, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x6e, 0x6e,
+    0x6e, 0x53, 0x2b, 0x01, 0x01, 0x2b, 0x53, 0x6e, 0x6e, 0x6e, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x00, 0x00, 0x00, 0x17, 0x38, 0x56, 0x73,
+    0x8e, 0x9f, 0x8a, 0x78, 0x6b, 0x61, 0x5c, 0x5a, 0x5c, 0x61, 0x6b, 0x78, 0x8a, 0x9f, 0x8c, 0x72,
+    0x55, 0x36, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3b, 0x5c, 0x7b, 0x98, 0xad, 0x96, 0x84,
+    0x78, 0x71, 0x71, 0x76, 0x82, 0x93, 0xa9, 0x9c, 0x80, 0x62, 0x41, 0x1e, 0x00, 0x00, 0x00, 0x0e,
+    0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x0a, 0x0e, 0x0e, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x0f, 0x0c, 0x1b, 0x45,
+    0x6f, 0x9a, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x60, 0x88, 0xa3, 0x7b, 0x53, 0x2b, 0x03,
+    0x00, 0x00, 0x1a, 0x42, 0x6a, 0x92, 0x98, 0x71, 0x49, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x3b, 0x61, 0x81, 0x8e, 0x7e, 0x5d, 0x37, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x55, 0x6c, 0x7e, 0x8a, 0x91, 0xa2, 0x93, 0x8f, 0x87, 0x7a,
+    0x6a, 0x56, 0x3b, 0x16, 0x00, 0x00, 0x19, 0x37, 0x44, 0x49, 0x72, 0x9c, 0x9b, 0x71, 0x47, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x5e, 0x88, 0xaf, 0x85, 0x5b, 0x44, 0x40, 0x27, 0x05,
+    0x00, 0x05, 0x2d, 0x55, 0x7d, 0xa5, 0x8b, 0x64, 0x3c, 0x15, 0x00, 0x00, 0x00, 0x00, 0x11, 0x38,
+    0x60, 0x88, 0xaa, 0x82, 0x5a, 0x32, 0x09, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x44,
+    0x44, 0x37, 0x19, 0x00, 0x00, 0x19, 0x37, 0x44, 0x44, 0x63, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x00, 0x00, 0x0d, 0x31, 0x53, 0x73, 0x92,
+    0x97, 0x7c, 0x65, 0x51, 0x42, 0x41, 0x46, 0x45, 0x40, 0x38, 0x42, 0x51, 0x64, 0x7b, 0x96, 0x90,
+    0x71, 0x50, 0x2e, 0x0a, 0x00, 0x00, 0x00, 0x09, 0x2e, 0x53, 0x76, 0x98, 0xaa, 0x8c, 0x72, 0x5d,
+    0x4f, 0x47, 0x47, 0x4d, 0x5b, 0x6f, 0x88, 0xa5, 0x9d, 0x7c, 0x59, 0x34, 0x0f, 0x00, 0x00, 0x0e,
+    0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x34, 0x39, 0x39, 0x34, 0x2a, 0x1c, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x16, 0x26, 0x31, 0x37, 0x39, 0x36, 0x2e, 0x45,
+    0x6f, 0x9a, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x46, 0x6e, 0x96, 0x95, 0x6d, 0x45, 0x1d, 0x00,
+    0x00, 0x00, 0x0c, 0x34, 0x5c, 0x84, 0xa6, 0x7f, 0x57, 0x2f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x26, 0x45, 0x5c, 0x63, 0x5a, 0x42, 0x23, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x32, 0x55, 0x75, 0x90, 0xa5, 0xa4, 0x9a, 0xa6, 0x98, 0x9d, 0xa7, 0xa2,
+    0x90, 0x74, 0x49, 0x1f, 0x00, 0x00, 0x00, 0x12, 0x1c, 0x46, 0x70, 0x9b, 0x9b, 0x71, 0x47, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x5e, 0x88, 0xae, 0x83, 0x59, 0x2f, 0x17, 0x07, 0x00,
+    0x00, 0x10, 0x39, 0x62, 0x8a, 0xa7, 0x7e, 0x56, 0x2e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2a,
+    0x52, 0x7b, 0xa3, 0x8f, 0x67, 0x3e, 0x15, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39,
+    0x19, 0x12, 0x00, 0x00, 0x00, 0x00, 0x12, 0x19, 0x39, 0x63, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x00, 0x00, 0x23, 0x48, 0x6b, 0x8e, 0x98,
+    0x78, 0x5b, 0x41, 0x4c, 0x5e, 0x6a, 0x70, 0x70, 0x69, 0x5d, 0x57, 0x6c, 0x6c, 0x6c, 0x77, 0x96,
+    0x8b, 0x68, 0x44, 0x1f, 0x00, 0x00, 0x00, 0x1a, 0x41, 0x67, 0x8d, 0xb1, 0x8f, 0x6e, 0x50, 0x38,
+    0x26, 0x1d, 0x1c, 0x24, 0x35, 0x4c, 0x69, 0x8a, 0xad, 0x93, 0x6e, 0x47, 0x20, 0x00, 0x00, 0x0e,
+    0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x52, 0x5e, 0x63, 0x63, 0x5d, 0x53, 0x43, 0x2f, 0x16, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x26, 0x3c, 0x4d, 0x5a, 0x61, 0x64, 0x60, 0x57, 0x48,
+    0x6f, 0x9a, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2c, 0x54, 0x7c, 0xa4, 0x87, 0x5f, 0x37, 0x0f, 0x00,
+    0x00, 0x00, 0x00, 0x26, 0x4e, 0x76, 0x9e, 0x8c, 0x65, 0x3d, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2c, 0x50, 0x5e, 0x5e, 0x5e, 0x4d, 0x29, 0x01,
+    0x00, 0x00, 0x00, 0x1f, 0x46, 0x6c, 0x90, 0xad, 0x90, 0x7c, 0x72, 0x9c, 0x79, 0x74, 0x7f, 0x8f,
+    0x8c, 0x64, 0x3d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x46, 0x70, 0x9b, 0x9b, 0x71, 0x47, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x5e, 0x88, 0xae, 0x83, 0x59, 0x2f, 0x04, 0x00, 0x00,
+    0x00, 0x1a, 0x43, 0x6c, 0x96, 0x9c, 0x73, 0x4a, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
+    0x47, 0x70, 0x99, 0x9a, 0x71, 0x48, 0x1f, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x39, 0x63, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x00, 0x0e, 0x35, 0x5c, 0x81, 0xa2, 0x7e,
+    0x5c, 0x3c, 0x58, 0x71, 0x85, 0x93, 0x9a, 0x9a, 0x92, 0x83, 0x6e, 0x86, 0x97, 0x7d, 0x5b, 0x7d,
+    0xa1, 0x7e, 0x58, 0x31, 0x0a, 0x00, 0x00, 0x27, 0x50, 0x78, 0x9f, 0x9d, 0x78, 0x54, 0x32, 0x15,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x2d, 0x4f, 0x73, 0x98, 0xa6, 0x7e, 0x56, 0x2e, 0x05, 0x00, 0x0e,
+    0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x67, 0x7a, 0x87, 0x8d, 0x8d, 0x87, 0x7b, 0x69, 0x52, 0x37, 0x19,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2c, 0x48, 0x61, 0x75, 0x83, 0x8b, 0x8e, 0x8a, 0x7f, 0x6e,
+    0x6f, 0x9a, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x3a, 0x62, 0x8a, 0xa1, 0x79, 0x51, 0x29, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x40, 0x68, 0x90, 0x9a, 0x73, 0x4b, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x5d, 0x88, 0x89, 0x84, 0x5a, 0x2f, 0x05,
+    0x00, 0x00, 0x00, 0x2a, 0x54, 0x7c, 0xa5, 0x95, 0x71, 0x56, 0x72, 0x9c, 0x79, 0x4f, 0x57, 0x69,
+    0x7b, 0x54, 0x2d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x46, 0x70, 0x9b, 0x9b, 0x71, 0x47, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x5e, 0x88, 0xae, 0x83, 0x59, 0x2f, 0x04, 0x00, 0x00,
+    0x00, 0x22, 0x4c, 0x75, 0x9f, 0x94, 0x6a, 0x41, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+    0x3d, 0x66, 0x90, 0xa4, 0x7a, 0x51, 0x27, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x39, 0x63, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x00, 0x1d, 0x45, 0x6d, 0x94, 0x8e, 0x68,
+    0x44, 0x56, 0x76, 0x93, 0xa8, 0x95, 0x8b, 0x88, 0x8e, 0x9d, 0x8f, 0x86, 0xa7, 0x7d, 0x52, 0x67,
+    0x8d, 0x90, 0x69, 0x41, 0x19, 0x00, 0x08, 0x31, 0x5b, 0x84, 0xad, 0x8e, 0x66, 0x3f, 0x19, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x39, 0x60, 0x88, 0xb1, 0x8b, 0x62, 0x38, 0x0e, 0x00, 0x0e,
+    0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x89, 0xa0, 0xa2, 0x9c, 0x9e, 0xa8, 0xa2, 0x8d, 0x73, 0x55, 0x34,
+    0x11, 0x00, 0x00, 0x00, 0x05, 0x28, 0x49, 0x68, 0x84, 0x9b, 0xab, 0xa1, 0x9c, 0x9f, 0xa7, 0x93,
+    0x78, 0x9a, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x48, 0x70, 0x98, 0x93, 0x6b, 0x43, 0x1b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x32, 0x5a, 0x82, 0xa8, 0x81, 0x59, 0x31, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x5d, 0x88, 0xae, 0x84, 0x5a, 0x2f, 0x05,
+    0x00, 0x00, 0x05, 0x2f, 0x59, 0x84, 0xae, 0x8a, 0x60, 0x48, 0x72, 0x9c, 0x79, 0x4f, 0x30, 0x44,
+    0x52, 0x3f, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x46, 0x70, 0x9b, 0x9b, 0x71, 0x47, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x5e, 0x88, 0xae, 0x83, 0x59, 0x2f, 0x04, 0x00, 0x00,
+    0x00, 0x29, 0x53, 0x7d, 0xa7, 0x8d, 0x63, 0x39, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x35, 0x5f, 0x88, 0xab, 0x82, 0x58, 0x2e, 0x04, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x39, 0x63, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x00, 0x29, 0x52, 0x7a, 0xa3, 0x7e, 0x56,
+    0x47, 0x6d, 0x91, 0xa4, 0x86, 0x6f, 0x61, 0x5e, 0x66, 0x78, 0x93, 0x9a, 0xa7, 0x7d, 0x52, 0x55,
+    0x7d, 0x9e, 0x76, 0x4d, 0x24, 0x00, 0x0d, 0x37, 0x61, 0x8c, 0xaf, 0x85, 0x5b, 0x32, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2b, 0x55, 0x7e, 0xa8, 0x92, 0x68, 0x3e, 0x14, 0x00, 0x0e,
+    0x38, 0x63, 0x8d, 0xab, 0x8c, 0xa1, 0x89, 0x79, 0x72, 0x74, 0x80, 0x95, 0xae, 0x91, 0x6f, 0x4c,
+    0x27, 0x01, 0x00, 0x00, 0x19, 0x3f, 0x63, 0x85, 0xa4, 0x9e, 0x86, 0x78, 0x72, 0x75, 0x82, 0x97,
+    0x94, 0x9d, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x2e, 0x56, 0x7e, 0xa6, 0x85, 0x5d, 0x35, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x24, 0x4c, 0x74, 0x9c, 0x8f, 0x67, 0x3f, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x5d, 0x88, 0xae, 0x84, 0x5a, 0x2f, 0x05,
+    0x00, 0x00, 0x04, 0x2e, 0x58, 0x82, 0xac, 0x8f, 0x68, 0x4c, 0x72, 0x9c, 0x79, 0x4f, 0x25, 0x1f,
+    0x27, 0x1c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x46, 0x70, 0x9b, 0x9b, 0x71, 0x47, 0x2a,
+    0x18, 0x00, 0x00, 0x00, 0x0d, 0x25, 0x34, 0x5e, 0x88, 0xae, 0x83, 0x59, 0x2f, 0x04, 0x00, 0x00,
+    0x04, 0x2e, 0x58, 0x82, 0xac, 0x87, 0x5d, 0x33, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x2f, 0x59, 0x83, 0xad, 0x87, 0x5d, 0x33, 0x09, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x39, 0x63, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x08, 0x31, 0x5b, 0x85, 0x9b, 0x72, 0x49,
+    0x57, 0x7f, 0xa6, 0x8c, 0x69, 0x4b, 0x38, 0x34, 0x3f, 0x57, 0x78, 0x9c, 0xa7, 0x7d, 0x52, 0x49,
+    0x72, 0x9b, 0x7f, 0x55, 0x2b, 0x02, 0x0f, 0x3a, 0x64, 0x8e, 0xac, 0x82, 0x57, 0x2d, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x51, 0x7b, 0xa5, 0x95, 0x6b, 0x40, 0x16, 0x00, 0x0e,
+    0x38, 0x63, 0x8d, 0xb7, 0xa4, 0x82, 0x65, 0x51, 0x48, 0x4b, 0x5a, 0x74, 0x94, 0xaa, 0x85, 0x5f,
+    0x38, 0x10, 0x00, 0x02, 0x2a, 0x51, 0x78, 0x9d, 0xa0, 0x7e, 0x62, 0x4f, 0x48, 0x4c, 0x5d, 0x77,
+    0x97, 0xbb, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3c, 0x64, 0x8c, 0x9f, 0x77, 0x4f, 0x27, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x3e, 0x66, 0x8e, 0x9d, 0x75, 0x4d, 0x25, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x5d, 0x88, 0xae, 0x84, 0x5a, 0x2f, 0x05,
+    0x00, 0x00, 0x00, 0x27, 0x50, 0x78, 0x9e, 0xa3, 0x87, 0x72, 0x72, 0x9c, 0x79, 0x4f, 0x38, 0x2a,
+    0x19, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x46, 0x70, 0x9a, 0x9c, 0x72, 0x57, 0x52,
+    0x35, 0x0f, 0x00, 0x00, 0x27, 0x49, 0x57, 0x5f, 0x89, 0xad, 0x83, 0x59, 0x2f, 0x04, 0x00, 0x00,
+    0x07, 0x32, 0x5c, 0x86, 0xae, 0x84, 0x59, 0x2f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2b, 0x55, 0x7f, 0xa9, 0x8b, 0x61, 0x36, 0x0c, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x39, 0x63, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x0d, 0x37, 0x61, 0x8b, 0x94, 0x6a, 0x40,
+    0x62, 0x8b, 0xa4, 0x7c, 0x53, 0x2e, 0x10, 0x0a, 0x1b, 0x3e, 0x64, 0x8c, 0xa7, 0x7d, 0x52, 0x41,
+    0x6b, 0x95, 0x85, 0x5a, 0x30, 0x06, 0x0e, 0x38, 0x62, 0x8c, 0xae, 0x84, 0x5a, 0x30, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x53, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x15, 0x00, 0x0e,
+    0x38, 0x63, 0x8d, 0xb7, 0x90, 0x6a, 0x46, 0x2a, 0x1e, 0x22, 0x38, 0x59, 0x7d, 0xa4, 0x96, 0x6e,
+    0x45, 0x1b, 0x00, 0x0c, 0x36, 0x5f, 0x88, 0xb0, 0x8b, 0x65, 0x43, 0x28, 0x1d, 0x24, 0x3b, 0x5c,
+    0x81, 0xa8, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x4a, 0x72, 0x9a, 0x91, 0x69, 0x41, 0x19, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x30, 0x58, 0x80, 0xa8, 0x83, 0x5b, 0x33, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x5d, 0x88, 0xae, 0x84, 0x5a, 0x2f, 0x05,
+    0x00, 0x00, 0x00, 0x19, 0x40, 0x64, 0x84, 0xa0, 0xab, 0x99, 0x8c, 0x9e, 0x79, 0x6c, 0x60, 0x51,
+    0x3f, 0x28, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x41, 0x6a, 0x91, 0xa8, 0x88, 0x81, 0x6c,
+    0x41, 0x17, 0x00, 0x06, 0x30, 0x5b, 0x81, 0x82, 0x98, 0x9e, 0x7b, 0x53, 0x2a, 0x00, 0x00, 0x00,
+    0x09, 0x34, 0x5e, 0x88, 0xac, 0x82, 0x57, 0x2d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x53, 0x7d, 0xa7, 0x8d, 0x63, 0x38, 0x0e, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x39, 0x63, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x0f, 0x39, 0x64, 0x8e, 0x91, 0x67, 0x3c,
+    0x67, 0x91, 0x9e, 0x74, 0x4a, 0x20, 0x00, 0x00, 0x07, 0x31, 0x5b, 0x85, 0xa7, 0x7d, 0x52, 0x3f,
+    0x69, 0x93, 0x86, 0x5c, 0x32, 0x07, 0x09, 0x33, 0x5d, 0x86, 0xaf, 0x8c, 0x63, 0x3b, 0x15, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x36, 0x5d, 0x86, 0xaf, 0x8d, 0x63, 0x39, 0x10, 0x00, 0x0e,
+    0x38, 0x63, 0x8d, 0xac, 0x83, 0x5a, 0x31, 0x0b, 0x00, 0x00, 0x1f, 0x46, 0x6f, 0x98, 0xa0, 0x76,
+    0x4c, 0x22, 0x00, 0x13, 0x3d, 0x67, 0x91, 0xa7, 0x7d, 0x54, 0x2c, 0x07, 0x00, 0x00, 0x23, 0x4b,
+    0x74, 0x9d, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x30, 0x58, 0x80, 0xa8, 0x83, 0x5b, 0x33, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x4a, 0x72, 0x9a, 0x91, 0x69, 0x41, 0x19, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x5d, 0x88, 0xae, 0x84, 0x5a, 0x2f, 0x05,
+    0x00, 0x00, 0x00, 0x06, 0x29, 0x48, 0x65, 0x7c, 0x8e, 0x9c, 0xa8, 0xb2, 0xa0, 0x95, 0x88, 0x78,
+    0x63, 0x49, 0x2b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x35, 0x5a, 0x77, 0x8f, 0xa9, 0x96, 0x6c,
+    0x41, 0x17, 0x00, 0x06, 0x30, 0x5b, 0x85, 0xa6, 0xa0, 0x7f, 0x67, 0x45, 0x1f, 0x00, 0x00, 0x00,
+    0x0a, 0x34, 0x5e, 0x89, 0xab, 0x81, 0x57, 0x2c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x52, 0x7c, 0xa7, 0x8e, 0x63, 0x39, 0x0f, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x39, 0x63, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x0f, 0x39, 0x63, 0x8e, 0x91, 0x67, 0x3d,
+    0x67, 0x91, 0x9e, 0x74, 0x4a, 0x20, 0x00, 0x00, 0x07, 0x31, 0x5b, 0x85, 0xa7, 0x7d, 0x52, 0x40,
+    0x6a, 0x94, 0x85, 0x5b, 0x31, 0x06, 0x01, 0x2a, 0x53, 0x7b, 0xa3, 0x9a, 0x73, 0x4e, 0x2c, 0x0e,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x27, 0x49, 0x6e, 0x94, 0xa9, 0x81, 0x59, 0x30, 0x07, 0x00, 0x0e,
+    0x38, 0x63, 0x8d, 0xa8, 0x7e, 0x54, 0x29, 0x00, 0x00, 0x00, 0x14, 0x3f, 0x69, 0x93, 0xa4, 0x7a,
+    0x4f, 0x25, 0x00, 0x15, 0x40, 0x6a, 0x94, 0xa3, 0x79, 0x4e, 0x24, 0x00, 0x00, 0x00, 0x1a, 0x44,
+    0x6e, 0x99, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x3e, 0x66, 0x8e, 0x9d, 0x75, 0x4d, 0x25, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3c, 0x64, 0x8c, 0x9f, 0x77, 0x4f, 0x27, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x5d, 0x88, 0xae, 0x84, 0x5a, 0x2f, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x29, 0x42, 0x57, 0x66, 0x73, 0x7f, 0x9d, 0x93, 0xa0, 0xaf, 0x9e,
+    0x85, 0x67, 0x45, 0x21, 0x00, 0x00, 0x00, 0x00, 0x18, 0x42, 0x6b, 0x94, 0xa5, 0x83, 0x7b, 0x6b,
+    0x41, 0x17, 0x00, 0x06, 0x30, 0x5a, 0x7b, 0x7c, 0x94, 0xa3, 0x7d, 0x54, 0x2b, 0x01, 0x00, 0x00,
+    0x09, 0x33, 0x5e, 0x88, 0xac, 0x82, 0x58, 0x2d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x53, 0x7d, 0xa7, 0x8d, 0x62, 0x38, 0x0e, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x39, 0x63, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x0c, 0x36, 0x60, 0x8a, 0x95, 0x6b, 0x41,
+    0x61, 0x8b, 0xa5, 0x7c, 0x54, 0x2e, 0x11, 0x0b, 0x1c, 0x3e, 0x65, 0x8d, 0xa7, 0x7d, 0x52, 0x45,
+    0x6f, 0x99, 0x81, 0x57, 0x2d, 0x03, 0x00, 0x1d, 0x45, 0x6b, 0x91, 0xad, 0x89, 0x68, 0x4a, 0x31,
+    0x1e, 0x15, 0x14, 0x1c, 0x2d, 0x46, 0x63, 0x84, 0xa8, 0x97, 0x71, 0x4a, 0x23, 0x00, 0x00, 0x0e,
+    0x38, 0x63, 0x8d, 0xab, 0x81, 0x57, 0x2e, 0x05, 0x00, 0x00, 0x1a, 0x43, 0x6c, 0x96, 0xa2, 0x78,
+    0x4e, 0x23, 0x00, 0x14, 0x3e, 0x68, 0x92, 0xa5, 0x7b, 0x52, 0x28, 0x00, 0x00, 0x00, 0x1f, 0x48,
+    0x71, 0x9b, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x24, 0x4c, 0x74, 0x9c, 0x8f, 0x67, 0x3f, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x2e, 0x56, 0x7e, 0xa6, 0x85, 0x5d, 0x35, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x5d, 0x88, 0xae, 0x84, 0x5a, 0x2f, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x30, 0x3e, 0x4b, 0x72, 0x9c, 0x79, 0x78, 0x8b, 0xa3,
+    0xa2, 0x7f, 0x59, 0x31, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x46, 0x70, 0x9b, 0x9b, 0x71, 0x50, 0x4c,
+    0x31, 0x0d, 0x00, 0x00, 0x23, 0x44, 0x50, 0x5e, 0x89, 0xae, 0x83, 0x59, 0x2f, 0x04, 0x00, 0x00,
+    0x07, 0x31, 0x5b, 0x86, 0xae, 0x84, 0x5a, 0x30, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x2b, 0x55, 0x80, 0xaa, 0x8a, 0x60, 0x36, 0x0c, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x39, 0x63, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x06, 0x30, 0x59, 0x83, 0x9c, 0x73, 0x4a,
+    0x57, 0x7f, 0xa6, 0x8d, 0x6a, 0x4c, 0x39, 0x35, 0x40, 0x58, 0x79, 0x9d, 0xa7, 0x7d, 0x52, 0x51,
+    0x79, 0xa1, 0x79, 0x50, 0x26, 0x00, 0x00, 0x0d, 0x33, 0x58, 0x7b, 0x9d, 0xa4, 0x86, 0x6b, 0x56,
+    0x47, 0x3f, 0x3e, 0x45, 0x53, 0x67, 0x81, 0x9f, 0xa3, 0x81, 0x5d, 0x38, 0x12, 0x00, 0x00, 0x0e,
+    0x38, 0x63, 0x8d, 0xb3, 0x8b, 0x64, 0x3f, 0x20, 0x11, 0x16, 0x2f, 0x52, 0x78, 0xa0, 0x9a, 0x71,
+    0x47, 0x1e, 0x00, 0x0f, 0x38, 0x62, 0x8b, 0xae, 0x86, 0x5f, 0x3b, 0x1d, 0x10, 0x18, 0x33, 0x56,
+    0x7c, 0xa4, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x32, 0x5a, 0x82, 0xa9, 0x81, 0x59, 0x31, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x48, 0x70, 0x98, 0x93, 0x6b, 0x43, 0x1b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x5d, 0x88, 0xae, 0x84, 0x5a, 0x2f, 0x05,
+    0x00, 0x00, 0x00, 0x04, 0x23, 0x35, 0x32, 0x1c, 0x1d, 0x48, 0x72, 0x9c, 0x79, 0x52, 0x67, 0x87,
+    0xae, 0x8e, 0x64, 0x3a, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x46, 0x70, 0x9b, 0x9b, 0x71, 0x47, 0x24,
+    0x12, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x34, 0x5e, 0x88, 0xae, 0x83, 0x59, 0x2f, 0x04, 0x00, 0x00,
+    0x03, 0x2d, 0x57, 0x81, 0xac, 0x88, 0x5e, 0x34, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0x30, 0x5a, 0x84, 0xae, 0x86, 0x5c, 0x32, 0x08, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x39, 0x63, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x00, 0x27, 0x50, 0x78, 0xa1, 0x80, 0x58,
+    0x47, 0x6d, 0x91, 0xa5, 0x87, 0x70, 0x62, 0x5f, 0x67, 0x79, 0x94, 0x8f, 0xab, 0x82, 0x60, 0x68,
+    0x8a, 0x93, 0x6c, 0x44, 0x1c, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x62, 0x81, 0x9f, 0xa6, 0x8f, 0x7d,
+    0x70, 0x69, 0x68, 0x6e, 0x7a, 0x8c, 0xa2, 0xa3, 0x86, 0x67, 0x46, 0x23, 0x00, 0x00, 0x00, 0x0e,
+    0x38, 0x63, 0x8d, 0xb7, 0x9d, 0x7a, 0x5b, 0x45, 0x3b, 0x3e, 0x4f, 0x6b, 0x8c, 0xb1, 0x8b, 0x64,
+    0x3c, 0x14, 0x00, 0x05, 0x2e, 0x56, 0x7d, 0xa4, 0x99, 0x76, 0x58, 0x43, 0x3b, 0x40, 0x52, 0x6e,
+    0x90, 0xb5, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x40, 0x68, 0x90, 0x9b, 0x73, 0x4b, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x3a, 0x62, 0x8a, 0xa1, 0x79, 0x51, 0x29, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x5d, 0x88, 0xae, 0x84, 0x5a, 0x2f, 0x05,
+    0x00, 0x00, 0x00, 0x18, 0x3e, 0x5e, 0x57, 0x3d, 0x29, 0x48, 0x72, 0x9c, 0x79, 0x4f, 0x52, 0x7d,
+    0xa7, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00, 0x1c, 0x46, 0x70, 0x9b, 0x9b, 0x71, 0x47, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x5e, 0x88, 0xae, 0x83, 0x59, 0x2f, 0x04, 0x00, 0x00,
+    0x00, 0x28, 0x52, 0x7c, 0xa6, 0x8e, 0x64, 0x3a, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
+    0x36, 0x60, 0x89, 0xaa, 0x80, 0x57, 0x2d, 0x03, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x39, 0x63, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x00, 0x1b, 0x43, 0x6a, 0x91, 0x90, 0x6b,
+    0x47, 0x55, 0x76, 0x93, 0xaa, 0x96, 0x8c, 0x89, 0x8f, 0x9e, 0x8f, 0x78, 0x9e, 0x9b, 0x88, 0x8d,
+    0xa0, 0x7e, 0x5a, 0x34, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x26, 0x46, 0x63, 0x7d, 0x95, 0xa8, 0xa4,
+    0x99, 0x93, 0x93, 0x97, 0xa2, 0xab, 0x98, 0x81, 0x67, 0x4a, 0x38, 0x31, 0x17, 0x00, 0x00, 0x0e,
+    0x38, 0x63, 0x8d, 0xaa, 0x94, 0x97, 0x7e, 0x6d, 0x65, 0x68, 0x74, 0x8a, 0xa7, 0x99, 0x76, 0x52,
+    0x2c, 0x06, 0x00, 0x00, 0x1f, 0x45, 0x6a, 0x8d, 0xad, 0x94, 0x7b, 0x6b, 0x65, 0x69, 0x76, 0x8d,
+    0x9c, 0x9e, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x26, 0x4e, 0x76, 0x9e, 0x8d, 0x65, 0x3d, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2c, 0x54, 0x7c, 0xa4, 0x87, 0x5f, 0x37, 0x0f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x5d, 0x88, 0xae, 0x84, 0x5a, 0x2f, 0x05,
+    0x00, 0x00, 0x04, 0x2a, 0x50, 0x77, 0x78, 0x62, 0x50, 0x48, 0x72, 0x9c, 0x79, 0x4f, 0x60, 0x85,
+    0xac, 0x8b, 0x62, 0x39, 0x0f, 0x00, 0x00, 0x00, 0x1c, 0x46, 0x70, 0x9b, 0x9b, 0x71, 0x47, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x5e, 0x88, 0xae, 0x83, 0x59, 0x2f, 0x04, 0x00, 0x00,
+    0x00, 0x21, 0x4b, 0x74, 0x9e, 0x95, 0x6b, 0x42, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0x3e, 0x67, 0x91, 0xa2, 0x79, 0x4f, 0x26, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x39, 0x63, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x00, 0x0c, 0x32, 0x59, 0x7e, 0xa2, 0x81,
+    0x60, 0x40, 0x57, 0x71, 0x85, 0x93, 0x9a, 0x9a, 0x93, 0x84, 0x6e, 0x64, 0x82, 0x96, 0x9b, 0x93,
+    0x80, 0x64, 0x43, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x27, 0x42, 0x5a, 0x70, 0x81, 0x8f,
+    0x97, 0x9c, 0xb2, 0xaa, 0x90, 0x84, 0x73, 0x5e, 0x46, 0x47, 0x62, 0x53, 0x33, 0x12, 0x00, 0x0e,
+    0x38, 0x63, 0x8d, 0xa5, 0x7b, 0x93, 0xa3, 0x95, 0x8f, 0x91, 0x9c, 0xad, 0x97, 0x7c, 0x5d, 0x3c,
+    0x18, 0x00, 0x00, 0x00, 0x0c, 0x2f, 0x52, 0x71, 0x8e, 0xa6, 0xa1, 0x94, 0x8f, 0x92, 0x9d, 0x9d,
+    0x81, 0x96, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x34, 0x5c, 0x84, 0xa7, 0x7f, 0x57, 0x2f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x46, 0x6e, 0x96, 0x95, 0x6d, 0x45, 0x1d, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x5d, 0x88, 0xae, 0x84, 0x5a, 0x2f, 0x05,
+    0x00, 0x00, 0x14, 0x3c, 0x62, 0x89, 0x9c, 0x88, 0x78, 0x6d, 0x72, 0x9c, 0x79, 0x6f, 0x80, 0x9c,
+    0x9f, 0x7c, 0x55, 0x2e, 0x06, 0x00, 0x00, 0x00, 0x1c, 0x46, 0x70, 0x9b, 0x9b, 0x71, 0x47, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x5e, 0x88, 0xae, 0x83, 0x59, 0x2f, 0x04, 0x00, 0x00,
+    0x00, 0x19, 0x42, 0x6b, 0x94, 0x9e, 0x75, 0x4c, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+    0x48, 0x71, 0x9a, 0x99, 0x70, 0x46, 0x1d, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x39, 0x63, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x00, 0x00, 0x1f, 0x44, 0x68, 0x8a, 0x9b,
+    0x7c, 0x5f, 0x45, 0x4c, 0x5e, 0x6a, 0x70, 0x70, 0x6a, 0x5d, 0x4b, 0x47, 0x5f, 0x6d, 0x70, 0x6b,
+    0x5c, 0x44, 0x28, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20, 0x36, 0x4a, 0x5a, 0x66,
+    0x6e, 0x76, 0x94, 0xad, 0x8e, 0x72, 0x5b, 0x51, 0x56, 0x68, 0x83, 0x6e, 0x4e, 0x2c, 0x06, 0x0e,
+    0x38, 0x63, 0x8d, 0x95, 0x7b, 0x72, 0x86, 0x94, 0x9a, 0x9a, 0x93, 0x87, 0x74, 0x5c, 0x40, 0x22,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x16, 0x36, 0x52, 0x6c, 0x80, 0x8f, 0x98, 0x9b, 0x97, 0x8c, 0x7a,
+    0x6b, 0x95, 0x95, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x42, 0x6a, 0x92, 0x99, 0x71, 0x49, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x60, 0x88, 0xa3, 0x7b, 0x53, 0x2b, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x09, 0x33, 0x5d, 0x88, 0xae, 0x84, 0x5a, 0x2f, 0x05,
+    0x00, 0x00, 0x15, 0x3e, 0x64, 0x80, 0x96, 0xa8, 0xa0, 0x96, 0x90, 0xa0, 0x91, 0x98, 0xa6, 0x9e,
+    0x83, 0x64, 0x41, 0x1d, 0x00, 0x00, 0x01, 0x18, 0x20, 0x46, 0x70, 0x9b, 0x9b, 0x71, 0x47, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x5e, 0x88, 0xae, 0x83, 0x59, 0x2f, 0x1d, 0x0c, 0x00,
+    0x00, 0x0e, 0x37, 0x60, 0x88, 0xa9, 0x80, 0x58, 0x30, 0x08, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2c,
+    0x54, 0x7d, 0xa5, 0x8d, 0x64, 0x3c, 0x13, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39,
+    0x20, 0x17, 0x01, 0x00, 0x00, 0x01, 0x18, 0x20, 0x39, 0x63, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x00, 0x00, 0x0a, 0x2d, 0x4f, 0x70, 0x8f,
+    0x9b, 0x80, 0x69, 0x56, 0x47, 0x41, 0x46, 0x45, 0x40, 0x40, 0x4b, 0x5c, 0x5c, 0x43, 0x46, 0x42,
+    0x35, 0x22, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x23, 0x31, 0x3c,
+    0x44, 0x58, 0x75, 0x90, 0xaa, 0x95, 0x83, 0x7b, 0x7f, 0x8d, 0xa4, 0x89, 0x63, 0x39, 0x0e, 0x0c,
+    0x35, 0x5c, 0x6a, 0x6a, 0x6a, 0x4d, 0x5f, 0x6a, 0x70, 0x70, 0x6a, 0x5f, 0x4e, 0x39, 0x21, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x31, 0x47, 0x59, 0x67, 0x6e, 0x70, 0x6d, 0x64, 0x54,
+    0x62, 0x6a, 0x6a, 0x66, 0x44, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0x50, 0x78, 0xa0, 0x8b, 0x63, 0x3b, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2a, 0x52, 0x7a, 0xa2, 0x89, 0x61, 0x39, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x29, 0x35, 0x2b, 0x33, 0x5d, 0x88, 0xae, 0x84, 0x5a, 0x2f, 0x05,
+    0x00, 0x00, 0x06, 0x29, 0x44, 0x5c, 0x70, 0x81, 0x8d, 0x96, 0x9b, 0xa8, 0x9b, 0x95, 0x8a, 0x79,
+    0x63, 0x47, 0x28, 0x07, 0x00, 0x00, 0x1d, 0x3d, 0x4a, 0x4d, 0x73, 0x9d, 0x9b, 0x71, 0x46, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x5e, 0x88, 0xaf, 0x86, 0x5d, 0x4a, 0x46, 0x2c, 0x08,
+    0x00, 0x02, 0x2b, 0x53, 0x7b, 0xa3, 0x8e, 0x66, 0x3e, 0x17, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3b,
+    0x62, 0x8a, 0xa7, 0x7f, 0x57, 0x2f, 0x07, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x4a,
+    0x4a, 0x3c, 0x1d, 0x00, 0x00, 0x1d, 0x3d, 0x4a, 0x4a, 0x63, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x00, 0x00, 0x00, 0x14, 0x34, 0x53, 0x70,
+    0x8a, 0xa2, 0x8e, 0x7d, 0x70, 0x67, 0x62, 0x60, 0x63, 0x69, 0x74, 0x82, 0x70, 0x48, 0x20, 0x18,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x13,
+    0x1c, 0x39, 0x55, 0x6f, 0x86, 0x99, 0xa5, 0xa5, 0xa7, 0x9a, 0x86, 0x6d, 0x4f, 0x2e, 0x07, 0x00,
+    0x20, 0x3a, 0x40, 0x40, 0x40, 0x31, 0x37, 0x41, 0x46, 0x45, 0x40, 0x37, 0x28, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x22, 0x32, 0x3d, 0x44, 0x46, 0x43, 0x3b, 0x2e,
+    0x3d, 0x40, 0x40, 0x3f, 0x2b, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x36, 0x5e, 0x86, 0xa5, 0x7d, 0x55, 0x2d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x44, 0x6c, 0x94, 0x97, 0x6f, 0x47, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x24, 0x49, 0x5f, 0x4e, 0x46, 0x63, 0x8c, 0xab, 0x81, 0x57, 0x2d, 0x03,
+    0x00, 0x00, 0x00, 0x09, 0x22, 0x37, 0x4a, 0x58, 0x64, 0x6c, 0x72, 0x9c, 0x79, 0x6b, 0x62, 0x53,
+    0x40, 0x27, 0x0b, 0x00, 0x00, 0x02, 0x2c, 0x56, 0x74, 0x76, 0x89, 0xaa, 0x93, 0x6a, 0x41, 0x17,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x2e, 0x58, 0x81, 0xa9, 0x97, 0x7b, 0x74, 0x66, 0x3e, 0x14,
+    0x00, 0x00, 0x1d, 0x44, 0x6b, 0x92, 0x9d, 0x76, 0x4f, 0x29, 0x03, 0x00, 0x00, 0x00, 0x25, 0x4c,
+    0x72, 0x99, 0x97, 0x70, 0x49, 0x21, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x74, 0x74,
+    0x74, 0x55, 0x2c, 0x02, 0x02, 0x2c, 0x56, 0x74, 0x74, 0x74, 0x8e, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x00, 0x00, 0x00, 0x00, 0x17, 0x34, 0x4f,
+    0x67, 0x7d, 0x90, 0x9f, 0x99, 0x90, 0x8c, 0x8b, 0x8d, 0x93, 0x9c, 0x9a, 0x7e, 0x56, 0x2c, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0x33, 0x4c, 0x61, 0x71, 0x7c, 0x80, 0x7d, 0x73, 0x62, 0x4b, 0x31, 0x13, 0x00, 0x00,
+    0x00, 0x12, 0x16, 0x16, 0x16, 0x0c, 0x0e, 0x17, 0x1b, 0x1b, 0x17, 0x0e, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x14, 0x1a, 0x1c, 0x19, 0x12, 0x06,
+    0x14, 0x16, 0x16, 0x15, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1c, 0x44, 0x6c, 0x94, 0x97, 0x6f, 0x47, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x36, 0x5e, 0x86, 0xa5, 0x7d, 0x55, 0x2d,
+    0x05, 0x00, 0x00, 0x0d, 0x34, 0x5b, 0x82, 0x75, 0x70, 0x7d, 0x9c, 0x9e, 0x77, 0x4f, 0x26, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x30, 0x3a, 0x48, 0x72, 0x9c, 0x79, 0x4f, 0x39, 0x2c,
+    0x1b, 0x05, 0x00, 0x00, 0x00, 0x02, 0x2d, 0x57, 0x81, 0xa0, 0xac, 0x9c, 0x7e, 0x5b, 0x34, 0x0d,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x4a, 0x6f, 0x90, 0xa7, 0xa3, 0x93, 0x69, 0x3f, 0x14,
+    0x00, 0x00, 0x0d, 0x34, 0x5a, 0x80, 0xa5, 0x87, 0x61, 0x3c, 0x17, 0x00, 0x00, 0x14, 0x39, 0x5e,
+    0x84, 0xa9, 0x84, 0x5e, 0x38, 0x11, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0xa2, 0x9f, 0x9f,
+    0x81, 0x57, 0x2c, 0x02, 0x02, 0x2d, 0x57, 0x81, 0x9f, 0x9f, 0xa2, 0xa9, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x86, 0x5c, 0x31, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2d,
+    0x43, 0x58, 0x69, 0x77, 0x82, 0x89, 0x8d, 0x8e, 0x8c, 0x87, 0x7e, 0x72, 0x63, 0x4b, 0x26, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x28, 0x3b, 0x49, 0x52, 0x55, 0x53, 0x4a, 0x3c, 0x28, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x2a, 0x52, 0x7a, 0xa2, 0x89, 0x61, 0x39, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x50, 0x78, 0xa0, 0x8b, 0x63, 0x3b,
+    0x13, 0x00, 0x00, 0x1c, 0x44, 0x6b, 0x92, 0x9f, 0x9b, 0xa3, 0xa2, 0x86, 0x64, 0x3f, 0x19, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1d, 0x48, 0x72, 0x90, 0x79, 0x4f, 0x25, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2d, 0x57, 0x81, 0x86, 0x83, 0x77, 0x61, 0x43, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x34, 0x55, 0x6e, 0x7f, 0x86, 0x86, 0x69, 0x3f, 0x14,
+    0x00, 0x00, 0x00, 0x21, 0x47, 0x6c, 0x86, 0x86, 0x76, 0x4d, 0x23, 0x00, 0x00, 0x1f, 0x49, 0x72,
+    0x86, 0x86, 0x6f, 0x4b, 0x25, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x86, 0x86, 0x86, 0x86,
+    0x81, 0x57, 0x2c, 0x02, 0x02, 0x2d, 0x57, 0x81, 0x86, 0x86, 0x86, 0x86, 0x7e, 0x54, 0x2a, 0x00,
+    0x00, 0x2a, 0x54, 0x7f, 0x86, 0x86, 0x5c, 0x31, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x1f, 0x31, 0x41, 0x4e, 0x58, 0x5f, 0x63, 0x64, 0x62, 0x5d, 0x55, 0x4a, 0x3c, 0x2a, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x13, 0x20, 0x28, 0x2b, 0x29, 0x21, 0x15, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0e,
+    0x13, 0x12, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0d, 0x0d, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x32, 0x5c, 0x7b, 0x7b, 0x7a, 0x53, 0x2b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x42, 0x6a, 0x7b, 0x7b, 0x6e, 0x44,
+    0x1a, 0x00, 0x00, 0x1c, 0x45, 0x68, 0x7d, 0x89, 0x8c, 0x89, 0x7d, 0x67, 0x4a, 0x29, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x42, 0x62, 0x65, 0x65, 0x48, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4a, 0x5c, 0x5c, 0x59, 0x4f, 0x3e, 0x25, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x34, 0x49, 0x56, 0x5b, 0x5c, 0x55, 0x35, 0x0f,
+    0x00, 0x00, 0x00, 0x0d, 0x32, 0x53, 0x5c, 0x5c, 0x5b, 0x42, 0x1d, 0x00, 0x00, 0x19, 0x3f, 0x5a,
+    0x5c, 0x5c, 0x55, 0x35, 0x11, 0x00, 0x00, 0x00, 0x00, 0x23, 0x47, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+    0x5c, 0x49, 0x25, 0x00, 0x00, 0x25, 0x4a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x47, 0x23, 0x00,
+    0x00, 0x23, 0x47, 0x5c, 0x5c, 0x5c, 0x4d, 0x2a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x19, 0x25, 0x2f, 0x35, 0x39, 0x3a, 0x38, 0x33, 0x2c, 0x22, 0x14, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x19, 0x1d, 0x16, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x2b, 0x38,
+    0x3d, 0x3c, 0x33, 0x23, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x22, 0x35, 0x38, 0x38, 0x31, 0x19, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x25, 0x45, 0x51, 0x51, 0x51, 0x3e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0x4c, 0x51, 0x51, 0x4e, 0x34,
+    0x10, 0x00, 0x00, 0x0c, 0x2d, 0x45, 0x55, 0x5f, 0x62, 0x5f, 0x55, 0x44, 0x2b, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x27, 0x3a, 0x3b, 0x3b, 0x2b, 0x0e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x28, 0x31, 0x31, 0x2f, 0x27, 0x18, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x21, 0x2c, 0x31, 0x31, 0x2e, 0x1a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x2d, 0x31, 0x31, 0x31, 0x23, 0x07, 0x00, 0x00, 0x04, 0x21, 0x31,
+    0x31, 0x31, 0x2e, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x26, 0x31, 0x31, 0x31, 0x31, 0x31,
+    0x31, 0x27, 0x0d, 0x00, 0x00, 0x0e, 0x28, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x26, 0x0b, 0x00,
+    0x00, 0x0c, 0x26, 0x31, 0x31, 0x31, 0x2a, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x0e, 0x0f, 0x0d, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x11, 0x15, 0x15, 0x12, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x17, 0x31, 0x42, 0x47, 0x3e, 0x29, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x51, 0x61,
+    0x68, 0x66, 0x5b, 0x48, 0x2e, 0x10, 0x00, 0x00, 0x1a, 0x3d, 0x5d, 0x62, 0x62, 0x55, 0x31, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x20, 0x27, 0x27, 0x27, 0x1b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x24, 0x27, 0x27, 0x25, 0x15,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x1f, 0x2d, 0x35, 0x38, 0x35, 0x2d, 0x1e, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x11, 0x10, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x07, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x07, 0x07, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x10, 0x13, 0x12, 0x0c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1a, 0x29, 0x34,
+    0x3b, 0x3f, 0x3f, 0x3c, 0x36, 0x2b, 0x1d, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0d, 0x32, 0x53, 0x6b, 0x71, 0x64, 0x49, 0x27, 0x01, 0x00, 0x00, 0x16, 0x39, 0x59, 0x75, 0x89,
+    0x92, 0x90, 0x82, 0x6a, 0x4c, 0x2b, 0x07, 0x0f, 0x32, 0x55, 0x78, 0x8c, 0x82, 0x5e, 0x35, 0x0b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x0d, 0x0b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x11, 0x15, 0x15, 0x12, 0x0c,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x11, 0x15, 0x15, 0x13, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x0d, 0x0d, 0x0d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0d, 0x0d, 0x0d, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x0a, 0x0a, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x24,
+    0x32, 0x3a, 0x3e, 0x3c, 0x35, 0x29, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x2e, 0x41, 0x51, 0x5d,
+    0x65, 0x69, 0x6a, 0x66, 0x5f, 0x54, 0x44, 0x32, 0x1c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1b, 0x44, 0x6c, 0x8f, 0x9b, 0x85, 0x60, 0x37, 0x0e, 0x00, 0x03, 0x2a, 0x50, 0x74, 0x95, 0x8c,
+    0x7d, 0x81, 0x95, 0x88, 0x65, 0x40, 0x1a, 0x27, 0x4a, 0x6d, 0x90, 0x8d, 0x6a, 0x47, 0x24, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x15, 0x15, 0x10, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x15, 0x15,
+    0x12, 0x0c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1b, 0x29, 0x34, 0x3b, 0x3f, 0x3f, 0x3c, 0x35,
+    0x2b, 0x1d, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1b, 0x29,
+    0x34, 0x3b, 0x3f, 0x3f, 0x3d, 0x36, 0x2c, 0x1f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2f,
+    0x38, 0x38, 0x38, 0x31, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x31, 0x38, 0x38, 0x38, 0x2e,
+    0x13, 0x00, 0x00, 0x00, 0x1e, 0x32, 0x34, 0x34, 0x34, 0x26, 0x09, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x2f, 0x34, 0x34, 0x34, 0x28, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x34, 0x4a,
+    0x5b, 0x64, 0x68, 0x66, 0x5e, 0x4f, 0x39, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0x3b, 0x53, 0x67, 0x79, 0x86,
+    0x8f, 0x94, 0x94, 0x90, 0x88, 0x7c, 0x6b, 0x57, 0x3f, 0x25, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1f, 0x49, 0x74, 0x9e, 0xb7, 0x90, 0x66, 0x3b, 0x11, 0x00, 0x10, 0x39, 0x61, 0x89, 0x90, 0x6c,
+    0x53, 0x5a, 0x79, 0x9f, 0x78, 0x50, 0x28, 0x3f, 0x62, 0x84, 0x98, 0x75, 0x52, 0x2f, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x21, 0x30, 0x3a, 0x3f, 0x3f, 0x3a, 0x30, 0x21, 0x0e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x18, 0x27, 0x33, 0x3b, 0x3f, 0x3f,
+    0x3c, 0x35, 0x2b, 0x1d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2f, 0x42, 0x51, 0x5d, 0x65, 0x69, 0x6a, 0x66, 0x5f,
+    0x53, 0x44, 0x31, 0x1a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2f, 0x42, 0x51,
+    0x5d, 0x65, 0x69, 0x6a, 0x67, 0x60, 0x55, 0x46, 0x34, 0x1e, 0x05, 0x00, 0x00, 0x02, 0x2b, 0x50,
+    0x62, 0x62, 0x62, 0x55, 0x31, 0x08, 0x00, 0x00, 0x00, 0x07, 0x2f, 0x54, 0x62, 0x62, 0x62, 0x4f,
+    0x29, 0x01, 0x00, 0x13, 0x3a, 0x59, 0x5e, 0x5e, 0x5e, 0x45, 0x1f, 0x00, 0x00, 0x00, 0x0a, 0x31,
+    0x54, 0x5e, 0x5e, 0x5e, 0x48, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x35, 0x54, 0x6f,
+    0x82, 0x8e, 0x92, 0x90, 0x87, 0x74, 0x5a, 0x3b, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3f, 0x5c, 0x76, 0x8d, 0xa0, 0xac,
+    0xa1, 0x9c, 0x9b, 0xa0, 0xaa, 0xa3, 0x90, 0x7a, 0x61, 0x44, 0x26, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x40, 0x66, 0x84, 0x8d, 0x7b, 0x59, 0x32, 0x0a, 0x00, 0x18, 0x41, 0x6b, 0x95, 0x82, 0x59,
+    0x31, 0x40, 0x69, 0x92, 0x83, 0x5a, 0x33, 0x56, 0x79, 0x9c, 0x80, 0x5d, 0x3a, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1a, 0x33, 0x48, 0x58, 0x64, 0x69, 0x69, 0x64, 0x58, 0x48, 0x32, 0x1a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x29, 0x3e, 0x4f, 0x5c, 0x65, 0x69, 0x6a,
+    0x66, 0x5f, 0x53, 0x43, 0x2e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0x3b, 0x53, 0x68, 0x79, 0x86, 0x8f, 0x94, 0x94, 0x90, 0x88,
+    0x7b, 0x6a, 0x55, 0x3c, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0x3c, 0x53, 0x68, 0x79,
+    0x86, 0x8f, 0x94, 0x94, 0x91, 0x89, 0x7d, 0x6d, 0x59, 0x41, 0x26, 0x08, 0x00, 0x06, 0x30, 0x5a,
+    0x85, 0x8c, 0x8b, 0x61, 0x37, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x35, 0x5f, 0x8a, 0x8c, 0x83, 0x59,
+    0x2e, 0x04, 0x00, 0x17, 0x41, 0x6a, 0x89, 0x89, 0x7d, 0x57, 0x30, 0x09, 0x00, 0x00, 0x1b, 0x42,
+    0x69, 0x89, 0x89, 0x79, 0x52, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x4d, 0x71, 0x90,
+    0xa5, 0x91, 0x8a, 0x8d, 0x9d, 0x96, 0x76, 0x51, 0x2a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3b, 0x5c, 0x7b, 0x98, 0xad, 0x96, 0x84,
+    0x78, 0x71, 0x71, 0x76, 0x82, 0x93, 0xa9, 0x9c, 0x80, 0x62, 0x41, 0x1e, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x2a, 0x49, 0x5d, 0x63, 0x58, 0x3f, 0x1e, 0x00, 0x00, 0x1a, 0x45, 0x6f, 0x99, 0x7d, 0x53,
+    0x29, 0x3a, 0x64, 0x8e, 0x87, 0x5d, 0x4b, 0x6e, 0x91, 0x8b, 0x68, 0x45, 0x22, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1b, 0x3a, 0x55, 0x6d, 0x80, 0x8d, 0x94, 0x94, 0x8d, 0x80, 0x6d, 0x55, 0x3a,
+    0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x31, 0x4b, 0x63, 0x76, 0x85, 0x8f, 0x94, 0x94,
+    0x90, 0x88, 0x7b, 0x69, 0x47, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x40, 0x5c, 0x76, 0x8d, 0xa0, 0xad, 0xa2, 0x9c, 0x9b, 0x9f, 0xa9,
+    0xa2, 0x8f, 0x78, 0x5c, 0x3e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x21, 0x40, 0x5d, 0x77, 0x8d, 0xa0,
+    0xad, 0xa2, 0x9c, 0x9b, 0x9f, 0xa7, 0xa4, 0x92, 0x7c, 0x62, 0x44, 0x23, 0x00, 0x06, 0x30, 0x5a,
+    0x85, 0xaf, 0x8b, 0x61, 0x37, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x35, 0x5f, 0x8a, 0xad, 0x83, 0x59,
+    0x2e, 0x04, 0x00, 0x0c, 0x32, 0x59, 0x80, 0xa7, 0x8e, 0x68, 0x41, 0x1a, 0x00, 0x05, 0x2c, 0x53,
+    0x79, 0xa0, 0x8f, 0x68, 0x42, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x34, 0x5d, 0x85, 0xab,
+    0x87, 0x6a, 0x5f, 0x64, 0x7d, 0xa2, 0x88, 0x5f, 0x36, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x2e, 0x53, 0x76, 0x98, 0xaa, 0x8c, 0x72, 0x5d,
+    0x4f, 0x47, 0x47, 0x4d, 0x5a, 0x6f, 0x88, 0xa5, 0x9d, 0x7c, 0x59, 0x34, 0x0f, 0x00, 0x00, 0x00,
+    0x09, 0x31, 0x54, 0x5e, 0x5e, 0x5e, 0x49, 0x24, 0x00, 0x00, 0x19, 0x43, 0x6d, 0x97, 0x80, 0x56,
+    0x2d, 0x3d, 0x67, 0x91, 0x85, 0x5b, 0x63, 0x86, 0x96, 0x74, 0x51, 0x2e, 0x13, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x36, 0x57, 0x76, 0x90, 0xa6, 0xa4, 0x9c, 0x9c, 0xa4, 0xa6, 0x90, 0x75, 0x57,
+    0x36, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2f, 0x4f, 0x6c, 0x87, 0x9c, 0xab, 0x9f, 0x99, 0x98,
+    0x9c, 0xa5, 0x93, 0x6d, 0x47, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x3b, 0x5c, 0x7c, 0x98, 0xae, 0x97, 0x85, 0x78, 0x72, 0x71, 0x76, 0x81,
+    0x93, 0xa9, 0x98, 0x7a, 0x52, 0x28, 0x00, 0x00, 0x00, 0x19, 0x3c, 0x5d, 0x7c, 0x98, 0xae, 0x97,
+    0x85, 0x79, 0x72, 0x71, 0x75, 0x7f, 0x8f, 0xa4, 0x9d, 0x80, 0x5a, 0x2f, 0x05, 0x06, 0x30, 0x5a,
+    0x85, 0xaf, 0x8b, 0x61, 0x37, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x35, 0x5f, 0x8a, 0xad, 0x83, 0x59,
+    0x2e, 0x04, 0x00, 0x00, 0x21, 0x48, 0x6f, 0x95, 0x9f, 0x79, 0x52, 0x2b, 0x04, 0x16, 0x3c, 0x63,
+    0x8a, 0xa5, 0x7e, 0x57, 0x31, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x3a, 0x64, 0x8e, 0xa1,
+    0x77, 0x4d, 0x35, 0x44, 0x6e, 0x98, 0x8f, 0x64, 0x3a, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x41, 0x67, 0x8d, 0xb1, 0x8f, 0x6e, 0x50, 0x38,
+    0x26, 0x1d, 0x1c, 0x24, 0x35, 0x4c, 0x69, 0x8a, 0xad, 0x93, 0x6e, 0x47, 0x20, 0x00, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x89, 0x89, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x13, 0x3c, 0x65, 0x8d, 0x8b, 0x65,
+    0x48, 0x50, 0x73, 0x9a, 0x7c, 0x58, 0x7b, 0x9e, 0x7f, 0x5c, 0x3e, 0x41, 0x3d, 0x31, 0x1f, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x29, 0x4e, 0x71, 0x93, 0xac, 0x90, 0x7c, 0x72, 0x72, 0x7c, 0x90, 0xac, 0x93, 0x71,
+    0x4e, 0x29, 0x04, 0x00, 0x00, 0x00, 0x23, 0x47, 0x6a, 0x8b, 0xa8, 0x99, 0x84, 0x76, 0x6f, 0x6e,
+    0x72, 0x7d, 0x81, 0x5b, 0x35, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x2e, 0x53, 0x76, 0x98, 0xaa, 0x8c, 0x73, 0x5e, 0x4f, 0x47, 0x46, 0x4c, 0x5a,
+    0x6e, 0x88, 0x81, 0x63, 0x45, 0x21, 0x00, 0x00, 0x09, 0x2f, 0x53, 0x77, 0x98, 0xaa, 0x8c, 0x73,
+    0x5e, 0x50, 0x48, 0x46, 0x4b, 0x57, 0x6a, 0x81, 0x86, 0x68, 0x4a, 0x27, 0x00, 0x06, 0x30, 0x5a,
+    0x85, 0xaf, 0x8b, 0x61, 0x37, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x35, 0x5f, 0x8a, 0xad, 0x83, 0x59,
+    0x2e, 0x04, 0x00, 0x00, 0x10, 0x37, 0x5e, 0x84, 0xab, 0x89, 0x63, 0x3c, 0x15, 0x26, 0x4d, 0x74,
+    0x9b, 0x94, 0x6d, 0x46, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x62, 0x8c, 0xa4,
+    0x7b, 0x54, 0x3d, 0x58, 0x79, 0x9f, 0x89, 0x60, 0x36, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x50, 0x78, 0x9f, 0x9d, 0x78, 0x54, 0x32, 0x15,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x2d, 0x4f, 0x73, 0x98, 0xa6, 0x7e, 0x56, 0x2e, 0x05, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x07, 0x2f, 0x56, 0x7b, 0x9d, 0x82,
+    0x71, 0x75, 0x8c, 0x90, 0x6c, 0x70, 0x93, 0x8a, 0x67, 0x5b, 0x68, 0x6b, 0x66, 0x58, 0x42, 0x27,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x14, 0x3b, 0x62, 0x88, 0xac, 0x90, 0x70, 0x56, 0x48, 0x48, 0x56, 0x70, 0x90, 0xac, 0x88,
+    0x62, 0x3c, 0x15, 0x00, 0x00, 0x10, 0x37, 0x5d, 0x82, 0xa5, 0x96, 0x78, 0x5f, 0x4d, 0x44, 0x43,
+    0x48, 0x56, 0x64, 0x48, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x41, 0x67, 0x8d, 0xb1, 0x8f, 0x6e, 0x51, 0x38, 0x27, 0x1d, 0x1c, 0x23, 0x34,
+    0x4c, 0x69, 0x62, 0x45, 0x27, 0x0a, 0x00, 0x00, 0x1a, 0x41, 0x68, 0x8d, 0xb1, 0x8f, 0x6e, 0x51,
+    0x39, 0x27, 0x1e, 0x1c, 0x22, 0x30, 0x46, 0x61, 0x68, 0x4a, 0x2c, 0x0e, 0x00, 0x06, 0x30, 0x5a,
+    0x85, 0xaf, 0x8b, 0x61, 0x37, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x35, 0x5f, 0x8a, 0xad, 0x83, 0x59,
+    0x2e, 0x04, 0x00, 0x00, 0x00, 0x26, 0x4c, 0x73, 0x9a, 0x9a, 0x74, 0x4d, 0x26, 0x37, 0x5e, 0x85,
+    0xa9, 0x83, 0x5c, 0x35, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2f, 0x58, 0x7f, 0xa4,
+    0x8f, 0x6d, 0x61, 0x79, 0x94, 0x9a, 0x77, 0x52, 0x2b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x31, 0x5b, 0x84, 0xad, 0x8e, 0x66, 0x3f, 0x19, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x39, 0x60, 0x88, 0xb1, 0x8b, 0x62, 0x38, 0x0e, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x1c, 0x40, 0x61, 0x7e, 0x94,
+    0x9b, 0x9b, 0x8d, 0x74, 0x65, 0x88, 0x95, 0x72, 0x67, 0x80, 0x91, 0x96, 0x8f, 0x7d, 0x63, 0x43,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x22, 0x4a, 0x72, 0x9a, 0x9f, 0x79, 0x55, 0x34, 0x1e, 0x1e, 0x34, 0x55, 0x79, 0xa0, 0x9a,
+    0x73, 0x4b, 0x22, 0x00, 0x00, 0x1f, 0x47, 0x6f, 0x96, 0xa3, 0x7e, 0x5b, 0x3c, 0x25, 0x1e, 0x1c,
+    0x1f, 0x31, 0x3a, 0x2b, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0x50, 0x78, 0xa0, 0x9d, 0x78, 0x54, 0x32, 0x15, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x2d, 0x44, 0x40, 0x26, 0x09, 0x00, 0x00, 0x00, 0x28, 0x50, 0x78, 0xa0, 0x9e, 0x78, 0x54, 0x32,
+    0x15, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x25, 0x3e, 0x42, 0x2c, 0x0e, 0x00, 0x00, 0x06, 0x30, 0x5a,
+    0x85, 0xaf, 0x8b, 0x61, 0x37, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x35, 0x5f, 0x8a, 0xad, 0x83, 0x59,
+    0x2e, 0x04, 0x00, 0x00, 0x00, 0x15, 0x3b, 0x62, 0x89, 0xab, 0x85, 0x5e, 0x37, 0x48, 0x6f, 0x96,
+    0x98, 0x72, 0x4b, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x46, 0x6a, 0x8c,
+    0xa9, 0x8a, 0x85, 0x9b, 0x97, 0x7c, 0x5e, 0x3d, 0x19, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x37, 0x61, 0x8c, 0xaf, 0x85, 0x5b, 0x32, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2b, 0x55, 0x7e, 0xa8, 0x92, 0x68, 0x3e, 0x14, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x05, 0x26, 0x43, 0x5b, 0x6c,
+    0x73, 0x72, 0x67, 0x5a, 0x7d, 0xa0, 0x7d, 0x5f, 0x83, 0x9a, 0x81, 0x79, 0x84, 0x9e, 0x7e, 0x5a,
+    0x35, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x2d, 0x56, 0x7f, 0xa8, 0x91, 0x69, 0x41, 0x1a, 0x00, 0x00, 0x1b, 0x41, 0x69, 0x91, 0xa8,
+    0x7f, 0x56, 0x2d, 0x03, 0x01, 0x2a, 0x54, 0x7d, 0xa5, 0x93, 0x6b, 0x44, 0x40, 0x47, 0x48, 0x46,
+    0x3e, 0x32, 0x21, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x31, 0x5b, 0x84, 0xad, 0x8e, 0x66, 0x3f, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x1a, 0x18, 0x06, 0x00, 0x00, 0x00, 0x08, 0x31, 0x5b, 0x84, 0xad, 0x8e, 0x66, 0x3f, 0x19,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x26, 0x2b, 0x2b, 0x2b, 0x20, 0x07, 0x00, 0x06, 0x30, 0x5a,
+    0x85, 0xaf, 0x8b, 0x61, 0x37, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x35, 0x5f, 0x8a, 0xad, 0x83, 0x59,
+    0x2e, 0x04, 0x00, 0x00, 0x00, 0x03, 0x2a, 0x51, 0x78, 0x9e, 0x95, 0x6f, 0x48, 0x59, 0x80, 0xa6,
+    0x87, 0x60, 0x3a, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x22, 0x3c, 0x55, 0x70,
+    0x8f, 0xa9, 0xa6, 0x8b, 0x74, 0x5c, 0x40, 0x33, 0x3f, 0x34, 0x27, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x3a, 0x64, 0x8e, 0xac, 0x82, 0x57, 0x2d, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x51, 0x7b, 0xa5, 0x95, 0x6b, 0x40, 0x16, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x07, 0x21, 0x36, 0x43,
+    0x49, 0x48, 0x4f, 0x72, 0x95, 0x88, 0x65, 0x70, 0x98, 0x80, 0x5e, 0x4f, 0x63, 0x86, 0x93, 0x6c,
+    0x43, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x34, 0x5e, 0x88, 0xb1, 0x88, 0x5f, 0x35, 0x0c, 0x00, 0x00, 0x0c, 0x35, 0x5e, 0x88, 0xb2,
+    0x88, 0x5e, 0x34, 0x0a, 0x09, 0x32, 0x5c, 0x86, 0xb0, 0x89, 0x5f, 0x5d, 0x6a, 0x71, 0x73, 0x70,
+    0x67, 0x59, 0x46, 0x2e, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0d, 0x37, 0x61, 0x8c, 0xaf, 0x85, 0x5b, 0x32, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x37, 0x62, 0x8c, 0xaf, 0x85, 0x5b, 0x32, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x2d, 0x4d, 0x55, 0x55, 0x55, 0x42, 0x1f, 0x00, 0x06, 0x30, 0x5a,
+    0x85, 0xaf, 0x8b, 0x61, 0x37, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x35, 0x5f, 0x8a, 0xad, 0x83, 0x59,
+    0x2e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x19, 0x40, 0x67, 0x8d, 0xa6, 0x80, 0x59, 0x69, 0x90, 0x9d,
+    0x76, 0x4f, 0x29, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x41, 0x5e, 0x77, 0x8f,
+    0xa3, 0x92, 0xa8, 0x89, 0x6c, 0x4e, 0x30, 0x51, 0x69, 0x5d, 0x4f, 0x3a, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x62, 0x8c, 0xae, 0x84, 0x5a, 0x30, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x53, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x15, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1a,
+    0x21, 0x44, 0x67, 0x8a, 0x93, 0x70, 0x50, 0x7a, 0x9b, 0x72, 0x49, 0x27, 0x4f, 0x78, 0x9f, 0x76,
+    0x4c, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x38, 0x62, 0x8c, 0xae, 0x83, 0x59, 0x2f, 0x05, 0x00, 0x00, 0x05, 0x2f, 0x59, 0x83, 0xad,
+    0x8d, 0x63, 0x38, 0x0e, 0x0d, 0x37, 0x62, 0x8c, 0xad, 0x83, 0x6e, 0x84, 0x92, 0x9b, 0x9d, 0x9a,
+    0x90, 0x80, 0x69, 0x4e, 0x2f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x3a, 0x64, 0x8e, 0xac, 0x82, 0x57, 0x2d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x3a, 0x64, 0x8e, 0xac, 0x82, 0x57, 0x2d, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x39, 0x64, 0x7f, 0x7f, 0x7e, 0x54, 0x29, 0x00, 0x06, 0x30, 0x5a,
+    0x85, 0xaf, 0x8b, 0x61, 0x37, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x35, 0x5f, 0x8a, 0xad, 0x83, 0x59,
+    0x2e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x2f, 0x55, 0x7c, 0xa3, 0x91, 0x6a, 0x7a, 0xa1, 0x8c,
+    0x65, 0x3e, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x5e, 0x7d, 0x99, 0x98,
+    0x7f, 0x71, 0x8e, 0xa7, 0x8a, 0x6c, 0x4e, 0x5c, 0x85, 0x85, 0x76, 0x4d, 0x23, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x5c, 0x86, 0xaf, 0x8c, 0x63, 0x3b, 0x15, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x36, 0x5d, 0x86, 0xaf, 0x8d, 0x63, 0x3a, 0x10, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+    0x39, 0x5c, 0x7e, 0x9e, 0x7b, 0x58, 0x53, 0x7e, 0x98, 0x6e, 0x43, 0x1f, 0x49, 0x73, 0x9e, 0x79,
+    0x4f, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x3a, 0x64, 0x8e, 0xac, 0x82, 0x57, 0x2d, 0x03, 0x00, 0x00, 0x02, 0x2d, 0x57, 0x81, 0xac,
+    0x8f, 0x64, 0x3a, 0x10, 0x0f, 0x39, 0x64, 0x8e, 0xac, 0x82, 0x90, 0xa2, 0x92, 0x8b, 0x8b, 0x92,
+    0xa1, 0xa4, 0x8a, 0x6b, 0x48, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x38, 0x62, 0x8c, 0xae, 0x84, 0x5a, 0x30, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x62, 0x8c, 0xae, 0x84, 0x5a, 0x30, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x39, 0x64, 0x8e, 0xa8, 0x7e, 0x54, 0x29, 0x00, 0x06, 0x30, 0x5a,
+    0x85, 0xaf, 0x8b, 0x61, 0x37, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x35, 0x5f, 0x8a, 0xad, 0x83, 0x59,
+    0x2e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x44, 0x6b, 0x92, 0xa1, 0x7b, 0x8b, 0xa1, 0x7b,
+    0x54, 0x2d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2b, 0x51, 0x77, 0x9a, 0x97, 0x77,
+    0x5c, 0x53, 0x70, 0x8e, 0xa8, 0x8a, 0x6c, 0x68, 0x90, 0x99, 0x70, 0x47, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2a, 0x52, 0x7b, 0xa3, 0x9a, 0x73, 0x4e, 0x2c, 0x0e,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x27, 0x49, 0x6e, 0x94, 0xa9, 0x81, 0x59, 0x30, 0x07, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2d,
+    0x50, 0x73, 0x96, 0x86, 0x63, 0x40, 0x51, 0x7b, 0x9b, 0x71, 0x47, 0x25, 0x4d, 0x77, 0xa0, 0x76,
+    0x4c, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x39, 0x63, 0x8d, 0xad, 0x83, 0x59, 0x2e, 0x04, 0x00, 0x00, 0x04, 0x2e, 0x58, 0x82, 0xad,
+    0x8d, 0x63, 0x39, 0x0f, 0x0f, 0x39, 0x63, 0x8e, 0xb2, 0x95, 0x9a, 0x7e, 0x6a, 0x61, 0x60, 0x69,
+    0x7d, 0x99, 0xa6, 0x82, 0x5d, 0x35, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x33, 0x5d, 0x86, 0xaf, 0x8c, 0x63, 0x3b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x13, 0x11, 0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x5d, 0x86, 0xaf, 0x8c, 0x64, 0x3c, 0x15,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x39, 0x64, 0x8e, 0xa8, 0x7e, 0x54, 0x29, 0x00, 0x05, 0x2f, 0x5a,
+    0x84, 0xae, 0x8c, 0x62, 0x38, 0x0e, 0x00, 0x00, 0x00, 0x0d, 0x37, 0x61, 0x8b, 0xac, 0x82, 0x58,
+    0x2e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x33, 0x5a, 0x81, 0xa7, 0x8c, 0x9c, 0x90, 0x6a,
+    0x43, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x37, 0x60, 0x89, 0xa9, 0x81, 0x5c,
+    0x3b, 0x35, 0x52, 0x70, 0x8e, 0xa8, 0x8a, 0x77, 0x9e, 0x8c, 0x64, 0x3b, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x44, 0x6b, 0x91, 0xad, 0x89, 0x68, 0x4a, 0x31,
+    0x1e, 0x15, 0x14, 0x1c, 0x2d, 0x46, 0x63, 0x84, 0xa8, 0x97, 0x72, 0x4b, 0x23, 0x00, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x45,
+    0x68, 0x8b, 0x91, 0x6e, 0x4b, 0x28, 0x49, 0x72, 0x9a, 0x7e, 0x5a, 0x4a, 0x5f, 0x84, 0x95, 0x6d,
+    0x44, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0x35, 0x5f, 0x89, 0xb1, 0x87, 0x5d, 0x33, 0x0a, 0x00, 0x00, 0x0a, 0x33, 0x5d, 0x87, 0xb1,
+    0x89, 0x5f, 0x35, 0x0b, 0x0c, 0x36, 0x60, 0x8a, 0xb4, 0xa6, 0x80, 0x5e, 0x44, 0x37, 0x36, 0x42,
+    0x5d, 0x80, 0xa6, 0x93, 0x6a, 0x41, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x2a, 0x53, 0x7b, 0xa3, 0x9a, 0x73, 0x4e, 0x2c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x28, 0x3c, 0x39, 0x21, 0x03, 0x00, 0x00, 0x01, 0x2a, 0x53, 0x7b, 0xa3, 0x9a, 0x74, 0x4f, 0x2d,
+    0x0f, 0x00, 0x00, 0x00, 0x0f, 0x39, 0x64, 0x8e, 0xa8, 0x7e, 0x54, 0x29, 0x00, 0x02, 0x2c, 0x56,
+    0x7f, 0xa9, 0x92, 0x68, 0x3f, 0x17, 0x00, 0x00, 0x00, 0x16, 0x3e, 0x67, 0x91, 0xa8, 0x7e, 0x54,
+    0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x49, 0x6f, 0x96, 0xad, 0xa6, 0x7f, 0x59,
+    0x32, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x3c, 0x67, 0x91, 0xa3, 0x79, 0x4e,
+    0x24, 0x17, 0x34, 0x52, 0x70, 0x8e, 0xa8, 0x92, 0xa1, 0x7b, 0x55, 0x2d, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x32, 0x57, 0x7b, 0x9d, 0xa4, 0x86, 0x6b, 0x56,
+    0x47, 0x3f, 0x3e, 0x45, 0x53, 0x67, 0x81, 0x9f, 0xa3, 0x81, 0x5e, 0x39, 0x13, 0x00, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x3a, 0x5d,
+    0x80, 0x9c, 0x79, 0x57, 0x34, 0x14, 0x3c, 0x62, 0x86, 0x95, 0x7c, 0x74, 0x7f, 0x9b, 0x81, 0x5d,
+    0x37, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x2e, 0x58, 0x81, 0xaa, 0x8f, 0x66, 0x3e, 0x17, 0x00, 0x00, 0x17, 0x3e, 0x66, 0x8f, 0xaa,
+    0x81, 0x58, 0x2f, 0x05, 0x07, 0x31, 0x5a, 0x84, 0xad, 0x9b, 0x72, 0x48, 0x22, 0x0d, 0x0c, 0x21,
+    0x49, 0x73, 0x9d, 0x9b, 0x71, 0x46, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1d, 0x45, 0x6b, 0x91, 0xad, 0x89, 0x68, 0x4a, 0x31, 0x1f, 0x15, 0x14, 0x1c, 0x2d,
+    0x47, 0x64, 0x5d, 0x3f, 0x22, 0x04, 0x00, 0x00, 0x1d, 0x45, 0x6b, 0x91, 0xae, 0x8a, 0x69, 0x4b,
+    0x32, 0x1f, 0x15, 0x14, 0x19, 0x39, 0x64, 0x8e, 0xa8, 0x7e, 0x54, 0x29, 0x00, 0x00, 0x25, 0x4e,
+    0x77, 0xa0, 0x9d, 0x75, 0x4f, 0x2d, 0x18, 0x13, 0x18, 0x2d, 0x4e, 0x74, 0x9c, 0x9e, 0x75, 0x4c,
+    0x23, 0x00, 0x00, 0x00, 0x00, 0x12, 0x1a, 0x11, 0x11, 0x38, 0x5e, 0x85, 0xac, 0x95, 0x6e, 0x47,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x3b, 0x65, 0x8f, 0xa8, 0x80, 0x5b,
+    0x41, 0x36, 0x35, 0x3c, 0x52, 0x70, 0x8e, 0xb7, 0x8e, 0x6d, 0x4f, 0x31, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x61, 0x81, 0x9e, 0xa6, 0x8f, 0x7d,
+    0x70, 0x69, 0x68, 0x6e, 0x7a, 0x8c, 0xa2, 0xa3, 0x87, 0x67, 0x46, 0x23, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2a, 0x52, 0x75,
+    0x95, 0x85, 0x62, 0x3f, 0x1c, 0x03, 0x28, 0x4b, 0x6b, 0x85, 0x96, 0x9b, 0x94, 0x82, 0x66, 0x46,
+    0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x24, 0x4d, 0x75, 0x9d, 0x9c, 0x75, 0x50, 0x2e, 0x16, 0x16, 0x2e, 0x50, 0x76, 0x9c, 0x9d,
+    0x76, 0x4d, 0x25, 0x00, 0x00, 0x28, 0x51, 0x7a, 0xa2, 0x9b, 0x71, 0x48, 0x22, 0x0d, 0x0c, 0x21,
+    0x49, 0x73, 0x9d, 0x9a, 0x70, 0x46, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x33, 0x58, 0x7c, 0x9e, 0xa4, 0x86, 0x6c, 0x56, 0x47, 0x3f, 0x3e, 0x44, 0x53,
+    0x68, 0x82, 0x7b, 0x5e, 0x40, 0x1e, 0x00, 0x00, 0x0d, 0x33, 0x58, 0x7b, 0x9d, 0xa4, 0x86, 0x6c,
+    0x57, 0x48, 0x3f, 0x3e, 0x42, 0x4e, 0x64, 0x8e, 0xa8, 0x7e, 0x54, 0x29, 0x00, 0x00, 0x1a, 0x42,
+    0x69, 0x90, 0xae, 0x89, 0x69, 0x4f, 0x41, 0x3e, 0x41, 0x4f, 0x68, 0x89, 0xad, 0x8f, 0x68, 0x41,
+    0x18, 0x00, 0x00, 0x00, 0x1a, 0x38, 0x44, 0x36, 0x1e, 0x39, 0x60, 0x86, 0xab, 0x84, 0x5d, 0x36,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x32, 0x5a, 0x81, 0xa6, 0x97, 0x7b,
+    0x69, 0x60, 0x5f, 0x65, 0x73, 0x87, 0xa1, 0x96, 0xa9, 0x8b, 0x6d, 0x4f, 0x31, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x26, 0x45, 0x63, 0x7d, 0x95, 0xa8, 0xa4,
+    0x99, 0x93, 0x93, 0x97, 0xa2, 0xab, 0x99, 0x82, 0x68, 0x4b, 0x2c, 0x0b, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2a, 0x52, 0x6a,
+    0x6a, 0x69, 0x4a, 0x27, 0x04, 0x00, 0x10, 0x2f, 0x4a, 0x60, 0x6d, 0x70, 0x6b, 0x5d, 0x46, 0x2a,
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x17, 0x3f, 0x66, 0x8c, 0xae, 0x8b, 0x6a, 0x4f, 0x3f, 0x3f, 0x4f, 0x6a, 0x8b, 0xaf, 0x8c,
+    0x66, 0x3f, 0x18, 0x00, 0x00, 0x1c, 0x44, 0x6b, 0x91, 0xa6, 0x80, 0x5d, 0x43, 0x37, 0x36, 0x42,
+    0x5d, 0x80, 0xa7, 0x91, 0x68, 0x3f, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1e, 0x41, 0x62, 0x82, 0x9f, 0xa7, 0x90, 0x7d, 0x70, 0x69, 0x68, 0x6e, 0x7a,
+    0x8c, 0xa3, 0x9a, 0x7c, 0x53, 0x28, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x62, 0x81, 0x9e, 0xa7, 0x90,
+    0x7e, 0x70, 0x69, 0x68, 0x6c, 0x76, 0x85, 0x9a, 0xa8, 0x7e, 0x54, 0x29, 0x00, 0x00, 0x0b, 0x32,
+    0x57, 0x7b, 0x9d, 0xa5, 0x8a, 0x76, 0x6b, 0x68, 0x6b, 0x76, 0x8a, 0xa4, 0x9d, 0x7b, 0x56, 0x30,
+    0x0a, 0x00, 0x00, 0x0a, 0x2f, 0x54, 0x6f, 0x57, 0x48, 0x51, 0x73, 0x98, 0x99, 0x73, 0x4c, 0x25,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x48, 0x6a, 0x89, 0xa2, 0xa0,
+    0x91, 0x8a, 0x8a, 0x8f, 0x9a, 0xa4, 0x8e, 0x73, 0x8d, 0xa9, 0x8b, 0x6c, 0x44, 0x1a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x27, 0x42, 0x5a, 0x70, 0x81, 0x8f,
+    0x98, 0x9c, 0x9c, 0x99, 0x91, 0x84, 0x73, 0x5f, 0x47, 0x2c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0x95, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x34, 0x40,
+    0x40, 0x3f, 0x2e, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x27, 0x38, 0x43, 0x46, 0x42, 0x36, 0x23, 0x0b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x2d, 0x52, 0x76, 0x98, 0xa6, 0x8a, 0x74, 0x69, 0x69, 0x74, 0x8a, 0xa6, 0x98, 0x76,
+    0x52, 0x2d, 0x07, 0x00, 0x00, 0x0c, 0x33, 0x58, 0x7c, 0x9e, 0x99, 0x7e, 0x6a, 0x61, 0x60, 0x69,
+    0x7c, 0x98, 0xa2, 0x7f, 0x59, 0x32, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x27, 0x46, 0x63, 0x7e, 0x96, 0xa9, 0xa5, 0x99, 0x93, 0x93, 0x97, 0xa2,
+    0xa9, 0x96, 0x7e, 0x62, 0x43, 0x20, 0x00, 0x00, 0x00, 0x05, 0x26, 0x45, 0x63, 0x7d, 0x95, 0xa8,
+    0xa5, 0x9a, 0x94, 0x92, 0x96, 0x9e, 0xac, 0x9d, 0x88, 0x70, 0x50, 0x27, 0x00, 0x00, 0x00, 0x1d,
+    0x40, 0x62, 0x80, 0x9a, 0xae, 0x9e, 0x95, 0x92, 0x95, 0x9e, 0xae, 0x9a, 0x80, 0x61, 0x40, 0x1c,
+    0x00, 0x00, 0x00, 0x1f, 0x44, 0x69, 0x8e, 0x7c, 0x72, 0x76, 0x8d, 0xa8, 0x85, 0x61, 0x3b, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2f, 0x4d, 0x68, 0x7d, 0x8d,
+    0x98, 0x9c, 0x9c, 0x97, 0x8d, 0x7e, 0x6a, 0x52, 0x6f, 0x8d, 0x7e, 0x5e, 0x3c, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x20, 0x36, 0x4a, 0x5a, 0x66,
+    0x6e, 0x72, 0x72, 0x6f, 0x67, 0x5c, 0x4d, 0x3a, 0x24, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x35, 0x5c, 0x6a, 0x6a, 0x6a, 0x50, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x16,
+    0x16, 0x15, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x19, 0x1c, 0x18, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x3b, 0x5d, 0x7c, 0x98, 0xad, 0x9c, 0x93, 0x93, 0x9c, 0xad, 0x98, 0x7c, 0x5d,
+    0x3b, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x41, 0x63, 0x81, 0x9c, 0xa2, 0x93, 0x8b, 0x8b, 0x91,
+    0xa1, 0xa0, 0x86, 0x66, 0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x28, 0x43, 0x5b, 0x71, 0x82, 0x8f, 0x98, 0x9c, 0x9c, 0x98, 0x90,
+    0x82, 0x71, 0x5b, 0x42, 0x26, 0x08, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x27, 0x42, 0x5a, 0x70, 0x81,
+    0x8f, 0x98, 0x9c, 0x9c, 0x99, 0x91, 0x86, 0x77, 0x64, 0x4e, 0x34, 0x16, 0x00, 0x00, 0x00, 0x05,
+    0x26, 0x44, 0x5f, 0x76, 0x88, 0x94, 0x9b, 0x9d, 0x9b, 0x94, 0x88, 0x76, 0x5f, 0x44, 0x25, 0x05,
+    0x00, 0x00, 0x02, 0x2c, 0x56, 0x7e, 0x9f, 0xa4, 0x9c, 0x9f, 0xa5, 0x8c, 0x6d, 0x4b, 0x27, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2d, 0x44, 0x57, 0x65,
+    0x6e, 0x72, 0x72, 0x6e, 0x65, 0x57, 0x45, 0x33, 0x51, 0x6f, 0x63, 0x42, 0x22, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x23, 0x31, 0x3c,
+    0x44, 0x48, 0x48, 0x45, 0x3e, 0x34, 0x26, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x3a, 0x40, 0x40, 0x40, 0x33, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x40, 0x5c, 0x75, 0x88, 0x95, 0x9c, 0x9c, 0x96, 0x88, 0x75, 0x5c, 0x40,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x27, 0x45, 0x61, 0x78, 0x8a, 0x96, 0x9c, 0x9d, 0x98,
+    0x8d, 0x7c, 0x65, 0x4a, 0x2b, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x21, 0x37, 0x4a, 0x5a, 0x66, 0x6e, 0x72, 0x72, 0x6e, 0x67,
+    0x5b, 0x4b, 0x37, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20, 0x36, 0x4a, 0x5a,
+    0x66, 0x6e, 0x72, 0x72, 0x6f, 0x68, 0x5e, 0x50, 0x3e, 0x2a, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x24, 0x3c, 0x51, 0x60, 0x6b, 0x71, 0x72, 0x71, 0x6a, 0x60, 0x50, 0x3c, 0x23, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x24, 0x48, 0x64, 0x79, 0x87, 0x8c, 0x8a, 0x7f, 0x6b, 0x50, 0x31, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x2f, 0x3c,
+    0x44, 0x48, 0x48, 0x44, 0x3c, 0x30, 0x20, 0x15, 0x33, 0x4a, 0x44, 0x27, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x13,
+    0x1a, 0x1d, 0x1e, 0x1b, 0x15, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x12, 0x16, 0x16, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x0d, 0x13, 0x15, 0x14, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x21, 0x3a, 0x50, 0x61, 0x6c, 0x72, 0x72, 0x6c, 0x61, 0x50, 0x3a, 0x21,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x25, 0x3e, 0x52, 0x62, 0x6c, 0x71, 0x72, 0x6e,
+    0x65, 0x56, 0x42, 0x2a, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x24, 0x32, 0x3d, 0x44, 0x48, 0x48, 0x44, 0x3d,
+    0x33, 0x24, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x23, 0x31,
+    0x3c, 0x44, 0x48, 0x48, 0x45, 0x3f, 0x35, 0x28, 0x18, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x18, 0x2a, 0x38, 0x41, 0x46, 0x48, 0x46, 0x41, 0x37, 0x29, 0x17, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x29, 0x40, 0x52, 0x5d, 0x62, 0x60, 0x57, 0x47, 0x30, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x13,
+    0x1a, 0x1d, 0x1d, 0x1a, 0x12, 0x07, 0x00, 0x00, 0x12, 0x20, 0x1c, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x1e, 0x2d,
+    0x37, 0x3d, 0x40, 0x3f, 0x3a, 0x32, 0x25, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x23,
+    0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x2a, 0x39, 0x43, 0x48, 0x48, 0x43, 0x39, 0x2a, 0x16, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x19, 0x2c, 0x39, 0x42, 0x47, 0x48, 0x44,
+    0x3c, 0x2f, 0x1d, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x13, 0x1a, 0x1d, 0x1d, 0x1a, 0x14,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x13, 0x1a, 0x1d, 0x1e, 0x1b, 0x15, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x0f, 0x17, 0x1c, 0x1e, 0x1c, 0x17, 0x0e, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1b, 0x2a, 0x33, 0x37, 0x36, 0x2e, 0x20, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0c, 0x13, 0x15, 0x14, 0x0f, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0e, 0x13, 0x15, 0x15, 0x11,
+    0x0b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x30, 0x45, 0x55,
+    0x60, 0x67, 0x6a, 0x69, 0x64, 0x5b, 0x4c, 0x39, 0x22, 0x07, 0x00, 0x00, 0x00, 0x00, 0x16, 0x3e,
+    0x5e, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5a, 0x39, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x19, 0x1d, 0x1d, 0x19, 0x10, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x19, 0x1d, 0x1e, 0x1a,
+    0x13, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x0d, 0x0c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0d,
+    0x0f, 0x0d, 0x06, 0x00, 0x06, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x0a,
+    0x0a, 0x01, 0x02, 0x0a, 0x0e, 0x0e, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x19, 0x29, 0x36, 0x3d, 0x40, 0x3e, 0x39, 0x2f, 0x20, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x1f, 0x2d, 0x37, 0x3d, 0x40, 0x3f, 0x3b,
+    0x34, 0x2a, 0x1c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x52, 0x6a, 0x7d,
+    0x8a, 0x91, 0x94, 0x93, 0x8e, 0x83, 0x73, 0x5d, 0x42, 0x24, 0x02, 0x00, 0x00, 0x00, 0x1a, 0x45,
+    0x6f, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x69, 0x3f, 0x15, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x0d, 0x0f, 0x0c, 0x05, 0x00, 0x08, 0x0a, 0x0a, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x14, 0x15, 0x14, 0x0e, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0e, 0x0e, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x26, 0x31, 0x37,
+    0x39, 0x37, 0x30, 0x24, 0x2f, 0x34, 0x34, 0x34, 0x26, 0x09, 0x00, 0x00, 0x18, 0x2f, 0x34, 0x34,
+    0x34, 0x27, 0x2a, 0x34, 0x39, 0x39, 0x34, 0x2a, 0x1c, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x27, 0x3e, 0x51, 0x5f, 0x67, 0x6a, 0x68, 0x62, 0x57, 0x47, 0x32, 0x19, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x31, 0x46, 0x56, 0x61, 0x67, 0x6a, 0x69, 0x65,
+    0x5d, 0x52, 0x44, 0x31, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x2d, 0x51, 0x71, 0x8d, 0xa3,
+    0xa2, 0x97, 0x93, 0x94, 0x9d, 0xab, 0x98, 0x7e, 0x5f, 0x3d, 0x18, 0x00, 0x00, 0x00, 0x1a, 0x45,
+    0x6f, 0x99, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa8, 0xb7, 0x94, 0x69, 0x3f, 0x15, 0x00,
+    0x00, 0x00, 0x0a, 0x0e, 0x0e, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x14, 0x12, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x16, 0x26, 0x31,
+    0x37, 0x39, 0x36, 0x2f, 0x22, 0x31, 0x34, 0x34, 0x33, 0x22, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x2c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0x24, 0x31, 0x39, 0x3e, 0x40, 0x3e, 0x38, 0x2e, 0x1f, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0x32, 0x38, 0x38, 0x38, 0x2c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x34, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x28, 0x3d, 0x4e, 0x5a, 0x61,
+    0x64, 0x61, 0x59, 0x4b, 0x54, 0x5e, 0x5e, 0x5e, 0x45, 0x1f, 0x00, 0x09, 0x31, 0x54, 0x5e, 0x5e,
+    0x5e, 0x46, 0x53, 0x5e, 0x63, 0x63, 0x5d, 0x53, 0x43, 0x2f, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x2b, 0x48, 0x62, 0x77, 0x87, 0x91, 0x94, 0x92, 0x8c, 0x7f, 0x6c, 0x55, 0x39, 0x1a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x54, 0x6b, 0x7e, 0x8a, 0x91, 0x94, 0x93, 0x8f,
+    0x87, 0x7b, 0x6a, 0x56, 0x3b, 0x16, 0x00, 0x00, 0x00, 0x00, 0x17, 0x3f, 0x66, 0x8b, 0xad, 0x94,
+    0x7c, 0x6d, 0x68, 0x6a, 0x74, 0x88, 0xa4, 0x9b, 0x77, 0x51, 0x29, 0x01, 0x00, 0x00, 0x1a, 0x44,
+    0x6d, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x97, 0x9e, 0x7d, 0x5c, 0x39, 0x11, 0x00,
+    0x00, 0x1a, 0x32, 0x38, 0x38, 0x38, 0x2c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x20, 0x30, 0x3a, 0x3e, 0x3c, 0x35, 0x27,
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x26, 0x3c, 0x4d, 0x5a,
+    0x61, 0x64, 0x60, 0x57, 0x49, 0x59, 0x5e, 0x5e, 0x5c, 0x3f, 0x18, 0x00, 0x00, 0x00, 0x00, 0x25,
+    0x4b, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5b, 0x39, 0x12, 0x00, 0x00,
+    0x00, 0x0b, 0x24, 0x3a, 0x4c, 0x5a, 0x63, 0x68, 0x6a, 0x68, 0x62, 0x56, 0x46, 0x30, 0x16, 0x00,
+    0x00, 0x00, 0x0a, 0x32, 0x56, 0x62, 0x62, 0x62, 0x4c, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x4c, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+    0x62, 0x62, 0x62, 0x59, 0x37, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x2f, 0x4a, 0x62, 0x75, 0x83, 0x8b,
+    0x8e, 0x8b, 0x81, 0x72, 0x63, 0x89, 0x89, 0x79, 0x4f, 0x25, 0x00, 0x0e, 0x38, 0x63, 0x89, 0x89,
+    0x7b, 0x67, 0x7a, 0x87, 0x8d, 0x8d, 0x87, 0x7b, 0x69, 0x52, 0x37, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x23, 0x46, 0x67, 0x84, 0x9d, 0xa5, 0x98, 0x93, 0x95, 0x9d, 0xa6, 0x90, 0x75, 0x56, 0x35,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x33, 0x55, 0x75, 0x8f, 0xa4, 0xa3, 0x9a, 0x97, 0x98, 0x9e,
+    0xa8, 0xa2, 0x90, 0x74, 0x49, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x21, 0x4b, 0x74, 0x9d, 0x9f, 0x78,
+    0x58, 0x44, 0x3e, 0x40, 0x4e, 0x68, 0x8c, 0xaf, 0x87, 0x5d, 0x34, 0x0a, 0x00, 0x00, 0x0e, 0x31,
+    0x4a, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4f, 0x6f, 0x90, 0xa5, 0x84, 0x63, 0x42, 0x21, 0x00, 0x00,
+    0x0a, 0x32, 0x56, 0x62, 0x62, 0x62, 0x4c, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2c, 0x45, 0x58, 0x64, 0x68, 0x66, 0x5d, 0x4d,
+    0x35, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2c, 0x48, 0x61, 0x75, 0x83,
+    0x8b, 0x8e, 0x8a, 0x80, 0x6f, 0x6b, 0x89, 0x89, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x2c,
+    0x56, 0x80, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x6a, 0x40, 0x16, 0x00, 0x00,
+    0x0c, 0x2a, 0x46, 0x5e, 0x73, 0x82, 0x8d, 0x93, 0x94, 0x92, 0x8b, 0x7e, 0x6a, 0x52, 0x34, 0x13,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0x8d, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2b, 0x56, 0x80, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
+    0x8c, 0x8c, 0x8c, 0x68, 0x3d, 0x13, 0x00, 0x00, 0x07, 0x2a, 0x4c, 0x6a, 0x86, 0x9c, 0xac, 0xa1,
+    0x9c, 0x9e, 0xa7, 0x97, 0x7e, 0x8e, 0xa4, 0x79, 0x4f, 0x25, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa5,
+    0x7b, 0x8a, 0xa1, 0xa2, 0x9c, 0x9e, 0xa8, 0xa2, 0x8d, 0x73, 0x55, 0x34, 0x11, 0x00, 0x00, 0x00,
+    0x0f, 0x36, 0x5c, 0x81, 0xa3, 0x99, 0x7f, 0x6f, 0x68, 0x6b, 0x76, 0x8a, 0xa5, 0x92, 0x70, 0x4c,
+    0x27, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x46, 0x6c, 0x91, 0xad, 0x90, 0x7b, 0x71, 0x6d, 0x6e, 0x74,
+    0x80, 0x8f, 0x8c, 0x64, 0x3d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x24, 0x4f, 0x79, 0xa3, 0x96, 0x6c,
+    0x42, 0x1d, 0x14, 0x17, 0x2e, 0x58, 0x82, 0xac, 0x8c, 0x62, 0x38, 0x0d, 0x00, 0x00, 0x00, 0x11,
+    0x20, 0x22, 0x22, 0x22, 0x28, 0x49, 0x69, 0x8a, 0xab, 0x8a, 0x69, 0x48, 0x27, 0x06, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0x8d, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x28, 0x4a, 0x68, 0x7f, 0x8d, 0x92, 0x90, 0x85, 0x71,
+    0x4c, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x28, 0x49, 0x68, 0x84, 0x9b, 0xab,
+    0xa1, 0x9c, 0x9f, 0xa7, 0x93, 0x79, 0x96, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x06, 0x30,
+    0x5a, 0x84, 0xae, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x95, 0x6a, 0x40, 0x16, 0x00, 0x02,
+    0x27, 0x48, 0x66, 0x81, 0x98, 0xaa, 0x9f, 0x98, 0x97, 0x9c, 0xa8, 0xa4, 0x8d, 0x70, 0x4e, 0x2a,
+    0x03, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2b, 0x56, 0x80, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
+    0xa1, 0xb3, 0x92, 0x68, 0x3d, 0x13, 0x00, 0x00, 0x1c, 0x41, 0x65, 0x87, 0xa6, 0x9c, 0x86, 0x78,
+    0x72, 0x74, 0x7e, 0x92, 0x9c, 0x91, 0xa4, 0x79, 0x4f, 0x25, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa6,
+    0x89, 0xa2, 0x8a, 0x79, 0x72, 0x74, 0x80, 0x95, 0xae, 0x91, 0x6f, 0x4c, 0x27, 0x01, 0x00, 0x00,
+    0x1b, 0x44, 0x6d, 0x95, 0xa3, 0x7e, 0x5d, 0x46, 0x3e, 0x41, 0x4f, 0x69, 0x8b, 0xab, 0x86, 0x60,
+    0x39, 0x11, 0x00, 0x00, 0x00, 0x2a, 0x53, 0x7c, 0xa5, 0x95, 0x71, 0x55, 0x47, 0x42, 0x44, 0x4b,
+    0x58, 0x69, 0x7b, 0x54, 0x2d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x22, 0x4b, 0x75, 0x9e, 0x9a, 0x72,
+    0x4d, 0x38, 0x31, 0x34, 0x41, 0x60, 0x87, 0xb0, 0x88, 0x5e, 0x35, 0x0b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x22, 0x42, 0x63, 0x84, 0xa5, 0x90, 0x6f, 0x4e, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x3d, 0x63, 0x86, 0xa3, 0x9d, 0x93, 0x95, 0x94, 0x6d,
+    0x46, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x3f, 0x63, 0x85, 0xa4, 0x9e, 0x86,
+    0x78, 0x72, 0x75, 0x83, 0x99, 0x95, 0x97, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x0a, 0x34,
+    0x5e, 0x88, 0xaa, 0x80, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0x3f, 0x15, 0x00, 0x0c,
+    0x36, 0x60, 0x84, 0xa2, 0x9c, 0x86, 0x76, 0x6e, 0x6d, 0x72, 0x82, 0x9c, 0xac, 0x88, 0x62, 0x3a,
+    0x11, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x0a, 0x0e, 0x0e, 0x0a, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2b, 0x55, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x7d, 0xa7, 0x92, 0x68, 0x3d, 0x13, 0x00, 0x04, 0x2c, 0x54, 0x7a, 0xa0, 0x9c, 0x7c, 0x61, 0x4f,
+    0x48, 0x4a, 0x58, 0x70, 0x8e, 0xb0, 0xa4, 0x79, 0x4f, 0x25, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xb7,
+    0xa4, 0x83, 0x66, 0x51, 0x48, 0x4b, 0x5a, 0x74, 0x94, 0xaa, 0x85, 0x5f, 0x38, 0x10, 0x00, 0x00,
+    0x22, 0x4c, 0x76, 0xa0, 0x97, 0x6d, 0x45, 0x21, 0x14, 0x18, 0x2d, 0x52, 0x7a, 0xa4, 0x97, 0x6f,
+    0x46, 0x1e, 0x00, 0x00, 0x05, 0x2f, 0x59, 0x84, 0xae, 0x8a, 0x60, 0x36, 0x1e, 0x18, 0x1a, 0x22,
+    0x30, 0x44, 0x52, 0x3f, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x41, 0x68, 0x8d, 0xab, 0x89,
+    0x6f, 0x60, 0x5c, 0x5d, 0x67, 0x7d, 0x9b, 0x9c, 0x79, 0x52, 0x2b, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x3c, 0x5d, 0x7e, 0x9f, 0x96, 0x76, 0x55, 0x42, 0x2f, 0x16, 0x00, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x03, 0x0a, 0x0a, 0x0a, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x23, 0x4c, 0x74, 0x9c, 0x9b, 0x79, 0x69, 0x6c, 0x7e, 0x5d,
+    0x36, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2a, 0x51, 0x78, 0x9d, 0xa0, 0x7e, 0x62,
+    0x4f, 0x48, 0x4c, 0x5e, 0x78, 0x98, 0xb7, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x0e, 0x38,
+    0x63, 0x8d, 0xa6, 0x7c, 0x52, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x48, 0x2e, 0x0a, 0x00, 0x08,
+    0x2f, 0x52, 0x6b, 0x83, 0x7b, 0x61, 0x4e, 0x44, 0x42, 0x4a, 0x60, 0x82, 0xa9, 0x97, 0x6d, 0x43,
+    0x19, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2b, 0x34, 0x39, 0x39, 0x34, 0x2a, 0x1b,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x53,
+    0x7d, 0xa7, 0x92, 0x68, 0x3d, 0x13, 0x00, 0x0e, 0x38, 0x61, 0x8a, 0xaf, 0x87, 0x62, 0x40, 0x27,
+    0x1d, 0x21, 0x34, 0x52, 0x77, 0x9e, 0xa4, 0x79, 0x4f, 0x25, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xb7,
+    0x90, 0x6a, 0x47, 0x2b, 0x1e, 0x22, 0x38, 0x59, 0x7d, 0xa4, 0x96, 0x6e, 0x45, 0x1b, 0x00, 0x00,
+    0x23, 0x4e, 0x78, 0xa2, 0x95, 0x6b, 0x41, 0x17, 0x03, 0x07, 0x25, 0x4e, 0x78, 0xa2, 0xa3, 0x7a,
+    0x51, 0x27, 0x00, 0x00, 0x04, 0x2e, 0x58, 0x82, 0xac, 0x8f, 0x68, 0x4c, 0x3a, 0x2f, 0x25, 0x1b,
+    0x0f, 0x1f, 0x27, 0x1c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x2f, 0x53, 0x73, 0x8e, 0xa3,
+    0x96, 0x8a, 0x86, 0x87, 0x90, 0xa0, 0x98, 0x7f, 0x61, 0x3f, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x4a, 0x75, 0x99, 0xaf, 0x8a, 0x84, 0x79, 0x68, 0x52, 0x36, 0x18, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x11, 0x2b, 0x34, 0x34, 0x34, 0x33,
+    0x22, 0x05, 0x00, 0x00, 0x13, 0x2c, 0x34, 0x53, 0x7d, 0xa7, 0x8d, 0x64, 0x3f, 0x44, 0x57, 0x48,
+    0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x36, 0x5f, 0x88, 0xb0, 0x8b, 0x65, 0x43,
+    0x28, 0x1d, 0x24, 0x3c, 0x5d, 0x82, 0xa9, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x13, 0x3d,
+    0x67, 0x91, 0xa2, 0x78, 0x4e, 0x24, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1f, 0x0e, 0x00, 0x00, 0x00,
+    0x16, 0x30, 0x48, 0x61, 0x5f, 0x3f, 0x27, 0x1a, 0x18, 0x24, 0x4d, 0x77, 0xa2, 0x9a, 0x6f, 0x45,
+    0x1b, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x53, 0x5e, 0x63, 0x63, 0x5d, 0x52, 0x41,
+    0x2a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x19, 0x22, 0x22, 0x22, 0x22, 0x28, 0x53,
+    0x7d, 0xa7, 0x92, 0x68, 0x3d, 0x13, 0x00, 0x14, 0x3e, 0x68, 0x92, 0xa5, 0x7b, 0x52, 0x29, 0x04,
+    0x00, 0x00, 0x18, 0x40, 0x69, 0x93, 0xa4, 0x79, 0x4f, 0x25, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xac,
+    0x83, 0x5a, 0x31, 0x0c, 0x00, 0x00, 0x1f, 0x46, 0x6f, 0x98, 0xa0, 0x76, 0x4c, 0x22, 0x00, 0x00,
+    0x20, 0x4a, 0x73, 0x9d, 0x9d, 0x75, 0x51, 0x37, 0x2d, 0x30, 0x41, 0x5f, 0x83, 0xaa, 0xab, 0x81,
+    0x57, 0x2d, 0x03, 0x00, 0x00, 0x27, 0x50, 0x78, 0x9f, 0xa4, 0x87, 0x71, 0x63, 0x58, 0x4e, 0x44,
+    0x38, 0x2a, 0x1a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x33, 0x52, 0x6d, 0x83, 0x98,
+    0xa8, 0x9f, 0x9c, 0x9e, 0xa4, 0xa9, 0x8a, 0x77, 0x5e, 0x41, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x4a, 0x75, 0x9b, 0x9b, 0x9f, 0xa9, 0xa1, 0x8d, 0x72, 0x53, 0x31, 0x0d, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x14, 0x30, 0x4d, 0x5e, 0x5e, 0x5e, 0x5c,
+    0x40, 0x19, 0x00, 0x02, 0x2a, 0x4e, 0x5e, 0x5e, 0x7f, 0xa9, 0x8b, 0x61, 0x5e, 0x5e, 0x5e, 0x49,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x3d, 0x67, 0x91, 0xa7, 0x7d, 0x54, 0x2c,
+    0x07, 0x00, 0x00, 0x24, 0x4b, 0x74, 0x9d, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x17, 0x41,
+    0x6b, 0x95, 0x9e, 0x74, 0x49, 0x44, 0x42, 0x3c, 0x34, 0x27, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0d, 0x26, 0x3b, 0x3a, 0x23, 0x04, 0x00, 0x19, 0x36, 0x57, 0x7d, 0xa6, 0x93, 0x6a, 0x40,
+    0x17, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x69, 0x7b, 0x88, 0x8d, 0x8d, 0x87, 0x79, 0x65,
+    0x4b, 0x2c, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x53,
+    0x7d, 0xa7, 0x92, 0x68, 0x3d, 0x13, 0x00, 0x15, 0x40, 0x6a, 0x94, 0xa3, 0x79, 0x4e, 0x24, 0x00,
+    0x00, 0x00, 0x12, 0x3c, 0x66, 0x91, 0xa4, 0x79, 0x4f, 0x25, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa8,
+    0x7e, 0x54, 0x29, 0x00, 0x00, 0x00, 0x14, 0x3f, 0x69, 0x93, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00,
+    0x17, 0x3f, 0x67, 0x8e, 0xaf, 0x8d, 0x70, 0x5e, 0x57, 0x59, 0x65, 0x7c, 0x9a, 0x9f, 0xaf, 0x85,
+    0x5b, 0x31, 0x06, 0x00, 0x00, 0x1a, 0x40, 0x65, 0x85, 0xa1, 0xaa, 0x98, 0x8c, 0x81, 0x77, 0x6c,
+    0x60, 0x52, 0x40, 0x29, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4b, 0x6e, 0x8e, 0xa8, 0x93,
+    0x80, 0x76, 0x72, 0x73, 0x7b, 0x8a, 0xa1, 0x9a, 0x7d, 0x5b, 0x36, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1f, 0x48, 0x6d, 0x71, 0x71, 0x75, 0x81, 0x95, 0xae, 0x8f, 0x6b, 0x45, 0x1e, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x16, 0x33, 0x4f, 0x6c, 0x89, 0x89, 0x89, 0x70,
+    0x48, 0x1e, 0x00, 0x06, 0x31, 0x5b, 0x85, 0x89, 0x89, 0xaa, 0x8e, 0x89, 0x89, 0x89, 0x7e, 0x54,
+    0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x6a, 0x94, 0xa3, 0x79, 0x4e, 0x24,
+    0x00, 0x00, 0x00, 0x1a, 0x44, 0x6e, 0x99, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x1b, 0x45,
+    0x6f, 0x99, 0x9a, 0x6f, 0x6f, 0x6e, 0x6c, 0x66, 0x5d, 0x4f, 0x3b, 0x24, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x11, 0x11, 0x01, 0x00, 0x1b, 0x38, 0x55, 0x72, 0x92, 0xa5, 0x82, 0x5c, 0x35,
+    0x0d, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x8c, 0xa2, 0xa2, 0x9e, 0xa2, 0xad, 0x9f, 0x86,
+    0x68, 0x46, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x53,
+    0x7d, 0xa7, 0x92, 0x68, 0x3d, 0x13, 0x00, 0x12, 0x3c, 0x66, 0x90, 0xa8, 0x7f, 0x57, 0x30, 0x10,
+    0x03, 0x08, 0x22, 0x46, 0x6e, 0x97, 0xa4, 0x79, 0x4f, 0x25, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xab,
+    0x81, 0x57, 0x2e, 0x05, 0x00, 0x00, 0x1a, 0x43, 0x6c, 0x96, 0xa2, 0x78, 0x4e, 0x23, 0x00, 0x00,
+    0x09, 0x2f, 0x54, 0x77, 0x96, 0xac, 0x95, 0x87, 0x82, 0x83, 0x8d, 0x9f, 0x91, 0x8a, 0xb0, 0x86,
+    0x5c, 0x31, 0x07, 0x00, 0x00, 0x06, 0x29, 0x49, 0x65, 0x7d, 0x8f, 0x9c, 0xa8, 0xaa, 0xa0, 0x95,
+    0x88, 0x79, 0x64, 0x49, 0x2b, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x34, 0x5c, 0x84, 0xa9, 0x91, 0x71,
+    0x59, 0x4c, 0x48, 0x49, 0x52, 0x65, 0x82, 0xa6, 0x95, 0x6e, 0x46, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x0a, 0x10, 0x32, 0x45, 0x46, 0x47, 0x4c, 0x5a, 0x76, 0x99, 0xa4, 0x7c, 0x53, 0x2a, 0x01,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x36, 0x52, 0x6f, 0x8b, 0xa8, 0x8d, 0x70, 0x52,
+    0x34, 0x12, 0x00, 0x06, 0x31, 0x5b, 0x85, 0x9c, 0x9c, 0xb2, 0x9f, 0x9c, 0x9c, 0x9c, 0x7e, 0x54,
+    0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3e, 0x68, 0x92, 0xa5, 0x7b, 0x52, 0x28,
+    0x00, 0x00, 0x00, 0x1f, 0x48, 0x71, 0x9b, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x1f, 0x4a,
+    0x74, 0x9e, 0xa3, 0x99, 0x99, 0x99, 0x96, 0x90, 0x85, 0x75, 0x5f, 0x44, 0x25, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x57, 0x74, 0x91, 0xa6, 0x89, 0x6a, 0x48, 0x23,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xad, 0x91, 0x9c, 0x85, 0x78, 0x74, 0x78, 0x87, 0xa0, 0xa4,
+    0x81, 0x5b, 0x34, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x53,
+    0x7d, 0xa7, 0x92, 0x68, 0x3d, 0x13, 0x00, 0x0b, 0x34, 0x5d, 0x85, 0xac, 0x8f, 0x6b, 0x4c, 0x36,
+    0x2d, 0x30, 0x41, 0x5d, 0x80, 0xa5, 0xa4, 0x79, 0x4f, 0x25, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xb3,
+    0x8b, 0x64, 0x3f, 0x20, 0x11, 0x16, 0x2f, 0x52, 0x78, 0xa0, 0x9a, 0x71, 0x47, 0x1e, 0x00, 0x00,
+    0x00, 0x1a, 0x3b, 0x5a, 0x75, 0x8b, 0x9b, 0xa3, 0xa6, 0xa2, 0x99, 0x88, 0x71, 0x8b, 0xae, 0x84,
+    0x5a, 0x30, 0x06, 0x00, 0x00, 0x00, 0x0d, 0x2a, 0x43, 0x57, 0x67, 0x74, 0x7f, 0x89, 0x94, 0x9f,
+    0xae, 0x9e, 0x85, 0x67, 0x45, 0x21, 0x00, 0x00, 0x00, 0x12, 0x3c, 0x66, 0x90, 0xaa, 0x81, 0x58,
+    0x35, 0x23, 0x1d, 0x1f, 0x2b, 0x47, 0x6e, 0x97, 0xa3, 0x79, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x17,
+    0x2f, 0x34, 0x24, 0x0f, 0x1c, 0x1c, 0x1d, 0x23, 0x3b, 0x63, 0x8c, 0xaf, 0x85, 0x5a, 0x30, 0x06,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x38, 0x55, 0x71, 0x8e, 0xaa, 0x8d, 0x6f, 0x51, 0x34,
+    0x16, 0x00, 0x00, 0x06, 0x30, 0x59, 0x72, 0x72, 0x7f, 0xa9, 0x8d, 0x72, 0x72, 0x72, 0x72, 0x52,
+    0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x38, 0x62, 0x8b, 0xae, 0x86, 0x5f, 0x3b,
+    0x1d, 0x10, 0x18, 0x33, 0x56, 0x7c, 0xa4, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x24, 0x4e,
+    0x78, 0x94, 0x94, 0x94, 0x94, 0x95, 0x9a, 0xa2, 0xad, 0x9a, 0x80, 0x61, 0x3f, 0x1a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x32, 0x55, 0x75, 0x93, 0xa5, 0x87, 0x6b, 0x4d, 0x2e, 0x0d,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xb7, 0x9e, 0x7d, 0x60, 0x4f, 0x49, 0x4f, 0x64, 0x85, 0xab,
+    0x92, 0x6a, 0x41, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x53,
+    0x7d, 0xa7, 0x92, 0x68, 0x3d, 0x13, 0x00, 0x00, 0x26, 0x4d, 0x73, 0x97, 0xa6, 0x88, 0x6f, 0x5e,
+    0x57, 0x5a, 0x67, 0x7c, 0x99, 0xae, 0xa4, 0x79, 0x4f, 0x25, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xb7,
+    0x9d, 0x7a, 0x5b, 0x45, 0x3b, 0x3e, 0x4f, 0x6b, 0x8c, 0xb1, 0x8b, 0x64, 0x3c, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x1f, 0x3a, 0x52, 0x65, 0x72, 0x79, 0x7b, 0x78, 0x70, 0x62, 0x65, 0x8f, 0xa9, 0x7f,
+    0x55, 0x2c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x30, 0x3f, 0x4b, 0x56, 0x60, 0x6b, 0x77,
+    0x89, 0xa3, 0xa3, 0x80, 0x59, 0x31, 0x08, 0x00, 0x00, 0x13, 0x3d, 0x68, 0x92, 0xa8, 0x7e, 0x54,
+    0x2b, 0x11, 0x0b, 0x0d, 0x1c, 0x41, 0x6b, 0x95, 0xa5, 0x7b, 0x51, 0x26, 0x00, 0x00, 0x0c, 0x30,
+    0x53, 0x5d, 0x44, 0x2e, 0x1e, 0x15, 0x13, 0x1b, 0x38, 0x61, 0x8b, 0xaf, 0x85, 0x5b, 0x31, 0x06,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x58, 0x74, 0x91, 0xaa, 0x8c, 0x6f, 0x51, 0x33, 0x16,
+    0x00, 0x00, 0x00, 0x00, 0x1f, 0x3d, 0x47, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x47, 0x47, 0x47, 0x39,
+    0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x2e, 0x56, 0x7d, 0xa4, 0x99, 0x76, 0x58,
+    0x43, 0x3b, 0x40, 0x52, 0x6e, 0x90, 0xb5, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x23, 0x4b,
+    0x69, 0x6a, 0x6a, 0x6a, 0x6a, 0x6b, 0x70, 0x7a, 0x8c, 0xa7, 0x9c, 0x79, 0x53, 0x2c, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x45, 0x6b, 0x90, 0xa9, 0x88, 0x69, 0x4b, 0x2f, 0x11, 0x00,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xb4, 0x8c, 0x65, 0x41, 0x27, 0x1f, 0x29, 0x4c, 0x74, 0x9d,
+    0x9c, 0x72, 0x48, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x53,
+    0x7d, 0xa7, 0x92, 0x68, 0x3d, 0x13, 0x00, 0x00, 0x15, 0x39, 0x5c, 0x7d, 0x9a, 0xa9, 0x94, 0x87,
+    0x82, 0x84, 0x8e, 0xa0, 0x91, 0x93, 0xa4, 0x79, 0x4f, 0x25, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xb0,
+    0x98, 0x97, 0x7e, 0x6d, 0x65, 0x68, 0x74, 0x8a, 0xa7, 0x99, 0x76, 0x52, 0x2c, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x2d, 0x3d, 0x49, 0x4f, 0x51, 0x4e, 0x47, 0x48, 0x70, 0x98, 0x9f, 0x77,
+    0x4d, 0x24, 0x00, 0x00, 0x00, 0x04, 0x23, 0x35, 0x32, 0x1c, 0x16, 0x22, 0x2d, 0x37, 0x42, 0x50,
+    0x67, 0x88, 0xae, 0x8e, 0x64, 0x3a, 0x10, 0x00, 0x00, 0x0f, 0x39, 0x62, 0x8b, 0xb1, 0x8a, 0x65,
+    0x49, 0x3a, 0x36, 0x37, 0x41, 0x58, 0x79, 0x9f, 0x9e, 0x75, 0x4c, 0x22, 0x00, 0x00, 0x21, 0x46,
+    0x6a, 0x80, 0x67, 0x54, 0x47, 0x3f, 0x3e, 0x43, 0x54, 0x72, 0x96, 0xa6, 0x7d, 0x54, 0x2b, 0x01,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x5a, 0x77, 0x93, 0xa9, 0x8c, 0x6e, 0x50, 0x33, 0x15, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x17, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x1d, 0x1d, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x45, 0x6a, 0x8d, 0xad, 0x94, 0x7b,
+    0x6b, 0x65, 0x69, 0x76, 0x8d, 0x9d, 0xa3, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x11, 0x2f,
+    0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x41, 0x46, 0x52, 0x6b, 0x8d, 0xb1, 0x89, 0x61, 0x37, 0x0e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x51, 0x7b, 0xa3, 0x97, 0x6f, 0x4c, 0x2d, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xac, 0x82, 0x58, 0x2f, 0x06, 0x00, 0x19, 0x43, 0x6d, 0x97,
+    0x9f, 0x75, 0x4b, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0f, 0x03, 0x00, 0x00, 0x28, 0x53,
+    0x7d, 0xa7, 0x92, 0x68, 0x3d, 0x13, 0x00, 0x00, 0x00, 0x21, 0x41, 0x5f, 0x79, 0x8e, 0x9d, 0xa6,
+    0xa9, 0xa5, 0x9b, 0x89, 0x72, 0x93, 0xa3, 0x79, 0x4f, 0x24, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9,
+    0x7f, 0x92, 0xa3, 0x95, 0x8f, 0x91, 0x9c, 0xad, 0x97, 0x7c, 0x5d, 0x3c, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x28, 0x32, 0x26, 0x1f, 0x25, 0x27, 0x24, 0x3b, 0x5c, 0x80, 0xa6, 0x91, 0x6a,
+    0x42, 0x1a, 0x00, 0x00, 0x00, 0x18, 0x3e, 0x5e, 0x57, 0x3e, 0x29, 0x1b, 0x12, 0x0f, 0x1a, 0x2b,
+    0x52, 0x7d, 0xa7, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x05, 0x2e, 0x55, 0x7b, 0x9f, 0xa1, 0x84,
+    0x6f, 0x64, 0x60, 0x61, 0x69, 0x7a, 0x93, 0xad, 0x8c, 0x67, 0x40, 0x18, 0x00, 0x0d, 0x36, 0x5b,
+    0x80, 0xa2, 0x8c, 0x7c, 0x70, 0x69, 0x68, 0x6c, 0x79, 0x8f, 0xad, 0x93, 0x6e, 0x47, 0x20, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x7a, 0x96, 0xb3, 0x8f, 0x6d, 0x50, 0x32, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2f, 0x52, 0x71, 0x8e, 0xa6, 0xa1,
+    0x94, 0x8f, 0x92, 0x9d, 0x9c, 0x80, 0x9a, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x0e, 0x2a,
+    0x35, 0x2a, 0x15, 0x15, 0x15, 0x17, 0x1d, 0x2f, 0x56, 0x80, 0xaa, 0x91, 0x67, 0x3d, 0x12, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x2c, 0x56, 0x81, 0x88, 0x88, 0x65, 0x3b, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x18, 0x42, 0x6c, 0x97,
+    0xa0, 0x75, 0x4b, 0x21, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x35, 0x39, 0x26, 0x07, 0x00, 0x28, 0x53,
+    0x7d, 0xa7, 0x92, 0x68, 0x3d, 0x13, 0x00, 0x00, 0x00, 0x09, 0x28, 0x3e, 0x55, 0x67, 0x74, 0x7c,
+    0x7e, 0x7b, 0x73, 0x64, 0x6b, 0x95, 0xa1, 0x77, 0x4d, 0x22, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9,
+    0x7f, 0x71, 0x86, 0x94, 0x9a, 0x9a, 0x93, 0x87, 0x74, 0x5c, 0x40, 0x22, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x26, 0x4a, 0x5c, 0x4b, 0x3f, 0x3b, 0x3d, 0x47, 0x5b, 0x77, 0x97, 0xa3, 0x7f, 0x59,
+    0x33, 0x0c, 0x00, 0x00, 0x04, 0x2a, 0x50, 0x77, 0x79, 0x62, 0x50, 0x44, 0x3c, 0x3a, 0x3c, 0x47,
+    0x60, 0x84, 0xac, 0x8b, 0x62, 0x39, 0x0f, 0x00, 0x00, 0x00, 0x1c, 0x41, 0x63, 0x82, 0x9c, 0xa8,
+    0x97, 0x8e, 0x8a, 0x8c, 0x92, 0xa0, 0xa5, 0x8e, 0x72, 0x51, 0x2d, 0x08, 0x00, 0x10, 0x39, 0x61,
+    0x7e, 0x96, 0xa9, 0xa4, 0x99, 0x94, 0x92, 0x96, 0xa0, 0xab, 0x94, 0x78, 0x58, 0x34, 0x0f, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x99, 0xa3, 0x9c, 0xa5, 0x83, 0x62, 0x41, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x36, 0x52, 0x6c, 0x80, 0x8f,
+    0x98, 0x9b, 0x97, 0x8b, 0x79, 0x6f, 0x9a, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x01, 0x26, 0x4a,
+    0x5f, 0x4c, 0x33, 0x22, 0x17, 0x13, 0x17, 0x2d, 0x55, 0x7f, 0xa9, 0x91, 0x67, 0x3c, 0x12, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4a, 0x5d, 0x5d, 0x5d, 0x54, 0x33, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x18, 0x42, 0x6c, 0x97,
+    0xa0, 0x75, 0x4b, 0x21, 0x00, 0x00, 0x00, 0x18, 0x38, 0x58, 0x61, 0x42, 0x23, 0x11, 0x2b, 0x55,
+    0x7f, 0xa9, 0x90, 0x66, 0x3c, 0x12, 0x00, 0x00, 0x00, 0x1f, 0x43, 0x62, 0x58, 0x40, 0x4b, 0x52,
+    0x54, 0x51, 0x4a, 0x50, 0x76, 0x9e, 0x99, 0x70, 0x47, 0x1d, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9,
+    0x7f, 0x55, 0x5e, 0x6a, 0x70, 0x70, 0x6a, 0x5f, 0x4e, 0x39, 0x21, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x12, 0x38, 0x5e, 0x84, 0x72, 0x68, 0x65, 0x67, 0x6f, 0x7f, 0x96, 0xa9, 0x8a, 0x68, 0x45,
+    0x20, 0x00, 0x00, 0x00, 0x14, 0x3c, 0x62, 0x89, 0x9c, 0x88, 0x78, 0x6d, 0x66, 0x64, 0x66, 0x6f,
+    0x80, 0x9c, 0xa0, 0x7c, 0x55, 0x2e, 0x06, 0x00, 0x00, 0x00, 0x06, 0x27, 0x46, 0x61, 0x77, 0x88,
+    0x94, 0x9a, 0x9d, 0x9c, 0x97, 0x8e, 0x7f, 0x6b, 0x53, 0x36, 0x16, 0x00, 0x00, 0x03, 0x26, 0x43,
+    0x5c, 0x71, 0x81, 0x8e, 0x97, 0x9c, 0x9d, 0x9a, 0x92, 0x85, 0x71, 0x59, 0x3c, 0x1c, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xb7, 0xa5, 0xa1, 0x84, 0x80, 0xa1, 0x9e, 0x7c, 0x5b, 0x3a, 0x19, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x31, 0x47, 0x59, 0x67,
+    0x6e, 0x70, 0x6d, 0x63, 0x53, 0x6f, 0x9a, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x17, 0x3b, 0x60,
+    0x84, 0x6e, 0x59, 0x4a, 0x41, 0x3e, 0x41, 0x4e, 0x68, 0x8c, 0xb0, 0x88, 0x60, 0x36, 0x0d, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41, 0x5b, 0x67, 0x61, 0x4c, 0x2c, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x18, 0x42, 0x6c, 0x97,
+    0xa0, 0x75, 0x4b, 0x21, 0x00, 0x00, 0x11, 0x33, 0x54, 0x74, 0x7e, 0x5f, 0x46, 0x3b, 0x42, 0x62,
+    0x89, 0xb1, 0x8a, 0x60, 0x37, 0x0d, 0x00, 0x00, 0x12, 0x36, 0x5a, 0x7e, 0x7a, 0x66, 0x56, 0x4d,
+    0x49, 0x4b, 0x55, 0x6b, 0x8a, 0xae, 0x8c, 0x65, 0x3c, 0x14, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9,
+    0x7f, 0x55, 0x36, 0x41, 0x46, 0x45, 0x40, 0x37, 0x28, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x24, 0x4b, 0x71, 0x97, 0x9b, 0x92, 0x8f, 0x91, 0x98, 0xa6, 0xa0, 0x89, 0x6d, 0x4e, 0x2d,
+    0x0b, 0x00, 0x00, 0x00, 0x15, 0x3e, 0x64, 0x80, 0x96, 0xa8, 0xa0, 0x96, 0x90, 0x8e, 0x90, 0x98,
+    0xa5, 0x9e, 0x84, 0x65, 0x42, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x26, 0x3d, 0x51, 0x60,
+    0x6a, 0x70, 0x72, 0x71, 0x6d, 0x65, 0x58, 0x47, 0x31, 0x17, 0x00, 0x00, 0x00, 0x00, 0x07, 0x21,
+    0x37, 0x4a, 0x59, 0x65, 0x6d, 0x71, 0x72, 0x70, 0x69, 0x5d, 0x4d, 0x37, 0x1d, 0x01, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xb7, 0x9f, 0x82, 0x65, 0x66, 0x87, 0xa8, 0x96, 0x75, 0x54, 0x33, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x22, 0x32, 0x3d,
+    0x44, 0x46, 0x43, 0x3b, 0x45, 0x6f, 0x9a, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x01, 0x2a, 0x50, 0x75,
+    0x9a, 0x92, 0x80, 0x73, 0x6b, 0x68, 0x6b, 0x74, 0x88, 0xa4, 0x9c, 0x78, 0x52, 0x2b, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x33, 0x5a, 0x7d, 0x91, 0x87, 0x67, 0x41, 0x19, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x18, 0x42, 0x6c, 0x97,
+    0xa0, 0x75, 0x4b, 0x21, 0x00, 0x00, 0x1e, 0x48, 0x6f, 0x8f, 0x9b, 0x80, 0x6d, 0x65, 0x69, 0x7d,
+    0x9c, 0xa3, 0x7d, 0x55, 0x2d, 0x04, 0x00, 0x00, 0x22, 0x4b, 0x70, 0x94, 0x9e, 0x8c, 0x7f, 0x77,
+    0x74, 0x75, 0x7d, 0x8e, 0xa7, 0x9a, 0x78, 0x54, 0x2d, 0x06, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9,
+    0x7f, 0x55, 0x2a, 0x17, 0x1b, 0x1b, 0x17, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x52, 0x74, 0x86, 0x93, 0x9a, 0x9d, 0x9b, 0x96, 0x8b, 0x7b, 0x66, 0x4d, 0x31, 0x13,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x29, 0x44, 0x5c, 0x70, 0x81, 0x8d, 0x96, 0x9b, 0x9d, 0x9b, 0x95,
+    0x8a, 0x79, 0x63, 0x48, 0x29, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x2a, 0x37,
+    0x40, 0x46, 0x48, 0x47, 0x43, 0x3c, 0x30, 0x21, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x23, 0x31, 0x3c, 0x43, 0x47, 0x48, 0x46, 0x40, 0x35, 0x26, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x80, 0x63, 0x46, 0x4b, 0x6c, 0x8d, 0xae, 0x8f, 0x6e, 0x4d, 0x2c,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x14,
+    0x1a, 0x1c, 0x19, 0x1b, 0x45, 0x6f, 0x9a, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x04, 0x2d, 0x56, 0x77,
+    0x8f, 0xa3, 0xa7, 0x9c, 0x95, 0x92, 0x95, 0x9d, 0xac, 0x9c, 0x81, 0x61, 0x3e, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x64, 0x8f, 0xb8, 0x9e, 0x74, 0x4a, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x18, 0x42, 0x6c, 0x97,
+    0xa0, 0x75, 0x4b, 0x21, 0x00, 0x00, 0x1a, 0x41, 0x63, 0x83, 0x9e, 0xa5, 0x96, 0x8f, 0x92, 0xa0,
+    0xa8, 0x8b, 0x69, 0x44, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x48, 0x67, 0x80, 0x94, 0xa3, 0xa8, 0xa1,
+    0x9e, 0x9f, 0xa6, 0xa6, 0x94, 0x7c, 0x5f, 0x3d, 0x1a, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9,
+    0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0x39, 0x4f, 0x5f, 0x6a, 0x70, 0x72, 0x71, 0x6c, 0x62, 0x54, 0x42, 0x2b, 0x12, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x22, 0x37, 0x4a, 0x59, 0x64, 0x6c, 0x71, 0x72, 0x71, 0x6b,
+    0x62, 0x53, 0x40, 0x28, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0e,
+    0x17, 0x1c, 0x1e, 0x1d, 0x19, 0x12, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x12, 0x19, 0x1d, 0x1e, 0x1c, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x31, 0x52, 0x73, 0x94, 0xaa, 0x88, 0x67, 0x46,
+    0x25, 0x03, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1b, 0x45, 0x6f, 0x9a, 0x9c, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x1d, 0x3b, 0x55,
+    0x6b, 0x7d, 0x8b, 0x94, 0x9b, 0x9d, 0x9b, 0x95, 0x8a, 0x78, 0x61, 0x45, 0x26, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x35, 0x5e, 0x83, 0x9a, 0x8e, 0x6c, 0x44, 0x1b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x18, 0x42, 0x6c, 0x97,
+    0xa0, 0x75, 0x4b, 0x21, 0x00, 0x00, 0x06, 0x28, 0x47, 0x63, 0x7b, 0x8d, 0x98, 0x9d, 0x9b, 0x93,
+    0x84, 0x6c, 0x4f, 0x2e, 0x0b, 0x00, 0x00, 0x00, 0x0d, 0x2c, 0x46, 0x5b, 0x6d, 0x7a, 0x84, 0x8a,
+    0x8c, 0x8b, 0x87, 0x7d, 0x6e, 0x5a, 0x40, 0x23, 0x02, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x86, 0x86,
+    0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x28, 0x36, 0x40, 0x46, 0x48, 0x47, 0x42, 0x3a, 0x2d, 0x1c, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x30, 0x3b, 0x42, 0x47, 0x48, 0x46, 0x42,
+    0x39, 0x2c, 0x1b, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x16, 0x37, 0x58, 0x79, 0x9a, 0xa3, 0x81, 0x60,
+    0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1b, 0x45, 0x6f, 0x86, 0x86, 0x72, 0x48, 0x1d, 0x00, 0x00, 0x00, 0x1a, 0x31,
+    0x45, 0x55, 0x62, 0x6b, 0x70, 0x72, 0x71, 0x6c, 0x62, 0x52, 0x3e, 0x25, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x48, 0x63, 0x70, 0x6a, 0x52, 0x32, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0x95, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x18, 0x42, 0x6c, 0x95,
+    0x95, 0x75, 0x4b, 0x21, 0x00, 0x00, 0x00, 0x0b, 0x27, 0x40, 0x55, 0x65, 0x6e, 0x72, 0x71, 0x6a,
+    0x5d, 0x4a, 0x31, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x22, 0x35, 0x45, 0x51, 0x5a, 0x5f,
+    0x62, 0x61, 0x5d, 0x54, 0x47, 0x36, 0x1f, 0x05, 0x00, 0x00, 0x00, 0x08, 0x30, 0x52, 0x5c, 0x5c,
+    0x5c, 0x48, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x0d, 0x16, 0x1c, 0x1e, 0x1d, 0x18, 0x11, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x18, 0x1d, 0x1e, 0x1c, 0x18,
+    0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0d, 0x0d, 0x0d, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x0e, 0x0e, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0d, 0x0d, 0x0d, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x38, 0x63, 0x8d, 0x95, 0x7f, 0x55, 0x2a, 0x00, 0x1d, 0x3e, 0x5e, 0x7f, 0x95, 0x95, 0x7a,
+    0x59, 0x32, 0x09, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x95, 0x8d, 0x63, 0x39, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x3b, 0x58, 0x5c, 0x5c, 0x59, 0x3d, 0x17, 0x00, 0x00, 0x00, 0x00, 0x0c,
+    0x1e, 0x2d, 0x39, 0x41, 0x46, 0x48, 0x47, 0x42, 0x39, 0x2c, 0x19, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x28, 0x3d, 0x46, 0x42, 0x31, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x35, 0x5c, 0x6a, 0x6a, 0x6a, 0x50, 0x28, 0x00, 0x00, 0x16, 0x3e, 0x63, 0x6a,
+    0x6a, 0x68, 0x47, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2e, 0x3c, 0x45, 0x48, 0x47, 0x41,
+    0x36, 0x25, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1d, 0x28, 0x30, 0x35,
+    0x37, 0x37, 0x33, 0x2b, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x2c, 0x31, 0x31,
+    0x31, 0x26, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x23, 0x36, 0x38, 0x38, 0x38, 0x2e, 0x13,
+    0x00, 0x00, 0x1a, 0x32, 0x38, 0x38, 0x38, 0x2c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x38, 0x38, 0x38, 0x36, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x35, 0x5c, 0x6a, 0x6a, 0x6a, 0x50, 0x28, 0x00, 0x02, 0x23, 0x44, 0x64, 0x6a, 0x6a, 0x6a,
+    0x59, 0x32, 0x09, 0x00, 0x00, 0x00, 0x27, 0x4f, 0x6a, 0x6a, 0x6a, 0x5c, 0x35, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1e, 0x30, 0x31, 0x31, 0x30, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x0f, 0x17, 0x1c, 0x1e, 0x1d, 0x18, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x15, 0x1c, 0x18, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x3a, 0x40, 0x40, 0x40, 0x33, 0x15, 0x00, 0x00, 0x06, 0x27, 0x3d, 0x40,
+    0x40, 0x3f, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x13, 0x1b, 0x1e, 0x1d, 0x17,
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0b,
+    0x0d, 0x0c, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x07,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x0d, 0x0d, 0x0d, 0x0d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0d, 0x0d,
+    0x0d, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x0d, 0x0d, 0x0d, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x3e, 0x5e, 0x62, 0x62, 0x62, 0x4f, 0x29,
+    0x01, 0x0a, 0x32, 0x56, 0x62, 0x62, 0x62, 0x4c, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x2a, 0x4c, 0x62, 0x62, 0x62, 0x5d, 0x3d, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x3a, 0x40, 0x40, 0x40, 0x33, 0x15, 0x00, 0x00, 0x08, 0x29, 0x3e, 0x40, 0x40, 0x40,
+    0x38, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x15, 0x33, 0x40, 0x40, 0x40, 0x3a, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x16, 0x16, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x05, 0x14, 0x16,
+    0x16, 0x15, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x0d, 0x0d, 0x0d, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x26, 0x37, 0x38, 0x38, 0x37, 0x26, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x38, 0x38,
+    0x38, 0x30, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x35, 0x38, 0x38, 0x37, 0x26, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x45, 0x6f, 0x8c, 0x8c, 0x83, 0x58, 0x2e,
+    0x04, 0x0e, 0x38, 0x63, 0x8d, 0x8d, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x23, 0x44, 0x66, 0x87, 0x8c, 0x8c, 0x6a, 0x43, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x12, 0x16, 0x16, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x06, 0x14, 0x16, 0x16, 0x16,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x16, 0x16, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0d, 0x0d, 0x0d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x0d, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x0d, 0x0d, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x0d,
+    0x0d, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0d, 0x0d, 0x0d,
+    0x01, 0x00, 0x02, 0x0d, 0x0d, 0x0d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+    0x2a, 0x37, 0x38, 0x38, 0x34, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1b, 0x42, 0x60, 0x62, 0x62, 0x60, 0x42, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x26, 0x4c, 0x62, 0x62,
+    0x62, 0x53, 0x2e, 0x06, 0x00, 0x00, 0x00, 0x13, 0x3a, 0x5c, 0x62, 0x62, 0x60, 0x43, 0x1c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x43, 0x6e, 0x98, 0xab, 0x81, 0x57, 0x2c,
+    0x02, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3d, 0x5f, 0x80, 0xa1, 0x93, 0x72, 0x50, 0x2f, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x0d, 0x0d, 0x0d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x0d, 0x0d, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x38, 0x38, 0x38, 0x2c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x2e, 0x38, 0x38, 0x37, 0x29, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x35,
+    0x38, 0x38, 0x38, 0x2d, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x27, 0x37, 0x38,
+    0x38, 0x36, 0x23, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x38, 0x38, 0x37,
+    0x26, 0x09, 0x27, 0x37, 0x38, 0x37, 0x2b, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 0x32, 0x2b, 0x20, 0x12, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23,
+    0x49, 0x62, 0x62, 0x62, 0x5a, 0x38, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1f, 0x48, 0x71, 0x8c, 0x8c, 0x79, 0x51, 0x29, 0x01, 0x00, 0x00, 0x0b, 0x33, 0x5b, 0x83, 0x8c,
+    0x8c, 0x64, 0x3c, 0x14, 0x00, 0x00, 0x00, 0x20, 0x48, 0x70, 0x8c, 0x8c, 0x72, 0x49, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x42, 0x6c, 0x96, 0xa9, 0x7f, 0x55, 0x2b,
+    0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x15, 0x36, 0x57, 0x79, 0x9a, 0x9b, 0x79, 0x58, 0x36, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x22, 0x36, 0x38, 0x38, 0x38, 0x2b, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x31, 0x38, 0x38, 0x38, 0x2f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x25, 0x4b, 0x62, 0x62, 0x62, 0x4b, 0x27, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x2b, 0x4f, 0x62, 0x62, 0x61, 0x47, 0x21, 0x00, 0x00, 0x13, 0x3a, 0x5c,
+    0x62, 0x62, 0x62, 0x4e, 0x29, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x44, 0x61, 0x62,
+    0x62, 0x5e, 0x3e, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4b, 0x62, 0x62, 0x60,
+    0x42, 0x1c, 0x43, 0x60, 0x62, 0x62, 0x4a, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4b, 0x62,
+    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x5c, 0x54, 0x48, 0x39, 0x27, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x34,
+    0x5b, 0x81, 0x8c, 0x8c, 0x70, 0x49, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x3b, 0x63, 0x8b, 0xaf, 0x86, 0x5e, 0x36, 0x0e, 0x00, 0x00, 0x19, 0x41, 0x69, 0x91, 0xb7,
+    0x9a, 0x71, 0x49, 0x21, 0x00, 0x00, 0x06, 0x2e, 0x56, 0x7e, 0xa6, 0x8c, 0x64, 0x3c, 0x14, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x40, 0x6b, 0x95, 0xa8, 0x7e, 0x53, 0x29,
+    0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0d, 0x2f, 0x50, 0x71, 0x93, 0xa2, 0x81, 0x5f, 0x3e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0x3d, 0x5d, 0x62, 0x62, 0x62, 0x4b, 0x27, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x31,
+    0x54, 0x62, 0x62, 0x62, 0x50, 0x2b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x8c, 0x86, 0x61, 0x3d, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1c, 0x40, 0x65, 0x89, 0x8c, 0x7a, 0x50, 0x26, 0x00, 0x00, 0x16, 0x40, 0x68,
+    0x8c, 0x8c, 0x87, 0x60, 0x3a, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x2f, 0x56, 0x7c, 0x8c,
+    0x8c, 0x6b, 0x43, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2c, 0x56, 0x80, 0x8c, 0x72,
+    0x48, 0x23, 0x4d, 0x77, 0x8c, 0x7b, 0x51, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x86, 0x7d, 0x70, 0x60, 0x4b, 0x34, 0x1a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x46,
+    0x6c, 0x93, 0xb1, 0xa8, 0x81, 0x5b, 0x34, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x2e, 0x56, 0x7e, 0xa6, 0x94, 0x6c, 0x43, 0x1b, 0x00, 0x00, 0x27, 0x4f, 0x77, 0x9f, 0xad,
+    0xa7, 0x7f, 0x57, 0x2f, 0x07, 0x00, 0x13, 0x3b, 0x63, 0x8c, 0xa7, 0x7f, 0x57, 0x2f, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3f, 0x69, 0x93, 0xa6, 0x7c, 0x52, 0x27,
+    0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0x27, 0x49, 0x6a, 0x8b, 0xaa, 0x88, 0x67, 0x45, 0x24, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0x43, 0x6a, 0x8c, 0x8c, 0x85, 0x61, 0x3d, 0x19, 0x00, 0x00, 0x00, 0x00, 0x23, 0x47,
+    0x6b, 0x8c, 0x8c, 0x7d, 0x58, 0x2f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x9b, 0x77, 0x52, 0x2e, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x31, 0x56, 0x7a, 0x9f, 0xa5, 0x7a, 0x50, 0x26, 0x00, 0x00, 0x09, 0x30, 0x57,
+    0x7e, 0xa4, 0x98, 0x71, 0x4b, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x40, 0x67, 0x8e, 0xa8,
+    0x81, 0x5a, 0x34, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x31, 0x5b, 0x85, 0x97, 0x6d,
+    0x43, 0x28, 0x52, 0x7c, 0xa0, 0x76, 0x4c, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0xa5, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa9, 0xa6, 0x98, 0x85, 0x6f, 0x55, 0x39, 0x1a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x31, 0x57,
+    0x7e, 0xa4, 0x8c, 0x9f, 0x93, 0x6c, 0x46, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x48, 0x71, 0x99, 0xa1, 0x79, 0x51, 0x29, 0x00, 0x0d, 0x35, 0x5d, 0x85, 0xaa, 0x83,
+    0xa7, 0x8d, 0x64, 0x3c, 0x14, 0x00, 0x21, 0x49, 0x71, 0x99, 0x9a, 0x72, 0x49, 0x21, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x3d, 0x67, 0x92, 0xa4, 0x7a, 0x50, 0x26,
+    0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x41, 0x63, 0x84, 0xa5, 0x90, 0x6e, 0x4d, 0x39, 0x39, 0x39, 0x2f, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0c, 0x30, 0x54, 0x78, 0x9d, 0x9b, 0x77, 0x53, 0x2e, 0x0a, 0x00, 0x00, 0x15, 0x39, 0x5d,
+    0x81, 0xa5, 0x8c, 0x67, 0x43, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0xb1, 0x8c, 0x68, 0x44, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x22, 0x46, 0x6b, 0x90, 0xb4, 0xa5, 0x7a, 0x50, 0x26, 0x00, 0x00, 0x00, 0x1f, 0x46,
+    0x6d, 0x93, 0xa9, 0x82, 0x5c, 0x35, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x2a, 0x51, 0x78, 0x9f, 0x97,
+    0x70, 0x49, 0x23, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x22, 0x2a, 0x2a, 0x36, 0x60, 0x8a, 0x92, 0x68,
+    0x3e, 0x2d, 0x57, 0x81, 0x9b, 0x71, 0x47, 0x2a, 0x29, 0x1a, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0x80, 0x8d, 0x9e, 0xaa, 0x91, 0x75, 0x56, 0x34,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x42, 0x69,
+    0x8f, 0xa2, 0x7b, 0x8e, 0xa4, 0x7e, 0x57, 0x31, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x13, 0x3b, 0x63, 0x8b, 0xae, 0x86, 0x5e, 0x36, 0x0e, 0x1b, 0x43, 0x6b, 0x93, 0x9c, 0x74,
+    0x9a, 0x9a, 0x72, 0x4a, 0x22, 0x06, 0x2e, 0x56, 0x7e, 0xa7, 0x8c, 0x64, 0x3c, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x3b, 0x66, 0x90, 0xa3, 0x78, 0x4e, 0x24,
+    0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x3a,
+    0x5b, 0x7d, 0x9e, 0x97, 0x76, 0x54, 0x53, 0x64, 0x64, 0x64, 0x4f, 0x29, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x3e, 0x62, 0x87, 0xab, 0x8d, 0x69, 0x44, 0x20, 0x00, 0x07, 0x2b, 0x4f, 0x73,
+    0x97, 0x9a, 0x76, 0x51, 0x2d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0xba, 0xa2, 0x7e, 0x59, 0x35, 0x10, 0x00, 0x00,
+    0x00, 0x13, 0x37, 0x5c, 0x80, 0xa5, 0xb8, 0xa5, 0x7a, 0x50, 0x26, 0x00, 0x00, 0x00, 0x0e, 0x35,
+    0x5c, 0x82, 0xa9, 0x93, 0x6d, 0x46, 0x1f, 0x00, 0x00, 0x00, 0x15, 0x3c, 0x62, 0x89, 0xad, 0x86,
+    0x5f, 0x38, 0x12, 0x00, 0x00, 0x00, 0x00, 0x24, 0x45, 0x54, 0x54, 0x54, 0x66, 0x90, 0x8d, 0x63,
+    0x54, 0x54, 0x5d, 0x87, 0x96, 0x6c, 0x54, 0x54, 0x53, 0x3a, 0x16, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x4c, 0x4c, 0x4c, 0x4c, 0x4f, 0x57, 0x66, 0x7a, 0x93, 0xb0, 0x91, 0x6f, 0x4c,
+    0x27, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2d, 0x54, 0x7a,
+    0xa1, 0x91, 0x6a, 0x7d, 0xa3, 0x8f, 0x69, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x2e, 0x56, 0x7e, 0xa6, 0x94, 0x6b, 0x43, 0x1b, 0x29, 0x51, 0x79, 0xa1, 0x8f, 0x67,
+    0x8c, 0xa8, 0x80, 0x57, 0x2f, 0x14, 0x3c, 0x64, 0x8c, 0xa7, 0x7f, 0x57, 0x2f, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x64, 0x8e, 0xa1, 0x77, 0x4d, 0x22,
+    0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x12, 0x33, 0x54,
+    0x76, 0x97, 0x9f, 0x7d, 0x5c, 0x3a, 0x5d, 0x87, 0x8e, 0x83, 0x58, 0x2e, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x28, 0x4c, 0x70, 0x95, 0xa3, 0x7f, 0x5a, 0x36, 0x12, 0x1d, 0x41, 0x65, 0x89,
+    0xa8, 0x84, 0x60, 0x3b, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x93, 0x9f, 0x93, 0x6f, 0x4a, 0x26, 0x02, 0x00,
+    0x04, 0x28, 0x4d, 0x71, 0x96, 0x9a, 0x95, 0xa5, 0x7b, 0x50, 0x26, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0x4a, 0x71, 0x98, 0xa4, 0x7e, 0x57, 0x30, 0x09, 0x00, 0x00, 0x26, 0x4d, 0x73, 0x9a, 0x9c, 0x75,
+    0x4e, 0x27, 0x01, 0x00, 0x00, 0x00, 0x04, 0x2e, 0x59, 0x7f, 0x7f, 0x7f, 0x7f, 0x95, 0x88, 0x7f,
+    0x7f, 0x7f, 0x7f, 0x8c, 0x91, 0x7f, 0x7f, 0x7f, 0x74, 0x49, 0x1f, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x3d, 0x22, 0x22, 0x22, 0x25, 0x2f, 0x40, 0x57, 0x74, 0x95, 0xaa, 0x86, 0x61,
+    0x3a, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3f, 0x65, 0x8c,
+    0xa6, 0x80, 0x59, 0x6c, 0x92, 0xa1, 0x7a, 0x54, 0x2d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x48, 0x70, 0x99, 0xa1, 0x79, 0x51, 0x28, 0x37, 0x5f, 0x87, 0xa9, 0x81, 0x59,
+    0x7e, 0xa6, 0x8d, 0x65, 0x3d, 0x21, 0x49, 0x71, 0x9a, 0x9a, 0x71, 0x49, 0x21, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0x9f, 0x75, 0x4b, 0x21,
+    0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x0a, 0x2c, 0x4d, 0x6e,
+    0x90, 0xa6, 0x85, 0x63, 0x42, 0x32, 0x5d, 0x87, 0xad, 0x83, 0x58, 0x2e, 0x1e, 0x19, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x36, 0x5a, 0x7f, 0xa3, 0x95, 0x70, 0x4c, 0x28, 0x33, 0x57, 0x7b, 0x9f,
+    0x92, 0x6e, 0x4a, 0x26, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x8a, 0xa9, 0x84, 0x60, 0x3c, 0x17, 0x00,
+    0x19, 0x3e, 0x62, 0x87, 0xa9, 0x84, 0x92, 0xa5, 0x7b, 0x50, 0x26, 0x00, 0x00, 0x00, 0x00, 0x13,
+    0x39, 0x60, 0x87, 0xae, 0x8f, 0x68, 0x41, 0x1a, 0x00, 0x10, 0x37, 0x5e, 0x85, 0xab, 0x8b, 0x64,
+    0x3d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2e, 0x59, 0x83, 0xa0, 0xa0, 0xa0, 0xac, 0xa0, 0xa0,
+    0xa0, 0xa0, 0xa0, 0xa7, 0xa1, 0xa0, 0xa0, 0x9e, 0x74, 0x49, 0x1f, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00, 0x07, 0x1c, 0x38, 0x5a, 0x7e, 0xa4, 0x99, 0x71,
+    0x49, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x29, 0x50, 0x77, 0x9d,
+    0x95, 0x6f, 0x48, 0x5a, 0x81, 0xa8, 0x8c, 0x65, 0x3f, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x3b, 0x63, 0x8b, 0xae, 0x86, 0x5e, 0x36, 0x44, 0x6c, 0x94, 0x9b, 0x73, 0x4b,
+    0x71, 0x99, 0x9b, 0x72, 0x4a, 0x2f, 0x57, 0x7f, 0xa7, 0x8c, 0x64, 0x3c, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x37, 0x61, 0x8b, 0x9e, 0x73, 0x49, 0x1f,
+    0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x03, 0x24, 0x46, 0x67, 0x88,
+    0xaa, 0x8c, 0x6b, 0x49, 0x48, 0x48, 0x5d, 0x87, 0xad, 0x83, 0x58, 0x48, 0x48, 0x40, 0x24, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x69, 0x8d, 0xab, 0x86, 0x62, 0x3e, 0x49, 0x6d, 0x91, 0xa0,
+    0x7c, 0x58, 0x34, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x74, 0x98, 0x9a, 0x76, 0x51, 0x2d, 0x0a,
+    0x2e, 0x53, 0x77, 0x9c, 0x93, 0x6f, 0x91, 0xa5, 0x7b, 0x50, 0x26, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x28, 0x4f, 0x76, 0x9d, 0xa0, 0x79, 0x52, 0x2b, 0x05, 0x21, 0x48, 0x6f, 0x96, 0xa0, 0x7a, 0x53,
+    0x2c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2e, 0x58, 0x76, 0x76, 0x76, 0x76, 0x9f, 0x7d, 0x76,
+    0x76, 0x76, 0x76, 0x96, 0x87, 0x76, 0x76, 0x76, 0x70, 0x49, 0x1f, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x45, 0x6d, 0x95, 0xa6, 0x7d,
+    0x54, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3b, 0x61, 0x88, 0xab,
+    0x84, 0x5e, 0x37, 0x49, 0x70, 0x97, 0x9d, 0x77, 0x50, 0x2a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x2d, 0x56, 0x7e, 0xa6, 0x93, 0x6b, 0x43, 0x52, 0x7a, 0xa2, 0x8e, 0x66, 0x3e,
+    0x63, 0x8b, 0xa8, 0x80, 0x58, 0x3c, 0x64, 0x8d, 0xa7, 0x7f, 0x57, 0x2e, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x35, 0x5f, 0x8a, 0x9c, 0x72, 0x47, 0x1d,
+    0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x15, 0x3d, 0x60, 0x81, 0xa2,
+    0x94, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x87, 0xad, 0x83, 0x72, 0x72, 0x72, 0x5e, 0x35, 0x0b,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x2e, 0x53, 0x77, 0x9b, 0x9c, 0x78, 0x54, 0x5f, 0x83, 0xa7, 0x8a,
+    0x66, 0x42, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x82, 0xa7, 0x8b, 0x67, 0x42, 0x1f,
+    0x44, 0x68, 0x8d, 0xa2, 0x7d, 0x67, 0x91, 0xa5, 0x7b, 0x50, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x3e, 0x65, 0x8c, 0xb1, 0x8a, 0x63, 0x3c, 0x16, 0x33, 0x59, 0x80, 0xa7, 0x8f, 0x69, 0x42,
+    0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x3f, 0x4c, 0x4c, 0x51, 0x7b, 0xa2, 0x78, 0x4e,
+    0x4c, 0x4c, 0x71, 0x9b, 0x81, 0x57, 0x4c, 0x4c, 0x4a, 0x35, 0x12, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x39, 0x62, 0x8c, 0xae, 0x84,
+    0x5a, 0x30, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x4c, 0x73, 0x9a, 0x9a,
+    0x73, 0x4d, 0x26, 0x38, 0x5f, 0x86, 0xad, 0x88, 0x62, 0x3b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x48, 0x70, 0x99, 0xa1, 0x79, 0x50, 0x60, 0x88, 0xa8, 0x80, 0x58, 0x30,
+    0x55, 0x7d, 0xa5, 0x8e, 0x65, 0x4a, 0x72, 0x9a, 0x99, 0x71, 0x49, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x5e, 0x88, 0x88, 0x70, 0x46, 0x1b,
+    0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x19, 0x44, 0x6e, 0x98, 0xba,
+    0xa1, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9e, 0xb6, 0x9d, 0x9d, 0x9d, 0x8b, 0x61, 0x36, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x61, 0x85, 0xa9, 0x8e, 0x6a, 0x75, 0x99, 0x99, 0x74,
+    0x50, 0x2c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x6d, 0x91, 0xa1, 0x7c, 0x58, 0x35,
+    0x59, 0x7e, 0xa2, 0x8c, 0x68, 0x67, 0x91, 0xa5, 0x7b, 0x50, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x2d, 0x54, 0x7b, 0xa1, 0x9b, 0x74, 0x4d, 0x27, 0x44, 0x6a, 0x91, 0xa5, 0x7e, 0x58, 0x31,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1a, 0x21, 0x2c, 0x56, 0x80, 0x9d, 0x73, 0x49,
+    0x22, 0x4c, 0x76, 0xa0, 0x7c, 0x52, 0x28, 0x21, 0x20, 0x13, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x35, 0x5f, 0x89, 0xb1, 0x87,
+    0x5c, 0x32, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x37, 0x5e, 0x84, 0xab, 0x89,
+    0x62, 0x45, 0x45, 0x45, 0x4e, 0x75, 0x9c, 0x9a, 0x73, 0x4d, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x3b, 0x63, 0x8b, 0xae, 0x86, 0x5e, 0x6e, 0x96, 0x9a, 0x72, 0x4a, 0x22,
+    0x47, 0x70, 0x98, 0x9b, 0x73, 0x57, 0x7f, 0xa8, 0x8c, 0x64, 0x3c, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2c, 0x4f, 0x5d, 0x5d, 0x5a, 0x3c, 0x15,
+    0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x19, 0x44, 0x6e, 0x8f, 0x8f,
+    0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x93, 0xb0, 0x90, 0x8f, 0x8f, 0x8b, 0x61, 0x36, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x26, 0x4b, 0x6f, 0x93, 0xa4, 0x80, 0x8b, 0xa7, 0x83, 0x5e,
+    0x3a, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x57, 0x7b, 0x9f, 0x92, 0x6e, 0x4a,
+    0x6f, 0x93, 0x9b, 0x76, 0x52, 0x67, 0x91, 0xa5, 0x7b, 0x50, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1c, 0x43, 0x69, 0x90, 0xac, 0x85, 0x5e, 0x38, 0x55, 0x7b, 0xa2, 0x94, 0x6d, 0x47, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x32, 0x43, 0x43, 0x43, 0x5b, 0x85, 0x97, 0x6d, 0x43,
+    0x43, 0x52, 0x7c, 0xa1, 0x77, 0x4d, 0x43, 0x43, 0x35, 0x16, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x37, 0x61, 0x8b, 0xaf, 0x85,
+    0x5b, 0x31, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x49, 0x6f, 0x96, 0x9f, 0x78,
+    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x8a, 0xab, 0x85, 0x5e, 0x38, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x2d, 0x56, 0x7e, 0xa6, 0x93, 0x6b, 0x7c, 0xa4, 0x8d, 0x65, 0x3d, 0x15,
+    0x3a, 0x62, 0x8a, 0xa9, 0x80, 0x65, 0x8d, 0xa7, 0x7f, 0x56, 0x2e, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x30, 0x4e, 0x62, 0x67, 0x59, 0x3e, 0x1d,
+    0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x16, 0x3e, 0x60, 0x65, 0x65,
+    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x8a, 0xad, 0x83, 0x65, 0x65, 0x65, 0x57, 0x32, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x35, 0x59, 0x7d, 0xa1, 0x97, 0xa1, 0x91, 0x6d, 0x48,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x41, 0x65, 0x8a, 0xa8, 0x83, 0x5f,
+    0x84, 0xa8, 0x85, 0x61, 0x3c, 0x67, 0x91, 0xa5, 0x7b, 0x51, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x32, 0x58, 0x7f, 0xa6, 0x96, 0x6f, 0x49, 0x66, 0x8d, 0xaa, 0x83, 0x5c, 0x36, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x4c, 0x6c, 0x6d, 0x6d, 0x6d, 0x8b, 0x92, 0x6d, 0x6d,
+    0x6d, 0x6d, 0x81, 0x9c, 0x72, 0x6d, 0x6d, 0x6d, 0x50, 0x27, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x42, 0x6a, 0x93, 0xa8, 0x7f,
+    0x55, 0x2c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x34, 0x5a, 0x81, 0xa7, 0xa5, 0x9a,
+    0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0xb6, 0x96, 0x70, 0x49, 0x23, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x48, 0x70, 0x98, 0xa1, 0x78, 0x8a, 0xa7, 0x7f, 0x57, 0x2f, 0x07,
+    0x2c, 0x54, 0x7c, 0xa4, 0x8e, 0x72, 0x9b, 0x99, 0x71, 0x49, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x46, 0x6b, 0x89, 0x91, 0x7a, 0x56, 0x2f,
+    0x06, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x04, 0x24, 0x38, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x60, 0x8a, 0xad, 0x83, 0x58, 0x3b, 0x3b, 0x34, 0x1b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x43, 0x67, 0x8b, 0xaf, 0x9f, 0x7b, 0x57, 0x32,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x50, 0x74, 0x98, 0x99, 0x75,
+    0x99, 0x94, 0x6f, 0x4b, 0x3c, 0x67, 0x91, 0xa5, 0x7b, 0x51, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x47, 0x6e, 0x95, 0xa7, 0x80, 0x5a, 0x77, 0x9e, 0x99, 0x72, 0x4b, 0x25, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4f, 0x79, 0x98, 0x98, 0x98, 0x9b, 0x9d, 0x98, 0x98,
+    0x98, 0x98, 0x98, 0xa3, 0x98, 0x98, 0x98, 0x7e, 0x53, 0x29, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x15, 0x32, 0x55, 0x7a, 0xa0, 0x9c, 0x74,
+    0x4c, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x45, 0x6c, 0x92, 0xa3, 0x8c, 0x8c,
+    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x91, 0xa8, 0x81, 0x5b, 0x34, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x3b, 0x63, 0x8b, 0xae, 0x86, 0x98, 0x99, 0x71, 0x49, 0x21, 0x00,
+    0x1e, 0x46, 0x6f, 0x97, 0x9c, 0x80, 0xa8, 0x8c, 0x64, 0x3c, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x4e, 0x79, 0xa3, 0xb5, 0x8b, 0x61, 0x36,
+    0x0c, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x36, 0x60, 0x8a, 0xad, 0x83, 0x58, 0x2e, 0x10, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x2d, 0x52, 0x7c, 0xa7, 0x93, 0x68, 0x41, 0x1d,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x3a, 0x5e, 0x82, 0xa7, 0x94,
+    0xa3, 0x7e, 0x5a, 0x35, 0x3c, 0x67, 0x91, 0xa5, 0x7b, 0x51, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x36, 0x5d, 0x84, 0xab, 0x91, 0x6b, 0x88, 0xaf, 0x88, 0x61, 0x3a, 0x14, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4f, 0x79, 0x87, 0x87, 0x87, 0x98, 0x8a, 0x87, 0x87,
+    0x87, 0x87, 0x8e, 0x92, 0x87, 0x87, 0x87, 0x7e, 0x53, 0x29, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x3d, 0x19, 0x19, 0x19, 0x1d, 0x27, 0x38, 0x51, 0x6e, 0x8f, 0xaf, 0x8a, 0x64,
+    0x3e, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x30, 0x57, 0x7d, 0xa4, 0x92, 0x6c, 0x62,
+    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x7e, 0xa5, 0x93, 0x6c, 0x46, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x2d, 0x55, 0x7e, 0xa6, 0x9d, 0xa9, 0x8c, 0x64, 0x3c, 0x14, 0x00,
+    0x11, 0x39, 0x61, 0x89, 0xab, 0x99, 0xa7, 0x7f, 0x56, 0x2e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x49, 0x70, 0x91, 0x99, 0x80, 0x5a, 0x32,
+    0x08, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x36, 0x60, 0x8a, 0x95, 0x83, 0x58, 0x2e, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x52, 0x7c, 0xa7, 0x93, 0x68, 0x3e, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x24, 0x48, 0x6d, 0x91, 0xb1,
+    0x8d, 0x69, 0x44, 0x20, 0x3c, 0x67, 0x91, 0xa5, 0x7b, 0x51, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x25, 0x4c, 0x73, 0x9a, 0xa2, 0x7c, 0x99, 0x9e, 0x77, 0x50, 0x29, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x44, 0x5c, 0x5d, 0x5d, 0x70, 0x9a, 0x82, 0x5d, 0x5d,
+    0x5d, 0x66, 0x90, 0x8c, 0x62, 0x5d, 0x5d, 0x5d, 0x47, 0x22, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x44, 0x44, 0x44, 0x44, 0x46, 0x4f, 0x5e, 0x73, 0x8c, 0xaa, 0x97, 0x75, 0x51,
+    0x2c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x41, 0x68, 0x8f, 0xa8, 0x81, 0x5b, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x46, 0x6d, 0x94, 0xa4, 0x7e, 0x57, 0x31, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x48, 0x70, 0x98, 0xbf, 0xa6, 0x7e, 0x56, 0x2e, 0x06, 0x00,
+    0x03, 0x2b, 0x53, 0x7b, 0xa3, 0xbf, 0x99, 0x71, 0x49, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x36, 0x55, 0x6b, 0x70, 0x61, 0x44, 0x21,
+    0x00, 0x0e, 0x38, 0x63, 0x8d, 0x95, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x59, 0x6a, 0x6a, 0x6a, 0x53, 0x2b, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x52, 0x7c, 0xa7, 0x93, 0x68, 0x3e, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x0e, 0x33, 0x57, 0x7b, 0x93,
+    0x77, 0x53, 0x2f, 0x12, 0x3c, 0x66, 0x91, 0xa5, 0x7b, 0x51, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0x3b, 0x62, 0x88, 0xaf, 0x95, 0xaa, 0x8d, 0x66, 0x3f, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x24, 0x32, 0x32, 0x4b, 0x76, 0xa0, 0x7d, 0x53, 0x32,
+    0x41, 0x6b, 0x95, 0x87, 0x5d, 0x33, 0x32, 0x32, 0x27, 0x0c, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x70, 0x78, 0x85, 0x97, 0xae, 0x98, 0x7b, 0x5b, 0x3a,
+    0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x2c, 0x53, 0x7a, 0xa0, 0x97, 0x70, 0x4a, 0x23,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x35, 0x5c, 0x83, 0xaa, 0x8f, 0x69, 0x42, 0x1c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x3b, 0x63, 0x8b, 0x95, 0x95, 0x70, 0x48, 0x20, 0x00, 0x00,
+    0x00, 0x1d, 0x45, 0x6e, 0x95, 0x95, 0x8c, 0x64, 0x3c, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x33, 0x43, 0x46, 0x3b, 0x26, 0x08,
+    0x00, 0x0c, 0x35, 0x5c, 0x6a, 0x6a, 0x6a, 0x50, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x39, 0x40, 0x40, 0x40, 0x35, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x52, 0x7c, 0xa7, 0x93, 0x68, 0x3e, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x0e, 0x1d, 0x41, 0x63, 0x69,
+    0x60, 0x3d, 0x19, 0x12, 0x3c, 0x66, 0x91, 0xa6, 0x7b, 0x51, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x2a, 0x51, 0x77, 0x9e, 0xbf, 0xa2, 0x7c, 0x55, 0x2e, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x27, 0x51, 0x7b, 0xa2, 0x78, 0x4e, 0x24,
+    0x47, 0x71, 0x9b, 0x82, 0x58, 0x2e, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x9e, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9b, 0xa1, 0xad, 0x9f, 0x8d, 0x76, 0x5c, 0x3f, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x3e, 0x64, 0x8b, 0x95, 0x86, 0x5f, 0x39, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x4b, 0x72, 0x95, 0x95, 0x7a, 0x54, 0x2c, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x2d, 0x55, 0x6a, 0x6a, 0x6a, 0x60, 0x3b, 0x13, 0x00, 0x00,
+    0x00, 0x10, 0x38, 0x5e, 0x6a, 0x6a, 0x6a, 0x55, 0x2e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x19, 0x1b, 0x14, 0x03, 0x00,
+    0x00, 0x00, 0x20, 0x3a, 0x40, 0x40, 0x40, 0x33, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x16, 0x16, 0x16, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x52, 0x7c, 0xa7, 0x93, 0x68, 0x3e, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x95, 0x8d, 0x63, 0x39, 0x0e, 0x07, 0x28, 0x3c, 0x3e,
+    0x3b, 0x24, 0x03, 0x12, 0x3c, 0x66, 0x91, 0x95, 0x7b, 0x51, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x40, 0x66, 0x8d, 0x95, 0x91, 0x6b, 0x44, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2c, 0x56, 0x80, 0x95, 0x73, 0x49, 0x22,
+    0x4c, 0x76, 0x95, 0x7d, 0x53, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x93, 0x8e, 0x85, 0x78, 0x67, 0x53, 0x3b, 0x20, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x3e, 0x62, 0x6a, 0x6a, 0x6a, 0x4e, 0x27, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x3a, 0x5f, 0x6a, 0x6a, 0x6a, 0x54, 0x2c, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x36, 0x40, 0x40, 0x40, 0x3c, 0x24, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x22, 0x3b, 0x40, 0x40, 0x40, 0x36, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x16, 0x16, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0d, 0x0d, 0x0d,
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x0d, 0x0d, 0x0d, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x52, 0x7c, 0x95, 0x93, 0x68, 0x3e, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x27, 0x4f, 0x6a, 0x6a, 0x6a, 0x5c, 0x35, 0x0c, 0x00, 0x05, 0x13, 0x14,
+    0x12, 0x03, 0x00, 0x10, 0x39, 0x5f, 0x6a, 0x6a, 0x6a, 0x4c, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x2f, 0x55, 0x6a, 0x6a, 0x6a, 0x59, 0x33, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2b, 0x53, 0x6a, 0x6a, 0x65, 0x42, 0x21,
+    0x4a, 0x69, 0x6a, 0x6a, 0x4b, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x4f, 0x6a,
+    0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x69, 0x64, 0x5c, 0x50, 0x41, 0x2e, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x26, 0x3d, 0x40, 0x40, 0x40, 0x32, 0x14, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x24, 0x3c, 0x40, 0x40, 0x40, 0x35, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x16, 0x16, 0x16, 0x13, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x12, 0x16, 0x16, 0x16, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x0d, 0x0d, 0x0d, 0x0d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x38, 0x38, 0x38,
+    0x33, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x34, 0x38, 0x38, 0x38, 0x31, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4d, 0x6a, 0x6a, 0x6a, 0x60, 0x3b, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x33, 0x40, 0x40, 0x40, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x23, 0x3b, 0x40, 0x40, 0x40, 0x31, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x36, 0x40, 0x40, 0x40, 0x38, 0x1e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x35, 0x40, 0x40, 0x3e, 0x2a, 0x10,
+    0x2f, 0x40, 0x40, 0x40, 0x30, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x33, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3f, 0x3b, 0x33, 0x28, 0x1a, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x14, 0x16, 0x16, 0x16, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0x16, 0x16, 0x16, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0d, 0x0d, 0x0d, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x0d, 0x0d, 0x0d, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x28, 0x37, 0x38, 0x38, 0x37, 0x2b, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x25, 0x36,
+    0x38, 0x38, 0x37, 0x2a, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4b, 0x62, 0x62, 0x62,
+    0x59, 0x36, 0x0e, 0x00, 0x00, 0x00, 0x1e, 0x3c, 0x5a, 0x62, 0x62, 0x62, 0x55, 0x31, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x31, 0x40, 0x40, 0x40, 0x3c, 0x24, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x16, 0x16, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0x16, 0x16, 0x16, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x16, 0x16, 0x16, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x16, 0x16, 0x15, 0x07, 0x00,
+    0x0b, 0x15, 0x16, 0x16, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x16,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x11, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0d, 0x0d, 0x0d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x0d, 0x0d, 0x0d, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x35, 0x2e, 0x24, 0x16, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x38, 0x38, 0x38, 0x33, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x2b, 0x37, 0x38, 0x38, 0x34, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1e, 0x45, 0x61, 0x62, 0x62, 0x62, 0x4a, 0x27, 0x05, 0x00, 0x00, 0x00, 0x1f, 0x42, 0x5f,
+    0x62, 0x62, 0x62, 0x49, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x8c, 0x8c,
+    0x67, 0x3d, 0x12, 0x00, 0x00, 0x1d, 0x3b, 0x5a, 0x78, 0x8c, 0x8c, 0x7f, 0x5e, 0x35, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x16, 0x16, 0x16, 0x13, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x38, 0x38, 0x38, 0x2c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x2b, 0x37, 0x38, 0x38, 0x34, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x4b, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x58, 0x4d, 0x3c, 0x27,
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4b, 0x62, 0x62, 0x62, 0x59, 0x36, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x23, 0x49, 0x62, 0x62, 0x62, 0x5a, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x22, 0x4b, 0x71, 0x8c, 0x8c, 0x85, 0x62, 0x40, 0x1e, 0x00, 0x00, 0x16, 0x38, 0x5b, 0x7d,
+    0x8c, 0x8c, 0x75, 0x50, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91,
+    0x67, 0x3d, 0x12, 0x00, 0x1c, 0x3a, 0x59, 0x77, 0x95, 0x9f, 0x81, 0x62, 0x43, 0x24, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x14, 0x15, 0x14, 0x0e, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x37, 0x35, 0x2e, 0x25, 0x17, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x35, 0x2e, 0x25, 0x17, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x32, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x31, 0x19, 0x00, 0x00, 0x00, 0x09, 0x27, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x2a, 0x0d, 0x00, 0x00, 0x1d, 0x33, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x25, 0x4b, 0x62, 0x62, 0x62, 0x4c, 0x2b, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x49, 0x62, 0x62, 0x62, 0x5a, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x54, 0x7f, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x81, 0x74, 0x61, 0x49,
+    0x2c, 0x0c, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x8c, 0x8c, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x52, 0x7d, 0x8c, 0x8c, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x13, 0x36, 0x58, 0x7b, 0x9d, 0x9e, 0x7b, 0x59, 0x37, 0x15, 0x0c, 0x2f, 0x51, 0x73, 0x96,
+    0xa0, 0x7e, 0x5c, 0x3a, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91,
+    0x67, 0x3d, 0x12, 0x1b, 0x3a, 0x58, 0x76, 0x95, 0xa1, 0x82, 0x64, 0x45, 0x26, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x23, 0x30, 0x39, 0x3e, 0x40, 0x3e, 0x38, 0x2e, 0x1e, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4b, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+    0x62, 0x62, 0x5f, 0x58, 0x4d, 0x3e, 0x2a, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4b, 0x62,
+    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x58, 0x4d, 0x3e, 0x2a, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x32, 0x56, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+    0x62, 0x62, 0x54, 0x30, 0x08, 0x00, 0x00, 0x1d, 0x44, 0x60, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x48, 0x21, 0x00, 0x0e, 0x36, 0x59, 0x62, 0x62, 0x62,
+    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5b, 0x39, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x8c, 0x87, 0x66, 0x45, 0x24, 0x03, 0x00, 0x00, 0x00,
+    0x28, 0x52, 0x7d, 0x8c, 0x8c, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x54, 0x7f, 0xa9, 0xa0, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9c, 0xa2, 0xaa, 0x9b, 0x84, 0x68,
+    0x47, 0x23, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1d, 0x40, 0x62, 0x84, 0xa7, 0x94, 0x72, 0x50, 0x2e, 0x25, 0x47, 0x6a, 0x8c, 0xa9,
+    0x87, 0x65, 0x43, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91,
+    0x67, 0x3d, 0x1a, 0x39, 0x57, 0x75, 0x94, 0xa3, 0x84, 0x65, 0x47, 0x28, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x23, 0x39, 0x4b, 0x59, 0x63, 0x68, 0x6a, 0x68, 0x61, 0x56, 0x45, 0x2e, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
+    0x8c, 0x8c, 0x89, 0x81, 0x75, 0x64, 0x4e, 0x33, 0x16, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x81, 0x75, 0x64, 0x4e, 0x33, 0x16, 0x00, 0x00,
+    0x00, 0x0d, 0x38, 0x62, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
+    0x8c, 0x8b, 0x60, 0x36, 0x0c, 0x00, 0x00, 0x22, 0x4c, 0x76, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
+    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x7b, 0x51, 0x26, 0x00, 0x12, 0x3c, 0x66, 0x8c, 0x8c, 0x8c,
+    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x6a, 0x40, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0xa2, 0x81, 0x60, 0x3f, 0x1e, 0x00, 0x00, 0x00,
+    0x28, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x70, 0x70, 0x70, 0x70, 0x70, 0x72, 0x78, 0x88, 0xa1, 0xa4, 0x82,
+    0x5c, 0x35, 0x0d, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x27, 0x49, 0x6b, 0x8e, 0xad, 0x8b, 0x69, 0x47, 0x3e, 0x60, 0x83, 0xa5, 0x90,
+    0x6e, 0x4c, 0x2a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91,
+    0x67, 0x3d, 0x38, 0x56, 0x75, 0x93, 0xa4, 0x85, 0x67, 0x48, 0x29, 0x0b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0c, 0x2a, 0x46, 0x5e, 0x72, 0x81, 0x8c, 0x92, 0x94, 0x92, 0x8b, 0x7d, 0x69, 0x50, 0x33,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0xa5, 0xa1, 0xa1, 0xa1,
+    0xa1, 0xa1, 0xa6, 0xaa, 0x9c, 0x88, 0x6f, 0x52, 0x31, 0x0f, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0xa5, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa6, 0xaa, 0x9c, 0x88, 0x6f, 0x52, 0x31, 0x0f, 0x00,
+    0x00, 0x0d, 0x38, 0x62, 0x8c, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xb2,
+    0xb2, 0x8b, 0x60, 0x36, 0x0c, 0x00, 0x00, 0x22, 0x4c, 0x76, 0xa1, 0xa8, 0xa1, 0xa1, 0xa1, 0xa1,
+    0xa1, 0xa1, 0xa1, 0xa1, 0xaf, 0xa5, 0x7b, 0x51, 0x26, 0x00, 0x12, 0x3c, 0x66, 0x91, 0xa1, 0xa1,
+    0xa1, 0xa1, 0xa1, 0xab, 0xad, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x94, 0x6a, 0x40, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0xbc, 0x9b, 0x7a, 0x59, 0x38, 0x17, 0x00, 0x00,
+    0x28, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x46, 0x46, 0x46, 0x46, 0x47, 0x50, 0x65, 0x86, 0xac, 0x92,
+    0x69, 0x40, 0x16, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x30, 0x53, 0x75, 0x97, 0xa4, 0x82, 0x60, 0x57, 0x79, 0x9b, 0x9a, 0x77,
+    0x55, 0x33, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91,
+    0x67, 0x3d, 0x55, 0x74, 0x92, 0xa6, 0x87, 0x68, 0x4a, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x26, 0x48, 0x66, 0x81, 0x97, 0xa9, 0xa3, 0x9c, 0x9b, 0x9f, 0xaa, 0xa3, 0x8c, 0x6e, 0x4d,
+    0x29, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x7c, 0x87, 0x9a, 0xab, 0x8e, 0x6c, 0x49, 0x23, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7c, 0x87, 0x9a, 0xab, 0x8e, 0x6c, 0x49, 0x23, 0x00,
+    0x00, 0x0d, 0x37, 0x61, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x82, 0xa7,
+    0x97, 0x76, 0x55, 0x31, 0x08, 0x00, 0x00, 0x22, 0x4c, 0x76, 0xa1, 0x96, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x7b, 0xa2, 0x96, 0x70, 0x49, 0x22, 0x00, 0x11, 0x3b, 0x65, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x9b, 0x9e, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x68, 0x3f, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0xac, 0xaf, 0x95, 0x74, 0x53, 0x32, 0x11, 0x00,
+    0x28, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x1c, 0x1c, 0x1c, 0x1d, 0x29, 0x4f, 0x79, 0xa3, 0x98,
+    0x6e, 0x43, 0x19, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x04, 0x04, 0x04,
+    0x04, 0x28, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x3a, 0x5c, 0x7e, 0xa1, 0x9b, 0x78, 0x6f, 0x92, 0xa3, 0x81, 0x5f,
+    0x3c, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91,
+    0x67, 0x54, 0x73, 0x91, 0xa7, 0x89, 0x6a, 0x4b, 0x2c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x32, 0x5c, 0x83, 0xa1, 0x9e, 0x89, 0x7a, 0x72, 0x71, 0x76, 0x84, 0x9c, 0xaa, 0x88, 0x62,
+    0x3b, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x4c, 0x4c,
+    0x4c, 0x4d, 0x53, 0x61, 0x79, 0x98, 0xa7, 0x82, 0x5b, 0x33, 0x0b, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x4c, 0x4c, 0x4c, 0x4d, 0x53, 0x61, 0x79, 0x98, 0xa7, 0x82, 0x5b, 0x33, 0x0b,
+    0x00, 0x02, 0x27, 0x44, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x5b, 0x7c, 0x9d, 0x9e,
+    0x7d, 0x5c, 0x3b, 0x1a, 0x00, 0x00, 0x00, 0x22, 0x4c, 0x76, 0xa1, 0x96, 0x6b, 0x4c, 0x4c, 0x4c,
+    0x4c, 0x4c, 0x66, 0x8d, 0xac, 0x85, 0x5e, 0x38, 0x11, 0x00, 0x06, 0x2b, 0x46, 0x4c, 0x4c, 0x4c,
+    0x4c, 0x4c, 0x70, 0x9b, 0x9e, 0x74, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x48, 0x2e, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x92, 0xaf, 0x8e, 0x6d, 0x4c, 0x2b, 0x0a,
+    0x28, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x2a, 0x2a, 0x2a, 0x2b, 0x35, 0x53, 0x7b, 0xa5, 0x94,
+    0x6a, 0x40, 0x17, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x43, 0x65, 0x88, 0xaa, 0x91, 0x88, 0xaa, 0x8a, 0x68, 0x46,
+    0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91,
+    0x67, 0x72, 0x90, 0xaf, 0x8a, 0x6b, 0x4d, 0x2e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x28, 0x4a, 0x66, 0x81, 0x7d, 0x63, 0x51, 0x48, 0x46, 0x4d, 0x61, 0x81, 0xa7, 0x98, 0x6f,
+    0x46, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x22,
+    0x22, 0x23, 0x2a, 0x3d, 0x5d, 0x83, 0xab, 0x90, 0x67, 0x3e, 0x14, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x3d, 0x22, 0x22, 0x23, 0x2a, 0x3d, 0x5d, 0x83, 0xab, 0x90, 0x67, 0x3e, 0x14,
+    0x00, 0x00, 0x09, 0x1d, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x34, 0x54, 0x75, 0x96, 0xa4, 0x83,
+    0x62, 0x41, 0x20, 0x00, 0x00, 0x00, 0x00, 0x22, 0x4c, 0x76, 0xa1, 0x96, 0x6b, 0x41, 0x22, 0x22,
+    0x2a, 0x51, 0x78, 0x9e, 0x9a, 0x74, 0x4d, 0x27, 0x00, 0x00, 0x00, 0x0c, 0x1f, 0x22, 0x22, 0x22,
+    0x22, 0x46, 0x70, 0x9b, 0x9e, 0x74, 0x4a, 0x22, 0x22, 0x22, 0x22, 0x1f, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x77, 0x98, 0xa9, 0x88, 0x67, 0x46, 0x25,
+    0x28, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x54, 0x54, 0x54, 0x54, 0x55, 0x5d, 0x6f, 0x8d, 0xa9, 0x85,
+    0x5f, 0x37, 0x0e, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x58, 0x58, 0x58, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x2a, 0x4d, 0x6f, 0x91, 0xac, 0xa6, 0x93, 0x71, 0x4f, 0x2d,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91,
+    0x71, 0x8f, 0xae, 0xb0, 0x97, 0x76, 0x55, 0x35, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x2a, 0x46, 0x62, 0x60, 0x41, 0x2a, 0x1e, 0x1c, 0x25, 0x49, 0x72, 0x9c, 0x9f, 0x74,
+    0x4a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12,
+    0x00, 0x00, 0x02, 0x26, 0x4f, 0x79, 0xa3, 0x97, 0x6d, 0x43, 0x18, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x02, 0x26, 0x4f, 0x79, 0xa3, 0x97, 0x6d, 0x43, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2d, 0x4e, 0x6f, 0x90, 0xab, 0x8a, 0x69,
+    0x48, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x21, 0x4b, 0x73, 0x77, 0x77, 0x69, 0x40, 0x16, 0x15,
+    0x3c, 0x62, 0x89, 0xb0, 0x89, 0x63, 0x3c, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x46, 0x70, 0x9b, 0x9e, 0x74, 0x4a, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x7e, 0x9f, 0xa2, 0x81, 0x60, 0x3f,
+    0x28, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x86, 0x94, 0xa3, 0x8c, 0x6d,
+    0x4b, 0x26, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x92, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3a, 0x5c, 0x7e, 0xa5, 0xaa, 0x84, 0x61, 0x3f, 0x1d,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91,
+    0x8f, 0xad, 0x8f, 0x91, 0xb1, 0x91, 0x70, 0x50, 0x2f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x26, 0x3c, 0x3b, 0x24, 0x06, 0x00, 0x00, 0x21, 0x4a, 0x73, 0x9d, 0x9c, 0x72,
+    0x48, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12,
+    0x00, 0x00, 0x00, 0x25, 0x4f, 0x79, 0xa3, 0x97, 0x6d, 0x43, 0x19, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00, 0x25, 0x4f, 0x79, 0xa3, 0x97, 0x6d, 0x43, 0x19,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x27, 0x48, 0x69, 0x8a, 0xab, 0x90, 0x6f, 0x4e,
+    0x2d, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x37, 0x4b, 0x4c, 0x4c, 0x48, 0x2f, 0x0b, 0x27,
+    0x4d, 0x74, 0x9a, 0x9e, 0x78, 0x51, 0x2b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x46, 0x70, 0x9b, 0x9e, 0x74, 0x4a, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x63, 0x84, 0xa5, 0x9c, 0x7b, 0x5a,
+    0x39, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x54, 0x7f, 0xa9, 0xac, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xb1, 0x90, 0x7e, 0x6a,
+    0x4f, 0x30, 0x0f, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0xae, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xba, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x31, 0x53, 0x75, 0x97, 0xa1, 0x9e, 0x9d, 0x7a, 0x58, 0x36,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0xaa,
+    0xad, 0x90, 0x72, 0x75, 0x95, 0xac, 0x8b, 0x6b, 0x4a, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x12, 0x12, 0x02, 0x00, 0x00, 0x17, 0x37, 0x5a, 0x7f, 0xa7, 0x92, 0x6a,
+    0x41, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x1d,
+    0x1d, 0x1e, 0x25, 0x39, 0x5b, 0x82, 0xaa, 0x91, 0x68, 0x3e, 0x15, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x3d, 0x1c, 0x1c, 0x1d, 0x24, 0x39, 0x5b, 0x82, 0xaa, 0x91, 0x68, 0x3e, 0x15,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x41, 0x62, 0x83, 0xa4, 0x97, 0x76, 0x55, 0x34,
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x21, 0x22, 0x22, 0x20, 0x0f, 0x12, 0x38,
+    0x5f, 0x85, 0xac, 0x8d, 0x67, 0x40, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x46, 0x70, 0x9b, 0x9e, 0x74, 0x4a, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x49, 0x6a, 0x8b, 0xac, 0x95, 0x74,
+    0x54, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x88, 0x97, 0xa4, 0x8b,
+    0x6c, 0x49, 0x24, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x28, 0x4a, 0x6c, 0x8e, 0xaa, 0x87, 0x84, 0xa7, 0x93, 0x71, 0x4f,
+    0x2d, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0xaf,
+    0x90, 0x72, 0x54, 0x5a, 0x7a, 0x9a, 0xa6, 0x86, 0x65, 0x44, 0x24, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x35, 0x53, 0x73, 0x94, 0xa4, 0x80, 0x5b,
+    0x34, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x47, 0x47,
+    0x47, 0x48, 0x4e, 0x5c, 0x75, 0x95, 0xaa, 0x84, 0x5d, 0x34, 0x0c, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x46, 0x46, 0x46, 0x47, 0x4d, 0x5c, 0x75, 0x95, 0xa9, 0x84, 0x5c, 0x34, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x3b, 0x5c, 0x7d, 0x9e, 0x9d, 0x7c, 0x5b, 0x3a, 0x19,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x4a,
+    0x70, 0x97, 0xa3, 0x7c, 0x55, 0x2f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x46, 0x70, 0x9b, 0x9e, 0x74, 0x4a, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x4f, 0x70, 0x91, 0xb0, 0x8f,
+    0x6e, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x54, 0x54, 0x54, 0x54, 0x54, 0x56, 0x5f, 0x74, 0x93, 0xa7,
+    0x82, 0x5b, 0x33, 0x0a, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x56, 0x56, 0x56, 0x56, 0x56,
+    0x56, 0x56, 0x56, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1e, 0x41, 0x63, 0x85, 0xa7, 0x91, 0x6f, 0x6c, 0x8e, 0xac, 0x8a, 0x68,
+    0x46, 0x24, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x92,
+    0x73, 0x54, 0x36, 0x3e, 0x5e, 0x7e, 0x9e, 0xa1, 0x80, 0x5f, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x36, 0x53, 0x71, 0x8f, 0xab, 0x8b, 0x69, 0x46,
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x77, 0x83, 0x96, 0xae, 0x91, 0x6f, 0x4b, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x71, 0x71, 0x71, 0x71, 0x71, 0x76, 0x82, 0x96, 0xae, 0x91, 0x6f, 0x4b, 0x25, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x35, 0x56, 0x77, 0x98, 0xa4, 0x83, 0x62, 0x41, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x34, 0x5b,
+    0x82, 0xa8, 0x91, 0x6b, 0x44, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x46, 0x70, 0x9b, 0x9e, 0x74, 0x4a, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x35, 0x56, 0x77, 0x98, 0xaa,
+    0x89, 0x68, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x29, 0x29, 0x29, 0x29, 0x2c, 0x39, 0x59, 0x81, 0xab,
+    0x90, 0x66, 0x3c, 0x12, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x2b, 0x2b, 0x2b, 0x2b,
+    0x2b, 0x2b, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x37, 0x5a, 0x7c, 0x9e, 0x9b, 0x78, 0x56, 0x53, 0x75, 0x97, 0xa3, 0x81,
+    0x5f, 0x3d, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91,
+    0x67, 0x3d, 0x19, 0x22, 0x42, 0x62, 0x82, 0xa3, 0x9b, 0x7a, 0x5a, 0x39, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x37, 0x54, 0x72, 0x8f, 0xab, 0x8d, 0x6f, 0x4f, 0x2e,
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0xa1, 0x9c, 0x9c, 0x9c,
+    0x9c, 0x9d, 0xa1, 0xab, 0xa1, 0x8c, 0x73, 0x55, 0x34, 0x11, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0xa0, 0x9b, 0x9b, 0x9b, 0x9b, 0x9c, 0xa0, 0xaa, 0xa0, 0x8c, 0x73, 0x55, 0x34, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0d, 0x2e, 0x4f, 0x70, 0x91, 0xaa, 0x89, 0x68, 0x47, 0x26, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x46, 0x6c,
+    0x93, 0xa7, 0x80, 0x59, 0x33, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x46, 0x70, 0x9b, 0x9e, 0x74, 0x4a, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x1a, 0x3b, 0x5c, 0x7d, 0x9e,
+    0xa3, 0x82, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x13, 0x13, 0x13, 0x13, 0x16, 0x2a, 0x54, 0x7e, 0xa8,
+    0x93, 0x69, 0x3f, 0x14, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x01, 0x01, 0x01,
+    0x01, 0x28, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x2e, 0x51, 0x73, 0x95, 0xa5, 0x82, 0x60, 0x3d, 0x3a, 0x5c, 0x7e, 0xa0, 0x9a,
+    0x78, 0x56, 0x34, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91,
+    0x67, 0x3d, 0x12, 0x07, 0x27, 0x47, 0x67, 0x87, 0xa7, 0x95, 0x75, 0x54, 0x33, 0x13, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x38, 0x55, 0x73, 0x90, 0xa9, 0x8c, 0x6f, 0x51, 0x33, 0x13,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x98, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x8d, 0x86, 0x79, 0x68, 0x51, 0x37, 0x19, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x98, 0x90, 0x90, 0x90, 0x90, 0x8f, 0x95, 0xa5, 0x7f, 0x67, 0x51, 0x37, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x28, 0x49, 0x6a, 0x8b, 0xac, 0x90, 0x6f, 0x4e, 0x2d, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x31, 0x57, 0x7e,
+    0xa4, 0x95, 0x6f, 0x48, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x46, 0x70, 0x9b, 0x9e, 0x74, 0x4a, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x21, 0x42, 0x62, 0x83,
+    0xa4, 0x9d, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x40, 0x4a, 0x63, 0x87, 0xaf,
+    0x8e, 0x65, 0x3b, 0x11, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x25, 0x47, 0x6a, 0x8c, 0xae, 0x8c, 0x6a, 0x47, 0x25, 0x21, 0x43, 0x65, 0x88, 0xaa,
+    0x91, 0x6f, 0x4d, 0x2a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91,
+    0x67, 0x3d, 0x12, 0x00, 0x0b, 0x2b, 0x4b, 0x6b, 0x8b, 0xab, 0x90, 0x6f, 0x4e, 0x2e, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1c, 0x39, 0x56, 0x74, 0x91, 0xa8, 0x8b, 0x6e, 0x50, 0x33, 0x15, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x67, 0x67,
+    0x67, 0x66, 0x63, 0x5d, 0x51, 0x42, 0x2e, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x66, 0x66, 0x66, 0x65, 0x7c, 0x9f, 0x97, 0x75, 0x52, 0x30, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x22, 0x43, 0x64, 0x85, 0xa5, 0x96, 0x75, 0x54, 0x33, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x18, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x42, 0x69, 0x8f,
+    0xab, 0x84, 0x5d, 0x37, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x46, 0x70, 0x9b, 0x9e, 0x74, 0x4a, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x06, 0x27, 0x48, 0x69,
+    0x8a, 0xab, 0xa0, 0xb3, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6a, 0x72, 0x83, 0x9f, 0xa3,
+    0x80, 0x59, 0x31, 0x09, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1c, 0x3e, 0x60, 0x83, 0xa5, 0x96, 0x73, 0x51, 0x2e, 0x0c, 0x08, 0x2a, 0x4c, 0x6f, 0x91,
+    0xaa, 0x88, 0x66, 0x43, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x95, 0x91,
+    0x67, 0x3d, 0x12, 0x00, 0x00, 0x0f, 0x30, 0x50, 0x70, 0x90, 0x95, 0x8a, 0x69, 0x46, 0x1d, 0x00,
+    0x00, 0x00, 0x00, 0x1d, 0x3a, 0x58, 0x75, 0x92, 0xa7, 0x8a, 0x6c, 0x4f, 0x32, 0x19, 0x19, 0x19,
+    0x17, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x3c,
+    0x3c, 0x3c, 0x39, 0x33, 0x29, 0x1b, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x3d, 0x3b, 0x3b, 0x41, 0x64, 0x87, 0xa9, 0x8d, 0x6b, 0x48, 0x25, 0x03, 0x00,
+    0x00, 0x00, 0x1b, 0x3c, 0x5d, 0x7e, 0x9f, 0x9d, 0x7c, 0x5b, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x41, 0x2a, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x2d, 0x54, 0x7a, 0xa1,
+    0x99, 0x73, 0x4c, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x46, 0x70, 0x9b, 0x9e, 0x74, 0x4a, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x0c, 0x2d, 0x4e,
+    0x6f, 0x90, 0xb1, 0xbe, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x54, 0x7f, 0xa9, 0x99, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x94, 0x9b, 0xa9, 0x9e, 0x86,
+    0x68, 0x46, 0x21, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x52, 0x7d, 0xa7, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x30, 0x57, 0x79, 0x95, 0x95, 0x7d, 0x5b, 0x38, 0x16, 0x00, 0x00, 0x11, 0x34, 0x56, 0x78,
+    0x95, 0x95, 0x7f, 0x5c, 0x36, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x4f, 0x6a, 0x6a, 0x6a,
+    0x5f, 0x39, 0x10, 0x00, 0x00, 0x00, 0x14, 0x34, 0x54, 0x6a, 0x6a, 0x6a, 0x67, 0x46, 0x1d, 0x00,
+    0x00, 0x00, 0x1e, 0x3b, 0x59, 0x76, 0x93, 0xa6, 0x89, 0x6b, 0x4e, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x40, 0x27, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12,
+    0x12, 0x12, 0x0f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x3d, 0x12, 0x11, 0x29, 0x4c, 0x6e, 0x91, 0xa6, 0x83, 0x60, 0x3e, 0x1b, 0x00,
+    0x00, 0x0e, 0x35, 0x57, 0x78, 0x99, 0xa4, 0x82, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+    0x6e, 0x6e, 0x66, 0x41, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3e, 0x65, 0x8c, 0xaf,
+    0x88, 0x61, 0x3b, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x46, 0x70, 0x9b, 0x9e, 0x74, 0x4a, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x13, 0x34,
+    0x55, 0x76, 0x97, 0xb8, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x54, 0x7f, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x93, 0x8f, 0x86, 0x78, 0x63,
+    0x4a, 0x2c, 0x0b, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x95, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x52, 0x7d, 0x95, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x30, 0x57, 0x6a, 0x6a, 0x6a, 0x64, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x3d, 0x5f,
+    0x6a, 0x6a, 0x6a, 0x5c, 0x36, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x33, 0x40, 0x40, 0x40,
+    0x3b, 0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x18, 0x35, 0x40, 0x40, 0x40, 0x3f, 0x2c, 0x0c, 0x00,
+    0x00, 0x14, 0x3a, 0x5a, 0x77, 0x94, 0xa7, 0x87, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+    0x63, 0x3c, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x11, 0x33, 0x56, 0x79, 0x9b, 0x9b, 0x79, 0x56, 0x34, 0x11,
+    0x00, 0x14, 0x3f, 0x69, 0x92, 0xb3, 0xa8, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+    0x98, 0x98, 0x6d, 0x43, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x29, 0x50, 0x76, 0x9d, 0x9d,
+    0x77, 0x50, 0x29, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x46, 0x70, 0x9b, 0x9e, 0x74, 0x4a, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x95, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00, 0x19,
+    0x3a, 0x5b, 0x7c, 0x95, 0x93, 0x69, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x4f, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x69, 0x65, 0x5d, 0x50, 0x3f,
+    0x29, 0x0e, 0x00, 0x00, 0x00, 0x27, 0x4f, 0x6a, 0x6a, 0x6a, 0x5f, 0x39, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x25, 0x4e, 0x6a, 0x6a, 0x6a, 0x61, 0x3b, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1c, 0x37, 0x40, 0x40, 0x40, 0x3d, 0x28, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x23, 0x3b,
+    0x40, 0x40, 0x40, 0x3a, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x16, 0x16,
+    0x13, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x16, 0x16, 0x16, 0x15, 0x09, 0x00, 0x00,
+    0x00, 0x1a, 0x45, 0x6f, 0x96, 0xb3, 0xab, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x93,
+    0x69, 0x3e, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x95, 0x91, 0x67, 0x3d, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f,
+    0x95, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x1b, 0x3e, 0x60, 0x83, 0x95, 0x91, 0x6f, 0x4b, 0x23,
+    0x00, 0x14, 0x3f, 0x69, 0x93, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+    0x95, 0x95, 0x6d, 0x43, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x3a, 0x61, 0x88, 0x95, 0x8c,
+    0x65, 0x3f, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x46, 0x70, 0x95, 0x95, 0x74, 0x4a, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x27, 0x4f, 0x6a, 0x6a, 0x6a, 0x5f, 0x39, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x41, 0x62, 0x6a, 0x6a, 0x61, 0x3b, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x33, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3f, 0x3b, 0x34, 0x28, 0x19,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x15, 0x33, 0x40, 0x40, 0x40, 0x3b, 0x23, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x13, 0x32, 0x40, 0x40, 0x40, 0x3c, 0x25, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x16, 0x16, 0x16, 0x14, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13,
+    0x16, 0x16, 0x16, 0x12, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1a, 0x45, 0x6f, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x93,
+    0x69, 0x3e, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x4f, 0x6a, 0x6a, 0x6a, 0x5f, 0x39, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x4f, 0x6a,
+    0x6a, 0x6a, 0x5f, 0x39, 0x10, 0x00, 0x00, 0x03, 0x25, 0x48, 0x68, 0x6a, 0x6a, 0x6a, 0x4b, 0x23,
+    0x00, 0x12, 0x3b, 0x61, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a,
+    0x6a, 0x6a, 0x64, 0x3f, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x3a, 0x60, 0x6a, 0x6a, 0x6a,
+    0x54, 0x2d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1a, 0x42, 0x66, 0x6a, 0x6a, 0x67, 0x46, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x33, 0x40, 0x40, 0x40, 0x3b, 0x23, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x26, 0x3d, 0x40, 0x40, 0x3c, 0x25, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0d, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x11, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x16, 0x16, 0x13, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x16, 0x16, 0x16, 0x13, 0x03, 0x00, 0x00, 0x00, 0x05, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x0f, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x29, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x41, 0x65, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a,
+    0x60, 0x3b, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x33, 0x40, 0x40, 0x40, 0x3b, 0x23, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x33, 0x40,
+    0x40, 0x40, 0x3b, 0x23, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x3f, 0x40, 0x40, 0x40, 0x30, 0x11,
+    0x00, 0x03, 0x25, 0x3c, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x3d, 0x28, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x24, 0x3c, 0x40, 0x40, 0x40,
+    0x35, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x2a, 0x3e, 0x40, 0x40, 0x3f, 0x2c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x16, 0x16, 0x13, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x14, 0x16, 0x16, 0x13, 0x03, 0x00, 0x00, 0x00, 0x05, 0x0d, 0x0d, 0x0d, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x29, 0x0c, 0x00, 0x00, 0x01, 0x1c, 0x30,
+    0x39, 0x36, 0x27, 0x0f, 0x00, 0x00, 0x00, 0x25, 0x4b, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+    0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x47, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x29, 0x3e, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x3c, 0x24, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x16, 0x16, 0x13, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x16,
+    0x16, 0x16, 0x13, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x15, 0x16, 0x16, 0x16, 0x0b, 0x00,
+    0x00, 0x00, 0x03, 0x13, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+    0x16, 0x16, 0x14, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x13, 0x16, 0x16, 0x16,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x15, 0x16, 0x16, 0x15, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x0d, 0x0d, 0x0d, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0f, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x38, 0x38, 0x38, 0x33, 0x1d,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x21,
+    0x2b, 0x2b, 0x2b, 0x26, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x32, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x37, 0x29, 0x0c, 0x00, 0x00, 0x00, 0x25, 0x4b, 0x62, 0x62, 0x62, 0x62,
+    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x47, 0x21, 0x00, 0x00, 0x1d, 0x3d, 0x56,
+    0x63, 0x5f, 0x4a, 0x2c, 0x09, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
+    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x7a, 0x50, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x14, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+    0x13, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0c, 0x0f, 0x0d, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0d,
+    0x0f, 0x0c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0a, 0x0a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x0c, 0x0f, 0x0e, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x0f, 0x0e, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x2c, 0x38, 0x38, 0x38, 0x33, 0x1d, 0x00, 0x00, 0x01, 0x1c, 0x30, 0x39, 0x36, 0x27, 0x0f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4b, 0x62, 0x62, 0x62, 0x59, 0x36,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x43,
+    0x55, 0x55, 0x55, 0x4d, 0x2d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x32, 0x56, 0x62, 0x62,
+    0x62, 0x62, 0x62, 0x62, 0x61, 0x47, 0x20, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x8c, 0x8c, 0x8c,
+    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x7a, 0x50, 0x26, 0x00, 0x09, 0x31, 0x58, 0x79,
+    0x8d, 0x85, 0x68, 0x43, 0x1b, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0xa5, 0xa1, 0xa1, 0xa1, 0xa1,
+    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x7a, 0x50, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x0e, 0x0f, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x23, 0x2f, 0x36, 0x39, 0x38, 0x32, 0x27,
+    0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x16, 0x26, 0x31, 0x37,
+    0x39, 0x36, 0x2f, 0x22, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x30, 0x34, 0x34, 0x34,
+    0x26, 0x0a, 0x00, 0x00, 0x07, 0x24, 0x33, 0x34, 0x34, 0x32, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x18, 0x26, 0x30, 0x36, 0x39, 0x38, 0x34, 0x2b, 0x1d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x23, 0x2f, 0x36, 0x39, 0x38, 0x32, 0x28, 0x19, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
+    0x4b, 0x62, 0x62, 0x62, 0x59, 0x36, 0x0e, 0x00, 0x1d, 0x3d, 0x56, 0x63, 0x5f, 0x4a, 0x2c, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x8c, 0x8c, 0x67, 0x3d,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2a, 0x54,
+    0x7f, 0x80, 0x80, 0x63, 0x39, 0x0e, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x62, 0x8c, 0x8c,
+    0x8c, 0x8c, 0x8c, 0x8c, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0xa5, 0xa1,
+    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x7a, 0x50, 0x26, 0x00, 0x11, 0x3b, 0x65, 0x8f,
+    0xb5, 0xa1, 0x77, 0x4d, 0x23, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x1c, 0x2a, 0x33, 0x38, 0x39, 0x37, 0x31, 0x28, 0x1b, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x23, 0x39, 0x4b, 0x58, 0x60, 0x64, 0x62, 0x5b, 0x4f,
+    0x3e, 0x29, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x26, 0x3c, 0x4d, 0x5a, 0x62,
+    0x64, 0x60, 0x58, 0x49, 0x36, 0x1f, 0x05, 0x00, 0x00, 0x00, 0x0e, 0x36, 0x57, 0x5e, 0x5e, 0x5e,
+    0x45, 0x1f, 0x00, 0x00, 0x1b, 0x42, 0x5d, 0x5e, 0x5e, 0x59, 0x39, 0x12, 0x00, 0x00, 0x00, 0x17,
+    0x2d, 0x40, 0x4e, 0x59, 0x60, 0x63, 0x63, 0x5e, 0x53, 0x43, 0x2d, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x23, 0x39, 0x4a, 0x58, 0x60, 0x63, 0x62, 0x5c, 0x50, 0x3f, 0x29, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x54, 0x7f, 0x8c, 0x8c, 0x67, 0x3d, 0x12, 0x09, 0x31, 0x58, 0x79, 0x8d, 0x85, 0x68, 0x43, 0x1b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2c, 0x34, 0x54,
+    0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x34, 0x34, 0x28, 0x0d, 0x00, 0x00, 0x0e, 0x38, 0x62, 0x8d, 0xa1,
+    0xa1, 0xa1, 0xa7, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x4f, 0x25, 0x00, 0x0f, 0x39, 0x62, 0x89,
+    0xa6, 0x98, 0x73, 0x4a, 0x21, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x4c, 0x4c, 0x4c,
+    0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x3a, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0x2e, 0x43, 0x53, 0x5d, 0x62, 0x63, 0x61, 0x5a, 0x50, 0x43, 0x31, 0x1a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2a, 0x46, 0x5e, 0x72, 0x81, 0x8a, 0x8e, 0x8c, 0x84, 0x76,
+    0x63, 0x4c, 0x31, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2c, 0x48, 0x60, 0x74, 0x83, 0x8c,
+    0x8e, 0x8a, 0x80, 0x70, 0x5a, 0x41, 0x23, 0x04, 0x00, 0x00, 0x13, 0x3d, 0x68, 0x89, 0x89, 0x7a,
+    0x50, 0x25, 0x00, 0x00, 0x21, 0x4b, 0x76, 0x89, 0x89, 0x6c, 0x42, 0x17, 0x00, 0x00, 0x19, 0x39,
+    0x52, 0x66, 0x76, 0x82, 0x8a, 0x8e, 0x8d, 0x87, 0x7b, 0x68, 0x4f, 0x31, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x29, 0x45, 0x5d, 0x71, 0x81, 0x8a, 0x8e, 0x8c, 0x85, 0x77, 0x64, 0x4b, 0x2f, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x11, 0x3b, 0x65, 0x8f, 0xb5, 0xa1, 0x77, 0x4d, 0x23,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2a, 0x4e, 0x5e, 0x5e,
+    0x7f, 0xa9, 0x8d, 0x63, 0x5e, 0x5e, 0x5e, 0x49, 0x24, 0x00, 0x00, 0x0d, 0x37, 0x61, 0x77, 0x77,
+    0x77, 0x77, 0x95, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67,
+    0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x3a, 0x18, 0x00, 0x04, 0x2b, 0x4f, 0x6d,
+    0x7d, 0x76, 0x5c, 0x3a, 0x15, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x12, 0x33, 0x50, 0x68, 0x7b, 0x87, 0x8d, 0x8e, 0x8b, 0x84, 0x79, 0x6a, 0x55, 0x34,
+    0x0d, 0x00, 0x00, 0x00, 0x03, 0x26, 0x47, 0x66, 0x81, 0x98, 0xa9, 0xa1, 0x9c, 0x9f, 0xa9, 0x9d,
+    0x87, 0x6d, 0x4e, 0x2e, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x27, 0x49, 0x68, 0x83, 0x9a, 0xa7, 0x9c,
+    0x99, 0x9e, 0xa8, 0x95, 0x7c, 0x5f, 0x3f, 0x1d, 0x00, 0x00, 0x13, 0x3d, 0x68, 0x92, 0xa4, 0x7a,
+    0x50, 0x25, 0x00, 0x00, 0x21, 0x4b, 0x76, 0xa0, 0x96, 0x6c, 0x42, 0x17, 0x00, 0x00, 0x27, 0x51,
+    0x74, 0x8c, 0x9e, 0xa7, 0x9e, 0x9b, 0x9e, 0xa8, 0xa2, 0x8b, 0x6d, 0x4b, 0x27, 0x01, 0x00, 0x00,
+    0x02, 0x25, 0x46, 0x65, 0x80, 0x97, 0xa9, 0xa1, 0x9c, 0x9f, 0xa9, 0x9e, 0x87, 0x6b, 0x4b, 0x28,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x0f, 0x39, 0x62, 0x89, 0xa6, 0x98, 0x73, 0x4a, 0x21,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x31, 0x5b, 0x85, 0x89,
+    0x89, 0xaa, 0x90, 0x89, 0x89, 0x89, 0x7e, 0x54, 0x2a, 0x00, 0x00, 0x03, 0x27, 0x44, 0x4c, 0x4c,
+    0x4c, 0x6b, 0x95, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67,
+    0x3d, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x16, 0x00, 0x00, 0x00, 0x13, 0x31, 0x48,
+    0x53, 0x4f, 0x3c, 0x21, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x28, 0x4d, 0x6e, 0x8b, 0xa1, 0xa3, 0x9c, 0x9a, 0x9e, 0xa6, 0xa1, 0x8b, 0x66, 0x3c,
+    0x12, 0x00, 0x00, 0x00, 0x18, 0x3d, 0x61, 0x83, 0xa2, 0x9e, 0x86, 0x78, 0x72, 0x75, 0x82, 0x97,
+    0xa8, 0x8a, 0x69, 0x45, 0x20, 0x00, 0x00, 0x00, 0x18, 0x3e, 0x62, 0x84, 0xa3, 0x96, 0x80, 0x72,
+    0x6f, 0x75, 0x85, 0x9d, 0x9b, 0x7a, 0x57, 0x32, 0x0d, 0x00, 0x13, 0x3d, 0x68, 0x92, 0xa4, 0x7a,
+    0x50, 0x25, 0x00, 0x00, 0x21, 0x4b, 0x76, 0xa0, 0x96, 0x6c, 0x42, 0x17, 0x00, 0x00, 0x23, 0x4a,
+    0x6f, 0x94, 0x8e, 0x7f, 0x75, 0x71, 0x74, 0x81, 0x99, 0xa9, 0x85, 0x5f, 0x38, 0x10, 0x00, 0x00,
+    0x17, 0x3c, 0x60, 0x82, 0xa1, 0x9e, 0x87, 0x78, 0x72, 0x75, 0x81, 0x97, 0xa7, 0x86, 0x62, 0x3a,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x04, 0x2b, 0x4f, 0x6d, 0x7d, 0x76, 0x5c, 0x3a, 0x15,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x31, 0x5b, 0x85, 0x9c,
+    0x9c, 0xb2, 0x9f, 0x9c, 0x9c, 0x9c, 0x7e, 0x54, 0x2a, 0x00, 0x00, 0x00, 0x0a, 0x1d, 0x22, 0x22,
+    0x41, 0x6b, 0x95, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67,
+    0x3d, 0x12, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x20,
+    0x28, 0x25, 0x18, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x57, 0x57, 0x57,
+    0x57, 0x57, 0x57, 0x57, 0x57, 0x40, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x38, 0x60, 0x87, 0xaa, 0x91, 0x7b, 0x71, 0x70, 0x74, 0x7e, 0x8e, 0x77, 0x52, 0x2d,
+    0x07, 0x00, 0x00, 0x01, 0x29, 0x50, 0x76, 0x9b, 0xa0, 0x7e, 0x62, 0x4f, 0x48, 0x4c, 0x5d, 0x77,
+    0x97, 0xa3, 0x7f, 0x59, 0x32, 0x0a, 0x00, 0x01, 0x29, 0x51, 0x77, 0x9c, 0x98, 0x77, 0x5b, 0x49,
+    0x44, 0x4c, 0x62, 0x7f, 0xa1, 0x91, 0x6b, 0x44, 0x1d, 0x00, 0x13, 0x3d, 0x68, 0x92, 0xa4, 0x7a,
+    0x50, 0x25, 0x00, 0x00, 0x21, 0x4b, 0x76, 0xa0, 0x96, 0x6c, 0x42, 0x17, 0x00, 0x00, 0x10, 0x35,
+    0x5a, 0x7f, 0x68, 0x57, 0x4b, 0x46, 0x4b, 0x5d, 0x7e, 0xa4, 0x96, 0x6d, 0x44, 0x1a, 0x00, 0x00,
+    0x28, 0x4f, 0x76, 0x9b, 0xa0, 0x7f, 0x63, 0x4f, 0x48, 0x4b, 0x5c, 0x77, 0x8a, 0x73, 0x5b, 0x37,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x13, 0x31, 0x48, 0x53, 0x4f, 0x3c, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x30, 0x59, 0x72, 0x72,
+    0x7f, 0xa9, 0x8d, 0x72, 0x72, 0x72, 0x72, 0x52, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+    0x41, 0x6b, 0x95, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67,
+    0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x2a, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x82, 0x82, 0x82, 0x79, 0x4f, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0x40, 0x6a, 0x94, 0xa1, 0x78, 0x55, 0x47, 0x46, 0x4a, 0x56, 0x69, 0x63, 0x3e, 0x19,
+    0x00, 0x00, 0x00, 0x0c, 0x35, 0x5e, 0x87, 0xae, 0x8b, 0x65, 0x43, 0x28, 0x1d, 0x23, 0x3b, 0x5c,
+    0x81, 0xa8, 0x90, 0x68, 0x3f, 0x16, 0x00, 0x0c, 0x35, 0x5e, 0x87, 0xac, 0x85, 0x5e, 0x4a, 0x4a,
+    0x4a, 0x4a, 0x4a, 0x67, 0x8d, 0xa2, 0x7a, 0x51, 0x28, 0x00, 0x13, 0x3d, 0x68, 0x92, 0xa4, 0x7a,
+    0x50, 0x25, 0x00, 0x00, 0x21, 0x4b, 0x76, 0xa0, 0x96, 0x6c, 0x42, 0x17, 0x00, 0x00, 0x00, 0x21,
+    0x44, 0x56, 0x45, 0x48, 0x4d, 0x4e, 0x4e, 0x4e, 0x6f, 0x99, 0x9e, 0x74, 0x4a, 0x20, 0x00, 0x0c,
+    0x35, 0x5e, 0x86, 0xae, 0x8b, 0x65, 0x43, 0x28, 0x1d, 0x23, 0x3b, 0x5c, 0x66, 0x4f, 0x38, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x0f, 0x20, 0x28, 0x25, 0x18, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x3d, 0x47, 0x54,
+    0x7f, 0xa9, 0x8d, 0x63, 0x47, 0x47, 0x47, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+    0x41, 0x6b, 0x95, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x47, 0x20, 0x00, 0x00, 0x00, 0x00, 0x03, 0x14,
+    0x1b, 0x19, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0xad, 0xa9, 0xa9, 0xa9, 0xa9,
+    0xa9, 0xa9, 0xa9, 0xa3, 0x79, 0x4f, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0x40, 0x6a, 0x94, 0xa3, 0x7c, 0x60, 0x53, 0x4b, 0x43, 0x3a, 0x43, 0x41, 0x28, 0x05,
+    0x00, 0x00, 0x00, 0x13, 0x3d, 0x67, 0x91, 0xa7, 0x7d, 0x54, 0x2c, 0x07, 0x00, 0x00, 0x23, 0x4b,
+    0x74, 0x9d, 0x9a, 0x71, 0x47, 0x1d, 0x00, 0x13, 0x3d, 0x67, 0x91, 0xa3, 0x79, 0x75, 0x75, 0x75,
+    0x75, 0x75, 0x75, 0x75, 0x82, 0xac, 0x83, 0x59, 0x2f, 0x05, 0x13, 0x3d, 0x68, 0x92, 0xa4, 0x7a,
+    0x50, 0x25, 0x00, 0x00, 0x21, 0x4b, 0x76, 0xa0, 0x96, 0x6c, 0x42, 0x17, 0x00, 0x00, 0x02, 0x22,
+    0x3f, 0x57, 0x68, 0x72, 0x77, 0x78, 0x78, 0x78, 0x78, 0x96, 0xa0, 0x76, 0x4b, 0x21, 0x00, 0x13,
+    0x3d, 0x67, 0x90, 0xa7, 0x7d, 0x54, 0x2c, 0x07, 0x00, 0x00, 0x21, 0x3a, 0x3e, 0x2b, 0x14, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x17, 0x2a, 0x54,
+    0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x1d, 0x1d, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+    0x41, 0x6b, 0x95, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x97, 0x8f,
+    0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x79, 0x4f, 0x24, 0x00, 0x00, 0x00, 0x0a, 0x27, 0x3c,
+    0x46, 0x42, 0x32, 0x18, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x7f, 0x7f, 0x7f, 0x7f,
+    0x7f, 0x7f, 0x7f, 0x7f, 0x79, 0x4f, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x38, 0x61, 0x87, 0xa9, 0x9a, 0x87, 0x7d, 0x74, 0x6d, 0x63, 0x57, 0x45, 0x2d, 0x11,
+    0x00, 0x00, 0x00, 0x15, 0x40, 0x6a, 0x94, 0xa3, 0x79, 0x4e, 0x24, 0x00, 0x00, 0x00, 0x1a, 0x44,
+    0x6e, 0x99, 0x9e, 0x74, 0x4a, 0x1f, 0x00, 0x15, 0x40, 0x6a, 0x94, 0xae, 0x9f, 0x9f, 0x9f, 0x9f,
+    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa6, 0x87, 0x5d, 0x32, 0x08, 0x13, 0x3d, 0x68, 0x92, 0xa4, 0x7a,
+    0x50, 0x25, 0x00, 0x00, 0x21, 0x4b, 0x76, 0xa0, 0x96, 0x6c, 0x42, 0x17, 0x00, 0x00, 0x19, 0x3d,
+    0x5e, 0x7a, 0x8f, 0x9b, 0xa1, 0xa2, 0xa2, 0xa2, 0xa2, 0xa9, 0xa0, 0x76, 0x4b, 0x21, 0x00, 0x15,
+    0x40, 0x6a, 0x94, 0xa3, 0x79, 0x4e, 0x24, 0x00, 0x00, 0x00, 0x00, 0x12, 0x15, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x03, 0x14, 0x1b, 0x19, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54,
+    0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+    0x41, 0x6b, 0x95, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0xa2, 0x9d,
+    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x79, 0x4f, 0x24, 0x00, 0x00, 0x00, 0x23, 0x46, 0x62,
+    0x70, 0x6b, 0x54, 0x34, 0x0f, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x54, 0x3e, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x29, 0x4d, 0x6d, 0x88, 0x9b, 0xa6, 0xa6, 0x9e, 0x96, 0x8c, 0x7e, 0x69, 0x4d, 0x2c,
+    0x07, 0x00, 0x00, 0x14, 0x3e, 0x68, 0x92, 0xa5, 0x7b, 0x52, 0x28, 0x00, 0x00, 0x00, 0x1f, 0x48,
+    0x71, 0x9b, 0x9c, 0x72, 0x48, 0x1e, 0x00, 0x14, 0x3e, 0x68, 0x92, 0xa2, 0x7c, 0x7c, 0x7c, 0x7c,
+    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x5b, 0x30, 0x06, 0x13, 0x3d, 0x68, 0x92, 0xa4, 0x7a,
+    0x50, 0x25, 0x00, 0x00, 0x23, 0x4d, 0x77, 0xa1, 0x96, 0x6c, 0x42, 0x17, 0x00, 0x02, 0x2a, 0x52,
+    0x78, 0x9a, 0x9d, 0x86, 0x7b, 0x79, 0x79, 0x79, 0x79, 0x96, 0xa0, 0x76, 0x4b, 0x21, 0x00, 0x14,
+    0x3e, 0x68, 0x92, 0xa5, 0x7b, 0x51, 0x28, 0x00, 0x00, 0x00, 0x18, 0x2e, 0x32, 0x21, 0x0a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x0a, 0x27, 0x3c, 0x46, 0x42, 0x32, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54,
+    0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+    0x41, 0x6b, 0x95, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x73,
+    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x71, 0x4d, 0x23, 0x00, 0x00, 0x0b, 0x34, 0x5c, 0x81,
+    0x9a, 0x8f, 0x6e, 0x47, 0x1e, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x1d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x12, 0x31, 0x4d, 0x63, 0x72, 0x7c, 0x84, 0x8b, 0x94, 0xa1, 0xa4, 0x88, 0x66, 0x40,
+    0x18, 0x00, 0x00, 0x0e, 0x38, 0x61, 0x8a, 0xae, 0x86, 0x5f, 0x3b, 0x1d, 0x10, 0x18, 0x33, 0x56,
+    0x7c, 0xa4, 0x94, 0x6b, 0x42, 0x18, 0x00, 0x0e, 0x38, 0x61, 0x8a, 0xab, 0x83, 0x5c, 0x51, 0x51,
+    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x44, 0x24, 0x00, 0x12, 0x3c, 0x66, 0x90, 0xa8, 0x7e,
+    0x55, 0x2d, 0x13, 0x16, 0x31, 0x57, 0x7f, 0xa8, 0x96, 0x6c, 0x42, 0x17, 0x00, 0x0b, 0x35, 0x5e,
+    0x88, 0xad, 0x85, 0x61, 0x51, 0x4e, 0x4e, 0x4e, 0x6c, 0x96, 0xa0, 0x76, 0x4b, 0x21, 0x00, 0x0e,
+    0x38, 0x61, 0x8a, 0xae, 0x86, 0x5f, 0x3a, 0x1d, 0x11, 0x17, 0x33, 0x53, 0x5b, 0x44, 0x2e, 0x16,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x24, 0x46, 0x62, 0x70, 0x6b, 0x54, 0x34, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54,
+    0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+    0x41, 0x6b, 0x95, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x36, 0x15, 0x00, 0x00, 0x0f, 0x3a, 0x64, 0x8e,
+    0xb9, 0xa2, 0x78, 0x4e, 0x23, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x38, 0x47, 0x3c, 0x49, 0x53, 0x5b, 0x62, 0x6b, 0x7d, 0x9d, 0x9e, 0x75, 0x4b,
+    0x21, 0x00, 0x00, 0x04, 0x2d, 0x55, 0x7c, 0xa2, 0x99, 0x76, 0x58, 0x43, 0x3b, 0x3f, 0x52, 0x6e,
+    0x90, 0xaa, 0x84, 0x5e, 0x36, 0x0e, 0x00, 0x04, 0x2d, 0x55, 0x7c, 0xa2, 0x96, 0x75, 0x58, 0x44,
+    0x3b, 0x3c, 0x47, 0x5d, 0x7a, 0x60, 0x40, 0x20, 0x09, 0x00, 0x0c, 0x36, 0x5f, 0x89, 0xb1, 0x8b,
+    0x66, 0x49, 0x3d, 0x3f, 0x50, 0x6c, 0x8f, 0xb5, 0x96, 0x6c, 0x42, 0x17, 0x00, 0x0d, 0x37, 0x62,
+    0x8c, 0xa9, 0x7f, 0x55, 0x35, 0x31, 0x3a, 0x53, 0x75, 0x9b, 0xa0, 0x76, 0x4b, 0x21, 0x00, 0x04,
+    0x2c, 0x54, 0x7b, 0xa1, 0x98, 0x76, 0x58, 0x43, 0x3b, 0x3f, 0x51, 0x6e, 0x7f, 0x68, 0x52, 0x32,
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x0d, 0x36, 0x5d, 0x82, 0x9a, 0x90, 0x6e, 0x47, 0x1e,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54,
+    0x7f, 0xa9, 0x8d, 0x63, 0x39, 0x1b, 0x26, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+    0x41, 0x6b, 0x95, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67,
+    0x3d, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x13, 0x00, 0x00, 0x00, 0x0b, 0x34, 0x5c, 0x80,
+    0x98, 0x9a, 0x71, 0x48, 0x1f, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3b, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x2d, 0x52, 0x71, 0x5e, 0x4d, 0x41, 0x3a, 0x3a, 0x43, 0x69, 0x94, 0xa2, 0x78, 0x4e,
+    0x23, 0x00, 0x00, 0x00, 0x1d, 0x43, 0x68, 0x8b, 0xaa, 0x94, 0x7b, 0x6b, 0x65, 0x69, 0x76, 0x8d,
+    0xaa, 0x92, 0x70, 0x4b, 0x26, 0x00, 0x00, 0x00, 0x1d, 0x43, 0x68, 0x8b, 0xab, 0x93, 0x7c, 0x6d,
+    0x66, 0x66, 0x6f, 0x80, 0x99, 0x7b, 0x5b, 0x36, 0x0d, 0x00, 0x03, 0x2b, 0x53, 0x7a, 0xa0, 0xa2,
+    0x84, 0x6f, 0x67, 0x69, 0x75, 0x8b, 0x9c, 0xa4, 0x96, 0x6c, 0x42, 0x17, 0x00, 0x09, 0x33, 0x5d,
+    0x85, 0xad, 0x8d, 0x6e, 0x5e, 0x5b, 0x62, 0x74, 0x8f, 0xa7, 0xa0, 0x76, 0x4b, 0x21, 0x00, 0x00,
+    0x1d, 0x42, 0x67, 0x8a, 0xaa, 0x94, 0x7c, 0x6c, 0x65, 0x68, 0x76, 0x8d, 0xa3, 0x8c, 0x66, 0x3c,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x11, 0x3c, 0x66, 0x90, 0xbb, 0xa2, 0x78, 0x4e, 0x23,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54,
+    0x7e, 0xa9, 0x8e, 0x64, 0x3b, 0x3e, 0x51, 0x44, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+    0x41, 0x6b, 0x95, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67,
+    0x3d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x44, 0x6a,
+    0x93, 0x8c, 0x64, 0x3c, 0x14, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x6e, 0x6e, 0x6e, 0x6e,
+    0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x5a, 0x32, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1b, 0x40, 0x66, 0x8b, 0x84, 0x75, 0x6a, 0x65, 0x64, 0x6b, 0x7d, 0x9f, 0x99, 0x71, 0x48,
+    0x1f, 0x00, 0x00, 0x00, 0x0a, 0x2d, 0x4f, 0x6f, 0x8b, 0xa3, 0xa1, 0x94, 0x8f, 0x92, 0x9d, 0xa8,
+    0x91, 0x76, 0x56, 0x35, 0x11, 0x00, 0x00, 0x00, 0x0a, 0x2d, 0x4f, 0x6f, 0x8b, 0xa3, 0xa3, 0x96,
+    0x90, 0x90, 0x97, 0xa6, 0x99, 0x7e, 0x5f, 0x38, 0x0f, 0x00, 0x00, 0x1c, 0x41, 0x65, 0x86, 0xa2,
+    0xa7, 0x98, 0x92, 0x93, 0x9c, 0x9d, 0x80, 0x9b, 0x96, 0x6c, 0x42, 0x17, 0x00, 0x00, 0x27, 0x4e,
+    0x73, 0x94, 0xa9, 0x93, 0x87, 0x85, 0x8b, 0x99, 0x8e, 0x91, 0xa0, 0x76, 0x4b, 0x21, 0x00, 0x00,
+    0x09, 0x2c, 0x4e, 0x6e, 0x8a, 0xa2, 0xa2, 0x95, 0x8f, 0x92, 0x9d, 0xa9, 0x90, 0x73, 0x52, 0x2e,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x0d, 0x36, 0x5d, 0x82, 0x9a, 0x8f, 0x6e, 0x47, 0x1e,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x29, 0x07, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4f,
+    0x78, 0xa1, 0x99, 0x76, 0x63, 0x66, 0x79, 0x5b, 0x35, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+    0x41, 0x6b, 0x95, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67,
+    0x3d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x4b, 0x74,
+    0x9d, 0x7f, 0x57, 0x2e, 0x06, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x9e, 0x98, 0x98, 0x98, 0x98,
+    0x98, 0x98, 0x98, 0x98, 0x98, 0x88, 0x5e, 0x34, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x27, 0x51, 0x7a, 0x9b, 0xab, 0x9d, 0x94, 0x8f, 0x8f, 0x94, 0xa1, 0x9e, 0x81, 0x5f, 0x3a,
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x13, 0x33, 0x4f, 0x69, 0x7e, 0x8d, 0x97, 0x9b, 0x99, 0x90, 0x82,
+    0x6e, 0x56, 0x3a, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x33, 0x4f, 0x69, 0x7d, 0x8d, 0x96,
+    0x9a, 0x9a, 0x94, 0x87, 0x75, 0x5e, 0x43, 0x24, 0x01, 0x00, 0x00, 0x07, 0x2a, 0x4a, 0x67, 0x7e,
+    0x8f, 0x98, 0x9b, 0x97, 0x8c, 0x7a, 0x70, 0x95, 0x95, 0x6c, 0x42, 0x17, 0x00, 0x00, 0x14, 0x38,
+    0x58, 0x73, 0x88, 0x95, 0x9a, 0x9a, 0x93, 0x85, 0x6f, 0x91, 0x95, 0x76, 0x4b, 0x21, 0x00, 0x00,
+    0x00, 0x13, 0x32, 0x4f, 0x68, 0x7d, 0x8d, 0x97, 0x9b, 0x99, 0x91, 0x83, 0x6f, 0x55, 0x37, 0x16,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x24, 0x46, 0x62, 0x70, 0x6a, 0x53, 0x33, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x6e, 0x6e,
+    0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x3e, 0x15, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x43,
+    0x6a, 0x8e, 0xad, 0x98, 0x8d, 0x8f, 0x93, 0x6c, 0x46, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+    0x41, 0x6b, 0x95, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x91, 0x67,
+    0x3d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2c, 0x55, 0x7e,
+    0x99, 0x71, 0x49, 0x21, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+    0x95, 0x95, 0x95, 0x95, 0x95, 0x88, 0x5e, 0x34, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x21, 0x46, 0x61, 0x75, 0x85, 0x90, 0x97, 0x9b, 0x9a, 0x95, 0x8b, 0x7a, 0x62, 0x46, 0x25,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2e, 0x44, 0x57, 0x65, 0x6d, 0x70, 0x6f, 0x67, 0x5b,
+    0x49, 0x33, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2e, 0x44, 0x56, 0x64, 0x6c,
+    0x70, 0x6f, 0x6a, 0x5f, 0x50, 0x3b, 0x23, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2b, 0x44, 0x58,
+    0x66, 0x6e, 0x70, 0x6e, 0x64, 0x55, 0x66, 0x6a, 0x6a, 0x63, 0x3e, 0x15, 0x00, 0x00, 0x00, 0x1c,
+    0x38, 0x4f, 0x60, 0x6b, 0x70, 0x70, 0x6a, 0x5e, 0x5f, 0x6a, 0x6a, 0x68, 0x47, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x2d, 0x44, 0x56, 0x64, 0x6d, 0x70, 0x6f, 0x68, 0x5c, 0x4a, 0x34, 0x19, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x0b, 0x27, 0x3c, 0x46, 0x42, 0x31, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0xa9, 0x9e, 0x98, 0x98,
+    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x95, 0x6b, 0x41, 0x16, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x30,
+    0x53, 0x71, 0x89, 0x97, 0x9b, 0x97, 0x8a, 0x73, 0x4d, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+    0x41, 0x6b, 0x95, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x95, 0x91, 0x67,
+    0x3d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x34, 0x5f, 0x82,
+    0x82, 0x63, 0x3b, 0x13, 0x00, 0x00, 0x00, 0x27, 0x4f, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a,
+    0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x58, 0x31, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x26, 0x3c, 0x4e, 0x5c, 0x67, 0x6d, 0x70, 0x70, 0x6b, 0x62, 0x54, 0x40, 0x27, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x30, 0x3c, 0x43, 0x46, 0x44, 0x3e, 0x33,
+    0x23, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x2f, 0x3b, 0x43,
+    0x46, 0x45, 0x40, 0x37, 0x29, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1f, 0x31,
+    0x3d, 0x44, 0x46, 0x44, 0x3c, 0x2e, 0x3e, 0x40, 0x40, 0x3d, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x29, 0x38, 0x42, 0x46, 0x45, 0x40, 0x36, 0x3b, 0x40, 0x40, 0x3f, 0x2d, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x1e, 0x2f, 0x3b, 0x43, 0x46, 0x45, 0x3f, 0x34, 0x24, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x54, 0x7f, 0xa9, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x04, 0x14, 0x1b, 0x19, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x95, 0x95, 0x95, 0x95,
+    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x6b, 0x41, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+    0x35, 0x4f, 0x62, 0x6d, 0x70, 0x6d, 0x63, 0x51, 0x37, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+    0x41, 0x6b, 0x95, 0x95, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x27, 0x4f, 0x6a, 0x6a, 0x6a, 0x5f,
+    0x39, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2a, 0x4c, 0x57,
+    0x57, 0x4d, 0x2d, 0x06, 0x00, 0x00, 0x00, 0x15, 0x33, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x38, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x16, 0x27, 0x34, 0x3d, 0x43, 0x46, 0x45, 0x41, 0x39, 0x2d, 0x1b, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x12, 0x19, 0x1c, 0x1a, 0x15, 0x0b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x12, 0x18,
+    0x1c, 0x1b, 0x17, 0x0e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x13, 0x1a, 0x1c, 0x1a, 0x12, 0x07, 0x15, 0x16, 0x16, 0x14, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x0f, 0x18, 0x1b, 0x1b, 0x17, 0x0e, 0x13, 0x16, 0x16, 0x15, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x12, 0x19, 0x1c, 0x1b, 0x15, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x54, 0x7f, 0x95, 0x91, 0x67, 0x3d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x4f, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a,
+    0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x62, 0x3d, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x2a, 0x3a, 0x43, 0x46, 0x43, 0x3b, 0x2b, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+    0x3d, 0x62, 0x6a, 0x6a, 0x6a, 0x4b, 0x22, 0x00, 0x00, 0x00, 0x15, 0x33, 0x40, 0x40, 0x40, 0x3b,
+    0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x27, 0x2d,
+    0x2d, 0x28, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x13, 0x19, 0x1c, 0x1b, 0x17, 0x10, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27,
+    0x4f, 0x6a, 0x6a, 0x6a, 0x5f, 0x39, 0x10, 0x00, 0x00, 0x06, 0x0a, 0x0a, 0x0a, 0x01, 0x03, 0x0b,
+    0x0e, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x33, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x26, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x11, 0x19, 0x1c, 0x19, 0x12, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x26, 0x3d, 0x40, 0x40, 0x40, 0x30, 0x11, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x16, 0x16, 0x13,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x0a, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x0a, 0x0a, 0x01, 0x04, 0x0b, 0x0f, 0x0e, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x0a, 0x0e, 0x0f, 0x0b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0a, 0x0a, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x0a, 0x0a,
+    0x01, 0x03, 0x0b, 0x0e, 0x0e, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x0a, 0x0a, 0x0a, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0a, 0x0a, 0x0a, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0x33, 0x40, 0x40, 0x40, 0x3b, 0x23, 0x01, 0x00, 0x18, 0x2f, 0x34, 0x34, 0x34, 0x27, 0x2c, 0x35,
+    0x39, 0x36, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x16, 0x16, 0x16, 0x16,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x14, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x14, 0x16, 0x16, 0x16, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x32, 0x34, 0x34, 0x34, 0x26, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x2f, 0x34, 0x34, 0x34, 0x28, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x07, 0x07, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x2f, 0x34, 0x34, 0x34, 0x27, 0x2d, 0x35, 0x39, 0x38, 0x32, 0x26, 0x16,
+    0x08, 0x1b, 0x2a, 0x33, 0x38, 0x39, 0x35, 0x2b, 0x1d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+    0x2f, 0x34, 0x34, 0x34, 0x25, 0x09, 0x00, 0x00, 0x02, 0x21, 0x33, 0x34, 0x34, 0x2f, 0x18, 0x00,
+    0x00, 0x00, 0x12, 0x2c, 0x34, 0x34, 0x34, 0x28, 0x0c, 0x00, 0x00, 0x18, 0x2f, 0x34, 0x34, 0x34,
+    0x27, 0x2b, 0x34, 0x39, 0x39, 0x34, 0x2a, 0x1b, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x27,
+    0x34, 0x34, 0x34, 0x33, 0x21, 0x02, 0x00, 0x00, 0x19, 0x30, 0x34, 0x34, 0x34, 0x2c, 0x13, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0d, 0x16, 0x16, 0x16, 0x13, 0x02, 0x00, 0x09, 0x31, 0x54, 0x5e, 0x5e, 0x5e, 0x46, 0x54, 0x5e,
+    0x63, 0x5d, 0x3b, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0d, 0x0d, 0x0d, 0x06,
+    0x0c, 0x0d, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x30, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x27, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x14, 0x1b, 0x19,
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x3a, 0x59, 0x5e, 0x5e, 0x5e, 0x45, 0x1f, 0x00,
+    0x00, 0x00, 0x0a, 0x31, 0x54, 0x5e, 0x5e, 0x5e, 0x48, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x2f, 0x31, 0x31, 0x2f, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x31, 0x54, 0x5e, 0x5e, 0x5e, 0x46, 0x55, 0x5f, 0x63, 0x62, 0x5b, 0x4e, 0x3b,
+    0x2d, 0x42, 0x52, 0x5d, 0x63, 0x63, 0x5e, 0x54, 0x43, 0x2c, 0x12, 0x00, 0x00, 0x00, 0x0b, 0x32,
+    0x55, 0x5e, 0x5e, 0x5e, 0x44, 0x1e, 0x00, 0x00, 0x16, 0x3d, 0x5b, 0x5e, 0x5e, 0x53, 0x31, 0x09,
+    0x00, 0x02, 0x2a, 0x4e, 0x5e, 0x5e, 0x5e, 0x48, 0x22, 0x00, 0x09, 0x31, 0x54, 0x5e, 0x5e, 0x5e,
+    0x46, 0x54, 0x5e, 0x63, 0x63, 0x5d, 0x52, 0x41, 0x2a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x22, 0x47,
+    0x5e, 0x5e, 0x5e, 0x5b, 0x3e, 0x1c, 0x00, 0x13, 0x35, 0x55, 0x5e, 0x5e, 0x5e, 0x4f, 0x2a, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x89, 0x89, 0x7b, 0x69, 0x7c, 0x88,
+    0x8d, 0x6b, 0x41, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0x1b, 0x2a, 0x32, 0x25, 0x09, 0x00, 0x00, 0x0a, 0x25, 0x32, 0x2a, 0x1a, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x38, 0x38, 0x38, 0x2d,
+    0x36, 0x38, 0x38, 0x33, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x34, 0x56, 0x5e, 0x5e, 0x5e, 0x5e,
+    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x47, 0x22, 0x00, 0x00, 0x0a, 0x27, 0x3c, 0x46, 0x42,
+    0x32, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x41, 0x6a, 0x89, 0x89, 0x7d, 0x56, 0x30, 0x09,
+    0x00, 0x00, 0x1b, 0x42, 0x69, 0x89, 0x89, 0x79, 0x52, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x38, 0x56, 0x5c, 0x5c, 0x56, 0x36, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x89, 0x89, 0x7b, 0x6b, 0x7d, 0x89, 0x8e, 0x8c, 0x84, 0x74, 0x5e,
+    0x4f, 0x67, 0x7a, 0x86, 0x8d, 0x8d, 0x88, 0x7b, 0x67, 0x4d, 0x2f, 0x0e, 0x00, 0x00, 0x0f, 0x39,
+    0x63, 0x89, 0x89, 0x7c, 0x54, 0x2c, 0x05, 0x00, 0x25, 0x4d, 0x74, 0x89, 0x89, 0x67, 0x40, 0x18,
+    0x00, 0x11, 0x39, 0x60, 0x88, 0x89, 0x7a, 0x51, 0x27, 0x00, 0x0e, 0x38, 0x63, 0x89, 0x89, 0x7b,
+    0x6a, 0x7c, 0x88, 0x8d, 0x8d, 0x87, 0x79, 0x65, 0x4b, 0x2c, 0x0b, 0x00, 0x00, 0x00, 0x27, 0x51,
+    0x77, 0x89, 0x89, 0x79, 0x58, 0x36, 0x14, 0x2d, 0x4e, 0x70, 0x89, 0x89, 0x7f, 0x5a, 0x31, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x23, 0x26, 0x26, 0x23, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa5, 0x7b, 0x8c, 0xa3, 0xa7,
+    0x96, 0x6b, 0x41, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x14, 0x23,
+    0x33, 0x42, 0x52, 0x5c, 0x44, 0x1e, 0x00, 0x00, 0x20, 0x45, 0x5c, 0x51, 0x42, 0x32, 0x23, 0x13,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4b, 0x62, 0x62, 0x62, 0x4d,
+    0x5e, 0x62, 0x62, 0x58, 0x34, 0x0c, 0x00, 0x00, 0x00, 0x11, 0x3c, 0x66, 0x89, 0x89, 0x89, 0x89,
+    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x7c, 0x52, 0x28, 0x00, 0x00, 0x23, 0x46, 0x62, 0x70, 0x6b,
+    0x54, 0x34, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x32, 0x59, 0x80, 0xa7, 0x8e, 0x67, 0x40, 0x19,
+    0x00, 0x05, 0x2c, 0x53, 0x7a, 0xa0, 0x8f, 0x68, 0x42, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x41, 0x6b, 0x86, 0x86, 0x6a, 0x40, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa5, 0x7b, 0x8e, 0xa4, 0xa0, 0x9e, 0xa4, 0xac, 0x99, 0x7e,
+    0x6e, 0x8a, 0xa0, 0xa4, 0x9e, 0xa1, 0xab, 0xa1, 0x89, 0x6b, 0x49, 0x25, 0x00, 0x00, 0x05, 0x2c,
+    0x54, 0x7c, 0xa3, 0x8a, 0x63, 0x3b, 0x13, 0x0d, 0x34, 0x5c, 0x83, 0xab, 0x9e, 0x76, 0x4e, 0x27,
+    0x00, 0x20, 0x47, 0x6f, 0x97, 0x92, 0x6b, 0x43, 0x1b, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa5, 0x7b,
+    0x8d, 0xa3, 0xa2, 0x9e, 0xa2, 0xad, 0x9f, 0x86, 0x68, 0x46, 0x22, 0x00, 0x00, 0x00, 0x1a, 0x3c,
+    0x5d, 0x7f, 0xa1, 0x93, 0x71, 0x50, 0x2e, 0x46, 0x68, 0x8a, 0xa8, 0x86, 0x65, 0x43, 0x22, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x2f, 0x4b, 0x51, 0x51, 0x4b, 0x2f, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa5, 0x85, 0xa0, 0x8b, 0x7e,
+    0x7a, 0x6b, 0x41, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1c, 0x2b, 0x3b, 0x4b,
+    0x5a, 0x6a, 0x79, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x26, 0x51, 0x7b, 0x79, 0x69, 0x5a, 0x4a, 0x3a,
+    0x2b, 0x1b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x8c, 0x80, 0x56,
+    0x70, 0x8c, 0x8c, 0x65, 0x3a, 0x10, 0x00, 0x00, 0x00, 0x11, 0x3c, 0x66, 0x90, 0x9c, 0x9c, 0x9c,
+    0x9c, 0x9c, 0x9c, 0x9c, 0xb3, 0xa6, 0x7c, 0x52, 0x28, 0x00, 0x0b, 0x34, 0x5c, 0x81, 0x9a, 0x8f,
+    0x6e, 0x47, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x48, 0x6f, 0x96, 0x9f, 0x78, 0x51, 0x2a,
+    0x03, 0x16, 0x3d, 0x64, 0x8b, 0xa5, 0x7e, 0x57, 0x31, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x41, 0x6b, 0x96, 0x94, 0x6a, 0x40, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa8, 0x8e, 0x9a, 0x83, 0x77, 0x74, 0x7b, 0x8e, 0xaa, 0x99,
+    0x8a, 0xa5, 0x8c, 0x7b, 0x74, 0x77, 0x85, 0x9e, 0xa7, 0x83, 0x5e, 0x37, 0x0f, 0x00, 0x00, 0x1e,
+    0x45, 0x6d, 0x95, 0x99, 0x71, 0x49, 0x22, 0x1c, 0x43, 0x6b, 0x92, 0xa6, 0xac, 0x85, 0x5d, 0x35,
+    0x0e, 0x2f, 0x56, 0x7e, 0xa6, 0x84, 0x5c, 0x34, 0x0d, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa7, 0x8d,
+    0x9c, 0x85, 0x78, 0x74, 0x78, 0x87, 0xa0, 0xa4, 0x81, 0x5b, 0x34, 0x0c, 0x00, 0x00, 0x01, 0x22,
+    0x44, 0x65, 0x87, 0xa8, 0x8b, 0x69, 0x48, 0x60, 0x81, 0xa3, 0x8e, 0x6d, 0x4b, 0x2a, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x41, 0x68, 0x7b, 0x7b, 0x69, 0x42, 0x1b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xb7, 0xa2, 0x81, 0x65, 0x54,
+    0x50, 0x4c, 0x31, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x05, 0x15, 0x24, 0x34, 0x43, 0x53, 0x62, 0x72,
+    0x81, 0x91, 0xa1, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x26, 0x51, 0x7b, 0xa0, 0x91, 0x81, 0x71, 0x62,
+    0x52, 0x43, 0x33, 0x24, 0x14, 0x05, 0x00, 0x00, 0x00, 0x00, 0x29, 0x53, 0x7e, 0xa8, 0x7f, 0x55,
+    0x6f, 0x9a, 0x8e, 0x63, 0x39, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x62, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x89, 0xac, 0x8b, 0x6a, 0x49, 0x23, 0x00, 0x0f, 0x3a, 0x64, 0x8e, 0xb9, 0xa2,
+    0x78, 0x4e, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x37, 0x5e, 0x85, 0xac, 0x88, 0x62, 0x3b,
+    0x14, 0x27, 0x4e, 0x75, 0x9c, 0x94, 0x6d, 0x47, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x24, 0x24, 0x24, 0x41, 0x6b, 0x96, 0x94, 0x6a, 0x40, 0x24, 0x24, 0x24, 0x18,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xb7, 0x9d, 0x7b, 0x5f, 0x4d, 0x4a, 0x54, 0x6f, 0x92, 0xb3,
+    0xab, 0x89, 0x69, 0x53, 0x4a, 0x4d, 0x62, 0x83, 0xa8, 0x95, 0x6c, 0x43, 0x1a, 0x00, 0x00, 0x0f,
+    0x36, 0x5e, 0x86, 0xa7, 0x80, 0x58, 0x30, 0x2b, 0x52, 0x7a, 0xa1, 0x89, 0x99, 0x93, 0x6c, 0x44,
+    0x1c, 0x3d, 0x65, 0x8d, 0x9c, 0x75, 0x4d, 0x25, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xb7, 0x9e,
+    0x7d, 0x60, 0x4f, 0x49, 0x4f, 0x64, 0x85, 0xab, 0x92, 0x6a, 0x41, 0x17, 0x00, 0x00, 0x00, 0x08,
+    0x2a, 0x4b, 0x6d, 0x8f, 0xa5, 0x83, 0x61, 0x79, 0x9b, 0x96, 0x74, 0x53, 0x31, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x2b, 0x52, 0x79, 0xa0, 0xa0, 0x79, 0x52, 0x2b, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xb6, 0x8e, 0x68, 0x45, 0x2c,
+    0x25, 0x24, 0x13, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x2c, 0x3c, 0x4c, 0x5b, 0x6b, 0x7a, 0x8a, 0x99,
+    0xa4, 0x94, 0x85, 0x76, 0x4f, 0x25, 0x00, 0x00, 0x26, 0x50, 0x76, 0x86, 0x95, 0xa4, 0x99, 0x89,
+    0x7a, 0x6a, 0x5b, 0x4b, 0x3b, 0x2c, 0x1c, 0x02, 0x00, 0x00, 0x28, 0x53, 0x7d, 0xa7, 0x7e, 0x54,
+    0x6e, 0x99, 0x8d, 0x62, 0x38, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x27, 0x42, 0x47, 0x47, 0x47, 0x47,
+    0x47, 0x62, 0x83, 0xa4, 0x91, 0x71, 0x50, 0x2f, 0x0e, 0x00, 0x0b, 0x34, 0x5c, 0x80, 0x98, 0x9a,
+    0x71, 0x48, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x4d, 0x74, 0x9b, 0x99, 0x72, 0x4b,
+    0x24, 0x38, 0x5f, 0x86, 0xaa, 0x83, 0x5c, 0x36, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1a, 0x3b, 0x4e, 0x4e, 0x4e, 0x4e, 0x6b, 0x96, 0x94, 0x6a, 0x4e, 0x4e, 0x4e, 0x4e, 0x3b,
+    0x18, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xb4, 0x8b, 0x64, 0x40, 0x25, 0x1f, 0x33, 0x5a, 0x83, 0xac,
+    0x9c, 0x74, 0x4e, 0x2e, 0x1f, 0x26, 0x4a, 0x72, 0x9b, 0x9e, 0x74, 0x4a, 0x20, 0x00, 0x00, 0x00,
+    0x28, 0x4f, 0x77, 0x9f, 0x8e, 0x66, 0x3f, 0x3a, 0x61, 0x89, 0xa1, 0x7a, 0x8a, 0xa2, 0x7a, 0x53,
+    0x2b, 0x4c, 0x74, 0x9b, 0x8e, 0x66, 0x3e, 0x17, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xb4, 0x8c,
+    0x65, 0x41, 0x27, 0x1f, 0x29, 0x4c, 0x74, 0x9d, 0x9c, 0x72, 0x48, 0x1e, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x32, 0x53, 0x75, 0x96, 0x9d, 0x7b, 0x93, 0x9d, 0x7c, 0x5a, 0x39, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x3c, 0x63, 0x8a, 0x93, 0x93, 0x8a, 0x63, 0x3c, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xad, 0x83, 0x5a, 0x31, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x3e, 0x54, 0x63, 0x73, 0x82, 0x92, 0xa2, 0x9b, 0x8b,
+    0x7c, 0x6d, 0x5e, 0x4e, 0x3a, 0x18, 0x00, 0x00, 0x19, 0x3b, 0x4f, 0x5e, 0x6d, 0x7d, 0x8c, 0x9b,
+    0xa1, 0x91, 0x82, 0x72, 0x63, 0x53, 0x3d, 0x1a, 0x00, 0x00, 0x27, 0x52, 0x7c, 0xa6, 0x7d, 0x53,
+    0x6d, 0x98, 0x8c, 0x61, 0x37, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1a, 0x1d, 0x1d, 0x1d, 0x3a,
+    0x5b, 0x7c, 0x9d, 0x98, 0x77, 0x56, 0x35, 0x14, 0x00, 0x00, 0x00, 0x23, 0x44, 0x6a, 0x93, 0x8c,
+    0x64, 0x3c, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x3c, 0x63, 0x8a, 0xaa, 0x83, 0x5c,
+    0x35, 0x49, 0x70, 0x97, 0x99, 0x72, 0x4b, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x26, 0x50, 0x77, 0x79, 0x79, 0x79, 0x79, 0x96, 0x94, 0x79, 0x79, 0x79, 0x79, 0x76, 0x4f,
+    0x25, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xac, 0x82, 0x58, 0x2e, 0x06, 0x00, 0x28, 0x52, 0x7c, 0xa6,
+    0x93, 0x69, 0x3f, 0x16, 0x00, 0x17, 0x41, 0x6b, 0x95, 0xa1, 0x77, 0x4d, 0x22, 0x00, 0x00, 0x00,
+    0x19, 0x41, 0x68, 0x90, 0x9d, 0x75, 0x4d, 0x49, 0x70, 0x98, 0x92, 0x6b, 0x7b, 0xa2, 0x89, 0x61,
+    0x3a, 0x5b, 0x83, 0xa6, 0x7f, 0x57, 0x2f, 0x08, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xac, 0x82,
+    0x58, 0x2f, 0x06, 0x00, 0x19, 0x43, 0x6d, 0x97, 0x9f, 0x75, 0x4b, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x39, 0x5b, 0x7d, 0x9e, 0x9b, 0xa5, 0x83, 0x62, 0x40, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x25, 0x4c, 0x73, 0x9a, 0x83, 0x83, 0x9a, 0x73, 0x4c, 0x25, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x51, 0x7a, 0x8b, 0x9a, 0xa1, 0x92, 0x82, 0x73, 0x64,
+    0x55, 0x45, 0x36, 0x27, 0x17, 0x00, 0x00, 0x00, 0x00, 0x18, 0x27, 0x37, 0x46, 0x55, 0x64, 0x73,
+    0x83, 0x92, 0xa1, 0x9a, 0x8a, 0x79, 0x4f, 0x25, 0x00, 0x00, 0x26, 0x51, 0x7b, 0xa5, 0x7c, 0x52,
+    0x6c, 0x97, 0x8b, 0x60, 0x36, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x34, 0x55,
+    0x76, 0x97, 0x9e, 0x7d, 0x5c, 0x3b, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x22, 0x4b, 0x74, 0x9d, 0x7f,
+    0x57, 0x2e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2b, 0x52, 0x79, 0xa0, 0x94, 0x6d,
+    0x46, 0x5a, 0x81, 0xa8, 0x88, 0x61, 0x3a, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x26, 0x51, 0x7b, 0xa3, 0xa3, 0xa3, 0xa3, 0xa9, 0xa9, 0xa3, 0xa3, 0xa3, 0xa3, 0x7a, 0x4f,
+    0x25, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x27, 0x51, 0x7c, 0xa6,
+    0x90, 0x66, 0x3c, 0x11, 0x00, 0x16, 0x40, 0x6a, 0x95, 0xa2, 0x77, 0x4d, 0x23, 0x00, 0x00, 0x00,
+    0x0a, 0x32, 0x5a, 0x81, 0xa9, 0x83, 0x5c, 0x58, 0x7f, 0xa7, 0x83, 0x5b, 0x6c, 0x93, 0x98, 0x70,
+    0x48, 0x6a, 0x91, 0x98, 0x70, 0x48, 0x21, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f,
+    0x55, 0x2a, 0x00, 0x00, 0x18, 0x42, 0x6c, 0x97, 0xa0, 0x75, 0x4b, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x42, 0x63, 0x86, 0xb0, 0x8e, 0x6a, 0x48, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x36, 0x5d, 0x84, 0x9a, 0x73, 0x73, 0x9a, 0x84, 0x5d, 0x36, 0x0f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x51, 0x7b, 0xa5, 0x8f, 0x79, 0x6a, 0x5b, 0x4c, 0x3c,
+    0x2d, 0x1e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1e, 0x2e, 0x3d, 0x4c,
+    0x5b, 0x6a, 0x7a, 0x8f, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x25, 0x50, 0x7a, 0xa4, 0x7b, 0x51,
+    0x6b, 0x96, 0x89, 0x5f, 0x35, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2d, 0x4e, 0x6f,
+    0x90, 0xa5, 0x84, 0x63, 0x42, 0x21, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2c, 0x55, 0x7e, 0x99, 0x71,
+    0x49, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x41, 0x68, 0x8f, 0xa4, 0x7d,
+    0x56, 0x6b, 0x92, 0x9e, 0x77, 0x50, 0x29, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x26, 0x51, 0x7b, 0x82, 0x82, 0x82, 0x82, 0x96, 0x94, 0x82, 0x82, 0x82, 0x82, 0x7a, 0x4f,
+    0x25, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x27, 0x51, 0x7c, 0xa6,
+    0x90, 0x66, 0x3c, 0x11, 0x00, 0x16, 0x40, 0x6a, 0x95, 0xa2, 0x77, 0x4d, 0x23, 0x00, 0x00, 0x00,
+    0x00, 0x23, 0x4b, 0x72, 0x9a, 0x92, 0x6a, 0x67, 0x8e, 0x9b, 0x74, 0x4c, 0x5d, 0x84, 0xa6, 0x7f,
+    0x57, 0x78, 0xa0, 0x89, 0x61, 0x39, 0x12, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f,
+    0x55, 0x2a, 0x00, 0x00, 0x18, 0x42, 0x6c, 0x97, 0xa0, 0x75, 0x4b, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x3a, 0x5b, 0x7d, 0x9e, 0x9b, 0xa5, 0x84, 0x62, 0x41, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1f, 0x46, 0x6d, 0x94, 0x8a, 0x63, 0x62, 0x8a, 0x94, 0x6d, 0x46, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x51, 0x7b, 0x93, 0xa2, 0x99, 0x8a, 0x7b, 0x6b, 0x5c,
+    0x4d, 0x3e, 0x2e, 0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x2f, 0x3e, 0x4d, 0x5c, 0x6c,
+    0x7b, 0x8a, 0x99, 0xa2, 0x92, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x24, 0x4f, 0x79, 0x87, 0x7a, 0x4f,
+    0x6b, 0x87, 0x87, 0x5e, 0x34, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x27, 0x48, 0x69, 0x8a,
+    0xab, 0x8a, 0x69, 0x48, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x34, 0x5f, 0x82, 0x82, 0x63,
+    0x3b, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x30, 0x57, 0x7e, 0xa4, 0x8e,
+    0x67, 0x7c, 0xa3, 0x8d, 0x66, 0x3f, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1e, 0x42, 0x57, 0x58, 0x58, 0x58, 0x6b, 0x96, 0x94, 0x6a, 0x58, 0x58, 0x58, 0x57, 0x41,
+    0x1d, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x27, 0x51, 0x7c, 0xa6,
+    0x90, 0x66, 0x3c, 0x11, 0x00, 0x16, 0x40, 0x6a, 0x95, 0xa2, 0x77, 0x4d, 0x23, 0x00, 0x00, 0x00,
+    0x00, 0x14, 0x3c, 0x64, 0x8b, 0xa0, 0x79, 0x76, 0x9d, 0x8c, 0x64, 0x3d, 0x4e, 0x75, 0x9d, 0x8d,
+    0x66, 0x87, 0xa2, 0x7a, 0x52, 0x2b, 0x03, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f,
+    0x55, 0x2a, 0x00, 0x00, 0x18, 0x42, 0x6c, 0x97, 0xa0, 0x75, 0x4b, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x32, 0x54, 0x75, 0x97, 0x9c, 0x7a, 0x94, 0x9e, 0x7c, 0x5b, 0x3a, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x30, 0x57, 0x7e, 0xa1, 0x7a, 0x52, 0x52, 0x79, 0xa1, 0x7e, 0x57, 0x30, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x44, 0x5c, 0x6b, 0x7b, 0x8a, 0x9a, 0xa2, 0x93, 0x84,
+    0x74, 0x65, 0x56, 0x47, 0x33, 0x14, 0x00, 0x00, 0x15, 0x34, 0x47, 0x56, 0x65, 0x75, 0x84, 0x93,
+    0xa2, 0x99, 0x8a, 0x7a, 0x6b, 0x5b, 0x43, 0x1e, 0x00, 0x00, 0x1e, 0x44, 0x5c, 0x5d, 0x5c, 0x44,
+    0x57, 0x5d, 0x5d, 0x4f, 0x2c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41, 0x62, 0x83, 0xa4,
+    0x90, 0x6f, 0x4e, 0x2e, 0x11, 0x11, 0x11, 0x0b, 0x00, 0x00, 0x03, 0x2a, 0x4c, 0x57, 0x57, 0x4d,
+    0x2d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x46, 0x6d, 0x93, 0x9f,
+    0x78, 0x8d, 0xa3, 0x7c, 0x55, 0x2e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x21, 0x2d, 0x2d, 0x2d, 0x41, 0x6b, 0x96, 0x94, 0x6a, 0x40, 0x2d, 0x2d, 0x2d, 0x20,
+    0x05, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x27, 0x51, 0x7c, 0xa6,
+    0x90, 0x66, 0x3c, 0x11, 0x00, 0x16, 0x40, 0x6a, 0x95, 0xa2, 0x77, 0x4d, 0x23, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x2d, 0x55, 0x7d, 0xa4, 0x87, 0x85, 0xa4, 0x7d, 0x55, 0x2e, 0x3f, 0x66, 0x8e, 0x9c,
+    0x74, 0x96, 0x93, 0x6b, 0x44, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f,
+    0x55, 0x2a, 0x00, 0x00, 0x18, 0x42, 0x6c, 0x97, 0xa0, 0x75, 0x4b, 0x21, 0x00, 0x00, 0x00, 0x09,
+    0x2b, 0x4c, 0x6e, 0x8f, 0xa4, 0x82, 0x60, 0x7a, 0x9c, 0x96, 0x75, 0x54, 0x32, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x41, 0x68, 0x8e, 0x90, 0x69, 0x42, 0x42, 0x69, 0x90, 0x8e, 0x67, 0x40, 0x1a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x24, 0x34, 0x44, 0x53, 0x63, 0x72, 0x82, 0x92, 0xa1,
+    0x9c, 0x8d, 0x7d, 0x6e, 0x4d, 0x23, 0x00, 0x00, 0x25, 0x4e, 0x6f, 0x7e, 0x8d, 0x9c, 0xa1, 0x91,
+    0x82, 0x72, 0x62, 0x53, 0x43, 0x34, 0x23, 0x07, 0x00, 0x00, 0x08, 0x24, 0x32, 0x32, 0x32, 0x25,
+    0x30, 0x32, 0x32, 0x2b, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x3b, 0x5c, 0x7d, 0x9e, 0x97,
+    0x76, 0x55, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x32, 0x17, 0x00, 0x00, 0x10, 0x27, 0x2d, 0x2d, 0x28,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x35, 0x5c, 0x82, 0xa9,
+    0x88, 0x9e, 0x92, 0x6b, 0x44, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x03, 0x17, 0x41, 0x6b, 0x96, 0x94, 0x6a, 0x40, 0x15, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x27, 0x51, 0x7c, 0xa6,
+    0x90, 0x66, 0x3c, 0x11, 0x00, 0x16, 0x40, 0x6a, 0x95, 0xa2, 0x77, 0x4d, 0x23, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1f, 0x46, 0x6e, 0x96, 0x96, 0x94, 0x95, 0x6d, 0x46, 0x1e, 0x30, 0x57, 0x7f, 0xa6,
+    0x83, 0xa5, 0x84, 0x5c, 0x35, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f,
+    0x55, 0x2a, 0x00, 0x00, 0x18, 0x42, 0x6c, 0x97, 0xa0, 0x75, 0x4b, 0x21, 0x00, 0x00, 0x01, 0x23,
+    0x44, 0x66, 0x87, 0xa9, 0x8a, 0x68, 0x47, 0x61, 0x82, 0xa4, 0x8f, 0x6e, 0x4c, 0x2b, 0x09, 0x00,
+    0x00, 0x03, 0x2a, 0x51, 0x78, 0x9f, 0x80, 0x59, 0x32, 0x32, 0x59, 0x80, 0x9f, 0x78, 0x51, 0x2a,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x1c, 0x2c, 0x3c, 0x4b, 0x5b, 0x6a, 0x7a,
+    0x89, 0x99, 0xa4, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x26, 0x51, 0x7b, 0xa5, 0x98, 0x89, 0x79, 0x6a,
+    0x5a, 0x4b, 0x3b, 0x2c, 0x1c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x00,
+    0x06, 0x08, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x34, 0x55, 0x76, 0x97, 0x9d, 0x7c,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x52, 0x2c, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x4b, 0x71, 0x98,
+    0xac, 0xa7, 0x81, 0x5a, 0x33, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x41, 0x6b, 0x8f, 0x8f, 0x6a, 0x40, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x27, 0x51, 0x7c, 0xa6,
+    0x90, 0x66, 0x3c, 0x11, 0x00, 0x16, 0x40, 0x6a, 0x95, 0xa2, 0x77, 0x4d, 0x23, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x38, 0x5f, 0x87, 0xaf, 0xad, 0x86, 0x5e, 0x37, 0x0f, 0x21, 0x48, 0x70, 0x97,
+    0xac, 0x9d, 0x75, 0x4e, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0xa9, 0x7f,
+    0x55, 0x2a, 0x00, 0x00, 0x18, 0x42, 0x6c, 0x97, 0xa0, 0x75, 0x4b, 0x21, 0x00, 0x00, 0x1b, 0x3d,
+    0x5e, 0x80, 0xa1, 0x92, 0x70, 0x4f, 0x2d, 0x47, 0x69, 0x8b, 0xa9, 0x88, 0x66, 0x45, 0x23, 0x01,
+    0x00, 0x14, 0x3b, 0x62, 0x89, 0x97, 0x70, 0x49, 0x22, 0x22, 0x49, 0x70, 0x97, 0x88, 0x61, 0x3a,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0x95, 0x7f, 0x55, 0x2a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x14, 0x24, 0x33, 0x43, 0x52,
+    0x62, 0x72, 0x81, 0x7a, 0x4f, 0x25, 0x00, 0x00, 0x26, 0x51, 0x7b, 0x81, 0x71, 0x61, 0x52, 0x42,
+    0x33, 0x23, 0x14, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0d, 0x0d, 0x0d, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x42, 0x6c, 0x91, 0xb2, 0x98, 0x90,
+    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x84, 0x5a, 0x30, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x3a, 0x60, 0x87,
+    0x95, 0x95, 0x70, 0x49, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x3b, 0x5e, 0x64, 0x64, 0x5d, 0x3a, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0x95, 0x7f, 0x55, 0x2a, 0x00, 0x00, 0x27, 0x51, 0x7c, 0x95,
+    0x90, 0x66, 0x3c, 0x11, 0x00, 0x16, 0x40, 0x6a, 0x95, 0x95, 0x77, 0x4d, 0x23, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x29, 0x50, 0x78, 0x95, 0x95, 0x77, 0x4f, 0x28, 0x00, 0x11, 0x39, 0x61, 0x88,
+    0x95, 0x8e, 0x66, 0x3f, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x63, 0x8d, 0x95, 0x7f,
+    0x55, 0x2a, 0x00, 0x00, 0x18, 0x42, 0x6c, 0x95, 0x95, 0x75, 0x4b, 0x21, 0x00, 0x06, 0x2f, 0x56,
+    0x78, 0x95, 0x95, 0x78, 0x57, 0x35, 0x13, 0x2e, 0x50, 0x71, 0x93, 0x95, 0x80, 0x5f, 0x39, 0x10,
+    0x00, 0x1e, 0x48, 0x72, 0x83, 0x83, 0x60, 0x39, 0x11, 0x12, 0x39, 0x60, 0x83, 0x83, 0x72, 0x48,
+    0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x35, 0x5c, 0x6a, 0x6a, 0x6a, 0x50, 0x28, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1b, 0x2b,
+    0x3b, 0x4a, 0x5a, 0x65, 0x49, 0x21, 0x00, 0x00, 0x22, 0x4a, 0x65, 0x59, 0x4a, 0x3a, 0x2b, 0x1b,
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x38, 0x38, 0x38, 0x2d,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x42, 0x6c, 0x95, 0x95, 0x95, 0x95,
+    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x84, 0x5a, 0x30, 0x05, 0x00, 0x00, 0x03, 0x14, 0x1b, 0x19,
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x29, 0x4f, 0x6a,
+    0x6a, 0x6a, 0x5e, 0x38, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x37, 0x3a, 0x3a, 0x37, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x35, 0x5c, 0x6a, 0x6a, 0x6a, 0x50, 0x28, 0x00, 0x00, 0x24, 0x4d, 0x6a, 0x6a,
+    0x6a, 0x5e, 0x38, 0x0f, 0x00, 0x14, 0x3d, 0x62, 0x6a, 0x6a, 0x69, 0x49, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0x42, 0x65, 0x6a, 0x6a, 0x64, 0x40, 0x18, 0x00, 0x02, 0x2a, 0x51, 0x6a,
+    0x6a, 0x6a, 0x57, 0x30, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x35, 0x5c, 0x6a, 0x6a, 0x6a,
+    0x50, 0x28, 0x00, 0x00, 0x16, 0x3e, 0x63, 0x6a, 0x6a, 0x68, 0x47, 0x1e, 0x00, 0x06, 0x2f, 0x56,
+    0x6a, 0x6a, 0x6a, 0x5f, 0x3d, 0x1b, 0x00, 0x14, 0x36, 0x58, 0x6a, 0x6a, 0x6a, 0x5f, 0x39, 0x10,
+    0x00, 0x17, 0x3c, 0x57, 0x59, 0x59, 0x4b, 0x28, 0x01, 0x02, 0x28, 0x4b, 0x59, 0x59, 0x57, 0x3c,
+    0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3a, 0x40, 0x40, 0x40, 0x33, 0x15, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x13, 0x23, 0x32, 0x3b, 0x2c, 0x0e, 0x00, 0x00, 0x0f, 0x2c, 0x3b, 0x32, 0x22, 0x13, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4b, 0x62, 0x62, 0x62, 0x4d,
+    0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x3e, 0x63, 0x6a, 0x6a, 0x6a, 0x6a,
+    0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x55, 0x2d, 0x04, 0x00, 0x0a, 0x27, 0x3c, 0x46, 0x42,
+    0x32, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x33, 0x40,
+    0x40, 0x40, 0x3b, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x10, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x3a, 0x40, 0x40, 0x40, 0x33, 0x15, 0x00, 0x00, 0x13, 0x31, 0x40, 0x40,
+    0x40, 0x3b, 0x23, 0x00, 0x00, 0x04, 0x26, 0x3d, 0x40, 0x40, 0x3f, 0x2e, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x29, 0x3e, 0x40, 0x40, 0x3e, 0x28, 0x07, 0x00, 0x00, 0x17, 0x34, 0x40,
+    0x40, 0x40, 0x37, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3a, 0x40, 0x40, 0x40,
+    0x33, 0x15, 0x00, 0x00, 0x06, 0x27, 0x3d, 0x40, 0x40, 0x3f, 0x2d, 0x0d, 0x00, 0x00, 0x1b, 0x37,
+    0x40, 0x40, 0x40, 0x3b, 0x23, 0x02, 0x00, 0x00, 0x1c, 0x38, 0x40, 0x40, 0x40, 0x3b, 0x23, 0x01,
+    0x00, 0x01, 0x1e, 0x2e, 0x2f, 0x2f, 0x27, 0x0f, 0x00, 0x00, 0x0f, 0x27, 0x2f, 0x2f, 0x2e, 0x1e,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x16, 0x16, 0x16, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x54, 0x7f, 0x8c, 0x80, 0x56,
+    0x2c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x27, 0x3d, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x36, 0x1a, 0x00, 0x00, 0x24, 0x46, 0x62, 0x70, 0x6b,
+    0x54, 0x34, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x16,
+    0x16, 0x16, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x0e, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x16, 0x16, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x16, 0x16,
+    0x16, 0x13, 0x02, 0x00, 0x00, 0x00, 0x04, 0x14, 0x16, 0x16, 0x15, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x15, 0x16, 0x16, 0x14, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x16,
+    0x16, 0x16, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x16, 0x16, 0x16,
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x05, 0x14, 0x16, 0x16, 0x15, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x16, 0x16, 0x16, 0x13, 0x02, 0x00, 0x00, 0x00, 0x00, 0x10, 0x16, 0x16, 0x16, 0x13, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x53, 0x7e, 0xa8, 0x7f, 0x55,
+    0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x14, 0x16, 0x16, 0x16, 0x16,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0f, 0x00, 0x00, 0x0d, 0x36, 0x5d, 0x82, 0x9a, 0x90,
+    0x6e, 0x47, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x34, 0x38, 0x38, 0x2d, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x14, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x14,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
+    0x1e, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x19, 0x25, 0x29, 0x26, 0x1b, 0x09, 0x00, 0x0e,
+    0x20, 0x23, 0x23, 0x1b, 0x04, 0x00, 0x00, 0x03, 0x21, 0x32, 0x33, 0x33, 0x33, 0x2c, 0x14, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x53, 0x7d, 0xa7, 0x7e, 0x54,
+    0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x3c, 0x66, 0x90, 0xbb, 0xa2,
+    0x78, 0x4e, 0x23, 0x00, 0x00, 0x0e, 0x26, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x29, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x1d, 0x20, 0x36, 0x59, 0x62, 0x62, 0x4d, 0x27, 0x21, 0x16, 0x00, 0x00, 0x00,
+    0x04, 0x26, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d,
+    0x26, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x16, 0x37, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+    0x48, 0x36, 0x15, 0x00, 0x00, 0x00, 0x0d, 0x2a, 0x40, 0x4f, 0x54, 0x50, 0x42, 0x2d, 0x15, 0x2d,
+    0x48, 0x4e, 0x4e, 0x40, 0x20, 0x00, 0x00, 0x18, 0x3e, 0x5b, 0x5d, 0x5d, 0x5d, 0x50, 0x33, 0x16,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x52, 0x7c, 0xa6, 0x7d, 0x53,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x36, 0x5d, 0x82, 0x9a, 0x8f,
+    0x6e, 0x47, 0x1e, 0x00, 0x00, 0x27, 0x4a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x4f, 0x2f,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x27, 0x44, 0x4a, 0x3d, 0x67, 0x8d, 0x80, 0x56, 0x3f, 0x4b, 0x3a, 0x19, 0x00, 0x00,
+    0x14, 0x3d, 0x62, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x62,
+    0x3d, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x25, 0x4f, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+    0x71, 0x4e, 0x24, 0x00, 0x00, 0x05, 0x29, 0x49, 0x65, 0x77, 0x7e, 0x79, 0x68, 0x50, 0x36, 0x3d,
+    0x66, 0x78, 0x78, 0x58, 0x2e, 0x03, 0x00, 0x1d, 0x48, 0x70, 0x87, 0x87, 0x87, 0x6f, 0x52, 0x34,
+    0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x51, 0x7b, 0xa5, 0x7c, 0x52,
+    0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x46, 0x62, 0x70, 0x6a,
+    0x53, 0x33, 0x0f, 0x00, 0x06, 0x30, 0x5b, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x63, 0x39,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x17, 0x3c, 0x61, 0x71, 0x5b, 0x67, 0x91, 0x80, 0x56, 0x64, 0x75, 0x52, 0x2d, 0x08, 0x00,
+    0x16, 0x40, 0x6a, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x6a,
+    0x40, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x26, 0x51, 0x7b, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
+    0x7a, 0x4f, 0x25, 0x00, 0x00, 0x18, 0x3f, 0x64, 0x85, 0x9f, 0xa2, 0xa1, 0x8b, 0x72, 0x58, 0x48,
+    0x6e, 0x96, 0x80, 0x56, 0x2c, 0x02, 0x00, 0x12, 0x35, 0x50, 0x6a, 0x84, 0x9d, 0x8e, 0x70, 0x53,
+    0x36, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x50, 0x7a, 0xa4, 0x7b, 0x51,
+    0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x27, 0x3c, 0x46, 0x42,
+    0x31, 0x18, 0x00, 0x00, 0x06, 0x30, 0x5b, 0x85, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0x8d, 0x63, 0x39,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x29, 0x50, 0x75, 0x95, 0x80, 0x6a, 0x91, 0x80, 0x73, 0x88, 0x8c, 0x67, 0x41, 0x19, 0x00,
+    0x16, 0x40, 0x6a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x6a,
+    0x40, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x26, 0x51, 0x7b, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x7a, 0x4f, 0x25, 0x00, 0x00, 0x25, 0x4e, 0x76, 0x9e, 0x89, 0x78, 0x82, 0x9a, 0x93, 0x7a, 0x70,
+    0x83, 0x9f, 0x77, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x14, 0x2e, 0x48, 0x62, 0x7c, 0x96, 0x8f, 0x72,
+    0x54, 0x35, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x4f, 0x79, 0x87, 0x7a, 0x4f,
+    0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x14, 0x1b, 0x19,
+    0x0c, 0x00, 0x00, 0x00, 0x06, 0x30, 0x5b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x63, 0x38,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x2b, 0x53, 0x71, 0x85, 0x99, 0x8f, 0x91, 0x82, 0x97, 0x91, 0x7d, 0x68, 0x43, 0x1a, 0x00,
+    0x0d, 0x33, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50,
+    0x33, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x46, 0x5d, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
+    0x5d, 0x45, 0x1f, 0x00, 0x03, 0x2d, 0x57, 0x81, 0x97, 0x6f, 0x4e, 0x5f, 0x79, 0x93, 0xa0, 0x9b,
+    0xa5, 0x89, 0x66, 0x41, 0x19, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x27, 0x41, 0x5b, 0x74, 0x7d, 0x7d,
+    0x6a, 0x40, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x44, 0x5c, 0x5d, 0x5c, 0x44,
+    0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x49, 0x2b,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0x37, 0x4b, 0x60, 0x74, 0x89, 0xb0, 0xa2, 0x81, 0x6c, 0x58, 0x43, 0x2c, 0x0b, 0x00,
+    0x00, 0x15, 0x28, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x28,
+    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x26, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x25, 0x09, 0x00, 0x05, 0x2f, 0x5a, 0x7e, 0x7e, 0x66, 0x3c, 0x3e, 0x58, 0x6f, 0x81, 0x85,
+    0x7e, 0x6a, 0x4d, 0x2c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1f, 0x39, 0x50, 0x52, 0x52,
+    0x4e, 0x32, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x24, 0x32, 0x32, 0x32, 0x25,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x22, 0x0e,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x27, 0x4c, 0x64, 0x79, 0x8d, 0x9a, 0x97, 0x90, 0x9a, 0x85, 0x71, 0x5c, 0x3e, 0x17, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1d, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x3f, 0x1c, 0x00, 0x00, 0x24, 0x46, 0x54, 0x54, 0x4d, 0x2f, 0x1d, 0x35, 0x4a, 0x57, 0x5b,
+    0x56, 0x46, 0x2f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x27, 0x28, 0x28,
+    0x25, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x2c, 0x56, 0x7c, 0x9e, 0x8b, 0x76, 0x90, 0x80, 0x7e, 0x94, 0x92, 0x6d, 0x45, 0x1b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x26, 0x51, 0x7b, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x7a, 0x4f, 0x25, 0x00, 0x00, 0x0a, 0x22, 0x2a, 0x2a, 0x26, 0x12, 0x00, 0x11, 0x23, 0x2e, 0x31,
+    0x2c, 0x20, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1e, 0x43, 0x67, 0x7c, 0x67, 0x66, 0x91, 0x80, 0x5a, 0x6f, 0x7e, 0x59, 0x34, 0x0f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x26, 0x51, 0x7b, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4,
+    0x7a, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x2e, 0x4f, 0x57, 0x42, 0x67, 0x91, 0x80, 0x56, 0x4b, 0x58, 0x43, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x26, 0x50, 0x79, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b,
+    0x78, 0x4f, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x29, 0x2d, 0x3b, 0x63, 0x70, 0x70, 0x53, 0x2a, 0x2e, 0x22, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1b, 0x3d, 0x50, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+    0x50, 0x3c, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x04, 0x27, 0x41, 0x46, 0x46, 0x39, 0x1a, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x1b, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x19, 0x1c, 0x1c, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const lv_font_sdf_glyph_dsc_t test_font_montserrat_ascii_sdf_glyph_dsc[] = {
+    {.unicode = 0x0020, .adv_w = 103, .atlas_x = 0, .atlas_y = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.unicode = 0x0021, .adv_w = 103, .atlas_x = 215, .atlas_y = 73, .box_w = 10, .box_h = 24, .ofs_x = -2, .ofs_y = -4},
+    {.unicode = 0x0022, .adv_w = 150, .atlas_x = 185, .atlas_y = 144, .box_w = 13, .box_h = 13, .ofs_x = -2, .ofs_y = 7},
+    {.unicode = 0x0023, .adv_w = 270, .atlas_x = 85, .atlas_y = 77, .box_w = 23, .box_h = 23, .ofs_x = -3, .ofs_y = -3},
+    {.unicode = 0x0024, .adv_w = 238, .atlas_x = 49, .atlas_y = 0, .box_w = 20, .box_h = 29, .ofs_x = -3, .ofs_y = -6},
+    {.unicode = 0x0025, .adv_w = 324, .atlas_x = 217, .atlas_y = 25, .box_w = 26, .box_h = 24, .ofs_x = -3, .ofs_y = -4},
+    {.unicode = 0x0026, .adv_w = 263, .atlas_x = 153, .atlas_y = 28, .box_w = 22, .box_h = 24, .ofs_x = -2, .ofs_y = -4},
+    {.unicode = 0x0027, .adv_w = 81, .atlas_x = 185, .atlas_y = 157, .box_w = 9, .box_h = 13, .ofs_x = -2, .ofs_y = 7},
+    {.unicode = 0x0028, .adv_w = 129, .atlas_x = 96, .atlas_y = 0, .box_w = 12, .box_h = 29, .ofs_x = -1, .ofs_y = -8},
+    {.unicode = 0x0029, .adv_w = 130, .atlas_x = 108, .atlas_y = 0, .box_w = 12, .box_h = 29, .ofs_x = -3, .ofs_y = -8},
+    {.unicode = 0x002a, .adv_w = 154, .atlas_x = 0, .atlas_y = 161, .box_w = 16, .box_h = 16, .ofs_x = -3, .ofs_y = 5},
+    {.unicode = 0x002b, .adv_w = 223, .atlas_x = 0, .atlas_y = 144, .box_w = 18, .box_h = 17, .ofs_x = -2, .ofs_y = 0},
+    {.unicode = 0x002c, .adv_w = 87, .atlas_x = 218, .atlas_y = 143, .box_w = 10, .box_h = 14, .ofs_x = -2, .ofs_y = -7},
+    {.unicode = 0x002d, .adv_w = 147, .atlas_x = 228, .atlas_y = 161, .box_w = 13, .box_h = 9, .ofs_x = -2, .ofs_y = 2},
+    {.unicode = 0x002e, .adv_w = 87, .atlas_x = 218, .atlas_y = 157, .box_w = 10, .box_h = 11, .ofs_x = -2, .ofs_y = -4},
+    {.unicode = 0x002f, .adv_w = 135, .atlas_x = 0, .atlas_y = 0, .box_w = 17, .box_h = 30, .ofs_x = -4, .ofs_y = -6},
+    {.unicode = 0x0030, .adv_w = 256, .atlas_x = 0, .atlas_y = 30, .box_w = 20, .box_h = 24, .ofs_x = -2, .ofs_y = -4},
+    {.unicode = 0x0031, .adv_w = 142, .atlas_x = 187, .atlas_y = 121, .box_w = 13, .box_h = 23, .ofs_x = -3, .ofs_y = -3},
+    {.unicode = 0x0032, .adv_w = 220, .atlas_x = 0, .atlas_y = 101, .box_w = 19, .box_h = 23, .ofs_x = -3, .ofs_y = -3},
+    {.unicode = 0x0033, .adv_w = 220, .atlas_x = 237, .atlas_y = 49, .box_w = 19, .box_h = 24, .ofs_x = -3, .ofs_y = -4},
+    {.unicode = 0x0034, .adv_w = 257, .atlas_x = 234, .atlas_y = 73, .box_w = 22, .box_h = 23, .ofs_x = -3, .ofs_y = -3},
+    {.unicode = 0x0035, .adv_w = 220, .atlas_x = 60, .atlas_y = 53, .box_w = 19, .box_h = 24, .ofs_x = -3, .ofs_y = -4},
+    {.unicode = 0x0036, .adv_w = 237, .atlas_x = 20, .atlas_y = 30, .box_w = 20, .box_h = 24, .ofs_x = -2, .ofs_y = -4},
+    {.unicode = 0x0037, .adv_w = 230, .atlas_x = 86, .atlas_y = 100, .box_w = 20, .box_h = 23, .ofs_x = -3, .ofs_y = -3},
+    {.unicode = 0x0038, .adv_w = 247, .atlas_x = 217, .atlas_y = 49, .box_w = 20, .box_h = 24, .ofs_x = -2, .ofs_y = -4},
+    {.unicode = 0x0039, .adv_w = 237, .atlas_x = 175, .atlas_y = 51, .box_w = 20, .box_h = 24, .ofs_x = -3, .ofs_y = -4},
+    {.unicode = 0x003a, .adv_w = 87, .atlas_x = 135, .atlas_y = 122, .box_w = 10, .box_h = 20, .ofs_x = -2, .ofs_y = -4},
+    {.unicode = 0x003b, .adv_w = 87, .atlas_x = 220, .atlas_y = 120, .box_w = 10, .box_h = 23, .ofs_x = -2, .ofs_y = -7},
+    {.unicode = 0x003c, .adv_w = 223, .atlas_x = 149, .atlas_y = 144, .box_w = 18, .box_h = 17, .ofs_x = -2, .ofs_y = 0},
+    {.unicode = 0x003d, .adv_w = 223, .atlas_x = 130, .atlas_y = 161, .box_w = 18, .box_h = 15, .ofs_x = -2, .ofs_y = 1},
+    {.unicode = 0x003e, .adv_w = 223, .atlas_x = 167, .atlas_y = 144, .box_w = 18, .box_h = 17, .ofs_x = -2, .ofs_y = 0},
+    {.unicode = 0x003f, .adv_w = 220, .atlas_x = 79, .atlas_y = 53, .box_w = 19, .box_h = 24, .ofs_x = -3, .ofs_y = -4},
+    {.unicode = 0x0040, .adv_w = 397, .atlas_x = 153, .atlas_y = 0, .box_w = 29, .box_h = 28, .ofs_x = -2, .ofs_y = -8},
+    {.unicode = 0x0041, .adv_w = 281, .atlas_x = 134, .atlas_y = 76, .box_w = 25, .box_h = 23, .ofs_x = -4, .ofs_y = -3},
+    {.unicode = 0x0042, .adv_w = 291, .atlas_x = 159, .atlas_y = 98, .box_w = 21, .box_h = 23, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x0043, .adv_w = 278, .atlas_x = 49, .atlas_y = 29, .box_w = 22, .box_h = 24, .ofs_x = -2, .ofs_y = -4},
+    {.unicode = 0x0044, .adv_w = 317, .atlas_x = 108, .atlas_y = 77, .box_w = 23, .box_h = 23, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x0045, .adv_w = 257, .atlas_x = 230, .atlas_y = 119, .box_w = 19, .box_h = 23, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x0046, .adv_w = 244, .atlas_x = 201, .atlas_y = 120, .box_w = 19, .box_h = 23, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x0047, .adv_w = 296, .atlas_x = 71, .atlas_y = 29, .box_w = 22, .box_h = 24, .ofs_x = -2, .ofs_y = -4},
+    {.unicode = 0x0048, .adv_w = 312, .atlas_x = 180, .atlas_y = 98, .box_w = 21, .box_h = 23, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x0049, .adv_w = 119, .atlas_x = 126, .atlas_y = 122, .box_w = 9, .box_h = 23, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x004a, .adv_w = 197, .atlas_x = 117, .atlas_y = 53, .box_w = 17, .box_h = 24, .ofs_x = -4, .ofs_y = -4},
+    {.unicode = 0x004b, .adv_w = 276, .atlas_x = 234, .atlas_y = 96, .box_w = 22, .box_h = 23, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x004c, .adv_w = 228, .atlas_x = 152, .atlas_y = 121, .box_w = 19, .box_h = 23, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x004d, .adv_w = 367, .atlas_x = 35, .atlas_y = 77, .box_w = 25, .box_h = 23, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x004e, .adv_w = 312, .atlas_x = 131, .atlas_y = 99, .box_w = 21, .box_h = 23, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x004f, .adv_w = 323, .atlas_x = 182, .atlas_y = 27, .box_w = 25, .box_h = 24, .ofs_x = -2, .ofs_y = -4},
+    {.unicode = 0x0050, .adv_w = 277, .atlas_x = 23, .atlas_y = 100, .box_w = 21, .box_h = 23, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x0051, .adv_w = 323, .atlas_x = 182, .atlas_y = 0, .box_w = 25, .box_h = 27, .ofs_x = -2, .ofs_y = -7},
+    {.unicode = 0x0052, .adv_w = 279, .atlas_x = 44, .atlas_y = 100, .box_w = 21, .box_h = 23, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x0053, .adv_w = 238, .atlas_x = 195, .atlas_y = 51, .box_w = 20, .box_h = 24, .ofs_x = -3, .ofs_y = -4},
+    {.unicode = 0x0054, .adv_w = 225, .atlas_x = 106, .atlas_y = 100, .box_w = 20, .box_h = 23, .ofs_x = -3, .ofs_y = -3},
+    {.unicode = 0x0055, .adv_w = 304, .atlas_x = 93, .atlas_y = 29, .box_w = 21, .box_h = 24, .ofs_x = -1, .ofs_y = -4},
+    {.unicode = 0x0056, .adv_w = 273, .atlas_x = 60, .atlas_y = 77, .box_w = 25, .box_h = 23, .ofs_x = -4, .ofs_y = -3},
+    {.unicode = 0x0057, .adv_w = 432, .atlas_x = 175, .atlas_y = 75, .box_w = 33, .box_h = 23, .ofs_x = -3, .ofs_y = -3},
+    {.unicode = 0x0058, .adv_w = 258, .atlas_x = 208, .atlas_y = 97, .box_w = 22, .box_h = 23, .ofs_x = -3, .ofs_y = -3},
+    {.unicode = 0x0059, .adv_w = 248, .atlas_x = 0, .atlas_y = 78, .box_w = 23, .box_h = 23, .ofs_x = -4, .ofs_y = -3},
+    {.unicode = 0x005a, .adv_w = 252, .atlas_x = 65, .atlas_y = 100, .box_w = 21, .box_h = 23, .ofs_x = -2, .ofs_y = -3},
+    {.unicode = 0x005b, .adv_w = 128, .atlas_x = 120, .atlas_y = 0, .box_w = 12, .box_h = 29, .ofs_x = -1, .ofs_y = -8},
+    {.unicode = 0x005c, .adv_w = 135, .atlas_x = 17, .atlas_y = 0, .box_w = 17, .box_h = 30, .ofs_x = -4, .ofs_y = -6},
+    {.unicode = 0x005d, .adv_w = 128, .atlas_x = 132, .atlas_y = 0, .box_w = 12, .box_h = 29, .ofs_x = -3, .ofs_y = -8},
+    {.unicode = 0x005e, .adv_w = 224, .atlas_x = 112, .atlas_y = 145, .box_w = 18, .box_h = 17, .ofs_x = -2, .ofs_y = 0},
+    {.unicode = 0x005f, .adv_w = 192, .atlas_x = 16, .atlas_y = 162, .box_w = 18, .box_h = 8, .ofs_x = -3, .ofs_y = -5},
+    {.unicode = 0x0060, .adv_w = 230, .atlas_x = 166, .atlas_y = 161, .box_w = 13, .box_h = 10, .ofs_x = -1, .ofs_y = 11},
+    {.unicode = 0x0061, .adv_w = 230, .atlas_x = 77, .atlas_y = 123, .box_w = 18, .box_h = 20, .ofs_x = -2, .ofs_y = -4},
+    {.unicode = 0x0062, .adv_w = 262, .atlas_x = 207, .atlas_y = 0, .box_w = 20, .box_h = 25, .ofs_x = -1, .ofs_y = -4},
+    {.unicode = 0x0063, .adv_w = 219, .atlas_x = 95, .atlas_y = 123, .box_w = 18, .box_h = 20, .ofs_x = -2, .ofs_y = -4},
+    {.unicode = 0x0064, .adv_w = 262, .atlas_x = 227, .atlas_y = 0, .box_w = 20, .box_h = 25, .ofs_x = -2, .ofs_y = -4},
+    {.unicode = 0x0065, .adv_w = 235, .atlas_x = 39, .atlas_y = 123, .box_w = 19, .box_h = 20, .ofs_x = -2, .ofs_y = -4},
+    {.unicode = 0x0066, .adv_w = 136, .atlas_x = 19, .atlas_y = 54, .box_w = 16, .box_h = 24, .ofs_x = -3, .ofs_y = -3},
+    {.unicode = 0x0067, .adv_w = 265, .atlas_x = 135, .atlas_y = 52, .box_w = 20, .box_h = 24, .ofs_x = -2, .ofs_y = -8},
+    {.unicode = 0x0068, .adv_w = 262, .atlas_x = 98, .atlas_y = 53, .box_w = 19, .box_h = 24, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x0069, .adv_w = 107, .atlas_x = 207, .atlas_y = 25, .box_w = 10, .box_h = 25, .ofs_x = -2, .ofs_y = -3},
+    {.unicode = 0x006a, .adv_w = 109, .atlas_x = 34, .atlas_y = 0, .box_w = 15, .box_h = 30, .ofs_x = -6, .ofs_y = -8},
+    {.unicode = 0x006b, .adv_w = 237, .atlas_x = 0, .atlas_y = 54, .box_w = 19, .box_h = 24, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x006c, .adv_w = 107, .atlas_x = 225, .atlas_y = 73, .box_w = 9, .box_h = 24, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x006d, .adv_w = 406, .atlas_x = 18, .atlas_y = 143, .box_w = 28, .box_h = 19, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x006e, .adv_w = 262, .atlas_x = 74, .atlas_y = 143, .box_w = 19, .box_h = 19, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x006f, .adv_w = 244, .atlas_x = 19, .atlas_y = 123, .box_w = 20, .box_h = 20, .ofs_x = -2, .ofs_y = -4},
+    {.unicode = 0x0070, .adv_w = 262, .atlas_x = 155, .atlas_y = 52, .box_w = 20, .box_h = 24, .ofs_x = -1, .ofs_y = -8},
+    {.unicode = 0x0071, .adv_w = 262, .atlas_x = 40, .atlas_y = 53, .box_w = 20, .box_h = 24, .ofs_x = -2, .ofs_y = -8},
+    {.unicode = 0x0072, .adv_w = 157, .atlas_x = 135, .atlas_y = 142, .box_w = 14, .box_h = 19, .ofs_x = -1, .ofs_y = -3},
+    {.unicode = 0x0073, .adv_w = 192, .atlas_x = 0, .atlas_y = 124, .box_w = 18, .box_h = 20, .ofs_x = -3, .ofs_y = -4},
+    {.unicode = 0x0074, .adv_w = 159, .atlas_x = 171, .atlas_y = 121, .box_w = 16, .box_h = 23, .ofs_x = -3, .ofs_y = -4},
+    {.unicode = 0x0075, .adv_w = 260, .atlas_x = 58, .atlas_y = 123, .box_w = 19, .box_h = 20, .ofs_x = -1, .ofs_y = -4},
+    {.unicode = 0x0076, .adv_w = 215, .atlas_x = 230, .atlas_y = 142, .box_w = 21, .box_h = 19, .ofs_x = -4, .ofs_y = -3},
+    {.unicode = 0x0077, .adv_w = 345, .atlas_x = 46, .atlas_y = 143, .box_w = 28, .box_h = 19, .ofs_x = -3, .ofs_y = -3},
+    {.unicode = 0x0078, .adv_w = 212, .atlas_x = 93, .atlas_y = 143, .box_w = 19, .box_h = 19, .ofs_x = -3, .ofs_y = -3},
+    {.unicode = 0x0079, .adv_w = 215, .atlas_x = 114, .atlas_y = 29, .box_w = 21, .box_h = 24, .ofs_x = -4, .ofs_y = -8},
+    {.unicode = 0x007a, .adv_w = 200, .atlas_x = 200, .atlas_y = 143, .box_w = 18, .box_h = 19, .ofs_x = -3, .ofs_y = -3},
+    {.unicode = 0x007b, .adv_w = 135, .atlas_x = 83, .atlas_y = 0, .box_w = 13, .box_h = 29, .ofs_x = -2, .ofs_y = -8},
+    {.unicode = 0x007c, .adv_w = 115, .atlas_x = 144, .atlas_y = 0, .box_w = 9, .box_h = 29, .ofs_x = -1, .ofs_y = -8},
+    {.unicode = 0x007d, .adv_w = 135, .atlas_x = 69, .atlas_y = 0, .box_w = 14, .box_h = 29, .ofs_x = -3, .ofs_y = -8},
+    {.unicode = 0x007e, .adv_w = 223, .atlas_x = 148, .atlas_y = 161, .box_w = 18, .box_h = 11, .ofs_x = -2, .ofs_y = 3},
+};
+
+const lv_font_sdf_dsc_t test_font_montserrat_ascii_sdf = {
+    .atlas = test_font_montserrat_ascii_sdf_atlas,
+    .atlas_w = 256,
+    .atlas_h = 177,
+    .glyph_dsc = test_font_montserrat_ascii_sdf_glyph_dsc,
+    .glyph_cnt = 95,
+    .size = 24,
+    .line_height = 29,
+    .base_line = 6,
+    .underline_position = -2,
+    .underline_thickness = 1,
+    .padding = 3,
+    .edge_value = 128,
+    .pixel_dist_scale = 42,
+};
+
+#endif /*LV_USE_FONT_SDF*/
+
+#endif /*LV_BUILD_TEST*/
@@ -165,4 +165,193 @@ void test_label_selection_with_letter_space(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("draw/label_selection_letter_space.png");
 }
 
+static void disable_run_event_cb(lv_event_t * e)
+{
+    /*Recoloring is not cached but the texts have no color commands so they look the same*/
+    lv_draw_label_dsc_t * dsc = lv_draw_task_get_label_dsc(lv_event_get_draw_task(e));
+    if(dsc) dsc->flag |= LV_TEXT_FLAG_RECOLOR;
+}
+
+static lv_draw_buf_t * take_run_snapshot(lv_obj_t * cont, bool cached)
+{
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(cont); i++) {
+        lv_obj_t * label = lv_obj_get_child(cont, i);
+        if(cached) {
+            lv_obj_remove_flag(label, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+            lv_obj_remove_event_cb(label, disable_run_event_cb);
+        }
+        else {
+            lv_obj_add_flag(label, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+            lv_obj_add_event_cb(label, disable_run_event_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+        }
+    }
+
+    lv_refr_now(NULL);
+    return lv_snapshot_take(cont, LV_COLOR_FORMAT_ARGB8888);
+}
+
+static void assert_run_snapshots_equal(lv_obj_t * cont)
+{
+    /*Draw twice to create the runs and to draw from them*/
+    lv_draw_buf_t * snapshots[3];
+    snapshots[0] = take_run_snapshot(cont, true);
+    snapshots[1] = take_run_snapshot(cont, true);
+    snapshots[2] = take_run_snapshot(cont, false);
+
+    uint32_t i;
+    for(i = 1; i < 3; i++) {
+        TEST_ASSERT_NOT_NULL(snapshots[i]);
+        for(uint32_t y = 0; y < snapshots[0]->header.h; y++) {
+            TEST_ASSERT_EQUAL_MEMORY(lv_draw_buf_goto_xy(snapshots[0], 0, y), lv_draw_buf_goto_xy(snapshots[i], 0, y),
+                                     snapshots[0]->header.w * 4);
+        }
+    }
+
+    for(i = 0; i < 3; i++) lv_draw_buf_destroy(snapshots[i]);
+}
+
+void test_draw_label_run_cache(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 400, 300);
+    lv_obj_set_style_pad_all(cont, 0, 0);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+
+    static char dynamic_text[] = "Dynamic text, version 1";
+    const lv_text_align_t aligns[] = {LV_TEXT_ALIGN_LEFT, LV_TEXT_ALIGN_CENTER, LV_TEXT_ALIGN_RIGHT};
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_obj_t * label = lv_label_create(cont);
+        lv_obj_set_width(label, 120);
+        lv_label_set_text(label, "The quick brown fox jumps over the lazy dog.\nNew line");
+        lv_obj_set_style_text_align(label, aligns[i], 0);
+        lv_obj_set_style_text_decor(label, LV_TEXT_DECOR_UNDERLINE | LV_TEXT_DECOR_STRIKETHROUGH, 0);
+
+        label = lv_label_create(cont);
+        lv_obj_set_width(label, 120);
+        lv_label_set_text_static(label, dynamic_text);
+        lv_obj_set_style_text_align(label, aligns[i], 0);
+        lv_obj_set_style_text_letter_space(label, 3, 0);
+        lv_obj_set_style_text_line_space(label, -2, 0);
+    }
+
+    assert_run_snapshots_equal(cont);
+
+    /*Runs are found by the content of the text, not only by its pointer*/
+    dynamic_text[lv_strlen(dynamic_text) - 1] = '2';
+    for(i = 1; i < lv_obj_get_child_count(cont); i += 2) lv_label_set_text_static(lv_obj_get_child(cont, i), NULL);
+    assert_run_snapshots_equal(cont);
+
+    lv_obj_delete(cont);
+}
+
+void test_draw_label_run_cache_fallback(void)
+{
+    static lv_font_t font_with_fallback;
+    font_with_fallback = lv_font_montserrat_14;
+    font_with_fallback.fallback = NULL;
+
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 200, 100);
+    lv_obj_set_style_pad_all(cont, 0, 0);
+    lv_obj_t * label = lv_label_create(cont);
+    lv_obj_set_width(label, 180);
+    lv_obj_set_style_text_font(label, &font_with_fallback, 0);
+    lv_label_set_text(label, "Hello \xE4\xBD\xA0\xE5\xA5\xBD");
+    assert_run_snapshots_equal(cont);
+    lv_draw_buf_t * without_fallback = take_run_snapshot(cont, true);
+
+    /*The runs are not used if the fallback font changes*/
+    font_with_fallback.fallback = &lv_font_source_han_sans_sc_14_cjk;
+    lv_obj_invalidate(cont);
+    assert_run_snapshots_equal(cont);
+    lv_draw_buf_t * with_fallback = take_run_snapshot(cont, true);
+    TEST_ASSERT_NOT_EQUAL(0, lv_memcmp(without_fallback->data, with_fallback->data, with_fallback->data_size));
+
+    lv_draw_buf_destroy(without_fallback);
+    lv_draw_buf_destroy(with_fallback);
+    lv_obj_delete(cont);
+}
+
+static void glyph_atlas_draw(lv_obj_t * canvas, bool by_letters)
+{
+    static const char * texts[] = {"ABCDEFGHIJKLM", "NOPQRSTUVWXYZ", "abcdefghijklm", "nopqrstuvwxyz", "0123456789", "AVAWATA Tyjf", "AVAWATA Tyjf"};
+    static const lv_font_t * fonts[] = {&lv_font_montserrat_48, &lv_font_montserrat_48, &lv_font_montserrat_48, &lv_font_montserrat_48, &lv_font_montserrat_48, &lv_font_montserrat_28_compressed, &lv_font_montserrat_14};
+
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    int32_t y = 0;
+    uint32_t i;
+    for(i = 0; i < sizeof(texts) / sizeof(texts[0]); i++) {
+        const lv_font_t * font = fonts[i];
+        lv_color_t color = i % 2 ? lv_palette_main(LV_PALETTE_RED) : lv_color_black();
+        lv_opa_t opa = i == 6 ? LV_OPA_50 : LV_OPA_COVER;
+        if(by_letters) {
+            /*`lv_draw_letter` draws the glyphs one by one*/
+            int32_t x = 0;
+            const char * txt = texts[i];
+            for(; *txt; txt++) {
+                lv_font_glyph_dsc_t g;
+                lv_font_get_glyph_dsc(font, &g, txt[0], 0);
+
+                lv_draw_letter_dsc_t dsc;
+                lv_draw_letter_dsc_init(&dsc);
+                dsc.font = font;
+                dsc.unicode = txt[0];
+                dsc.color = color;
+                dsc.opa = opa;
+                lv_point_t pos = {x + g.adv_w / 2, y + font->line_height - font->base_line};
+                lv_draw_letter(&layer, &dsc, &pos);
+                x += lv_font_get_glyph_width(font, txt[0], txt[1]);
+            }
+        }
+        else {
+            lv_draw_label_dsc_t dsc;
+            lv_draw_label_dsc_init(&dsc);
+            dsc.font = font;
+            dsc.text = texts[i];
+            dsc.color = color;
+            dsc.opa = opa;
+            lv_area_t coords = {0, y, lv_canvas_get_draw_buf(canvas)->header.w - 1, y + font->line_height - 1};
+            lv_draw_label(&layer, &dsc, &coords);
+        }
+        y += font->line_height;
+    }
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+void test_draw_label_glyph_atlas(void)
+{
+    /*The glyphs of the labels are blended directly from the atlas.
+     *It should look exactly the same as drawing them one by one.
+     *The glyphs of the 48 px font don't fit into the atlas so it's reset while drawing too.*/
+    lv_obj_t * canvas_label = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas_label, lv_draw_buf_create(480, 400, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO));
+    lv_obj_t * canvas_letter = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas_letter, lv_draw_buf_create(480, 400, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO));
+
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        glyph_atlas_draw(canvas_label, false);
+        glyph_atlas_draw(canvas_letter, true);
+
+        lv_draw_buf_t * buf_label = lv_canvas_get_draw_buf(canvas_label);
+        lv_draw_buf_t * buf_letter = lv_canvas_get_draw_buf(canvas_letter);
+        for(uint32_t y = 0; y < buf_label->header.h; y++) {
+            TEST_ASSERT_EQUAL_MEMORY(lv_draw_buf_goto_xy(buf_letter, 0, y), lv_draw_buf_goto_xy(buf_label, 0, y),
+                                     buf_label->header.w * 4);
+        }
+    }
+
+    lv_draw_buf_destroy(lv_canvas_get_draw_buf(canvas_label));
+    lv_draw_buf_destroy(lv_canvas_get_draw_buf(canvas_letter));
+    lv_obj_delete(canvas_label);
+    lv_obj_delete(canvas_letter);
+}
+
 #endif
@@ -444,4 +444,67 @@ void test_vtile_rectangular(void)
     TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_buf_lsb, dst_buf, 8);
 }
 
+/*Rotate a buffer larger than a rotation tile with padded strides and compare it to a pixel by pixel rotation*/
+static void rotate_big_and_compare(lv_display_rotation_t rotation, lv_color_format_t cf)
+{
+    const int32_t w = 75;
+    const int32_t h = 43;
+    const uint32_t px_size = lv_color_format_get_size(cf);
+    const bool swap = rotation == LV_DISPLAY_ROTATION_90 || rotation == LV_DISPLAY_ROTATION_270;
+    const int32_t dst_w = swap ? h : w;
+    const int32_t dst_h = swap ? w : h;
+    const uint32_t src_stride = (w + 5) * px_size;
+    const uint32_t dst_stride = (dst_w + 7) * px_size;
+
+    uint8_t * src = lv_malloc(src_stride * h);
+    uint8_t * dst = lv_malloc_zeroed(dst_stride * dst_h);
+    uint8_t * expected = lv_malloc_zeroed(dst_stride * dst_h);
+
+    for(uint32_t i = 0; i < src_stride * h; i++) src[i] = (uint8_t)(i * 7 + i / 251);
+
+    for(int32_t y = 0; y < h; y++) {
+        for(int32_t x = 0; x < w; x++) {
+            int32_t dst_x;
+            int32_t dst_y;
+            switch(rotation) {
+                case LV_DISPLAY_ROTATION_90:
+                    dst_x = y;
+                    dst_y = w - x - 1;
+                    break;
+                case LV_DISPLAY_ROTATION_180:
+                    dst_x = w - x - 1;
+                    dst_y = h - y - 1;
+                    break;
+                default:
+                    dst_x = h - y - 1;
+                    dst_y = x;
+                    break;
+            }
+            lv_memcpy(&expected[dst_y * dst_stride + dst_x * px_size], &src[y * src_stride + x * px_size], px_size);
+        }
+    }
+
+    lv_draw_sw_rotate(src, dst, w, h, src_stride, dst_stride, rotation, cf);
+
+    /*The padding at the end of the lines must be untouched*/
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, dst, dst_stride * dst_h);
+
+    lv_free(src);
+    lv_free(dst);
+    lv_free(expected);
+}
+
+void test_rotate_tiles(void)
+{
+    static const lv_color_format_t cfs[] = {
+        LV_COLOR_FORMAT_L8, LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB888, LV_COLOR_FORMAT_XRGB8888
+    };
+
+    for(uint32_t i = 0; i < sizeof(cfs) / sizeof(cfs[0]); i++) {
+        rotate_big_and_compare(LV_DISPLAY_ROTATION_90, cfs[i]);
+        rotate_big_and_compare(LV_DISPLAY_ROTATION_180, cfs[i]);
+        rotate_big_and_compare(LV_DISPLAY_ROTATION_270, cfs[i]);
+    }
+}
+
 #endif
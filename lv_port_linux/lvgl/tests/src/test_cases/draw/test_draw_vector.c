@@ -359,6 +359,72 @@ void test_draw_shapes(void)
     canvas_draw("draw_shapes", draw_shapes);
 }
 
+static void shape_cache_get_counts(uint32_t * hit_cnt, uint32_t * miss_cnt)
+{
+    *hit_cnt = 0;
+    *miss_cnt = 0;
+    for(uint32_t i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        *hit_cnt += LV_GLOBAL_DEFAULT()->sw_vector_state.canvases[i].shape_hit_cnt;
+        *miss_cnt += LV_GLOBAL_DEFAULT()->sw_vector_state.canvases[i].shape_miss_cnt;
+    }
+}
+
+static void draw_rect_translated(lv_obj_t * canvas, float x)
+{
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_vector_dsc_t * ctx = lv_draw_vector_dsc_create(&layer);
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+    lv_area_t rect = {0, 0, 19, 19};
+    lv_vector_path_append_rect(path, &rect, 0, 0);
+    lv_draw_vector_dsc_translate(ctx, x, 0);
+    lv_draw_vector_dsc_set_fill_color(ctx, lv_color_make(0xff, 0x00, 0x00));
+    lv_draw_vector_dsc_add_path(ctx, path);
+    lv_draw_vector(ctx);
+    lv_vector_path_delete(path);
+    lv_draw_vector_dsc_delete(ctx);
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+void test_draw_shape_cache_reuse(void)
+{
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(100, 40, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    TEST_ASSERT_NOT_NULL(draw_buf);
+    lv_canvas_set_draw_buf(canvas, draw_buf);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+
+    uint32_t hit_start, miss_start;
+    shape_cache_get_counts(&hit_start, &miss_start);
+
+    draw_rect_translated(canvas, 0);
+
+    uint32_t hit_cnt, miss_cnt;
+    shape_cache_get_counts(&hit_cnt, &miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(hit_start, hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(miss_start + 1, miss_cnt);
+
+    /*Same path and style, only the transformation differs*/
+    draw_rect_translated(canvas, 50);
+
+    shape_cache_get_counts(&hit_cnt, &miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(hit_start + 1, hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(miss_start + 1, miss_cnt);
+
+    /*The reused shape is drawn at the new position*/
+    TEST_ASSERT_UINT8_WITHIN(2, 0xff, lv_canvas_get_px(canvas, 10, 10).red);
+    TEST_ASSERT_UINT8_WITHIN(2, 0x00, lv_canvas_get_px(canvas, 10, 10).green);
+    TEST_ASSERT_UINT8_WITHIN(2, 0xff, lv_canvas_get_px(canvas, 30, 10).green);
+    TEST_ASSERT_UINT8_WITHIN(2, 0xff, lv_canvas_get_px(canvas, 60, 10).red);
+    TEST_ASSERT_UINT8_WITHIN(2, 0x00, lv_canvas_get_px(canvas, 60, 10).green);
+
+    lv_image_cache_drop(draw_buf);
+    lv_draw_buf_destroy(draw_buf);
+    lv_obj_delete(canvas);
+}
+
 static void event_cb(lv_event_t * e)
 {
     lv_layer_t * layer = lv_event_get_layer(e);
@@ -566,6 +566,45 @@ void test_freetype_render_outline(void)
 #endif
 }
 
+static void wait_for_cached_glyphs(lv_cache_t * cache, size_t cnt)
+{
+    /*The glyphs are rendered in the background*/
+    uint32_t i;
+    for(i = 0; i < 1000 && lv_cache_get_size(cache, NULL) < cnt; i++) {
+        lv_sleep_ms(1);
+    }
+    TEST_ASSERT_EQUAL_UINT32(cnt, lv_cache_get_size(cache, NULL));
+}
+
+void test_freetype_prefetch(void)
+{
+    lv_font_t * font = lv_freetype_font_create("./src/test_files/fonts/Montserrat-Bold.ttf",
+                                               LV_FREETYPE_FONT_RENDER_MODE_BITMAP,
+                                               32,
+                                               LV_FREETYPE_FONT_STYLE_NORMAL);
+    TEST_ASSERT_NOT_NULL(font);
+
+    lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)font->dsc;
+    lv_cache_t * cache = dsc->cache_node->draw_data_cache;
+    TEST_ASSERT_EQUAL_UINT32(0, lv_cache_get_size(cache, NULL));
+
+    /*The space has no bitmap and the repeated letters are rendered only once*/
+    lv_font_prefetch(font, "Hello world");
+    wait_for_cached_glyphs(cache, 7);
+
+    /*Only the new letters of the next language are rendered*/
+    static const char * tags[] = {"tiger", NULL};
+    static const char * languages[] = {"en", "de", NULL};
+    static const char * translations[] = {"Tiger", "Der Tiger"};
+    lv_translation_add_static(languages, tags, translations);
+    lv_translation_prefetch("de", font);
+    wait_for_cached_glyphs(cache, 11);
+
+    /*Deleting the font drops its glyphs waiting to be rendered*/
+    lv_font_prefetch(font, UNIVERSAL_DECLARATION_OF_HUMAN_RIGHTS_EN);
+    lv_freetype_font_delete(font);
+}
+
 static void freetype_outline_event_cb(lv_event_t * e)
 {
     lv_event_code_t code = lv_event_get_code(e);
@@ -642,6 +681,10 @@ void test_freetype_render_outline(void)
 {
 }
 
+void test_freetype_prefetch(void)
+{
+}
+
 #endif /*LV_USE_FREETYPE*/
 
 #endif
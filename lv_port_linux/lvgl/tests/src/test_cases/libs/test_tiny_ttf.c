@@ -12,6 +12,7 @@ void setUp(void)
 void tearDown(void)
 {
     /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
 }
 
 void test_tiny_ttf_rendering_test(void)
@@ -114,4 +115,37 @@ void test_tiny_ttf_gpos(void)
 #endif
 }
 
+void test_tiny_ttf_prefetch(void)
+{
+#if LV_USE_TINY_TTF
+    extern const uint8_t test_ubuntu_font[];
+    extern size_t test_ubuntu_font_size;
+    lv_font_t * font = lv_tiny_ttf_create_data(test_ubuntu_font, test_ubuntu_font_size, 30);
+
+    static const char * txt = "Hello world\n"
+                              "I'm a font created with Tiny TTF\n"
+                              "Accents: ÁÉÍÓÖŐÜŰ áéíóöőüű";
+
+    /*The prefetched glyphs are drawn the same way as the ones rendered while drawing*/
+    lv_font_prefetch(font, txt);
+
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_set_style_bg_opa(label, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(label, lv_color_hex(0xffaaaa), 0);
+    lv_label_set_text_static(label, txt);
+    lv_obj_center(label);
+
+#ifndef NON_AMD64_BUILD
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/tiny_ttf_1.png");
+#endif
+
+    lv_obj_delete(label);
+    lv_tiny_ttf_destroy(font);
+#else
+    TEST_PASS();
+#endif
+}
+
 #endif
@@ -250,6 +250,71 @@ void test_display_triple_buffer(void)
     lv_draw_buf_destroy(buf3);
 }
 
+static lv_obj_t * create_black_rect(lv_obj_t * parent, int32_t x, int32_t y)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_style_bg_color(obj, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, 10, 10);
+    return obj;
+}
+
+static uint32_t get_px(lv_draw_buf_t * buf, int32_t x, int32_t y)
+{
+    return *(uint32_t *)lv_draw_buf_goto_xy(buf, x, y) & 0xffffff;
+}
+
+void test_display_triple_buffer_sync(void)
+{
+    lv_display_t * disp = lv_display_create(100, 100);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_XRGB8888);
+    lv_display_set_flush_cb(disp, dummy_flush_cb);
+    lv_draw_buf_t * buf1 = lv_draw_buf_create(100, 100, LV_COLOR_FORMAT_XRGB8888, 0);
+    lv_draw_buf_t * buf2 = lv_draw_buf_create(100, 100, LV_COLOR_FORMAT_XRGB8888, 0);
+    lv_draw_buf_t * buf3 = lv_draw_buf_create(100, 100, LV_COLOR_FORMAT_XRGB8888, 0);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_display_set_draw_buffers(disp, buf1, buf2);
+    lv_display_set_3rd_draw_buffer(disp, buf3);
+
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_set_style_bg_color(scr, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+
+    /*Frame 1: the whole screen is rendered into buf1*/
+    lv_display_refr_timer(lv_display_get_refr_timer(disp));
+
+    /*Frame 2: buf2 is rendered*/
+    lv_obj_t * obj1 = create_black_rect(scr, 0, 0);
+    lv_display_refr_timer(lv_display_get_refr_timer(disp));
+
+    /*Frame 3: buf3 is rendered*/
+    create_black_rect(scr, 50, 50);
+    lv_display_refr_timer(lv_display_get_refr_timer(disp));
+
+    /*Frame 4: buf1 needs to get the areas of frame 2 and 3*/
+    lv_obj_delete(obj1);
+    lv_display_refr_timer(lv_display_get_refr_timer(disp));
+    TEST_ASSERT_EQUAL_HEX32(0xffffff, get_px(buf1, 5, 5));
+    TEST_ASSERT_EQUAL_HEX32(0x000000, get_px(buf1, 55, 55));
+
+    /*Frame 5: buf2 needs to get the areas of frame 3 and 4*/
+    create_black_rect(scr, 20, 80);
+    lv_display_refr_timer(lv_display_get_refr_timer(disp));
+    TEST_ASSERT_EQUAL_HEX32(0xffffff, get_px(buf2, 5, 5));
+    TEST_ASSERT_EQUAL_HEX32(0x000000, get_px(buf2, 55, 55));
+    TEST_ASSERT_EQUAL_HEX32(0x000000, get_px(buf2, 25, 85));
+
+    /*Only the areas of the last 2 frames are kept*/
+    TEST_ASSERT_EQUAL(2, lv_ll_get_len(&disp->sync_areas));
+
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(buf1);
+    lv_draw_buf_destroy(buf2);
+    lv_draw_buf_destroy(buf3);
+}
+
 static void refr_event_handler(lv_event_t * e)
 {
     lv_event_code_t code = lv_event_get_code(e);
@@ -283,4 +348,217 @@ void test_display_deleted_during_event(void)
     lv_draw_buf_destroy(buf1);
 }
 
+static uint32_t flush_cnt;
+
+static void counting_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * color_p)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(color_p);
+    flush_cnt++;
+    lv_display_flush_ready(disp);
+}
+
+static lv_display_t * create_paced_display(lv_draw_buf_t ** buf)
+{
+    lv_display_t * disp = lv_display_create(100, 100);
+    lv_display_set_flush_cb(disp, counting_flush_cb);
+    *buf = lv_draw_buf_create(100, 100, LV_COLOR_FORMAT_NATIVE, 0);
+    lv_display_set_draw_buffers(disp, *buf, NULL);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_DIRECT);
+    flush_cnt = 0;
+    return disp;
+}
+
+void test_display_vblank_period_measured(void)
+{
+    lv_draw_buf_t * buf;
+    lv_display_t * disp = create_paced_display(&buf);
+    lv_display_frame_stats_t stats;
+
+    /*60 Hz with millisecond timestamps, and some vblanks not reported*/
+    uint32_t t0 = lv_tick_get();
+    uint32_t i;
+    for(i = 0; i < 60; i++) {
+        if(i % 7 == 3) continue;
+        lv_display_report_vblank(disp, t0 + i * 50 / 3);
+    }
+
+    lv_display_get_frame_stats(disp, &stats);
+    TEST_ASSERT_UINT32_WITHIN(300, 16667, stats.vblank_period_us);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.frame_cnt);
+
+    uint32_t vblank;
+    lv_tick_inc(lv_tick_diff(t0 + 59 * 50 / 3, lv_tick_get()));
+    TEST_ASSERT_TRUE(lv_display_get_next_vblank(disp, &vblank));
+    TEST_ASSERT_UINT32_WITHIN(1, t0 + 60 * 50 / 3, vblank);
+
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(buf);
+}
+
+void test_display_frame_pacing_delays_refresh(void)
+{
+    lv_draw_buf_t * buf;
+    lv_display_t * disp = create_paced_display(&buf);
+    lv_timer_t * refr_timer = lv_display_get_refr_timer(disp);
+    lv_display_frame_stats_t stats;
+
+    lv_display_set_vblank_period(disp, 20000);
+    lv_display_set_frame_pacing(disp, true);
+    uint32_t t0 = lv_tick_get();
+    lv_display_report_vblank(disp, t0);
+
+    /*Rendering is expected to be quick, so it starts with only a margin before the next vblank*/
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_timer_ready(refr_timer);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(0, flush_cnt);
+
+    lv_tick_inc(20 - LV_DISPLAY_PACING_MARGIN - 1);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(0, flush_cnt);
+
+    lv_tick_inc(1);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_DEF_REFR_PERIOD, refr_timer->period);
+
+    /*Presented on time*/
+    lv_display_report_vblank(disp, t0 + 20);
+    lv_display_get_frame_stats(disp, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.frame_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.dropped_cnt);
+
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(buf);
+}
+
+void test_display_frame_stats_dropped(void)
+{
+    lv_draw_buf_t * buf;
+    lv_display_t * disp = create_paced_display(&buf);
+    lv_display_frame_stats_t stats;
+
+    lv_display_set_vblank_period(disp, 20000);
+    uint32_t t0 = lv_tick_get();
+    lv_display_report_vblank(disp, t0);
+
+    /*Planned for the next vblank but presented 2 vblanks later*/
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(1, flush_cnt);
+    lv_tick_inc(60);
+    lv_display_report_vblank(disp, t0 + 60);
+
+    lv_display_get_frame_stats(disp, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.frame_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.dropped_cnt);
+    TEST_ASSERT_EQUAL_UINT32(20000, stats.vblank_period_us);
+
+    lv_display_reset_frame_stats(disp);
+    lv_display_get_frame_stats(disp, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.frame_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.dropped_cnt);
+    TEST_ASSERT_EQUAL_UINT32(20000, stats.vblank_period_us);
+
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(buf);
+}
+
+static void presenting_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * color_p)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(color_p);
+    flush_cnt++;
+    /*Present synchronously, e.g. like a window system*/
+    if(lv_display_flush_is_last(disp)) {
+        lv_tick_inc(3);
+        lv_display_report_presented(disp, lv_tick_get());
+    }
+    lv_display_flush_ready(disp);
+}
+
+void test_display_frame_stats_present_latency(void)
+{
+    lv_draw_buf_t * buf;
+    lv_display_t * disp = create_paced_display(&buf);
+    lv_display_frame_stats_t stats;
+
+    /*Presented asynchronously*/
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+    lv_tick_inc(7);
+    lv_display_report_presented(disp, lv_tick_get());
+    /*Nothing new to present*/
+    lv_display_report_presented(disp, lv_tick_get());
+
+    lv_display_get_frame_stats(disp, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.frame_cnt);
+    TEST_ASSERT_EQUAL_UINT32(7, stats.present_latency_avg_ms);
+    TEST_ASSERT_EQUAL_UINT32(7, stats.present_latency_max_ms);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.vblank_period_us);
+
+    /*Presented in the flush callback*/
+    lv_display_set_flush_cb(disp, presenting_flush_cb);
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+
+    lv_display_get_frame_stats(disp, &stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.frame_cnt);
+    TEST_ASSERT_EQUAL_UINT32((7 * 7 + 3) / 8, stats.present_latency_avg_ms);
+    TEST_ASSERT_EQUAL_UINT32(7, stats.present_latency_max_ms);
+
+    lv_display_reset_frame_stats(disp);
+    lv_display_get_frame_stats(disp, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.present_latency_avg_ms);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.present_latency_max_ms);
+
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(buf);
+}
+
+static int32_t anim_value;
+
+static void anim_exec_cb(void * var, int32_t v)
+{
+    LV_UNUSED(var);
+    anim_value = v;
+}
+
+void test_display_frame_pacing_anim_at_vblank(void)
+{
+    lv_draw_buf_t * buf;
+    lv_display_t * disp = create_paced_display(&buf);
+
+    lv_display_set_vblank_period(disp, 20000);
+    lv_display_set_frame_pacing(disp, true);
+    lv_display_report_vblank(disp, lv_tick_get());
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &anim_value);
+    lv_anim_set_exec_cb(&a, anim_exec_cb);
+    lv_anim_set_values(&a, 0, 1024);
+    lv_anim_set_duration(&a, 1024);
+    lv_anim_start(&a);
+
+    /*The frame will be presented at the next vblank, show the animation in that state*/
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_INT32(20, anim_value);
+
+    /*Don't step back*/
+    lv_tick_inc(5);
+    lv_anim_refr_now();
+    TEST_ASSERT_EQUAL_INT32(20, anim_value);
+
+    lv_tick_inc(20);
+    lv_anim_refr_now();
+    TEST_ASSERT_EQUAL_INT32(25, anim_value);
+
+    lv_anim_delete(&anim_value, anim_exec_cb);
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(buf);
+}
+
 #endif
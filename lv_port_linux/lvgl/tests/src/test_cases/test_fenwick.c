@@ -0,0 +1,104 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define VALUE_CNT 37
+
+static lv_fenwick_t fenwick;
+static int32_t values[VALUE_CNT * 2];
+
+void setUp(void)
+{
+    lv_fenwick_init(&fenwick, true);
+    TEST_ASSERT_TRUE(lv_fenwick_set_count(&fenwick, VALUE_CNT));
+
+    for(uint32_t i = 0; i < VALUE_CNT; i++) {
+        values[i] = (int32_t)(i * 7 % 5) - 2;
+        lv_fenwick_add(&fenwick, i, values[i]);
+    }
+}
+
+void tearDown(void)
+{
+    lv_fenwick_deinit(&fenwick);
+}
+
+static void assert_values(uint32_t cnt)
+{
+    int32_t sum = 0;
+    for(uint32_t i = 0; i < cnt; i++) {
+        TEST_ASSERT_EQUAL_INT32(values[i], lv_fenwick_get(&fenwick, i));
+        TEST_ASSERT_EQUAL_INT32(sum, lv_fenwick_get_sum(&fenwick, i));
+        sum += values[i];
+    }
+    TEST_ASSERT_EQUAL_INT32(sum, lv_fenwick_get_sum(&fenwick, cnt));
+}
+
+void test_fenwick_get_and_sum(void)
+{
+    assert_values(VALUE_CNT);
+
+    lv_fenwick_add(&fenwick, 10, 100);
+    values[10] += 100;
+    assert_values(VALUE_CNT);
+}
+
+void test_fenwick_find(void)
+{
+    /*Items of `10 + value` size*/
+    int32_t base = 10;
+    int32_t y = 0;
+    for(uint32_t i = 0; i < VALUE_CNT; i++) {
+        int32_t item_y;
+        TEST_ASSERT_EQUAL_UINT32(i, lv_fenwick_find(&fenwick, base, y, &item_y));
+        TEST_ASSERT_EQUAL_INT32(y, item_y);
+        TEST_ASSERT_EQUAL_UINT32(i, lv_fenwick_find(&fenwick, base, y + base + values[i] - 1, &item_y));
+        TEST_ASSERT_EQUAL_INT32(y, item_y);
+        y += base + values[i];
+    }
+
+    int32_t item_y;
+    TEST_ASSERT_EQUAL_UINT32(VALUE_CNT, lv_fenwick_find(&fenwick, base, y + 1000, &item_y));
+    TEST_ASSERT_EQUAL_INT32(y, item_y);
+}
+
+void test_fenwick_set_count_keeps_the_values(void)
+{
+    lv_fenwick_set_measured(&fenwick, 3, true);
+    lv_fenwick_set_measured(&fenwick, VALUE_CNT - 1, true);
+
+    /*The new values are 0 and not measured*/
+    TEST_ASSERT_TRUE(lv_fenwick_set_count(&fenwick, VALUE_CNT * 2));
+    for(uint32_t i = VALUE_CNT; i < VALUE_CNT * 2; i++) {
+        values[i] = 0;
+        TEST_ASSERT_FALSE(lv_fenwick_is_measured(&fenwick, i));
+    }
+    assert_values(VALUE_CNT * 2);
+    TEST_ASSERT_TRUE(lv_fenwick_is_measured(&fenwick, 3));
+    TEST_ASSERT_TRUE(lv_fenwick_is_measured(&fenwick, VALUE_CNT - 1));
+
+    TEST_ASSERT_TRUE(lv_fenwick_set_count(&fenwick, 5));
+    assert_values(5);
+    TEST_ASSERT_TRUE(lv_fenwick_is_measured(&fenwick, 3));
+    TEST_ASSERT_FALSE(lv_fenwick_is_measured(&fenwick, 4));
+
+    /*Growing again doesn't bring back the removed values*/
+    TEST_ASSERT_TRUE(lv_fenwick_set_count(&fenwick, VALUE_CNT));
+    for(uint32_t i = 5; i < VALUE_CNT; i++) values[i] = 0;
+    assert_values(VALUE_CNT);
+    TEST_ASSERT_FALSE(lv_fenwick_is_measured(&fenwick, VALUE_CNT - 1));
+}
+
+void test_fenwick_clear(void)
+{
+    lv_fenwick_set_measured(&fenwick, 3, true);
+    lv_fenwick_clear(&fenwick);
+
+    for(uint32_t i = 0; i < VALUE_CNT; i++) values[i] = 0;
+    assert_values(VALUE_CNT);
+    TEST_ASSERT_FALSE(lv_fenwick_is_measured(&fenwick, 3));
+}
+
+#endif
@@ -0,0 +1,161 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/* fonts converted to C structs using the LVGL Font Converter */
+extern lv_font_t test_font_1;
+extern lv_font_t test_font_3;
+
+extern uint8_t const test_font_3_buf[4892];
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+/* Find the glyph ID by walking the cmaps without any lookup tables */
+static uint32_t ref_glyph_id(const lv_font_t * font, uint32_t letter)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    uint32_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        uint32_t rcp = letter - cmap->range_start;
+        if(rcp >= cmap->range_length) continue;
+
+        if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) return cmap->glyph_id_start + rcp;
+        if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+            const uint8_t * ofs = cmap->glyph_id_ofs_list;
+            if(ofs[rcp] == 0 && rcp != 0) continue;
+            return cmap->glyph_id_start + ofs[rcp];
+        }
+
+        uint32_t j;
+        for(j = 0; j < cmap->list_length; j++) {
+            if(cmap->unicode_list[j] != rcp) continue;
+            if(cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) return cmap->glyph_id_start + j;
+            const uint16_t * ofs = cmap->glyph_id_ofs_list;
+            return cmap->glyph_id_start + ofs[j];
+        }
+        return 0;
+    }
+    return 0;
+}
+
+/* Check the glyph IDs of a lot of letters twice: first they are looked up, then they come from the lookup tables */
+static void check_glyph_ids(const lv_font_t * font, uint32_t letter_max, uint32_t step)
+{
+    uint32_t pass;
+    for(pass = 0; pass < 2; pass++) {
+        uint32_t letter;
+        for(letter = 1; letter < letter_max; letter += step) {
+            /*Go backward in the second pass to hit the entries of other letters too*/
+            uint32_t l = pass == 0 ? letter : letter_max - letter;
+            lv_font_glyph_dsc_t dsc;
+            /*Tabs are drawn as spaces*/
+            uint32_t gid = ref_glyph_id(font, l == '\t' ? ' ' : l);
+            bool found = lv_font_get_glyph_dsc_fmt_txt(font, &dsc, l, 0);
+            TEST_ASSERT_EQUAL(gid != 0, found);
+            if(found) TEST_ASSERT_EQUAL_UINT32(gid, dsc.gid.index);
+        }
+    }
+}
+
+/* Check the kerning of all the letter pairs of a text */
+static void check_kerning(const lv_font_t * font, const char * txt)
+{
+    uint32_t len = lv_strlen(txt);
+    uint32_t pass;
+    for(pass = 0; pass < 2; pass++) {
+        uint32_t i;
+        uint32_t j;
+        for(i = 0; i < len; i++) {
+            for(j = 0; j < len; j++) {
+                lv_font_glyph_dsc_t dsc_kern;
+                lv_font_get_glyph_dsc_fmt_txt(font, &dsc_kern, txt[i], txt[j]);
+
+                /*Compare with the kerning of the pair without lookup tables*/
+                lv_font_fmt_txt_remove_lookup(font->dsc);
+                lv_font_glyph_dsc_t dsc_ref;
+                lv_font_get_glyph_dsc_fmt_txt(font, &dsc_ref, txt[i], txt[j]);
+                TEST_ASSERT_EQUAL_UINT32(dsc_ref.adv_w, dsc_kern.adv_w);
+
+                if(pass == 1) {
+                    lv_font_get_glyph_dsc_fmt_txt(font, &dsc_kern, txt[i], txt[j]);
+                    TEST_ASSERT_EQUAL_UINT32(dsc_ref.adv_w, dsc_kern.adv_w);
+                }
+            }
+        }
+    }
+}
+
+void test_font_fmt_txt_lookup_glyph_ids(void)
+{
+    check_glyph_ids(&lv_font_montserrat_14, 0x10000, 1);
+    check_glyph_ids(&test_font_1, 0x10000, 1);
+#if LV_FONT_SOURCE_HAN_SANS_SC_16_CJK
+    check_glyph_ids(&lv_font_source_han_sans_sc_16_cjk, 0x10000, 1);
+#endif
+#if LV_FONT_DEJAVU_16_PERSIAN_HEBREW
+    check_glyph_ids(&lv_font_dejavu_16_persian_hebrew, 0x10000, 1);
+#endif
+}
+
+void test_font_fmt_txt_lookup_kerning(void)
+{
+    const char * txt = "AVATar To. LT, Wo yY";
+    check_kerning(&lv_font_montserrat_14, txt);
+    check_kerning(&test_font_3, txt);
+#if LV_FONT_DEJAVU_16_PERSIAN_HEBREW
+    check_kerning(&lv_font_dejavu_16_persian_hebrew, txt);
+#endif
+}
+
+void test_font_fmt_txt_lookup_eviction(void)
+{
+    /*Use more fonts than the number of lookup tables*/
+    const lv_font_t * fonts[] = {&lv_font_montserrat_8, &lv_font_montserrat_10, &lv_font_montserrat_12,
+                                 &lv_font_montserrat_14, &lv_font_montserrat_16, &lv_font_montserrat_18
+                                };
+    uint32_t round;
+    uint32_t i;
+    for(round = 0; round < 2; round++) {
+        for(i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+            check_glyph_ids(fonts[i], 0x300, 1);
+            check_kerning(fonts[i], "AVATar");
+        }
+    }
+
+    /*All the tables are in use and the last used font has tables*/
+    uint32_t font_cnt = sizeof(fonts) / sizeof(fonts[0]);
+    bool has_last = false;
+    for(i = 0; i < LV_FONT_FMT_TXT_LOOKUP_FONT_CNT; i++) {
+        lv_font_fmt_txt_lookup_t * lookup = LV_GLOBAL_DEFAULT()->font_fmt_txt_lookups[i];
+        TEST_ASSERT_NOT_NULL(lookup);
+        TEST_ASSERT_NOT_NULL(lookup->fdsc);
+        if(lookup->fdsc == fonts[font_cnt - 1]->dsc) has_last = true;
+    }
+    TEST_ASSERT_TRUE(has_last);
+}
+
+void test_font_fmt_txt_lookup_of_loaded_font(void)
+{
+    lv_font_t * font = lv_binfont_create_from_buffer((void *)&test_font_3_buf, sizeof(test_font_3_buf));
+    TEST_ASSERT_NOT_NULL(font);
+    check_glyph_ids(font, 0x3000, 1);
+
+    /*The lookup tables are freed with the font*/
+    lv_binfont_destroy(font);
+    font = lv_binfont_create_from_buffer((void *)&test_font_3_buf, sizeof(test_font_3_buf));
+    check_glyph_ids(font, 0x3000, 1);
+    lv_binfont_destroy(font);
+}
+
+#endif
@@ -0,0 +1,266 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_FONT_SDF
+
+/* generated with scripts/font_sdf_conv from Montserrat-Medium.ttf */
+extern const lv_font_sdf_dsc_t test_font_montserrat_ascii_sdf;
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static void on_canvas_delete(lv_event_t * e)
+{
+    lv_obj_t * canvas = lv_event_get_current_target(e);
+    lv_draw_buf_destroy(lv_canvas_get_draw_buf(canvas));
+}
+
+static lv_obj_t * canvas_create(int32_t w, int32_t h)
+{
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(w, h, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    lv_draw_buf_clear(draw_buf, NULL);
+    lv_canvas_set_draw_buf(canvas, draw_buf);
+    lv_obj_add_event_cb(canvas, on_canvas_delete, LV_EVENT_DELETE, NULL);
+    return canvas;
+}
+
+void test_font_sdf_metrics(void)
+{
+    const lv_font_sdf_dsc_t * dsc = &test_font_montserrat_ascii_sdf;
+    lv_font_t * font = lv_font_sdf_create(dsc, dsc->size);
+    TEST_ASSERT_NOT_NULL(font);
+    TEST_ASSERT_TRUE(lv_font_is_sdf(font));
+    TEST_ASSERT_FALSE(lv_font_is_sdf(&lv_font_montserrat_14));
+    TEST_ASSERT_EQUAL_INT32(dsc->size, lv_font_sdf_get_size(font));
+    TEST_ASSERT_EQUAL_INT32(dsc->line_height, lv_font_get_line_height(font));
+    TEST_ASSERT_EQUAL_INT32(dsc->base_line, font->base_line);
+
+    lv_font_glyph_dsc_t g1;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g1, 'H', 0));
+    TEST_ASSERT_EQUAL(LV_FONT_GLYPH_FORMAT_A8, g1.format);
+    TEST_ASSERT_GREATER_THAN(0, g1.box_w);
+    TEST_ASSERT_GREATER_THAN(0, g1.box_h);
+
+    /*Letters which are not in the distance fields are not found*/
+    lv_font_glyph_dsc_t g_missing;
+    TEST_ASSERT_FALSE(font->get_glyph_dsc(font, &g_missing, 0x4E00, 0));
+
+    /*The metrics scale with the size*/
+    lv_font_sdf_set_size(font, dsc->size * 2);
+    TEST_ASSERT_EQUAL_INT32(dsc->size * 2, lv_font_sdf_get_size(font));
+    TEST_ASSERT_INT32_WITHIN(1, dsc->line_height * 2, lv_font_get_line_height(font));
+
+    lv_font_glyph_dsc_t g2;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g2, 'H', 0));
+    TEST_ASSERT_INT32_WITHIN(1, g1.adv_w * 2, g2.adv_w);
+    TEST_ASSERT_INT32_WITHIN(2, g1.box_w * 2, g2.box_w);
+    TEST_ASSERT_INT32_WITHIN(2, g1.box_h * 2, g2.box_h);
+
+    /*Invalid sizes are ignored*/
+    lv_font_sdf_set_size(font, 0);
+    TEST_ASSERT_EQUAL_INT32(dsc->size * 2, lv_font_sdf_get_size(font));
+
+    lv_font_sdf_destroy(font);
+}
+
+void test_font_sdf_bitmap(void)
+{
+    lv_font_t * font = lv_font_sdf_create(&test_font_montserrat_ascii_sdf, 40);
+
+    lv_font_glyph_dsc_t g;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g, 'l', 0));
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(g.box_w, g.box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    TEST_ASSERT_EQUAL_PTR(draw_buf, lv_font_get_glyph_bitmap(&g, draw_buf));
+
+    /*The middle of the stem is covered, the corners of the box are empty*/
+    const uint8_t * mask = draw_buf->data;
+    uint32_t stride = draw_buf->header.stride;
+    int32_t max_x = 0;
+    int32_t x;
+    for(x = 1; x < g.box_w; x++) {
+        if(mask[g.box_h / 2 * stride + x] > mask[g.box_h / 2 * stride + max_x]) max_x = x;
+    }
+    TEST_ASSERT_EQUAL_UINT8(255, mask[g.box_h / 2 * stride + max_x]);
+    TEST_ASSERT_EQUAL_UINT8(0, mask[0]);
+    TEST_ASSERT_EQUAL_UINT8(0, mask[(g.box_h - 1) * stride + g.box_w - 1]);
+
+    lv_draw_buf_destroy(draw_buf);
+    lv_font_sdf_destroy(font);
+}
+
+void test_font_sdf_sizes(void)
+{
+    static const int32_t sizes[] = {10, 16, 24, 36, 60, 96};
+    lv_font_t * fonts[sizeof(sizes) / sizeof(sizes[0])];
+
+    lv_obj_set_flex_flow(lv_screen_active(), LV_FLEX_FLOW_COLUMN);
+    uint32_t i;
+    for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        fonts[i] = lv_font_sdf_create(&test_font_montserrat_ascii_sdf, sizes[i]);
+        lv_obj_t * label = lv_label_create(lv_screen_active());
+        lv_obj_set_style_text_font(label, fonts[i], 0);
+        lv_label_set_text(label, "Hello SDF, agqy!");
+    }
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("font_sdf_1.png");
+
+    /*Changing the size relayouts the labels*/
+    lv_obj_t * label = lv_obj_get_child(lv_screen_active(), 0);
+    int32_t h = lv_obj_get_height(label);
+    lv_font_sdf_set_size(fonts[0], sizes[0] * 2);
+    lv_obj_send_event(label, LV_EVENT_STYLE_CHANGED, NULL);
+    lv_obj_update_layout(label);
+    TEST_ASSERT_GREATER_THAN(h, lv_obj_get_height(label));
+
+    lv_obj_clean(lv_screen_active());
+    lv_obj_set_flex_flow(lv_screen_active(), LV_FLEX_FLOW_ROW);
+    for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        lv_font_sdf_destroy(fonts[i]);
+    }
+}
+
+static void draw_text(lv_obj_t * canvas, const lv_font_t * font)
+{
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.font = font;
+    dsc.text = "Hello SDF, agqy!";
+    lv_area_t coords = {0, 0, 399, 59};
+    lv_draw_label(&layer, &dsc, &coords);
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+void test_font_sdf_set_size_drops_the_cached_runs(void)
+{
+    lv_font_t * font = lv_font_sdf_create(&test_font_montserrat_ascii_sdf, 16);
+    lv_font_t * font_ref = lv_font_sdf_create(&test_font_montserrat_ascii_sdf, 32);
+    lv_obj_t * canvas = canvas_create(400, 60);
+    lv_obj_t * canvas_ref = canvas_create(400, 60);
+
+    /*The glyphs of the text are cached with the old size first*/
+    draw_text(canvas, font);
+    lv_font_sdf_set_size(font, 32);
+    draw_text(canvas, font);
+    draw_text(canvas_ref, font_ref);
+
+    lv_draw_buf_t * buf = lv_canvas_get_draw_buf(canvas);
+    lv_draw_buf_t * buf_ref = lv_canvas_get_draw_buf(canvas_ref);
+    uint32_t y;
+    for(y = 0; y < buf->header.h; y++) {
+        TEST_ASSERT_EQUAL_MEMORY(lv_draw_buf_goto_xy(buf_ref, 0, y), lv_draw_buf_goto_xy(buf, 0, y),
+                                 buf->header.w * 4);
+    }
+
+    lv_obj_clean(lv_screen_active());
+    lv_font_sdf_destroy(font);
+    lv_font_sdf_destroy(font_ref);
+}
+
+void test_font_sdf_transform(void)
+{
+    lv_font_t * font = lv_font_sdf_create(&test_font_montserrat_ascii_sdf, 40);
+
+    lv_obj_t * canvas = canvas_create(760, 380);
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_letter_dsc_t dsc;
+    lv_draw_letter_dsc_init(&dsc);
+    dsc.color = lv_color_hex(0x2040c0);
+
+    /*Rotated SDF glyphs*/
+    const char * txt = "Rotate me!";
+    int32_t i;
+    for(i = 0; txt[i]; i++) {
+        dsc.font = font;
+        dsc.unicode = txt[i];
+        dsc.rotation = i * 400;
+        lv_draw_letter(&layer, &dsc, &(lv_point_t) {
+            .x = 40 + i * 60, .y = 50
+        });
+    }
+
+    /*Scaled SDF glyphs, also non uniformly*/
+    dsc.rotation = 0;
+    static const int32_t scales[][2] = {{128, 128}, {256, 256}, {384, 384}, {640, 640}, {512, 256}, {256, 512}};
+    for(i = 0; i < 6; i++) {
+        dsc.unicode = 'S';
+        dsc.scale_x = scales[i][0];
+        dsc.scale_y = scales[i][1];
+        lv_draw_letter(&layer, &dsc, &(lv_point_t) {
+            .x = 50 + i * 120, .y = 180
+        });
+    }
+
+    /*Rotated and scaled SDF glyphs*/
+    for(i = 0; i < 6; i++) {
+        dsc.unicode = 'A' + i;
+        dsc.rotation = -300 + i * 120;
+        dsc.scale_x = 256 + i * 64;
+        dsc.scale_y = 256 + i * 64;
+        lv_draw_letter(&layer, &dsc, &(lv_point_t) {
+            .x = 60 + i * 120, .y = 300
+        });
+    }
+
+    lv_canvas_finish_layer(canvas, &layer);
+
+#ifndef NON_AMD64_BUILD
+    TEST_ASSERT_EQUAL_SCREENSHOT("font_sdf_2.png");
+#endif
+
+    lv_obj_delete(canvas);
+    lv_font_sdf_destroy(font);
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_font_sdf_metrics(void)
+{
+}
+
+void test_font_sdf_bitmap(void)
+{
+}
+
+void test_font_sdf_sizes(void)
+{
+}
+
+void test_font_sdf_set_size_drops_the_cached_runs(void)
+{
+}
+
+void test_font_sdf_transform(void)
+{
+}
+
+#endif /*LV_USE_FONT_SDF*/
+
+#endif /*LV_BUILD_TEST*/
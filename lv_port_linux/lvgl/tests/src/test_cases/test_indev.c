@@ -100,4 +100,113 @@ void test_indev_wait_release(void)
     TEST_ASSERT_EQUAL_UINT32(2, pressed_count);
 }
 
+static uint32_t buffered_read_cnt;
+
+static void buffered_read_cb(lv_indev_t * indev, lv_indev_data_t * data)
+{
+    LV_UNUSED(indev);
+    /*Report 3 buffered samples*/
+    data->point.x = (int32_t)buffered_read_cnt * 10;
+    data->point.y = 10;
+    data->state = LV_INDEV_STATE_PRESSED;
+    data->timestamp = 1000 + buffered_read_cnt;
+    buffered_read_cnt++;
+    data->continue_reading = buffered_read_cnt < 3;
+}
+
+void test_indev_event_mode_continue_reading(void)
+{
+    lv_indev_t * indev = lv_indev_create();
+    lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(indev, buffered_read_cb);
+    lv_indev_set_mode(indev, LV_INDEV_MODE_EVENT);
+
+    buffered_read_cnt = 0;
+    lv_indev_read(indev);
+
+    /*All the buffered samples should be processed by one read*/
+    TEST_ASSERT_EQUAL_UINT32(3, buffered_read_cnt);
+
+    lv_point_t p;
+    lv_indev_get_point(indev, &p);
+    TEST_ASSERT_EQUAL_INT32(20, p.x);
+    TEST_ASSERT_EQUAL_INT32(10, p.y);
+
+    lv_indev_delete(indev);
+}
+
+void test_indev_sample_queue(void)
+{
+    lv_indev_t * indev = lv_indev_create();
+    lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_mode(indev, LV_INDEV_MODE_EVENT);
+
+    lv_indev_data_t data;
+    lv_memzero(&data, sizeof(data));
+    data.state = LV_INDEV_STATE_PRESSED;
+    data.point.y = 10;
+
+    /*The size is rounded up to 4*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_indev_set_sample_queue_size(indev, 3));
+    TEST_ASSERT_EQUAL_UINT32(4, lv_indev_get_sample_queue_space(indev));
+
+    int32_t i;
+    for(i = 0; i < 4; i++) {
+        data.point.x = i * 10;
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_indev_push_data(indev, &data));
+    }
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_indev_push_data(indev, &data));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_indev_get_sample_queue_space(indev));
+
+    /*One read reports all the samples*/
+    lv_indev_read(indev);
+    TEST_ASSERT_EQUAL_UINT32(4, lv_indev_get_sample_queue_space(indev));
+
+    lv_point_t p;
+    lv_indev_get_point(indev, &p);
+    TEST_ASSERT_EQUAL_INT32(30, p.x);
+    TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, lv_indev_get_state(indev));
+
+    /*The last state is kept if there is no new sample*/
+    lv_indev_read(indev);
+    TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, lv_indev_get_state(indev));
+
+    lv_indev_delete(indev);
+}
+
+static int32_t swipe_and_throw(uint32_t sample_period)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 300, 400);
+    lv_obj_t * content = lv_obj_create(cont);
+    lv_obj_set_size(content, 200, 5000);
+    lv_obj_update_layout(cont);
+
+    lv_test_mouse_release();
+    lv_test_wait(50);
+    lv_test_mouse_move_to(150, 350);
+    lv_test_mouse_press();
+    lv_test_wait(50);
+    lv_test_mouse_swipe_to(150, 150, 100, sample_period);
+    lv_test_mouse_release();
+    lv_test_wait(2000);
+
+    int32_t scroll_y = lv_obj_get_scroll_y(cont);
+    lv_obj_delete(cont);
+    return scroll_y;
+}
+
+void test_indev_scroll_throw_sample_rate(void)
+{
+    /*The scroll throw shouldn't depend on how often the touch screen is sampled*/
+    int32_t scroll_1ms = swipe_and_throw(1);
+    int32_t scroll_5ms = swipe_and_throw(5);
+    int32_t scroll_10ms = swipe_and_throw(10);
+
+    /*Scrolled more than the swipe itself because of the throw*/
+    TEST_ASSERT_GREATER_THAN_INT32(250, scroll_1ms);
+    TEST_ASSERT_INT32_WITHIN(scroll_1ms / 10, scroll_1ms, scroll_5ms);
+    TEST_ASSERT_INT32_WITHIN(scroll_1ms / 10, scroll_1ms, scroll_10ms);
+}
+
 #endif
@@ -0,0 +1,221 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define LOG_MAX 16
+
+static char run_log[LOG_MAX + 1];
+static uint32_t run_log_cnt;
+static uint32_t run_cnt;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    lv_memzero(run_log, sizeof(run_log));
+    run_log_cnt = 0;
+    run_cnt = 0;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static void log_cb(lv_timer_t * timer)
+{
+    if(run_log_cnt < LOG_MAX) run_log[run_log_cnt++] = (char)(lv_uintptr_t)lv_timer_get_user_data(timer);
+}
+
+static void count_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+    run_cnt++;
+}
+
+static void delete_self_cb(lv_timer_t * timer)
+{
+    run_cnt++;
+    lv_timer_delete(timer);
+}
+
+static bool timer_exists(lv_timer_t * timer)
+{
+    lv_timer_t * t;
+    for(t = lv_timer_get_next(NULL); t; t = lv_timer_get_next(t)) {
+        if(t == timer) return true;
+    }
+    return false;
+}
+
+void test_timer_order(void)
+{
+    lv_timer_t * a = lv_timer_create(log_cb, 30, (void *)'a');
+    lv_timer_t * b = lv_timer_create(log_cb, 10, (void *)'b');
+    lv_timer_t * c = lv_timer_create(log_cb, 20, (void *)'c');
+
+    /*Nothing is due yet*/
+    lv_tick_inc(5);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_STRING("", run_log);
+
+    /*The due timers run in the order of their due time*/
+    lv_tick_inc(25);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_STRING("bca", run_log);
+
+    lv_timer_delete(a);
+    lv_timer_delete(b);
+    lv_timer_delete(c);
+}
+
+void test_timer_order_same_due(void)
+{
+    lv_timer_t * a = lv_timer_create(log_cb, 10, (void *)'a');
+    lv_timer_t * b = lv_timer_create(log_cb, 10, (void *)'b');
+
+    /*With the same due time the newer timer runs first*/
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_STRING("ba", run_log);
+
+    lv_timer_delete(a);
+    lv_timer_delete(b);
+}
+
+void test_timer_runs_once_per_handler(void)
+{
+    /*A timer which is due again right after running is run only once per call*/
+    lv_timer_t * timer = lv_timer_create(count_cb, 0, NULL);
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+
+    lv_timer_delete(timer);
+}
+
+void test_timer_pause_resume(void)
+{
+    lv_timer_t * timer = lv_timer_create(count_cb, 10, NULL);
+
+    lv_timer_pause(timer);
+    TEST_ASSERT_TRUE(lv_timer_get_paused(timer));
+    lv_tick_inc(50);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt);
+
+    /*The missed period makes it run right after resuming, but only once*/
+    lv_timer_resume(timer);
+    TEST_ASSERT_FALSE(lv_timer_get_paused(timer));
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+
+    lv_timer_delete(timer);
+}
+
+void test_timer_set_period(void)
+{
+    lv_timer_t * timer = lv_timer_create(count_cb, 100, NULL);
+
+    lv_tick_inc(50);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt);
+
+    /*A shorter period makes the timer due from its last run*/
+    lv_timer_set_period(timer, 40);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+
+    /*A longer period postpones it*/
+    lv_timer_set_period(timer, 200);
+    lv_tick_inc(100);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+    lv_tick_inc(100);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+
+    lv_timer_delete(timer);
+}
+
+void test_timer_ready_and_reset(void)
+{
+    lv_timer_t * timer = lv_timer_create(count_cb, 100, NULL);
+
+    lv_timer_ready(timer);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+
+    lv_tick_inc(60);
+    lv_timer_reset(timer);
+    lv_tick_inc(60);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+    lv_tick_inc(40);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+
+    lv_timer_delete(timer);
+}
+
+void test_timer_delete_in_own_cb(void)
+{
+    lv_timer_t * timer = lv_timer_create(delete_self_cb, 10, NULL);
+    lv_timer_t * other = lv_timer_create(log_cb, 10, (void *)'o');
+
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+    TEST_ASSERT_FALSE(timer_exists(timer));
+
+    /*The other due timer still runs in the same call and later*/
+    TEST_ASSERT_EQUAL_STRING("o", run_log);
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+    TEST_ASSERT_EQUAL_STRING("oo", run_log);
+
+    lv_timer_delete(other);
+}
+
+void test_timer_repeat_count(void)
+{
+    lv_timer_t * timer = lv_timer_create(count_cb, 10, NULL);
+    lv_timer_set_repeat_count(timer, 3);
+
+    lv_test_wait(100);
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt);
+    TEST_ASSERT_FALSE(timer_exists(timer));
+}
+
+void test_timer_repeat_count_no_auto_delete(void)
+{
+    lv_timer_t * timer = lv_timer_create(count_cb, 10, NULL);
+    lv_timer_set_repeat_count(timer, 2);
+    lv_timer_set_auto_delete(timer, false);
+
+    lv_test_wait(100);
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+    TEST_ASSERT_TRUE(timer_exists(timer));
+    TEST_ASSERT_TRUE(lv_timer_get_paused(timer));
+
+    /*Setting the repeat count to 0 deletes the timer in the next call*/
+    lv_timer_set_auto_delete(timer, true);
+    lv_timer_resume(timer);
+    lv_timer_set_repeat_count(timer, 0);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+    TEST_ASSERT_FALSE(timer_exists(timer));
+}
+
+#endif
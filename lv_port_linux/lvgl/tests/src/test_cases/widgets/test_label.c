@@ -850,4 +850,293 @@ void test_label_setting_text_disables_translation(void)
     TEST_ASSERT_EQUAL_STRING(lv_label_get_text(label), "Der Tiger");
 }
 
+#if LV_LABEL_LINE_TABLE
+void test_label_line_table(void)
+{
+    lv_obj_set_width(long_label, 150);
+    lv_obj_set_style_text_align(long_label, LV_TEXT_ALIGN_CENTER, 0);
+    lv_refr_now(NULL);
+
+    /*The lines are found when the text is refreshed*/
+    lv_label_t * l = (lv_label_t *)long_label;
+    const lv_font_t * font = lv_obj_get_style_text_font(long_label, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL_PTR(l->text, l->lines.text);
+    TEST_ASSERT_GREATER_THAN(1, l->lines.line_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, l->lines.lines[0].start);
+    TEST_ASSERT_EQUAL_UINT32(strlen(long_text), l->lines.lines[l->lines.line_cnt].start);
+
+    lv_text_attributes_t attributes = {0};
+    for(uint32_t i = 0; i < l->lines.line_cnt; i++) {
+        uint32_t start = l->lines.lines[i].start;
+        uint32_t len = l->lines.lines[i + 1].start - start;
+        TEST_ASSERT_GREATER_THAN(0, len);
+        TEST_ASSERT_EQUAL_INT32(lv_text_get_width(&long_text[start], len, font, &attributes), l->lines.lines[i].width);
+    }
+
+    /*The lines are found again only if the width changes*/
+    uint32_t line_cnt = l->lines.line_cnt;
+    lv_obj_set_width(long_label, 100);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(line_cnt, l->lines.line_cnt);
+
+    /*The lines are found again when the text changes*/
+    lv_label_set_text(long_label, "Hello\nworld");
+    TEST_ASSERT_EQUAL_PTR(l->text, l->lines.text);
+    TEST_ASSERT_EQUAL_UINT32(2, l->lines.line_cnt);
+    TEST_ASSERT_EQUAL_UINT32(6, l->lines.lines[1].start);
+}
+
+void test_label_line_table_content_size(void)
+{
+    lv_obj_t * fit_label = lv_label_create(active_screen);
+    lv_label_set_text(fit_label, "Hello\nworld");
+    lv_obj_update_layout(fit_label);
+    lv_label_t * l = (lv_label_t *)fit_label;
+    TEST_ASSERT_EQUAL_PTR(l->text, l->lines.text);
+
+    /*The size of a label with content width is calculated from its lines without measuring the text again*/
+    l->lines.lines[0].width += 100;
+    l->invalid_size_cache = true;
+    lv_obj_refresh_self_size(fit_label);
+    lv_obj_update_layout(fit_label);
+    TEST_ASSERT_EQUAL_INT32(l->lines.lines[0].width, l->size_cache.x);
+}
+
+static void remove_lines_event_cb(lv_event_t * e)
+{
+    lv_draw_label_dsc_t * dsc = lv_draw_task_get_label_dsc(lv_event_get_draw_task(e));
+    if(dsc) dsc->lines = NULL;
+}
+
+static lv_draw_buf_t * take_line_table_snapshot(lv_obj_t * cont, lv_obj_t * scrolled_label, lv_text_align_t align)
+{
+    lv_obj_set_style_text_align(scrolled_label, align, 0);
+    lv_refr_now(NULL);
+    return lv_snapshot_take(cont, LV_COLOR_FORMAT_ARGB8888);
+}
+
+void test_label_line_table_draw(void)
+{
+    /*The label starts above its parent so the drawing starts in the middle of the text*/
+    lv_obj_t * cont = lv_obj_create(active_screen);
+    lv_obj_set_size(cont, 200, 100);
+    lv_obj_set_style_pad_all(cont, 0, 0);
+    lv_obj_remove_flag(cont, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_t * scrolled_label = lv_label_create(cont);
+    lv_obj_set_width(scrolled_label, 200);
+    lv_obj_set_y(scrolled_label, -45);
+    lv_obj_set_style_text_line_space(scrolled_label, 3, 0);
+    lv_obj_set_style_text_decor(scrolled_label, LV_TEXT_DECOR_UNDERLINE, 0);
+    lv_label_set_text(scrolled_label, long_text);
+    lv_label_ins_text(scrolled_label, LV_LABEL_POS_LAST, long_text_multiline);
+
+    const lv_text_align_t aligns[] = {LV_TEXT_ALIGN_LEFT, LV_TEXT_ALIGN_CENTER, LV_TEXT_ALIGN_RIGHT};
+    for(uint32_t i = 0; i < sizeof(aligns) / sizeof(aligns[0]); i++) {
+        lv_obj_remove_flag(scrolled_label, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+        lv_obj_remove_event_cb(scrolled_label, remove_lines_event_cb);
+        lv_draw_buf_t * with_lines = take_line_table_snapshot(cont, scrolled_label, aligns[i]);
+        TEST_ASSERT_NOT_NULL(with_lines);
+
+        /*Draw again without the line table*/
+        lv_obj_add_flag(scrolled_label, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+        lv_obj_add_event_cb(scrolled_label, remove_lines_event_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+        lv_draw_buf_t * without_lines = take_line_table_snapshot(cont, scrolled_label, aligns[i]);
+        TEST_ASSERT_NOT_NULL(without_lines);
+
+        TEST_ASSERT_EQUAL_UINT32(with_lines->data_size, without_lines->data_size);
+        for(uint32_t y = 0; y < with_lines->header.h; y++) {
+            TEST_ASSERT_EQUAL_MEMORY(lv_draw_buf_goto_xy(with_lines, 0, y), lv_draw_buf_goto_xy(without_lines, 0, y),
+                                     with_lines->header.w * 4);
+        }
+
+        lv_draw_buf_destroy(with_lines);
+        lv_draw_buf_destroy(without_lines);
+    }
+}
+
+/*Compare the edited line table with a line table built from scratch*/
+static void assert_lines_rebuilt(lv_obj_t * obj)
+{
+    lv_label_t * l = (lv_label_t *)obj;
+    TEST_ASSERT_EQUAL_PTR(l->text, l->lines.text);
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.text = l->text;
+    dsc.font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    dsc.letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+    lv_area_t coords;
+    lv_obj_get_content_coords(obj, &coords);
+
+    lv_draw_label_lines_t rebuilt;
+    lv_memzero(&rebuilt, sizeof(rebuilt));
+    lv_draw_label_lines_update(&rebuilt, &dsc, &coords);
+
+    TEST_ASSERT_EQUAL_UINT32(rebuilt.line_cnt, l->lines.line_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(rebuilt.lines, l->lines.lines, (rebuilt.line_cnt + 1) * sizeof(lv_draw_label_line_t));
+    lv_draw_label_lines_reset(&rebuilt);
+}
+
+void test_label_line_table_edit(void)
+{
+    lv_obj_set_width(long_label, 120);
+    lv_obj_update_layout(long_label);
+    lv_label_set_text(long_label, long_text_multiline);
+    lv_label_ins_text(long_label, LV_LABEL_POS_LAST, long_text);
+    lv_label_t * l = (lv_label_t *)long_label;
+
+    /*Pseudo random edits in every paragraph*/
+    uint32_t seed = 1;
+    const char * ins_txts[] = {"a", " ", "\n", "Hello world ", "x\ny", "aaaaaaaaaaaaaaaaaaaaaaaaaaaa"};
+    for(uint32_t i = 0; i < 100; i++) {
+        seed = seed * 1103515245 + 12345;
+        uint32_t char_cnt = lv_text_get_encoded_length(l->text);
+        uint32_t pos = (seed >> 8) % (char_cnt + 1);
+        if(i % 3 == 2) lv_label_cut_text(long_label, pos, (seed >> 4) % 8);
+        else lv_label_ins_text(long_label, pos, ins_txts[(seed >> 16) % (sizeof(ins_txts) / sizeof(ins_txts[0]))]);
+
+        assert_lines_rebuilt(long_label);
+    }
+
+    /*The size is the same as measuring the text*/
+    lv_obj_update_layout(long_label);
+    lv_point_t size;
+    lv_text_attributes_t attributes = {0};
+    attributes.max_width = lv_obj_get_content_width(long_label);
+    lv_text_get_size_attributes(&size, l->text, lv_obj_get_style_text_font(long_label, 0), &attributes);
+    TEST_ASSERT_EQUAL_INT32(size.x, l->text_size.x);
+    TEST_ASSERT_EQUAL_INT32(size.y, l->text_size.y);
+    TEST_ASSERT_EQUAL_INT32(size.y, lv_obj_get_height(long_label));
+}
+
+void test_label_line_table_edit_text(void)
+{
+    /*Edit a text directly to test the insertions also when the label always finds all the lines*/
+    static char buf[1024];
+    lv_strcpy(buf, long_text_multiline);
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.text = buf;
+    dsc.font = lv_obj_get_style_text_font(long_label, LV_PART_MAIN);
+    lv_area_t coords = {0, 0, 99, 999};
+
+    lv_draw_label_lines_t lines;
+    lv_draw_label_lines_t rebuilt;
+    lv_memzero(&lines, sizeof(lines));
+    lv_memzero(&rebuilt, sizeof(rebuilt));
+    lv_draw_label_lines_update(&lines, &dsc, &coords);
+
+    uint32_t seed = 7;
+    const char * ins_txts[] = {"b", " ", "\n", "Hello world ", "x\ny", "bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb"};
+    for(uint32_t i = 0; i < 100; i++) {
+        seed = seed * 1103515245 + 12345;
+        uint32_t len = lv_strlen(buf);
+        uint32_t pos = (seed >> 8) % (len + 1);
+        if(i % 3 == 2) {
+            uint32_t cut = LV_MIN((seed >> 4) % 8, len - pos);
+            lv_memmove(buf + pos, buf + pos + cut, len - pos - cut + 1);
+            lv_draw_label_lines_edit(&lines, buf, pos, -(int32_t)cut);
+        }
+        else {
+            const char * ins = ins_txts[(seed >> 16) % (sizeof(ins_txts) / sizeof(ins_txts[0]))];
+            uint32_t ins_len = lv_strlen(ins);
+            if(len + ins_len >= sizeof(buf)) continue;
+            lv_memmove(buf + pos + ins_len, buf + pos, len - pos + 1);
+            lv_memcpy(buf + pos, ins, ins_len);
+            lv_draw_label_lines_edit(&lines, buf, pos, ins_len);
+        }
+
+        lv_draw_label_lines_update(&rebuilt, &dsc, &coords);
+        TEST_ASSERT_EQUAL_PTR(buf, lines.text);
+        TEST_ASSERT_EQUAL_UINT32(rebuilt.line_cnt, lines.line_cnt);
+        TEST_ASSERT_EQUAL_MEMORY(rebuilt.lines, lines.lines, (rebuilt.line_cnt + 1) * sizeof(lv_draw_label_line_t));
+        lv_draw_label_lines_reset(&rebuilt);
+    }
+
+    lv_draw_label_lines_reset(&lines);
+}
+
+void test_label_append_text(void)
+{
+    lv_obj_set_width(long_label, 150);
+    lv_label_set_text(long_label, "");
+    lv_label_set_append_limit(long_label, 200);
+    TEST_ASSERT_EQUAL_UINT32(200, lv_label_get_append_limit(long_label));
+
+    char buf[64];
+    size_t prev_len = 0;
+    uint32_t trim_cnt = 0;
+    for(uint32_t i = 0; i < 50; i++) {
+        lv_snprintf(buf, sizeof(buf), "Log line %" LV_PRIu32 " with some long text\n", i);
+        lv_label_append_text(long_label, buf);
+
+        /*Only whole lines are removed*/
+        const char * text = lv_label_get_text(long_label);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(200, strlen(text));
+        TEST_ASSERT_EQUAL_STRING(buf, text + strlen(text) - strlen(buf));
+        TEST_ASSERT_EQUAL_STRING_LEN("Log line ", text, 9);
+        if(strlen(text) < prev_len + strlen(buf)) trim_cnt++;
+        prev_len = strlen(text);
+
+        assert_lines_rebuilt(long_label);
+    }
+
+    /*The text is trimmed to 3/4 of the limit at once so not for every line*/
+    TEST_ASSERT_GREATER_THAN_UINT32(0, trim_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(25, trim_cnt);
+
+    /*Static text can't be appended*/
+    lv_label_set_text_static(label, "static");
+    lv_label_append_text(label, "text");
+    TEST_ASSERT_EQUAL_STRING("static", lv_label_get_text(label));
+}
+
+void test_label_append_text_trim_all(void)
+{
+    lv_obj_set_width(long_label, 150);
+    lv_label_set_text(long_label, "");
+    lv_label_set_append_limit(long_label, 20);
+
+    /*The only line break is the last character so the whole text is old*/
+    lv_label_append_text(long_label, "A single long log line\n");
+    TEST_ASSERT_EQUAL_STRING("", lv_label_get_text(long_label));
+    assert_lines_rebuilt(long_label);
+
+    lv_label_append_text(long_label, "abc\n");
+    TEST_ASSERT_EQUAL_STRING("abc\n", lv_label_get_text(long_label));
+    assert_lines_rebuilt(long_label);
+
+    /*Cut the text in place*/
+    lv_label_cut_text(long_label, 1, 2);
+    TEST_ASSERT_EQUAL_STRING("a\n", lv_label_get_text(long_label));
+    assert_lines_rebuilt(long_label);
+}
+
+void test_label_textarea_edit(void)
+{
+    lv_obj_t * ta = lv_textarea_create(active_screen);
+    lv_obj_set_size(ta, 200, 300);
+    lv_textarea_set_text(ta, long_text_multiline);
+    lv_textarea_set_cursor_pos(ta, 30);
+    lv_textarea_add_text(ta, "typed text ");
+    lv_textarea_delete_char(ta);
+    lv_textarea_delete_char(ta);
+    lv_textarea_add_char(ta, '\n');
+
+    lv_obj_t * ta_label = lv_textarea_get_label(ta);
+    assert_lines_rebuilt(ta_label);
+
+    /*The cursor is at the same position as without the line table*/
+    lv_point_t pos;
+    lv_label_get_letter_pos(ta_label, lv_textarea_get_cursor_pos(ta), &pos);
+    lv_label_set_long_mode(ta_label, LV_LABEL_LONG_MODE_DOTS);
+    lv_point_t pos_no_lines;
+    lv_label_get_letter_pos(ta_label, lv_textarea_get_cursor_pos(ta), &pos_no_lines);
+    TEST_ASSERT_EQUAL_INT32(pos_no_lines.x, pos.x);
+    TEST_ASSERT_EQUAL_INT32(pos_no_lines.y, pos.y);
+    TEST_ASSERT_GREATER_THAN_INT32(0, pos.y);
+}
+#endif
+
 #endif
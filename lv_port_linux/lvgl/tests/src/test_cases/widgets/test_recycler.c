@@ -0,0 +1,286 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define ITEM_CNT 100000
+
+static lv_obj_t * recycler = NULL;
+static uint32_t create_cnt;
+static uint32_t bind_cnt;
+static uint32_t tall_item_step;
+static const char * item_prefix;
+
+static lv_obj_t * item_create_cb(lv_obj_t * obj)
+{
+    create_cnt++;
+    lv_obj_t * item = lv_label_create(obj);
+    lv_obj_set_width(item, lv_pct(100));
+    return item;
+}
+
+static void item_bind_cb(lv_obj_t * obj, lv_obj_t * item, uint32_t index)
+{
+    LV_UNUSED(obj);
+    bind_cnt++;
+    /*Some items have 3 lines, but not the first one which is used as estimation*/
+    if(tall_item_step && index % tall_item_step == tall_item_step - 1) {
+        lv_label_set_text_fmt(item, "%s %" LV_PRIu32 "\nsecond line\nthird line", item_prefix, index);
+    }
+    else {
+        lv_label_set_text_fmt(item, "%s %" LV_PRIu32, item_prefix, index);
+    }
+}
+
+static void create_items(uint32_t cnt)
+{
+    lv_recycler_set_item_cb(recycler, item_create_cb, item_bind_cb);
+    lv_recycler_set_item_count(recycler, cnt);
+    lv_obj_update_layout(recycler);
+}
+
+/* Check that the visible items are bound to the correct data items and they follow each other */
+static void check_visible_items(void)
+{
+    uint32_t first = lv_recycler_get_first_visible_index(recycler);
+    uint32_t last = lv_recycler_get_last_visible_index(recycler);
+    TEST_ASSERT_NOT_EQUAL_UINT32(LV_RECYCLER_INDEX_NONE, first);
+    TEST_ASSERT_NOT_EQUAL_UINT32(LV_RECYCLER_INDEX_NONE, last);
+
+    lv_obj_update_layout(recycler);
+
+    int32_t gap = lv_obj_get_style_pad_row(recycler, LV_PART_MAIN);
+    char buf[64];
+    uint32_t i;
+    for(i = first; i <= last; i++) {
+        lv_obj_t * item = lv_recycler_get_item(recycler, i);
+        TEST_ASSERT_NOT_NULL(item);
+        TEST_ASSERT_EQUAL_UINT32(i, lv_recycler_get_item_index(recycler, item));
+        TEST_ASSERT_FALSE(lv_obj_has_flag(item, LV_OBJ_FLAG_HIDDEN));
+
+        lv_snprintf(buf, sizeof(buf), "%s %" LV_PRIu32, item_prefix, i);
+        TEST_ASSERT_EQUAL_STRING_LEN(buf, lv_label_get_text(item), lv_strlen(buf));
+
+        if(i > first) {
+            lv_obj_t * prev = lv_recycler_get_item(recycler, i - 1);
+            TEST_ASSERT_EQUAL_INT32(prev->coords.y2 + 1 + gap, item->coords.y1);
+        }
+    }
+
+    /*The visible area is covered*/
+    TEST_ASSERT_TRUE(first == 0 || lv_recycler_get_item(recycler, first)->coords.y1 <= recycler->coords.y1);
+    TEST_ASSERT_TRUE(last == lv_recycler_get_item_count(recycler) - 1 ||
+                     lv_recycler_get_item(recycler, last)->coords.y2 + gap >= recycler->coords.y2);
+}
+
+void setUp(void)
+{
+    recycler = lv_recycler_create(lv_screen_active());
+    lv_obj_set_size(recycler, 300, 400);
+    create_cnt = 0;
+    bind_cnt = 0;
+    tall_item_step = 0;
+    item_prefix = "Item";
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_recycler_should_create_only_the_visible_items(void)
+{
+    create_items(ITEM_CNT);
+
+    TEST_ASSERT_EQUAL_UINT32(ITEM_CNT, lv_recycler_get_item_count(recycler));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_recycler_get_first_visible_index(recycler));
+    TEST_ASSERT_LESS_THAN_UINT32(30, create_cnt);
+    TEST_ASSERT_EQUAL_UINT32(create_cnt, lv_obj_get_child_count(recycler));
+    TEST_ASSERT_NULL(lv_recycler_get_item(recycler, ITEM_CNT - 1));
+    check_visible_items();
+
+    /*The height of the first item is used as estimation*/
+    int32_t item_h = lv_obj_get_height(lv_recycler_get_item(recycler, 0));
+    int32_t gap = lv_obj_get_style_pad_row(recycler, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL_INT32(item_h, lv_recycler_get_item_height(recycler));
+    TEST_ASSERT_EQUAL_INT32(ITEM_CNT * (item_h + gap) - gap, lv_obj_get_self_height(recycler));
+}
+
+void test_recycler_should_reuse_the_items_on_scroll(void)
+{
+    create_items(ITEM_CNT);
+    uint32_t create_cnt_start = create_cnt;
+
+    uint32_t i;
+    for(i = 0; i < 50; i++) {
+        lv_obj_scroll_by(recycler, 0, -37, LV_ANIM_OFF);
+        lv_refr_now(NULL);
+        check_visible_items();
+    }
+
+    /*Without the top padding an item can be partially visible at both ends*/
+    TEST_ASSERT_GREATER_THAN_UINT32(0, lv_recycler_get_first_visible_index(recycler));
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(create_cnt_start + 2, create_cnt);
+
+    /*Jump far away*/
+    lv_obj_scroll_to_y(recycler, lv_obj_get_self_height(recycler) / 2, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    check_visible_items();
+    TEST_ASSERT_GREATER_THAN_UINT32(ITEM_CNT / 3, lv_recycler_get_first_visible_index(recycler));
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(create_cnt_start + 2, create_cnt);
+}
+
+void test_recycler_should_measure_items_with_different_heights(void)
+{
+    tall_item_step = 3;
+    create_items(ITEM_CNT);
+
+    int32_t self_h_start = lv_obj_get_self_height(recycler);
+
+    /*The tall items are measured when they get visible and the list grows*/
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_obj_scroll_by(recycler, 0, -100, LV_ANIM_OFF);
+        lv_refr_now(NULL);
+        check_visible_items();
+    }
+    TEST_ASSERT_GREATER_THAN_INT32(self_h_start, lv_obj_get_self_height(recycler));
+
+    /*Scrolling back keeps the items in place*/
+    for(i = 0; i < 20; i++) {
+        lv_obj_scroll_by(recycler, 0, 100, LV_ANIM_OFF);
+        lv_refr_now(NULL);
+        check_visible_items();
+    }
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_scroll_y(recycler));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_recycler_get_first_visible_index(recycler));
+}
+
+void test_recycler_should_scroll_to_item(void)
+{
+    tall_item_step = 2;
+    create_items(ITEM_CNT);
+
+    lv_recycler_scroll_to_item(recycler, 5001, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    check_visible_items();
+
+    /*The item is at the top of the content area*/
+    lv_obj_t * item = lv_recycler_get_item(recycler, 5001);
+    TEST_ASSERT_NOT_NULL(item);
+    TEST_ASSERT_EQUAL_INT32(recycler->coords.y1 + lv_obj_get_style_space_top(recycler, LV_PART_MAIN), item->coords.y1);
+
+    /*Scroll up to an item with an estimated height above the visible ones*/
+    lv_recycler_scroll_to_item(recycler, 4000, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    check_visible_items();
+    item = lv_recycler_get_item(recycler, 4000);
+    TEST_ASSERT_NOT_NULL(item);
+    TEST_ASSERT_EQUAL_INT32(recycler->coords.y1 + lv_obj_get_style_space_top(recycler, LV_PART_MAIN), item->coords.y1);
+
+    /*The end of the list can't be scrolled to the top*/
+    lv_recycler_scroll_to_item(recycler, ITEM_CNT - 1, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    check_visible_items();
+    TEST_ASSERT_EQUAL_UINT32(ITEM_CNT - 1, lv_recycler_get_last_visible_index(recycler));
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_scroll_bottom(recycler));
+}
+
+void test_recycler_should_scroll_to_item_with_animation(void)
+{
+    tall_item_step = 2;
+    create_items(ITEM_CNT);
+
+    /*The estimated position is corrected when the animation ends*/
+    lv_recycler_scroll_to_item(recycler, 301, LV_ANIM_ON);
+    lv_test_wait(2000);
+    check_visible_items();
+
+    lv_obj_t * item = lv_recycler_get_item(recycler, 301);
+    TEST_ASSERT_NOT_NULL(item);
+    TEST_ASSERT_EQUAL_INT32(recycler->coords.y1 + lv_obj_get_style_space_top(recycler, LV_PART_MAIN), item->coords.y1);
+}
+
+void test_recycler_should_handle_item_count_change(void)
+{
+    create_items(ITEM_CNT);
+    lv_recycler_scroll_to_item(recycler, ITEM_CNT - 1, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+
+    /*Removing data items scrolls back to the new end*/
+    lv_recycler_set_item_count(recycler, 100);
+    lv_refr_now(NULL);
+    check_visible_items();
+    TEST_ASSERT_EQUAL_UINT32(99, lv_recycler_get_last_visible_index(recycler));
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_scroll_bottom(recycler));
+
+    /*Adding data items keeps the position*/
+    int32_t scroll_y = lv_obj_get_scroll_y(recycler);
+    lv_recycler_set_item_count(recycler, 200);
+    lv_refr_now(NULL);
+    check_visible_items();
+    TEST_ASSERT_EQUAL_INT32(scroll_y, lv_obj_get_scroll_y(recycler));
+    TEST_ASSERT_GREATER_THAN_INT32(0, lv_obj_get_scroll_bottom(recycler));
+
+    /*No data items*/
+    lv_recycler_set_item_count(recycler, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(LV_RECYCLER_INDEX_NONE, lv_recycler_get_first_visible_index(recycler));
+    TEST_ASSERT_EQUAL_UINT32(LV_RECYCLER_INDEX_NONE, lv_recycler_get_last_visible_index(recycler));
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_scroll_y(recycler));
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(recycler); i++) {
+        TEST_ASSERT_TRUE(lv_obj_has_flag(lv_obj_get_child(recycler, i), LV_OBJ_FLAG_HIDDEN));
+    }
+}
+
+void test_recycler_should_bind_the_refreshed_items_again(void)
+{
+    create_items(ITEM_CNT);
+    uint32_t bind_cnt_start = bind_cnt;
+
+    /*Nothing changes without scrolling*/
+    lv_obj_invalidate(recycler);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(bind_cnt_start, bind_cnt);
+
+    item_prefix = "Changed";
+    lv_recycler_refresh_items(recycler, 0, ITEM_CNT);
+    uint32_t visible_cnt = lv_recycler_get_last_visible_index(recycler) - lv_recycler_get_first_visible_index(recycler) + 1;
+    TEST_ASSERT_EQUAL_UINT32(bind_cnt_start + visible_cnt, bind_cnt);
+    check_visible_items();
+}
+
+void test_recycler_should_handle_deleted_items(void)
+{
+    create_items(ITEM_CNT);
+    uint32_t create_cnt_start = create_cnt;
+
+    lv_obj_delete(lv_recycler_get_item(recycler, 1));
+    TEST_ASSERT_NULL(lv_recycler_get_item(recycler, 1));
+
+    /*A new item is created for the data item*/
+    lv_recycler_refresh_items(recycler, 1, 1);
+    TEST_ASSERT_EQUAL_UINT32(create_cnt_start + 1, create_cnt);
+    check_visible_items();
+}
+
+void test_recycler_should_measure_again_on_width_change(void)
+{
+    item_prefix = "A long text which wraps on a narrow recycler";
+    create_items(ITEM_CNT);
+    int32_t item_h = lv_recycler_get_item_height(recycler);
+
+    lv_obj_set_width(recycler, 100);
+    lv_obj_update_layout(recycler);
+    check_visible_items();
+    TEST_ASSERT_GREATER_THAN_INT32(item_h, lv_recycler_get_item_height(recycler));
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_height(lv_recycler_get_item(recycler, 0)), lv_recycler_get_item_height(recycler));
+
+    /*The estimation can be set too*/
+    lv_recycler_set_item_height(recycler, 100);
+    TEST_ASSERT_EQUAL_INT32(100, lv_recycler_get_item_height(recycler));
+}
+
+#endif
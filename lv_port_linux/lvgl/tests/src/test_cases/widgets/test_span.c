@@ -603,4 +603,53 @@ void test_spangroup_less_letter_overflow(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/span_15.png");
 }
 
+void test_spangroup_layout_reuse(void)
+{
+    active_screen = lv_screen_active();
+    spangroup = lv_spangroup_create(active_screen);
+    lv_obj_set_width(spangroup, 150);
+
+    lv_span_t * span_1 = lv_spangroup_add_span(spangroup);
+    lv_span_set_text_static(span_1, "The layout of the spans ");
+    lv_span_t * span_2 = lv_spangroup_add_span(spangroup);
+    lv_span_set_text_static(span_2, "is kept between the redraws.");
+    lv_style_set_text_font(lv_span_get_style(span_2), &lv_font_montserrat_20);
+    lv_refr_now(NULL);
+
+    lv_spangroup_t * spans = (lv_spangroup_t *)spangroup;
+    const lv_span_layout_t * layout = &spans->layout;
+    TEST_ASSERT_TRUE(layout->valid);
+    TEST_ASSERT_EQUAL_INT32(150, layout->width);
+    uint32_t line_cnt = layout->line_cnt;
+    TEST_ASSERT_GREATER_THAN_UINT32(1, line_cnt);
+    int32_t height = lv_obj_get_height(spangroup);
+
+    /*Redrawing and changing only the height keep the layout*/
+    lv_obj_invalidate(spangroup);
+    lv_refr_now(NULL);
+    lv_obj_set_height(spangroup, 200);
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(layout->valid);
+    TEST_ASSERT_EQUAL_UINT32(line_cnt, layout->line_cnt);
+
+    /*The span is hit tested on the layout*/
+    lv_area_t content_coords;
+    lv_obj_get_content_coords(spangroup, &content_coords);
+    lv_point_t p = {content_coords.x1 + 2, content_coords.y1 + 2};
+    TEST_ASSERT_EQUAL_PTR(span_1, lv_spangroup_get_span_by_point(spangroup, &p));
+
+    /*Setting the text without the spangroup still updates the layout*/
+    lv_obj_set_height(spangroup, LV_SIZE_CONTENT);
+    lv_span_set_text(span_2, "is kept between the redraws, but it's updated when the text changes.");
+    TEST_ASSERT_GREATER_THAN_INT32(height, lv_spangroup_get_expand_height(spangroup, 150));
+    TEST_ASSERT_GREATER_THAN_UINT32(line_cnt, layout->line_cnt);
+
+    /*A new width breaks the lines again*/
+    line_cnt = layout->line_cnt;
+    lv_obj_set_width(spangroup, 300);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_INT32(300, layout->width);
+    TEST_ASSERT_LESS_THAN_UINT32(line_cnt, layout->line_cnt);
+}
+
 #endif
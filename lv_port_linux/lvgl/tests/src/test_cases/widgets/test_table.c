@@ -350,4 +350,172 @@ void test_table_cell_select_should_not_allow_set_on_table_with_no_rows(void)
     TEST_ASSERT_EQUAL_UINT32(LV_TABLE_CELL_NONE, selected_column);
 }
 
+static uint32_t g_cell_value_cb_cnt;
+
+static const char * virtual_cell_value_cb(lv_obj_t * obj, uint32_t row, uint32_t col)
+{
+    LV_UNUSED(obj);
+    static char buf[32];
+    g_cell_value_cb_cnt++;
+    if(col == 1 && row % 7 == 3) lv_snprintf(buf, sizeof(buf), "Row %" LV_PRIu32 "\nsecond line", row);
+    else lv_snprintf(buf, sizeof(buf), "%" LV_PRIu32 ".%" LV_PRIu32, row, col);
+    return buf;
+}
+
+static void create_virtual_table(uint32_t row_cnt)
+{
+    lv_obj_set_size(table, 300, 200);
+    lv_table_set_column_count(table, 3);
+    lv_table_set_row_count(table, row_cnt);
+    lv_table_set_cell_value_cb(table, virtual_cell_value_cb);
+    lv_obj_update_layout(table);
+}
+
+/*The height of all rows if the measured rows have their real height and the others the estimated one*/
+static int32_t get_virtual_table_height(void)
+{
+    lv_table_t * t = (lv_table_t *)table;
+    int32_t one_line_h = t->row_h_est;
+    int32_t two_line_h = one_line_h + lv_font_get_line_height(lv_obj_get_style_text_font(table, LV_PART_ITEMS)) +
+                         lv_obj_get_style_text_line_space(table, LV_PART_ITEMS);
+    int32_t h = 0;
+    for(uint32_t i = 0; i < t->row_cnt; i++) {
+        bool measured = lv_fenwick_is_measured(&t->row_h_tree, i);
+        h += (measured && i % 7 == 3) ? two_line_h : one_line_h;
+    }
+    return h;
+}
+
+/*The top of a row if the measured rows have their real height and the others the estimated one*/
+static int32_t get_virtual_row_y(uint32_t row)
+{
+    lv_table_t * t = (lv_table_t *)table;
+    int32_t one_line_h = t->row_h_est;
+    int32_t two_line_h = one_line_h + lv_font_get_line_height(lv_obj_get_style_text_font(table, LV_PART_ITEMS)) +
+                         lv_obj_get_style_text_line_space(table, LV_PART_ITEMS);
+    int32_t y = 0;
+    for(uint32_t i = 0; i < row; i++) {
+        bool measured = lv_fenwick_is_measured(&t->row_h_tree, i);
+        y += (measured && i % 7 == 3) ? two_line_h : one_line_h;
+    }
+    return y;
+}
+
+void test_table_virtual_should_get_cell_values_from_cb(void)
+{
+    lv_table_set_cell_value(table, 0, 0, "stored");
+    create_virtual_table(100000);
+
+    TEST_ASSERT_EQUAL_PTR(virtual_cell_value_cb, lv_table_get_cell_value_cb(table));
+    TEST_ASSERT_EQUAL_UINT32(100000, lv_table_get_row_count(table));
+    TEST_ASSERT_EQUAL_STRING("0.0", lv_table_get_cell_value(table, 0, 0));
+    TEST_ASSERT_EQUAL_STRING("99999.2", lv_table_get_cell_value(table, 99999, 2));
+
+    /*The cells can't be set*/
+    lv_table_set_cell_value(table, 1, 1, "x");
+    TEST_ASSERT_EQUAL_STRING("1.1", lv_table_get_cell_value(table, 1, 1));
+    TEST_ASSERT_FALSE(lv_table_has_cell_ctrl(table, 1, 1, LV_TABLE_CELL_CTRL_MERGE_RIGHT));
+
+    /*Back to normal mode with empty cells*/
+    lv_table_set_cell_value_cb(table, NULL);
+    TEST_ASSERT_EQUAL_STRING("", lv_table_get_cell_value(table, 1, 1));
+    lv_table_set_cell_value(table, 1, 1, "x");
+    TEST_ASSERT_EQUAL_STRING("x", lv_table_get_cell_value(table, 1, 1));
+}
+
+void test_table_virtual_should_measure_only_the_visible_rows(void)
+{
+    create_virtual_table(100000);
+    TEST_ASSERT_EQUAL_INT32(get_virtual_table_height(), lv_obj_get_self_height(table) + 1);
+
+    /*Only the cells of the visible rows are read*/
+    g_cell_value_cb_cnt = 0;
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, g_cell_value_cb_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(100, g_cell_value_cb_cnt);
+
+    g_cell_value_cb_cnt = 0;
+    lv_obj_scroll_to_y(table, 1000000, LV_ANIM_OFF);
+    lv_obj_scroll_to_y(table, 500000, LV_ANIM_OFF);
+    lv_obj_scroll_by(table, 0, 150, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    TEST_ASSERT_LESS_THAN_UINT32(300, g_cell_value_cb_cnt);
+    TEST_ASSERT_EQUAL_INT32(get_virtual_table_height(), lv_obj_get_self_height(table) + 1);
+
+    /*The size of the tree is changed too*/
+    lv_table_set_row_count(table, 123457);
+    TEST_ASSERT_EQUAL_INT32(get_virtual_table_height(), lv_obj_get_self_height(table) + 1);
+    lv_obj_scroll_to_y(table, 2000000, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_INT32(get_virtual_table_height(), lv_obj_get_self_height(table) + 1);
+    lv_table_set_row_count(table, 70001);
+    lv_obj_scroll_to_y(table, 0, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_INT32(get_virtual_table_height(), lv_obj_get_self_height(table) + 1);
+
+    /*The changed rows are measured again*/
+    lv_table_refresh_rows(table, 0, 1000);
+    TEST_ASSERT_EQUAL_INT32(get_virtual_table_height(), lv_obj_get_self_height(table) + 1);
+}
+
+void test_table_virtual_should_keep_the_rows_in_place_when_scrolling_up(void)
+{
+    create_virtual_table(1000);
+    lv_obj_scroll_to_y(table, 1000000, LV_ANIM_OFF);
+    lv_obj_update_layout(table);
+
+    /*The rows above are estimated only so they are measured while scrolling up.
+     *The visible rows shall move only by the scrolled distance.*/
+    uint32_t step_cnt = 0;
+    while(lv_obj_get_scroll_y(table) >= 30) {
+        int32_t scroll_y = lv_obj_get_scroll_y(table);
+        uint32_t row = 0;
+        while(get_virtual_row_y(row + 1) <= scroll_y + 100) row++;
+        int32_t pos = get_virtual_row_y(row) - scroll_y;
+
+        lv_obj_scroll_by(table, 0, 30, LV_ANIM_OFF);
+        TEST_ASSERT_EQUAL_INT32(pos + 30, get_virtual_row_y(row) - lv_obj_get_scroll_y(table));
+        TEST_ASSERT_EQUAL_INT32(get_virtual_table_height(), lv_obj_get_self_height(table) + 1);
+        step_cnt++;
+    }
+
+    /*The first row is reached*/
+    TEST_ASSERT_GREATER_THAN_UINT32(100, step_cnt);
+    lv_obj_scroll_to_y(table, 0, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_scroll_y(table));
+}
+
+void test_table_virtual_should_be_drawn_as_a_normal_table(void)
+{
+    lv_obj_t * normal_table = lv_table_create(scr);
+    lv_obj_set_size(normal_table, 300, 200);
+    for(uint32_t row = 0; row < 300; row++) {
+        for(uint32_t col = 0; col < 3; col++) {
+            lv_table_set_cell_value(normal_table, row, col, virtual_cell_value_cb(normal_table, row, col));
+        }
+    }
+    create_virtual_table(300);
+
+    lv_obj_set_y(normal_table, 200);
+    lv_obj_scroll_to_y(normal_table, 1000, LV_ANIM_OFF);
+
+    /*Scroll the virtual table slowly to measure the rows above too, so they are at the same place in both tables*/
+    for(int32_t y = 0; y <= 1000; y += 50) {
+        lv_obj_scroll_to_y(table, y, LV_ANIM_OFF);
+    }
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_scroll_y(normal_table), lv_obj_get_scroll_y(table));
+
+    lv_draw_buf_t * normal_buf = lv_snapshot_take(normal_table, LV_COLOR_FORMAT_ARGB8888);
+    lv_draw_buf_t * virtual_buf = lv_snapshot_take(table, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(normal_buf);
+    TEST_ASSERT_NOT_NULL(virtual_buf);
+    TEST_ASSERT_EQUAL_UINT32(normal_buf->data_size, virtual_buf->data_size);
+    /*Compare only the pixels as the end of the lines can be uninitialized*/
+    for(uint32_t y = 0; y < normal_buf->header.h; y++) {
+        TEST_ASSERT_EQUAL_MEMORY(lv_draw_buf_goto_xy(normal_buf, 0, y), lv_draw_buf_goto_xy(virtual_buf, 0, y),
+                                 normal_buf->header.w * 4);
+    }
+    lv_draw_buf_destroy(normal_buf);
+    lv_draw_buf_destroy(virtual_buf);
+}
+
 #endif
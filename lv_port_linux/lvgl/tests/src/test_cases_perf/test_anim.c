@@ -0,0 +1,79 @@
+/* Performance test for the lv_anim registry with many animations */
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+
+#define ANIM_CNT 2000
+
+static int32_t vars[ANIM_CNT];
+
+static void exec_cb(void * var, int32_t v)
+{
+    *(int32_t *)var = v;
+}
+
+static void anims_start(void)
+{
+    uint32_t i;
+    for(i = 0; i < ANIM_CNT; i++) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, &vars[i]);
+        lv_anim_set_exec_cb(&a, exec_cb);
+        lv_anim_set_values(&a, 0, 100);
+        lv_anim_set_duration(&a, 1000 + i);
+        lv_anim_start(&a);
+    }
+}
+
+void setUp(void)
+{
+    anims_start();
+}
+
+void tearDown(void)
+{
+    lv_anim_delete_all();
+}
+
+static void anims_get(void)
+{
+    uint32_t i;
+    for(i = 0; i < ANIM_CNT; i++) {
+        lv_anim_get(&vars[i], exec_cb);
+    }
+}
+
+static void anims_delete_start(void)
+{
+    uint32_t i;
+    for(i = 0; i < ANIM_CNT; i++) {
+        lv_anim_delete(&vars[i], exec_cb);
+    }
+    anims_start();
+}
+
+static void anim_timer_run(uint32_t iterations)
+{
+    uint32_t i;
+    for(i = 0; i < iterations; i++) {
+        lv_tick_inc(1);
+        lv_anim_refr_now();
+    }
+}
+
+void test_anim_get(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(anims_get, 5, 10);
+}
+
+void test_anim_delete_start(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(anims_delete_start, 30, 10);
+    TEST_ASSERT_EQUAL_UINT32(ANIM_CNT, lv_anim_count_running());
+}
+
+void test_anim_timer_run(void)
+{
+    TEST_ASSERT_MAX_TIME(anim_timer_run, 50, 100);
+}
+#endif
@@ -0,0 +1,90 @@
+/* Performance test for rotating rendered areas by 90 and 270 degrees */
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "unity/unity.h"
+
+#define W 480
+#define H 272
+#define ITERATIONS 20
+
+static uint32_t src_buf[W * H];
+static uint32_t dst_buf[W * H];
+
+/*The column by column rotations which were used before the tiled ones*/
+static void rotate90_naive_rgb565(void)
+{
+    const uint16_t * src = (const uint16_t *)src_buf;
+    uint16_t * dst = (uint16_t *)dst_buf;
+    for(int32_t x = 0; x < W; ++x) {
+        int32_t dstIndex = (W - x - 1);
+        int32_t srcIndex = x;
+        for(int32_t y = 0; y < H; ++y) {
+            dst[dstIndex * H + y] = src[srcIndex];
+            srcIndex += W;
+        }
+    }
+}
+
+static void rotate90_naive_xrgb8888(void)
+{
+    for(int32_t x = 0; x < W; ++x) {
+        int32_t dstIndex = (W - x - 1);
+        int32_t srcIndex = x;
+        for(int32_t y = 0; y < H; ++y) {
+            dst_buf[dstIndex * H + y] = src_buf[srcIndex];
+            srcIndex += W;
+        }
+    }
+}
+
+static void rotate90_rgb565(void)
+{
+    lv_draw_sw_rotate(src_buf, dst_buf, W, H, W * 2, H * 2, LV_DISPLAY_ROTATION_90, LV_COLOR_FORMAT_RGB565);
+}
+
+static void rotate270_rgb565(void)
+{
+    lv_draw_sw_rotate(src_buf, dst_buf, W, H, W * 2, H * 2, LV_DISPLAY_ROTATION_270, LV_COLOR_FORMAT_RGB565);
+}
+
+static void rotate90_xrgb8888(void)
+{
+    lv_draw_sw_rotate(src_buf, dst_buf, W, H, W * 4, H * 4, LV_DISPLAY_ROTATION_90, LV_COLOR_FORMAT_XRGB8888);
+}
+
+static void rotate270_xrgb8888(void)
+{
+    lv_draw_sw_rotate(src_buf, dst_buf, W, H, W * 4, H * 4, LV_DISPLAY_ROTATION_270, LV_COLOR_FORMAT_XRGB8888);
+}
+
+static double time_ms(void (*fn)(void))
+{
+    clock_t t = clock();
+    for(uint32_t i = 0; i < ITERATIONS; i++) fn();
+    return ((double)(clock() - t) * 1000.) / CLOCKS_PER_SEC;
+}
+
+void setUp(void)
+{
+    for(uint32_t i = 0; i < W * H; i++) src_buf[i] = i * 2654435761u;
+}
+
+void tearDown(void)
+{
+}
+
+void test_rotate_rgb565(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(rotate90_rgb565, 100, ITERATIONS);
+    TEST_ASSERT_MAX_TIME_ITER(rotate270_rgb565, 100, ITERATIONS);
+    TEST_PRINTF("RGB565 90 deg: naive %.2f ms, tiled %.2f ms", time_ms(rotate90_naive_rgb565), time_ms(rotate90_rgb565));
+}
+
+void test_rotate_xrgb8888(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(rotate90_xrgb8888, 150, ITERATIONS);
+    TEST_ASSERT_MAX_TIME_ITER(rotate270_xrgb8888, 150, ITERATIONS);
+    TEST_PRINTF("XRGB8888 90 deg: naive %.2f ms, tiled %.2f ms", time_ms(rotate90_naive_xrgb8888),
+                time_ms(rotate90_xrgb8888));
+}
+#endif
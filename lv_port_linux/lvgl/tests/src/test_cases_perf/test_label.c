@@ -17,4 +17,47 @@ void test_label(void)
                          "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Ut auctor sed dui interdum convallis. Proin in ante magna. Pellentesque placerat condimentum erat ac laoreet. Cras mi eros, convallis vitae massa ac, blandit sodales urna. Proin tincidunt fermentum leo a volutpat. Donec ut blandit tortor. Duis elementum nibh nec consequat sagittis. Lutrae sunt praeclarae");
 
 }
+
+static void fill_log(uint32_t line_cnt)
+{
+    lv_obj_set_width(label, 400);
+    lv_obj_update_layout(label);
+    lv_label_set_text(label, "");
+    char buf[64];
+    for(uint32_t i = 0; i < line_cnt; i++) {
+        lv_snprintf(buf, sizeof(buf), "[%05" LV_PRIu32 "] Lorem ipsum dolor sit amet, consectetur\n", i);
+        lv_label_append_text(label, buf);
+    }
+}
+
+static void append_lines(uint32_t line_cnt)
+{
+    for(uint32_t i = 0; i < line_cnt; i++) {
+        lv_label_append_text(label, "Lorem ipsum dolor sit amet, consectetur adipiscing elit\n");
+    }
+}
+
+static void type_text(uint32_t char_cnt)
+{
+    for(uint32_t i = 0; i < char_cnt; i++) {
+        lv_label_ins_text(label, 100, "a");
+    }
+    lv_label_cut_text(label, 100, char_cnt);
+}
+
+void test_label_append_long_text(void)
+{
+    /*~100 kB text. Only the last paragraph is measured for each line*/
+    TEST_ASSERT_MAX_TIME(fill_log, 500, 2000);
+    TEST_ASSERT_MAX_TIME(append_lines, 50, 100);
+
+    lv_label_set_append_limit(label, 50000);
+    TEST_ASSERT_MAX_TIME(append_lines, 100, 1000);
+}
+
+void test_label_edit_long_text(void)
+{
+    fill_log(2000);
+    TEST_ASSERT_MAX_TIME(type_text, 100, 100);
+}
 #endif
@@ -0,0 +1,52 @@
+/* Performance test for scrolling recyclers with a lot of items */
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+
+#define ITEM_CNT 100000
+
+static lv_obj_t * recycler;
+
+static lv_obj_t * item_create_cb(lv_obj_t * obj)
+{
+    lv_obj_t * item = lv_label_create(obj);
+    lv_obj_set_width(item, lv_pct(100));
+    return item;
+}
+
+static void item_bind_cb(lv_obj_t * obj, lv_obj_t * item, uint32_t index)
+{
+    LV_UNUSED(obj);
+    if(index % 3 == 2) lv_label_set_text_fmt(item, "Item %" LV_PRIu32 "\nwith a second line", index);
+    else lv_label_set_text_fmt(item, "Item %" LV_PRIu32, index);
+}
+
+void setUp(void)
+{
+    recycler = lv_recycler_create(lv_screen_active());
+    lv_obj_set_size(recycler, 400, 300);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void scroll_and_draw(uint32_t step_cnt)
+{
+    uint32_t i;
+    for(i = 0; i < step_cnt; i++) {
+        lv_obj_scroll_by(recycler, 0, -(int32_t)(ITEM_CNT * 7 / step_cnt), LV_ANIM_OFF);
+        lv_refr_now(NULL);
+    }
+}
+
+void test_recycler_scroll(void)
+{
+    lv_recycler_set_item_cb(recycler, item_create_cb, item_bind_cb);
+    lv_recycler_set_item_count(recycler, ITEM_CNT);
+    lv_obj_update_layout(recycler);
+
+    /*Only the visible items are bound, measured and drawn*/
+    TEST_ASSERT_MAX_TIME(scroll_and_draw, 500, 50);
+}
+#endif
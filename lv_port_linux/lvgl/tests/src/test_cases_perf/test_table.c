@@ -0,0 +1,47 @@
+/* Performance test for scrolling tables with a lot of rows */
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+
+#define ROW_CNT 100000
+
+static lv_obj_t * table;
+
+static const char * cell_value_cb(lv_obj_t * obj, uint32_t row, uint32_t col)
+{
+    LV_UNUSED(obj);
+    static char buf[32];
+    lv_snprintf(buf, sizeof(buf), "Item %" LV_PRIu32 "/%" LV_PRIu32, row, col);
+    return buf;
+}
+
+void setUp(void)
+{
+    table = lv_table_create(lv_screen_active());
+    lv_obj_set_size(table, 400, 300);
+    lv_table_set_column_count(table, 4);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void scroll_and_draw(uint32_t step_cnt)
+{
+    uint32_t i;
+    for(i = 0; i < step_cnt; i++) {
+        lv_obj_scroll_by(table, 0, -(int32_t)(ROW_CNT * 7 / step_cnt), LV_ANIM_OFF);
+        lv_refr_now(NULL);
+    }
+}
+
+void test_table_virtual_scroll(void)
+{
+    lv_table_set_row_count(table, ROW_CNT);
+    lv_table_set_cell_value_cb(table, cell_value_cb);
+    lv_obj_update_layout(table);
+
+    /*Only the visible rows are measured and drawn*/
+    TEST_ASSERT_MAX_TIME(scroll_and_draw, 250, 50);
+}
+#endif
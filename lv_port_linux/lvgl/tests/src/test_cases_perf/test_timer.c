@@ -0,0 +1,96 @@
+/* Performance test for the lv_timer scheduler with many timers */
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+
+#define TIMER_CNT 2000
+
+static lv_timer_t * timers[TIMER_CNT];
+static uint32_t run_cnt;
+
+static void timer_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+    run_cnt++;
+}
+
+void setUp(void)
+{
+    run_cnt = 0;
+
+    uint32_t i;
+    for(i = 0; i < TIMER_CNT; i++) {
+        timers[i] = lv_timer_create(timer_cb, 100 + (i * 7) % 5000, NULL);
+    }
+}
+
+void tearDown(void)
+{
+    uint32_t i;
+    for(i = 0; i < TIMER_CNT; i++) {
+        lv_timer_delete(timers[i]);
+    }
+}
+
+static void handler_idle(uint32_t iterations)
+{
+    uint32_t i;
+    for(i = 0; i < iterations; i++) {
+        lv_timer_handler();
+    }
+}
+
+static void handler_run(uint32_t iterations)
+{
+    uint32_t i;
+    for(i = 0; i < iterations; i++) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+    }
+}
+
+static void timers_reset(void)
+{
+    uint32_t i;
+    for(i = 0; i < TIMER_CNT; i++) {
+        lv_timer_reset(timers[i]);
+    }
+}
+
+static void timers_recreate(void)
+{
+    uint32_t i;
+    for(i = 0; i < TIMER_CNT; i += 2) {
+        lv_timer_delete(timers[i]);
+        timers[i] = lv_timer_create(timer_cb, 100 + (i * 13) % 5000, NULL);
+    }
+}
+
+void test_timer_handler_idle(void)
+{
+    /*No timer is due, only the first one should be checked*/
+    TEST_ASSERT_MAX_TIME(handler_idle, 5, 10000);
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt);
+}
+
+void test_timer_handler_run(void)
+{
+    TEST_ASSERT_MAX_TIME(handler_run, 50, 5000);
+    TEST_ASSERT_NOT_EQUAL_UINT32(0, run_cnt);
+}
+
+void test_timer_reset(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(timers_reset, 20, 10);
+}
+
+void test_timer_create_delete(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(timers_recreate, 20, 10);
+}
+
+void test_timer_time_until_next(void)
+{
+    lv_timer_handler();
+    TEST_ASSERT_MAX_TIME_ITER(lv_timer_get_time_until_next, 1, 100000);
+}
+#endif
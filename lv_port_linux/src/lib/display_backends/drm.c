@@ -25,6 +25,7 @@
 #include "../simulator_util.h"
 #include "../simulator_settings.h"
 #include "../backends.h"
+#include "../event_loop.h"
 
 /*********************
  *      DEFINES
@@ -45,6 +46,7 @@ static lv_display_t *init_drm(void);
  *  STATIC VARIABLES
  **********************/
 static char *backend_name = "DRM";
+static lv_display_t *drm_disp;
 
 /**********************
  *      MACROS
@@ -94,6 +96,7 @@ static lv_display_t *init_drm(void)
     }
 
     lv_linux_drm_set_file(disp, device, -1);
+    drm_disp = disp;
 
     return disp;
 }
@@ -106,6 +109,21 @@ static void run_loop_drm(void)
 {
     uint32_t idle_time;
 
+    /* Sleep until a timer or an input device needs LVGL */
+    if (event_loop_init() == 0) {
+
+        /* Optionally refresh the display only on vblank, or just in time before the next one */
+        if (atoi(getenv_default("LV_LINUX_DRM_VBLANK", "0"))) {
+            event_loop_set_drm_vblank(drm_disp);
+        }
+        else if (atoi(getenv_default("LV_LINUX_DRM_FRAME_PACING", "0"))) {
+            lv_display_set_frame_pacing(drm_disp, true);
+        }
+
+        event_loop_run();
+        return;
+    }
+
     /* Handle LVGL tasks */
     while (true) {
         /* Returns the time to the next timer execution */
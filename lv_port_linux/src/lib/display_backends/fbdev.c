@@ -23,6 +23,7 @@
 #if LV_USE_LINUX_FBDEV
 #include "../simulator_util.h"
 #include "../backends.h"
+#include "../event_loop.h"
 
 /*********************
  *      DEFINES
@@ -94,6 +95,12 @@ static lv_display_t *init_fbdev(void)
 
     lv_linux_fbdev_set_file(disp, device);
 
+    /* Optionally copy the frames on vblank and pace the refresh to it */
+    if (atoi(getenv_default("LV_LINUX_FBDEV_VSYNC", "0"))) {
+        lv_linux_fbdev_set_wait_for_vsync(disp, true);
+        lv_display_set_frame_pacing(disp, true);
+    }
+
     return disp;
 }
 
@@ -104,6 +111,12 @@ static void run_loop_fbdev(void)
 {
     uint32_t idle_time;
 
+    /* Sleep until a timer or an input device needs LVGL */
+    if (event_loop_init() == 0) {
+        event_loop_run();
+        return;
+    }
+
     /* Handle LVGL tasks */
     while (true) {
 
@@ -0,0 +1,497 @@
+/**
+ * @file event_loop.c
+ *
+ * Event driven main loop for Linux
+ *
+ * Instead of polling the timer handler at a fixed rate the loop blocks
+ * on epoll until
+ * - the timerfd armed with the time until the next LVGL timer expires
+ * - the eventfd is written because a timer was created or resumed
+ * - an input device has new events
+ * - a requested DRM vblank event arrives
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+
+#include "lvgl/lvgl.h"
+#include "event_loop.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define MAX_EVENTS 8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/* A watched file descriptor */
+typedef struct {
+    int fd;
+    event_loop_fd_cb_t cb;
+    void *user_data;
+} watcher_t;
+
+/* The DRM display refreshed on vblank */
+typedef struct {
+    lv_display_t *disp;
+    bool refr_requested;  /* Something was invalidated, the display waits for a vblank */
+    bool vblank_pending;  /* A vblank event was requested and not received yet */
+    bool vblank_ready;    /* The vblank arrived, the display can be refreshed */
+} vblank_ctx_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void timer_fd_cb(int fd, uint32_t events, void *user_data);
+static void wakeup_fd_cb(int fd, uint32_t events, void *user_data);
+static void timer_resume_cb(void *data);
+static void timer_fd_arm(uint32_t idle_time);
+static void indev_fd_cb(int fd, uint32_t events, void *user_data);
+static void indev_delete_cb(lv_event_t *e);
+#if LV_USE_LINUX_DRM
+static void drm_fd_cb(int fd, uint32_t events, void *user_data);
+static void drm_vblank_cb(lv_display_t *disp);
+static void drm_refr_request_cb(lv_event_t *e);
+static void drm_vblank_request(void);
+static void drm_refr_hold(void);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static int epoll_fd = -1;
+static int timer_fd = -1;
+static int wakeup_fd = -1;
+static watcher_t watchers[EVENT_LOOP_MAX_FDS];
+static vblank_ctx_t vblank;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int event_loop_init(void)
+{
+    int i;
+
+    /* Already initialized */
+    if (epoll_fd >= 0) {
+        return 0;
+    }
+
+    for (i = 0; i < EVENT_LOOP_MAX_FDS; i++) {
+        watchers[i].fd = -1;
+    }
+
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd < 0) {
+        LV_LOG_ERROR("epoll_create1 failed: %s", strerror(errno));
+        return -1;
+    }
+
+    timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (timer_fd < 0) {
+        LV_LOG_ERROR("timerfd_create failed: %s", strerror(errno));
+        goto err_out;
+    }
+
+    wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeup_fd < 0) {
+        LV_LOG_ERROR("eventfd failed: %s", strerror(errno));
+        goto err_out;
+    }
+
+    if (event_loop_add_fd(timer_fd, EPOLLIN, timer_fd_cb, NULL) < 0 ||
+        event_loop_add_fd(wakeup_fd, EPOLLIN, wakeup_fd_cb, NULL) < 0) {
+        goto err_out;
+    }
+
+    lv_timer_handler_set_resume_cb(timer_resume_cb, NULL);
+
+    return 0;
+
+err_out:
+    event_loop_deinit();
+    return -1;
+}
+
+void event_loop_deinit(void)
+{
+    int i;
+
+    lv_timer_handler_set_resume_cb(NULL, NULL);
+
+    for (i = 0; i < EVENT_LOOP_MAX_FDS; i++) {
+        watchers[i].fd = -1;
+    }
+
+    if (timer_fd >= 0) {
+        close(timer_fd);
+        timer_fd = -1;
+    }
+
+    if (wakeup_fd >= 0) {
+        close(wakeup_fd);
+        wakeup_fd = -1;
+    }
+
+    if (epoll_fd >= 0) {
+        close(epoll_fd);
+        epoll_fd = -1;
+    }
+}
+
+int event_loop_add_fd(int fd, uint32_t events, event_loop_fd_cb_t cb, void *user_data)
+{
+    int i;
+    watcher_t *watcher = NULL;
+    struct epoll_event ev;
+
+    LV_ASSERT_NULL(cb);
+
+    if (epoll_fd < 0 && event_loop_init() < 0) {
+        return -1;
+    }
+
+    for (i = 0; i < EVENT_LOOP_MAX_FDS; i++) {
+        if (watchers[i].fd < 0) {
+            watcher = &watchers[i];
+            break;
+        }
+    }
+
+    if (watcher == NULL) {
+        LV_LOG_ERROR("can't watch more than %d file descriptors", EVENT_LOOP_MAX_FDS);
+        return -1;
+    }
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events = events;
+    ev.data.ptr = watcher;
+
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        LV_LOG_ERROR("epoll_ctl failed: %s", strerror(errno));
+        return -1;
+    }
+
+    watcher->fd = fd;
+    watcher->cb = cb;
+    watcher->user_data = user_data;
+
+    return 0;
+}
+
+void event_loop_remove_fd(int fd)
+{
+    int i;
+
+    for (i = 0; i < EVENT_LOOP_MAX_FDS; i++) {
+        if (watchers[i].fd == fd) {
+            /* It fails if the file descriptor was already closed, that's fine */
+            epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+            watchers[i].fd = -1;
+            return;
+        }
+    }
+}
+
+int event_loop_add_indev(lv_indev_t *indev, int fd)
+{
+    LV_ASSERT_NULL(indev);
+
+    if (event_loop_add_fd(fd, EPOLLIN, indev_fd_cb, indev) < 0) {
+        return -1;
+    }
+
+    lv_indev_set_mode(indev, LV_INDEV_MODE_EVENT);
+    lv_indev_add_event_cb(indev, indev_delete_cb, LV_EVENT_DELETE, (void *)(intptr_t)fd);
+
+    return 0;
+}
+
+int event_loop_set_drm_vblank(lv_display_t *disp)
+{
+#if LV_USE_LINUX_DRM
+    int fd = lv_linux_drm_get_fd(disp);
+
+    if (fd < 0 || lv_display_get_refr_timer(disp) == NULL) {
+        LV_LOG_ERROR("the display can't be refreshed on vblank");
+        return -1;
+    }
+
+    if (event_loop_add_fd(fd, EPOLLIN, drm_fd_cb, disp) < 0) {
+        return -1;
+    }
+
+    vblank.disp = disp;
+    vblank.refr_requested = false;
+    vblank.vblank_pending = false;
+    vblank.vblank_ready = false;
+
+    /* Also called when the driver handles the vblank while waiting for a page flip */
+    lv_linux_drm_set_vblank_cb(disp, drm_vblank_cb);
+
+    /* Called after the display resumed its refresh timer */
+    lv_display_add_event_cb(disp, drm_refr_request_cb, LV_EVENT_REFR_REQUEST, NULL);
+
+    return 0;
+#else
+    LV_UNUSED(disp);
+    LV_LOG_ERROR("DRM is not enabled");
+    return -1;
+#endif
+}
+
+void event_loop_wakeup(void)
+{
+    uint64_t val = 1;
+
+    if (wakeup_fd < 0) {
+        return;
+    }
+
+    /* Fails only if the counter would overflow, i.e. a wakeup is already pending */
+    if (write(wakeup_fd, &val, sizeof(val)) < 0) {
+        LV_LOG_TRACE("eventfd write failed: %s", strerror(errno));
+    }
+}
+
+void event_loop_run(void)
+{
+    int i;
+    int n;
+    uint32_t idle_time;
+    struct epoll_event events[MAX_EVENTS];
+
+    while (true) {
+
+        /* Returns the time to the next timer execution */
+        idle_time = lv_timer_handler();
+
+#if LV_USE_LINUX_DRM
+        if (vblank.disp) {
+            vblank.vblank_ready = false;
+            drm_refr_hold();
+            drm_vblank_request();
+        }
+#endif
+
+        timer_fd_arm(idle_time);
+
+        n = epoll_wait(epoll_fd, events, MAX_EVENTS, -1);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            LV_LOG_ERROR("epoll_wait failed: %s", strerror(errno));
+            return;
+        }
+
+        for (i = 0; i < n; i++) {
+            watcher_t *watcher = events[i].data.ptr;
+
+            /* Might be removed by an earlier callback */
+            if (watcher->fd < 0) {
+                continue;
+            }
+
+            watcher->cb(watcher->fd, events[i].events, watcher->user_data);
+        }
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Consume the expiration of the timer
+ */
+static void timer_fd_cb(int fd, uint32_t events, void *user_data)
+{
+    uint64_t expirations;
+
+    LV_UNUSED(events);
+    LV_UNUSED(user_data);
+
+    if (read(fd, &expirations, sizeof(expirations)) < 0 && errno != EAGAIN) {
+        LV_LOG_WARN("timerfd read failed: %s", strerror(errno));
+    }
+}
+
+/**
+ * Consume the wakeup requests
+ */
+static void wakeup_fd_cb(int fd, uint32_t events, void *user_data)
+{
+    uint64_t cnt;
+
+    LV_UNUSED(events);
+    LV_UNUSED(user_data);
+
+    if (read(fd, &cnt, sizeof(cnt)) < 0 && errno != EAGAIN) {
+        LV_LOG_WARN("eventfd read failed: %s", strerror(errno));
+    }
+}
+
+/**
+ * Called by LVGL when a timer is created, resumed or reset
+ */
+static void timer_resume_cb(void *data)
+{
+    LV_UNUSED(data);
+    event_loop_wakeup();
+}
+
+/**
+ * Arm the timerfd to expire when the next LVGL timer should run
+ *
+ * @param idle_time the time until the next timer in milliseconds
+ */
+static void timer_fd_arm(uint32_t idle_time)
+{
+    struct itimerspec spec;
+
+    memset(&spec, 0, sizeof(spec));
+
+    if (idle_time != LV_NO_TIMER_READY) {
+        spec.it_value.tv_sec = idle_time / 1000;
+        spec.it_value.tv_nsec = (long)(idle_time % 1000) * 1000000L;
+
+        /* A zero value would disarm the timer */
+        if (idle_time == 0) {
+            spec.it_value.tv_nsec = 1;
+        }
+    }
+
+    if (timerfd_settime(timer_fd, 0, &spec, NULL) < 0) {
+        LV_LOG_ERROR("timerfd_settime failed: %s", strerror(errno));
+    }
+}
+
+/**
+ * Read the input device with the new events
+ */
+static void indev_fd_cb(int fd, uint32_t events, void *user_data)
+{
+    lv_indev_t *indev = user_data;
+
+    LV_UNUSED(fd);
+
+    if (events & (EPOLLERR | EPOLLHUP)) {
+        event_loop_remove_fd(fd);
+        return;
+    }
+
+    lv_indev_read(indev);
+}
+
+/**
+ * Stop watching the input device when it's deleted
+ */
+static void indev_delete_cb(lv_event_t *e)
+{
+    int fd = (int)(intptr_t)lv_event_get_user_data(e);
+    event_loop_remove_fd(fd);
+}
+
+#if LV_USE_LINUX_DRM
+
+/**
+ * Dispatch the DRM events with the driver's event context,
+ * so the page flips the driver waits for are not lost
+ */
+static void drm_fd_cb(int fd, uint32_t events, void *user_data)
+{
+    LV_UNUSED(fd);
+    LV_UNUSED(events);
+
+    lv_linux_drm_handle_events(user_data);
+}
+
+/**
+ * Let the refresh timer of the display run in the next timer handler call
+ */
+static void drm_vblank_cb(lv_display_t *disp)
+{
+    lv_timer_t *refr_timer = lv_display_get_refr_timer(disp);
+
+    vblank.refr_requested = false;
+    vblank.vblank_pending = false;
+    vblank.vblank_ready = true;
+
+    if (refr_timer) {
+        lv_timer_resume(refr_timer);
+        lv_timer_ready(refr_timer);
+    }
+}
+
+/**
+ * Hold back the refresh timer until the next vblank
+ */
+static void drm_refr_request_cb(lv_event_t *e)
+{
+    LV_UNUSED(e);
+
+    /* The display is about to be refreshed anyway */
+    if (vblank.vblank_ready) {
+        return;
+    }
+
+    drm_refr_hold();
+}
+
+/**
+ * Pause the refresh timer of the display if it's running
+ * and remember that it needs to be refreshed on the next vblank
+ */
+static void drm_refr_hold(void)
+{
+    lv_timer_t *refr_timer = lv_display_get_refr_timer(vblank.disp);
+
+    if (refr_timer == NULL || lv_timer_get_paused(refr_timer)) {
+        return;
+    }
+
+    lv_timer_pause(refr_timer);
+    vblank.refr_requested = true;
+}
+
+/**
+ * Request a vblank event if the display has something to refresh
+ */
+static void drm_vblank_request(void)
+{
+    if (vblank.vblank_pending || vblank.refr_requested == false) {
+        return;
+    }
+
+    if (lv_linux_drm_request_vblank(vblank.disp) != LV_RESULT_OK) {
+        LV_LOG_WARN("refreshing without vblank");
+        vblank.refr_requested = false;
+        lv_timer_resume(lv_display_get_refr_timer(vblank.disp));
+        return;
+    }
+
+    vblank.vblank_pending = true;
+}
+
+#endif /*LV_USE_LINUX_DRM*/
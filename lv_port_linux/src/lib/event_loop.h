@@ -0,0 +1,115 @@
+/**
+ * @file event_loop.h
+ *
+ * Event driven main loop for Linux based on epoll
+ *
+ */
+#ifndef EVENT_LOOP_H
+#define EVENT_LOOP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include <stdint.h>
+#include "lvgl/lvgl.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* Maximum number of file descriptors that can be watched */
+#define EVENT_LOOP_MAX_FDS 16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/* Prototype of the callbacks called when a watched file descriptor is ready */
+typedef void (*event_loop_fd_cb_t)(int fd, uint32_t events, void *user_data);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create the epoll instance, the timerfd and the eventfd of the loop
+ *
+ * @description Calling it again has no effect.
+ * The loop registers itself as the resume callback
+ * of the LVGL timer handler, so creating or resuming an LVGL timer
+ * (e.g. with lv_async_call) from any thread wakes the loop up
+ * @return 0 on success -1 on failure
+ */
+int event_loop_init(void);
+
+/**
+ * Close all the file descriptors of the loop
+ */
+void event_loop_deinit(void);
+
+/**
+ * Watch a file descriptor
+ *
+ * @param fd the file descriptor
+ * @param events the epoll events to wait for (e.g. EPOLLIN)
+ * @param cb the callback to call when the file descriptor is ready
+ * @param user_data passed to the callback
+ * @return 0 on success -1 on failure
+ */
+int event_loop_add_fd(int fd, uint32_t events, event_loop_fd_cb_t cb, void *user_data);
+
+/**
+ * Stop watching a file descriptor
+ *
+ * @param fd the file descriptor
+ */
+void event_loop_remove_fd(int fd);
+
+/**
+ * Read an input device only when its file descriptor has new events
+ *
+ * @description The input device is switched to LV_INDEV_MODE_EVENT,
+ * LVGL still polls it while it's pressed to detect long presses.
+ * The file descriptor is removed when the input device is deleted.
+ * @param indev the input device
+ * @param fd the file descriptor of the device (e.g. lv_evdev_get_fd())
+ * @return 0 on success -1 on failure
+ */
+int event_loop_add_indev(lv_indev_t *indev, int fd);
+
+/**
+ * Refresh a DRM display on the vertical blanking interval
+ *
+ * @description Instead of running its refresh timer periodically
+ * the display is refreshed only after a vblank event which is
+ * requested only when something was invalidated
+ * @param disp the DRM display
+ * @return 0 on success -1 on failure
+ */
+int event_loop_set_drm_vblank(lv_display_t *disp);
+
+/**
+ * Wake up the loop, can be called from any thread
+ */
+void event_loop_wakeup(void);
+
+/**
+ * Run the LVGL timer handler and sleep until the next timer
+ * or a watched file descriptor is ready, never returns
+ */
+void event_loop_run(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*EVENT_LOOP_H*/
@@ -25,6 +25,7 @@
 #if LV_USE_EVDEV
 #include "lvgl/src/core/lv_global.h"
 #include "../backends.h"
+#include "../event_loop.h"
 
 /*********************
  *      DEFINES
@@ -114,6 +115,9 @@ static void discovery_cb(lv_indev_t *indev, lv_evdev_type_t type, void *user_dat
     lv_display_t *disp = user_data;
     lv_indev_set_display(indev, disp);
 
+    /* Read the device only when it has new events */
+    event_loop_add_indev(indev, lv_evdev_get_fd(indev));
+
     if(type == LV_EVDEV_TYPE_REL) {
         set_mouse_cursor_icon(indev, disp);
     }
@@ -134,6 +138,13 @@ static void set_mouse_cursor_icon(lv_indev_t *indev, lv_display_t *display)
     lv_image_set_src(cursor_obj, &mouse_cursor_icon);
     lv_indev_set_cursor(indev, cursor_obj);
 
+#if LV_USE_LINUX_DRM
+    /* Move the cursor on a hardware plane if the display is a DRM display which has one */
+    if (lv_linux_drm_set_cursor(display, indev) == LV_RESULT_OK) {
+        LV_LOG_USER("using the DRM cursor plane");
+    }
+#endif
+
     /* delete the mouse cursor icon if the device is removed */
     lv_indev_add_event_cb(indev, indev_deleted_cb, LV_EVENT_DELETE, cursor_obj);
 
@@ -169,6 +180,7 @@ static lv_indev_t *init_pointer_evdev(lv_display_t *display)
     }
 
     lv_indev_set_display(indev, display);
+    event_loop_add_indev(indev, lv_evdev_get_fd(indev));
 
     set_mouse_cursor_icon(indev, display);
     return indev;
@@ -29,6 +29,7 @@
 #include "src/lib/driver_backends.h"
 #include "src/lib/simulator_util.h"
 #include "src/lib/simulator_settings.h"
+#include "src/lib/event_loop.h"
 
 
 #include "mpu6050.h"
@@ -132,6 +133,10 @@ static void input_config(void){
     //     die("Failed to initialize evdev");
     // }
     lv_indev_t * indev = lv_evdev_create(LV_INDEV_TYPE_POINTER, "/dev/input/event4");
+    if (indev) {
+        /* Read the touchscreen only when it has new events */
+        event_loop_add_indev(indev, lv_evdev_get_fd(indev));
+    }
 #endif
 
     // === 添加 SDL 输入设备初始化（替代 EVDEV�?===
@@ -190,6 +195,10 @@ int main(int argc, char **argv)
     /* Initialize LVGL. */
     lv_init();
 
+    /* Sleep until a timer, an input device or another thread needs LVGL */
+    if (event_loop_init() == -1) {
+        die("Failed to initialize the event loop");
+    }
 
     /* Initialize the configured backend */
     if (driver_backends_init_backend(selected_backend) == -1) {
@@ -206,9 +215,9 @@ int main(int argc, char **argv)
     // setup_mpu6050_and_ui();
     
     setup_mpu6050_chart_refresh();
-	while(1){
-        lv_timer_handler();
-        usleep(1000);
-    }
+
+    /* Run the loop of the backend, e.g. DRM can refresh on vblank in the event loop */
+    driver_backends_run_loop();
+
     return 0;
 }